@@ -34,5 +34,6 @@
 #include "zenoh-pico/api/primitives.h"
 #include "zenoh-pico/api/types.h"
 #include "zenoh-pico/config.h"
+#include "zenoh-pico/system/common/allocator.h"
 
 #endif /* ZENOH_PICO_H */
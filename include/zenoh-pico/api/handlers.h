@@ -20,6 +20,7 @@
 #include "zenoh-pico/api/types.h"
 #include "zenoh-pico/collections/element.h"
 #include "zenoh-pico/collections/fifo_mt.h"
+#include "zenoh-pico/collections/freelist.h"
 #include "zenoh-pico/collections/ring_mt.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/result.h"
@@ -28,27 +29,38 @@
 extern "C" {
 #endif
 // -- Channel
+// Element boxes come from a lock-free free list and elements go through the lock-free queue of the collection, so
+// sending and receiving only take a lock to park or wake a waiting thread.
+
+// Boxes pulled at once by a batch receive before they are released together
+#define _Z_CHANNEL_BATCH_CHUNK 32
+
+static inline void _z_channel_box_move(void *dst, void *src) { *(void **)dst = src; }
+
 #define _Z_CHANNEL_DEFINE_IMPL(handler_type, handler_name, handler_new_f_name, callback_type, callback_new_f,        \
                                collection_type, collection_new_f, collection_clear_f, collection_push_f,             \
-                               collection_pull_f, collection_try_pull_f, collection_close_f, elem_owned_type,        \
-                               elem_loaned_type, elem_take_f, elem_move_f, elem_drop_f, elem_null_f)                 \
+                               collection_pull_f, collection_try_pull_f, collection_pull_batch_f,                    \
+                               collection_try_pull_batch_f, collection_close_f, elem_owned_type, elem_loaned_type,   \
+                               elem_take_f, elem_move_f, elem_drop_f, elem_null_f)                                   \
     typedef struct {                                                                                                 \
         collection_type collection;                                                                                  \
+        _z_freelist_t elems;                                                                                         \
     } handler_type;                                                                                                  \
                                                                                                                      \
     static inline void _z_##handler_name##_elem_free(void **elem) {                                                  \
         elem_drop_f(elem_move_f((elem_owned_type *)*elem));                                                          \
-        z_free(*elem);                                                                                               \
+        _z_freelist_release(*elem);                                                                                  \
         *elem = NULL;                                                                                                \
     }                                                                                                                \
     static inline void _z_##handler_name##_elem_move(void *dst, void *src) {                                         \
         memcpy(dst, src, sizeof(elem_owned_type));                                                                   \
-        z_free(src);                                                                                                 \
+        _z_freelist_release(src);                                                                                    \
     }                                                                                                                \
                                                                                                                      \
     static inline void _z_##handler_name##_clear(handler_type *handler) {                                            \
         if (handler != NULL) {                                                                                       \
             collection_clear_f(&handler->collection, _z_##handler_name##_elem_free);                                 \
+            _z_freelist_clear(&handler->elems);                                                                      \
         }                                                                                                            \
     }                                                                                                                \
     _Z_REFCOUNT_DEFINE(_z_##handler_name, _z_##handler_name)                                                         \
@@ -68,7 +80,8 @@ extern "C" {
     static inline void _z_##handler_name##_send(elem_loaned_type *elem, void *context) {                             \
         _z_##handler_name##_rc_t *handler = (_z_##handler_name##_rc_t *)context;                                     \
         if (_z_rc_strong_count(handler->_cnt) > 1) {                                                                 \
-            elem_owned_type *internal_elem = (elem_owned_type *)z_malloc(sizeof(elem_owned_type));                   \
+            elem_owned_type *internal_elem =                                                                         \
+                (elem_owned_type *)_z_freelist_get(&_Z_RC_IN_VAL(handler)->elems);                                   \
             if (internal_elem == NULL) {                                                                             \
                 _Z_ERROR("Out of memory");                                                                           \
                 return;                                                                                              \
@@ -89,6 +102,12 @@ extern "C" {
         }                                                                                                            \
         _z_##handler_name##_t h;                                                                                     \
         _Z_RETURN_IF_ERR(collection_new_f(&h.collection, capacity));                                                 \
+        /* Element boxes are recycled, keeping at most as many as the channel holds */                               \
+        z_result_t ret = _z_freelist_init(&h.elems, sizeof(elem_owned_type), capacity);                              \
+        if (ret != _Z_RES_OK) {                                                                                      \
+            collection_clear_f(&h.collection, _z_##handler_name##_elem_free);                                        \
+            _Z_ERROR_RETURN(ret);                                                                                    \
+        }                                                                                                            \
         handler->_rc = _z_##handler_name##_rc_new_from_val(&h);                                                      \
         if (_Z_RC_IS_NULL(&handler->_rc)) {                                                                          \
             _z_##handler_name##_clear(&h);                                                                           \
@@ -131,6 +150,62 @@ extern "C" {
             return ret;                                                                                              \
         }                                                                                                            \
         return _Z_RES_OK;                                                                                            \
+    }                                                                                                                \
+    /* Boxes are pulled by chunks, their elements copied out and the chunk released to the free list at once */    \
+    static inline z_result_t _z_##handler_name##_pull_batch(const z_loaned_##handler_name##_t *handler,              \
+                                                            elem_owned_type *elems, size_t max, size_t *count,       \
+                                                            bool block) {                                            \
+        collection_type *collection = (collection_type *)(&_Z_RC_IN_VAL(handler)->collection);                       \
+        void *boxes[_Z_CHANNEL_BATCH_CHUNK];                                                                         \
+        z_result_t ret = _Z_RES_OK;                                                                                  \
+        *count = 0;                                                                                                  \
+        while (*count < max) {                                                                                       \
+            size_t chunk = (max - *count < _Z_CHANNEL_BATCH_CHUNK) ? max - *count : _Z_CHANNEL_BATCH_CHUNK;          \
+            size_t n = 0;                                                                                            \
+            if (block && (*count == 0)) {                                                                            \
+                ret = collection_pull_batch_f(boxes, sizeof(void *), chunk, &n, collection, _z_channel_box_move);    \
+            } else {                                                                                                 \
+                ret = collection_try_pull_batch_f(boxes, sizeof(void *), chunk, &n, collection,                      \
+                                                  _z_channel_box_move);                                              \
+            }                                                                                                        \
+            for (size_t i = 0; i < n; i++) {                                                                         \
+                memcpy(&elems[*count + i], boxes[i], sizeof(elem_owned_type));                                       \
+            }                                                                                                        \
+            _z_freelist_release_n(boxes, n);                                                                         \
+            *count += n;                                                                                             \
+            if ((ret != _Z_RES_OK) || (n < chunk)) {                                                                 \
+                break;                                                                                               \
+            }                                                                                                        \
+        }                                                                                                            \
+        /* Running out of elements after the first chunk is not an error */                                         \
+        return (*count > 0) ? _Z_RES_OK : ret;                                                                       \
+    }                                                                                                                \
+    static inline z_result_t z_##handler_name##_recv_batch(const z_loaned_##handler_name##_t *handler,               \
+                                                           elem_owned_type *elems, size_t max, size_t *count) {      \
+        z_result_t ret = _z_##handler_name##_pull_batch(handler, elems, max, count, true);                           \
+        if (ret == _Z_RES_CHANNEL_CLOSED) {                                                                          \
+            return Z_CHANNEL_DISCONNECTED;                                                                           \
+        }                                                                                                            \
+        if (ret != _Z_RES_OK) {                                                                                      \
+            _Z_ERROR("%s failed: %i", #collection_pull_batch_f, ret);                                                \
+            return ret;                                                                                              \
+        }                                                                                                            \
+        return _Z_RES_OK;                                                                                            \
+    }                                                                                                                \
+    static inline z_result_t z_##handler_name##_try_recv_batch(const z_loaned_##handler_name##_t *handler,           \
+                                                               elem_owned_type *elems, size_t max,                   \
+                                                               size_t *count) {                                      \
+        z_result_t ret = _z_##handler_name##_pull_batch(handler, elems, max, count, false);                          \
+        if (ret == _Z_RES_CHANNEL_CLOSED) {                                                                          \
+            return Z_CHANNEL_DISCONNECTED;                                                                           \
+        } else if (ret == _Z_RES_CHANNEL_NODATA) {                                                                   \
+            return Z_CHANNEL_NODATA;                                                                                 \
+        }                                                                                                            \
+        if (ret != _Z_RES_OK) {                                                                                      \
+            _Z_ERROR("%s failed: %i", #collection_try_pull_batch_f, ret);                                            \
+            return ret;                                                                                              \
+        }                                                                                                            \
+        return _Z_RES_OK;                                                                                            \
     }
 
 #define _Z_CHANNEL_DEFINE(item_name, kind_name)                                                             \
@@ -145,6 +220,8 @@ extern "C" {
                            /* collection_push_f               */ _z_##kind_name##_mt_push,                  \
                            /* collection_pull_f               */ _z_##kind_name##_mt_pull,                  \
                            /* collection_try_pull_f           */ _z_##kind_name##_mt_try_pull,              \
+                           /* collection_pull_batch_f         */ _z_##kind_name##_mt_pull_batch,            \
+                           /* collection_try_pull_batch_f     */ _z_##kind_name##_mt_try_pull_batch,        \
                            /* collection_close_f              */ _z_##kind_name##_mt_close,                 \
                            /* elem_owned_type                 */ z_owned_##item_name##_t,                   \
                            /* elem_loaned_type                */ z_loaned_##item_name##_t,                  \
@@ -177,6 +254,23 @@ extern "C" {
         _ZP_UNUSED(handler);                                                                                    \
         _ZP_UNUSED(e);                                                                                          \
         return Z_CHANNEL_DISCONNECTED;                                                                          \
+    }                                                                                                           \
+    static inline z_result_t z_##handler_name##_try_recv_batch(const z_loaned_##handler_name##_t *handler,      \
+                                                               z_owned_##item_name##_t *e, size_t max,          \
+                                                               size_t *count) {                                 \
+        _ZP_UNUSED(handler);                                                                                    \
+        _ZP_UNUSED(e);                                                                                          \
+        _ZP_UNUSED(max);                                                                                        \
+        *count = 0;                                                                                             \
+        return Z_CHANNEL_DISCONNECTED;                                                                          \
+    }                                                                                                           \
+    static inline z_result_t z_##handler_name##_recv_batch(const z_loaned_##handler_name##_t *handler,          \
+                                                           z_owned_##item_name##_t *e, size_t max, size_t *count) {\
+        _ZP_UNUSED(handler);                                                                                    \
+        _ZP_UNUSED(e);                                                                                          \
+        _ZP_UNUSED(max);                                                                                        \
+        *count = 0;                                                                                             \
+        return Z_CHANNEL_DISCONNECTED;                                                                          \
     }
 
 #define _Z_CHANNEL_DEFINE_DUMMY(item_name, kind_name) \
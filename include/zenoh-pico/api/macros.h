@@ -391,6 +391,26 @@
         const z_loaned_ring_handler_sample_t* : z_ring_handler_sample_recv \
     )(x, __VA_ARGS__)
 
+#define z_try_recv_batch(x, ...) \
+    _Generic((x), \
+        const z_loaned_fifo_handler_query_t* : z_fifo_handler_query_try_recv_batch, \
+        const z_loaned_fifo_handler_reply_t* : z_fifo_handler_reply_try_recv_batch, \
+        const z_loaned_fifo_handler_sample_t* : z_fifo_handler_sample_try_recv_batch, \
+        const z_loaned_ring_handler_query_t* : z_ring_handler_query_try_recv_batch, \
+        const z_loaned_ring_handler_reply_t* : z_ring_handler_reply_try_recv_batch, \
+        const z_loaned_ring_handler_sample_t* : z_ring_handler_sample_try_recv_batch \
+    )(x, __VA_ARGS__)
+
+#define z_recv_batch(x, ...) \
+    _Generic((x), \
+        const z_loaned_fifo_handler_query_t* : z_fifo_handler_query_recv_batch, \
+        const z_loaned_fifo_handler_reply_t* : z_fifo_handler_reply_recv_batch, \
+        const z_loaned_fifo_handler_sample_t* : z_fifo_handler_sample_recv_batch, \
+        const z_loaned_ring_handler_query_t* : z_ring_handler_query_recv_batch, \
+        const z_loaned_ring_handler_reply_t* : z_ring_handler_reply_recv_batch, \
+        const z_loaned_ring_handler_sample_t* : z_ring_handler_sample_recv_batch \
+    )(x, __VA_ARGS__)
+
 /**
  * Defines a generic function for moving any of the ``z_owned_X_t`` types.
  *
@@ -1036,6 +1056,44 @@ inline z_result_t z_recv(const z_loaned_ring_handler_sample_t* this_, z_owned_sa
     return z_ring_handler_sample_recv(this_, sample);
 }
 
+inline z_result_t z_try_recv_batch(const z_loaned_fifo_handler_query_t* this_, z_owned_query_t* queries, size_t max, size_t* count) {
+    return z_fifo_handler_query_try_recv_batch(this_, queries, max, count);
+}
+inline z_result_t z_try_recv_batch(const z_loaned_fifo_handler_reply_t* this_, z_owned_reply_t* replies, size_t max, size_t* count) {
+    return z_fifo_handler_reply_try_recv_batch(this_, replies, max, count);
+}
+inline z_result_t z_try_recv_batch(const z_loaned_fifo_handler_sample_t* this_, z_owned_sample_t* samples, size_t max, size_t* count) {
+    return z_fifo_handler_sample_try_recv_batch(this_, samples, max, count);
+}
+inline z_result_t z_try_recv_batch(const z_loaned_ring_handler_query_t* this_, z_owned_query_t* queries, size_t max, size_t* count) {
+    return z_ring_handler_query_try_recv_batch(this_, queries, max, count);
+}
+inline z_result_t z_try_recv_batch(const z_loaned_ring_handler_reply_t* this_, z_owned_reply_t* replies, size_t max, size_t* count) {
+    return z_ring_handler_reply_try_recv_batch(this_, replies, max, count);
+}
+inline z_result_t z_try_recv_batch(const z_loaned_ring_handler_sample_t* this_, z_owned_sample_t* samples, size_t max, size_t* count) {
+    return z_ring_handler_sample_try_recv_batch(this_, samples, max, count);
+}
+
+inline z_result_t z_recv_batch(const z_loaned_fifo_handler_query_t* this_, z_owned_query_t* queries, size_t max, size_t* count) {
+    return z_fifo_handler_query_recv_batch(this_, queries, max, count);
+}
+inline z_result_t z_recv_batch(const z_loaned_fifo_handler_reply_t* this_, z_owned_reply_t* replies, size_t max, size_t* count) {
+    return z_fifo_handler_reply_recv_batch(this_, replies, max, count);
+}
+inline z_result_t z_recv_batch(const z_loaned_fifo_handler_sample_t* this_, z_owned_sample_t* samples, size_t max, size_t* count) {
+    return z_fifo_handler_sample_recv_batch(this_, samples, max, count);
+}
+inline z_result_t z_recv_batch(const z_loaned_ring_handler_query_t* this_, z_owned_query_t* queries, size_t max, size_t* count) {
+    return z_ring_handler_query_recv_batch(this_, queries, max, count);
+}
+inline z_result_t z_recv_batch(const z_loaned_ring_handler_reply_t* this_, z_owned_reply_t* replies, size_t max, size_t* count) {
+    return z_ring_handler_reply_recv_batch(this_, replies, max, count);
+}
+inline z_result_t z_recv_batch(const z_loaned_ring_handler_sample_t* this_, z_owned_sample_t* samples, size_t max, size_t* count) {
+    return z_ring_handler_sample_recv_batch(this_, samples, max, count);
+}
+
 // clang-format on
 
 inline z_moved_bytes_t* z_move(z_owned_bytes_t& x) { return z_bytes_move(&x); }
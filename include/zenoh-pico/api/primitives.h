@@ -3267,6 +3267,43 @@ z_result_t zp_stop_lease_task(z_loaned_session_t *zs);
  */
 bool zp_lease_task_is_running(const z_loaned_session_t *zs);
 #endif
+#if Z_FEATURE_ASYNC_LOG == 1 || defined(SPHINX_DOCS)
+/************* Asynchronous logging **************/
+/**
+ * Starts the asynchronous logging backend. From then on log records are formatted by the logging thread into a
+ * ring of ``Z_LOG_ASYNC_RING_SIZE`` records and written to ``sink`` by a background task, so that logging never blocks
+ * on I/O. Records logged while the ring is full are dropped and counted.
+ *
+ * Note: only if Z_FEATURE_ASYNC_LOG is enabled.
+ *
+ * Parameters:
+ *   sink: Callback writing the records, or ``NULL`` to write them with ``ZENOH_LOG_PRINT``.
+ *   arg: Argument passed to ``sink``.
+ *
+ * Return:
+ *   ``0`` if the backend started successfully, ``negative value`` otherwise.
+ */
+z_result_t zp_log_async_start(zp_log_sink_t sink, void *arg);
+
+/**
+ * Stops the asynchronous logging backend after writing the pending records. Records are then written synchronously
+ * with ``ZENOH_LOG_PRINT`` again.
+ *
+ * Note: only if Z_FEATURE_ASYNC_LOG is enabled.
+ *
+ * Return:
+ *   ``0`` if the backend stopped successfully, ``negative value`` otherwise.
+ */
+z_result_t zp_log_async_stop(void);
+
+/**
+ * Returns the number of log records dropped because the ring of the asynchronous logging backend was full, since it
+ * was last started.
+ *
+ * Note: only if Z_FEATURE_ASYNC_LOG is enabled.
+ */
+size_t zp_log_async_dropped(void);
+#endif
 #if Z_FEATURE_MULTI_THREAD == 0 || defined(SPHINX_DOCS)
 /************* Single Thread helpers **************/
 /**
@@ -233,6 +233,9 @@ _Z_OWNED_TYPE_RC(_z_cancellation_token_rc_t, cancellation_token)
  *   z_priority_t priority: The priority of messages issued by this publisher.
  *   bool is_express: If ``true``, Zenoh will not wait to batch this operation with others to reduce the bandwidth.
  *   z_reliability_t reliability: The reliability that should be used to transmit the data (unstable).
+ *   bool compression: If ``true``, payloads of at least ``Z_COMPRESSION_THRESHOLD`` bytes are LZ4 compressed when it
+ *     makes them smaller. Subscribers decompress them transparently. Compressed payloads carry the reserved encoding
+ *     schema ``@lz4``, followed by ``;`` and the original schema if any.
  */
 typedef struct {
     z_moved_encoding_t *encoding;
@@ -245,6 +248,9 @@ typedef struct {
 #if Z_FEATURE_LOCAL_SUBSCRIBER == 1
     z_locality_t allowed_destination;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    bool compression;
+#endif
 } z_publisher_options_t;
 
 /**
@@ -382,6 +388,9 @@ typedef struct {
  *   z_moved_bytes_t* attachment: An optional attachment to the publication.
  *   z_reliability_t reliability: The reliability that should be used to transmit the data (unstable).
  *   z_source_info_t* source_info: The source info for the message (unstable).
+ *   bool compression: If ``true``, a payload of at least ``Z_COMPRESSION_THRESHOLD`` bytes is LZ4 compressed when it
+ *     makes it smaller. Subscribers decompress it transparently. Publishers declared with compression reuse their
+ *     compression tables across puts.
  */
 typedef struct {
     z_moved_encoding_t *encoding;
@@ -397,6 +406,9 @@ typedef struct {
     z_reliability_t reliability;
     z_source_info_t *source_info;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    bool compression;
+#endif
 } z_put_options_t;
 
 /**
@@ -515,6 +527,15 @@ typedef struct {
     z_task_attr_t *task_attributes;
 } zp_task_lease_options_t;
 #endif
+#if Z_FEATURE_ASYNC_LOG == 1 || defined(SPHINX_DOCS)
+/**
+ * Callback writing a preformatted log record of ``len`` bytes, registered with :c:func:`zp_log_async_start`.
+ * It is only called from the asynchronous logger task.
+ *
+ * Note: only if Z_FEATURE_ASYNC_LOG is enabled.
+ */
+typedef void (*zp_log_sink_t)(const char *record, size_t len, void *arg);
+#endif
 #if Z_FEATURE_MULTI_THREAD == 0 || defined(SPHINX_DOCS)
 /**
  * Represents the configuration used to configure a read operation started via :c:func:`zp_read`.
@@ -19,7 +19,7 @@
 
 #include "zenoh-pico/api/liveliness.h"
 #include "zenoh-pico/api/types.h"
-#include "zenoh-pico/collections/ring.h"
+#include "zenoh-pico/net/sample.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -46,13 +46,19 @@ typedef struct {
     bool _liveliness;  // TODO: Private as not yet exposed in Zenoh implementation.
 } ze_advanced_publisher_cache_options_t;
 
+/**
+ * Samples are stored in a fixed-capacity slab used as a ring, oldest first. Sequenced samples are kept in
+ * sequence number order, so that range queries can be resolved by index and time queries by binary search.
+ */
 typedef struct {
-    _z_sample_ring_t _cache;
-    _z_sample_t *_outbox;
-    size_t _outbox_cap;
+    _z_sample_t *_slots;
+    size_t _capacity;
+    size_t _head;
+    size_t _len;
+    size_t _unsequenced;    // Number of cached samples without a sequence number
+    size_t _time_disorder;  // Number of adjacent sample pairs not in ascending timestamp order
 #if Z_FEATURE_MULTI_THREAD == 1
     _z_mutex_t _mutex;
-    _z_mutex_t _outbox_mutex;
 #endif
     z_owned_queryable_t _queryable;
     z_owned_liveliness_token_t _liveliness;
@@ -67,7 +73,24 @@ _ze_advanced_cache_t *_ze_advanced_cache_new(const z_loaned_session_t *zs, const
                                              const z_loaned_keyexpr_t *suffix,
                                              const ze_advanced_publisher_cache_options_t options);
 
-z_result_t _ze_advanced_cache_add(_ze_advanced_cache_t *cache, _z_sample_t *sample);
+/**
+ * Stores a published sample in the cache, evicting the oldest one when full. Keyexpr and encoding strings that are
+ * aliases are stored as aliases and must outlive the cache, owned ones are copied. Payload and attachment slices are
+ * shared by reference count, and the slice vectors of evicted samples are reused, so that a full cache does not
+ * allocate per sample.
+ */
+z_result_t _ze_advanced_cache_add(_ze_advanced_cache_t *cache, const _z_declared_keyexpr_t *key,
+                                  const _z_bytes_t *payload, const _z_timestamp_t *timestamp,
+                                  const _z_encoding_t *encoding, z_sample_kind_t kind, _z_qos_t qos,
+                                  const _z_bytes_t *attachment, z_reliability_t reliability,
+                                  const _z_source_info_t *source_info);
+
+/**
+ * Takes a reference on the cached samples matching the ``_sn``, ``_time`` and ``_max`` query parameters, oldest
+ * first. The returned array is NULL when no sample matches, otherwise the caller clears its samples and frees it.
+ */
+z_result_t _ze_advanced_cache_collect(_ze_advanced_cache_t *cache, const _z_string_t *parameters, _z_ntp64_t now,
+                                      _z_sample_t **samples, size_t *count);
 
 void _ze_advanced_cache_free(_ze_advanced_cache_t **xs);
 
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_COLLECTIONS_FREELIST_H
+#define ZENOH_PICO_COLLECTIONS_FREELIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/collections/mpmc_queue.h"
+#include "zenoh-pico/system/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------- Free list --------*/
+// Recycles fixed-size heap blocks. Released blocks are kept, up to a bound, and handed out again instead of going
+// back to the allocator. Each block remembers the list it was taken from, so it can be released without it.
+// Blocks are kept in a bounded lock-free queue, getting and releasing them never takes a lock.
+typedef struct {
+    _z_mpmc_queue_t _blocks;
+    size_t _elem_size;
+} _z_freelist_t;
+
+z_result_t _z_freelist_init(_z_freelist_t *fl, size_t elem_size, size_t max_len);
+void _z_freelist_clear(_z_freelist_t *fl);
+
+// Returns a block of elem_size bytes, or NULL if out of memory
+void *_z_freelist_get(_z_freelist_t *fl);
+// Releases a block returned by _z_freelist_get to the list it was taken from
+void _z_freelist_release(void *elem);
+// Releases n blocks at once, all taken from the same list. The elems array is used as scratch space.
+void _z_freelist_release_n(void **elems, size_t n);
+// Only a snapshot while other threads get or release blocks
+size_t _z_freelist_len(_z_freelist_t *fl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_COLLECTIONS_FREELIST_H */
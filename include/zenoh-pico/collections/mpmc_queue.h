@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_COLLECTIONS_MPMC_QUEUE_H
+#define ZENOH_PICO_COLLECTIONS_MPMC_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/collections/atomic.h"
+#include "zenoh-pico/collections/element.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Z_CACHE_LINE_SIZE
+#define Z_CACHE_LINE_SIZE 64
+#endif
+
+/*-------- Bounded lock-free multi-producer multi-consumer queue --------*/
+// Each slot carries a sequence number telling whether it is ready to be written or read at a given position, so that
+// producers and consumers only contend on their own position counter. The slot count is rounded up to a power of two
+// for the positions to wrap around cleanly, the queue itself holds at most capacity elements.
+typedef struct {
+    _z_atomic_size_t _seq;
+    void *_val;
+} _z_mpmc_queue_slot_t;
+
+typedef struct {
+    _z_mpmc_queue_slot_t *_slots;
+    size_t _mask;
+    size_t _capacity;
+#if Z_FEATURE_MULTI_THREAD == 1
+    uint8_t _pad0[Z_CACHE_LINE_SIZE];
+#endif
+    _z_atomic_size_t _w_pos;
+#if Z_FEATURE_MULTI_THREAD == 1
+    uint8_t _pad1[Z_CACHE_LINE_SIZE - sizeof(_z_atomic_size_t)];
+#endif
+    _z_atomic_size_t _r_pos;
+} _z_mpmc_queue_t;
+
+z_result_t _z_mpmc_queue_init(_z_mpmc_queue_t *q, size_t capacity);
+void _z_mpmc_queue_clear(_z_mpmc_queue_t *q, z_element_free_f free_f);
+
+size_t _z_mpmc_queue_capacity(const _z_mpmc_queue_t *q);
+// Only a snapshot while other threads push or pull
+size_t _z_mpmc_queue_len(_z_mpmc_queue_t *q);
+
+// Returns false if the queue is full
+bool _z_mpmc_queue_push(_z_mpmc_queue_t *q, void *e);
+// Pushes up to n elements of e at consecutive positions at once, returns how many fit
+size_t _z_mpmc_queue_push_n(_z_mpmc_queue_t *q, void **e, size_t n);
+// Pushes e, dropping the oldest elements with free_f to make room if the queue is full
+void _z_mpmc_queue_push_force_drop(_z_mpmc_queue_t *q, void *e, z_element_free_f free_f);
+// Returns NULL if the queue is empty
+void *_z_mpmc_queue_pull(_z_mpmc_queue_t *q);
+// Claims up to max consecutive elements at once, returns how many and the position of the first one in pos. Each
+// claimed element must then be taken with _z_mpmc_queue_take, in order, for its slot to be reused.
+size_t _z_mpmc_queue_claim(_z_mpmc_queue_t *q, size_t max, size_t *pos);
+void *_z_mpmc_queue_take(_z_mpmc_queue_t *q, size_t pos);
+// Takes n claimed elements from pos on, moving them with move_f into consecutive elem_size entries of dst
+void _z_mpmc_queue_take_n(_z_mpmc_queue_t *q, size_t pos, size_t n, void *dst, size_t elem_size,
+                          z_element_move_f move_f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_COLLECTIONS_MPMC_QUEUE_H */
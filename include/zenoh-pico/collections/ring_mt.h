@@ -17,7 +17,7 @@
 #include <stdint.h>
 
 #include "zenoh-pico/collections/element.h"
-#include "zenoh-pico/collections/fifo.h"
+#include "zenoh-pico/collections/mpmc_queue.h"
 #include "zenoh-pico/system/platform.h"
 
 #ifdef __cplusplus
@@ -25,10 +25,13 @@ extern "C" {
 #endif
 
 /*-------- Ring Buffer Multithreaded --------*/
+// Pushes and pulls go through a lock-free queue. The mutex and condition variable are only used to park a consumer
+// waiting on an empty ring.
 typedef struct {
-    _z_ring_t _ring;
-    bool is_closed;
+    _z_mpmc_queue_t _queue;
+    _z_atomic_bool_t _is_closed;
 #if Z_FEATURE_MULTI_THREAD == 1
+    _z_atomic_size_t _pull_waiters;
     _z_mutex_t _mutex;
     _z_condvar_t _cv_not_empty;
 #endif
@@ -45,6 +48,12 @@ z_result_t _z_ring_mt_push(const void *src, void *context, z_element_free_f elem
 
 z_result_t _z_ring_mt_pull(void *dst, void *context, z_element_move_f element_move);
 z_result_t _z_ring_mt_try_pull(void *dst, void *context, z_element_move_f element_move);
+// Moves up to max elements into consecutive elem_size entries of dst at once, count being set to how many. The
+// blocking variant waits for at least one element.
+z_result_t _z_ring_mt_pull_batch(void *dst, size_t elem_size, size_t max, size_t *count, void *context,
+                                 z_element_move_f element_move);
+z_result_t _z_ring_mt_try_pull_batch(void *dst, size_t elem_size, size_t max, size_t *count, void *context,
+                                     z_element_move_f element_move);
 
 #ifdef __cplusplus
 }
@@ -101,6 +101,7 @@ z_result_t _z_slice_n_copy(_z_slice_t *dst, const _z_slice_t *src, size_t offset
 _z_slice_t _z_slice_duplicate(const _z_slice_t *src);
 z_result_t _z_slice_move(_z_slice_t *dst, _z_slice_t *src);
 bool _z_slice_eq(const _z_slice_t *left, const _z_slice_t *right);
+size_t _z_slice_hash(const _z_slice_t *s);
 void _z_slice_free(_z_slice_t **bs);
 bool _z_slice_is_alloced(const _z_slice_t *s);
 
@@ -121,6 +121,7 @@ int _z_string_compare(const _z_string_t *left, const _z_string_t *right);
 int _z_substring_compare(const _z_string_t *left, size_t left_start, size_t left_len, const _z_string_t *right,
                          size_t right_start, size_t right_len);
 bool _z_string_equals(const _z_string_t *left, const _z_string_t *right);
+size_t _z_string_hash(const _z_string_t *s);
 _z_string_t _z_string_convert_bytes_le(const _z_slice_t *bs);
 _z_string_t _z_string_preallocate(const size_t len);
 z_result_t _z_string_concat_substr(_z_string_t *s, const _z_string_t *left, const char *right, size_t len,
@@ -133,7 +134,7 @@ static inline z_result_t _z_string_concat(_z_string_t *s, const _z_string_t *lef
 char *_z_str_from_string_clone(const _z_string_t *str);
 
 _Z_ELEM_DEFINE(_z_string, _z_string_t, _z_string_len, _z_string_clear, _z_string_copy, _z_string_move, _z_string_equals,
-               _z_string_compare, _z_noop_hash)
+               _z_string_compare, _z_string_hash)
 _Z_SVEC_DEFINE(_z_string, _z_string_t)
 _Z_LIST_DEFINE(_z_string, _z_string_t)
 _Z_INT_MAP_DEFINE(_z_string, _z_string_t)
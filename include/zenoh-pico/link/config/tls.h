@@ -24,7 +24,7 @@ extern "C" {
 
 #if Z_FEATURE_LINK_TLS == 1
 
-#define TLS_CONFIG_ARGC 12
+#define TLS_CONFIG_ARGC 14
 
 #define TLS_CONFIG_ROOT_CA_CERTIFICATE_KEY 0x01
 #define TLS_CONFIG_ROOT_CA_CERTIFICATE_STR "root_ca_certificate"
@@ -62,6 +62,12 @@ extern "C" {
 #define TLS_CONFIG_VERIFY_NAME_ON_CONNECT_KEY 0x0C
 #define TLS_CONFIG_VERIFY_NAME_ON_CONNECT_STR "verify_name_on_connect"
 
+#define TLS_CONFIG_SESSION_CACHE_KEY 0x0D
+#define TLS_CONFIG_SESSION_CACHE_STR "session_cache"
+
+#define TLS_CONFIG_SESSION_TICKET_LIFETIME_KEY 0x0E
+#define TLS_CONFIG_SESSION_TICKET_LIFETIME_STR "session_ticket_lifetime"
+
 #define TLS_CONFIG_MAPPING_BUILD                                       \
     _z_str_intmapping_t args[TLS_CONFIG_ARGC];                         \
     args[0]._key = TLS_CONFIG_ROOT_CA_CERTIFICATE_KEY;                 \
@@ -87,7 +93,11 @@ extern "C" {
     args[10]._key = TLS_CONFIG_CONNECT_CERTIFICATE_BASE64_KEY;         \
     args[10]._str = (char *)TLS_CONFIG_CONNECT_CERTIFICATE_BASE64_STR; \
     args[11]._key = TLS_CONFIG_VERIFY_NAME_ON_CONNECT_KEY;             \
-    args[11]._str = (char *)TLS_CONFIG_VERIFY_NAME_ON_CONNECT_STR;
+    args[11]._str = (char *)TLS_CONFIG_VERIFY_NAME_ON_CONNECT_STR;     \
+    args[12]._key = TLS_CONFIG_SESSION_CACHE_KEY;                      \
+    args[12]._str = (char *)TLS_CONFIG_SESSION_CACHE_STR;              \
+    args[13]._key = TLS_CONFIG_SESSION_TICKET_LIFETIME_KEY;            \
+    args[13]._str = (char *)TLS_CONFIG_SESSION_TICKET_LIFETIME_STR;
 
 size_t _z_tls_config_strlen(const _z_str_intmap_t *s);
 
@@ -44,6 +44,13 @@ extern "C" {
 #if Z_FEATURE_LINK_TLS == 1
 #define TLS_SCHEMA "tls"
 #endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+#define UNIXSOCK_STREAM_SCHEMA "unixsock-stream"
+#define UNIXSOCK_DGRAM_SCHEMA "unixsock-dgram"
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+#define SHM_SCHEMA "shm"
+#endif
 
 #define LOCATOR_PROTOCOL_SEPARATOR '/'
 #define LOCATOR_METADATA_SEPARATOR '?'
@@ -19,8 +19,10 @@
 #include "zenoh-pico/link/endpoint.h"
 #include "zenoh-pico/link/transport/bt.h"
 #include "zenoh-pico/link/transport/raweth.h"
+#include "zenoh-pico/link/transport/shm.h"
 #include "zenoh-pico/link/transport/tcp.h"
 #include "zenoh-pico/link/transport/udp_unicast.h"
+#include "zenoh-pico/link/transport/unixsock.h"
 #include "zenoh-pico/link/transport/ws.h"
 #include "zenoh-pico/protocol/iobuf.h"
 #include "zenoh-pico/system/platform.h"
@@ -95,6 +97,12 @@ typedef size_t (*_z_f_link_read_exact)(const struct _z_link_t *self, uint8_t *pt
                                        _z_sys_net_socket_t *socket);
 typedef size_t (*_z_f_link_read_socket)(const _z_sys_net_socket_t socket, uint8_t *ptr, size_t len);
 typedef void (*_z_f_link_free)(struct _z_link_t *self);
+// Sends consecutive datagrams of segment bytes, the last one possibly shorter, in as few system calls as possible
+typedef size_t (*_z_f_link_write_segments)(const struct _z_link_t *self, const uint8_t *ptr, size_t len,
+                                           size_t segment);
+// Sends a buffer on several sockets at once, returns the number of sockets it was sent on, SIZE_MAX if none was tried
+typedef size_t (*_z_f_link_write_sockets)(const struct _z_link_t *self, const uint8_t *ptr, size_t len,
+                                          _z_sys_net_socket_t *const *sockets, size_t nb);
 
 static inline size_t _z_noop_link_read_socket(const _z_sys_net_socket_t socket, uint8_t *ptr, size_t len) {
     _ZP_UNUSED(socket);
@@ -112,6 +120,8 @@ enum _z_link_type_e {
     _Z_LINK_TYPE_WS,
     _Z_LINK_TYPE_TLS,
     _Z_LINK_TYPE_RAWETH,
+    _Z_LINK_TYPE_UNIXSOCK,
+    _Z_LINK_TYPE_SHM,
 };
 
 typedef struct _z_link_t {
@@ -138,6 +148,12 @@ typedef struct _z_link_t {
 #endif
 #if Z_FEATURE_RAWETH_TRANSPORT == 1
         _z_raweth_socket_t _raweth;
+#endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+        _z_unixsock_socket_t _unixsock;
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        _z_shm_socket_t _shm;
 #endif
     } _socket;
 
@@ -150,6 +166,8 @@ typedef struct _z_link_t {
     _z_f_link_read_exact _read_exact_f;
     _z_f_link_read_socket _read_socket_f;
     _z_f_link_free _free_f;
+    _z_f_link_write_segments _write_segments_f;  // Optional, NULL if the link has no segmentation offload
+    _z_f_link_write_sockets _write_sockets_f;    // Optional, NULL if the link sends on each socket in turn
 
     uint16_t _mtu;
     _z_link_capabilities_t _cap;
@@ -162,6 +180,8 @@ z_result_t _z_open_link(_z_link_t *zl, const _z_string_t *locator, const _z_conf
 z_result_t _z_listen_link(_z_link_t *zl, const _z_string_t *locator, const _z_config_t *session_cfg);
 
 z_result_t _z_link_send_wbuf(const _z_link_t *zl, const _z_wbuf_t *wbf, _z_sys_net_socket_t *socket);
+void _z_link_send_wbuf_sockets(const _z_link_t *zl, const _z_wbuf_t *wbf, _z_sys_net_socket_t *const *sockets,
+                               size_t nb);
 size_t _z_link_recv_zbuf(const _z_link_t *zl, _z_zbuf_t *zbf, _z_slice_t *addr);
 size_t _z_link_recv_exact_zbuf(const _z_link_t *zl, _z_zbuf_t *zbf, size_t len, _z_slice_t *addr,
                                _z_sys_net_socket_t *socket);
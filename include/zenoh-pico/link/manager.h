@@ -53,6 +53,18 @@ z_result_t _z_endpoint_tls_valid(_z_endpoint_t *ep);
 z_result_t _z_new_peer_tls(_z_endpoint_t *endpoint, _z_sys_net_socket_t *socket, const _z_config_t *session_cfg);
 z_result_t _z_new_link_tls(_z_link_t *zl, _z_endpoint_t *ep, const _z_config_t *session_cfg);
 #endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+z_result_t _z_endpoint_unixsock_stream_valid(_z_endpoint_t *ep);
+z_result_t _z_endpoint_unixsock_dgram_valid(_z_endpoint_t *ep);
+z_result_t _z_new_peer_unixsock_stream(_z_endpoint_t *endpoint, _z_sys_net_socket_t *socket);
+z_result_t _z_new_link_unixsock_stream(_z_link_t *zl, _z_endpoint_t *ep);
+z_result_t _z_new_link_unixsock_dgram(_z_link_t *zl, _z_endpoint_t *ep);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+z_result_t _z_endpoint_shm_valid(_z_endpoint_t *ep);
+z_result_t _z_new_peer_shm(_z_endpoint_t *endpoint, _z_sys_net_socket_t *socket);
+z_result_t _z_new_link_shm(_z_link_t *zl, _z_endpoint_t *ep);
+#endif
 
 #ifdef __cplusplus
 }
@@ -74,10 +74,18 @@ typedef struct {
     uint16_t data_length;               // Payload length
 } _zp_eth_vlan_header_t;
 
+// Memory-mapped frame rings of a raw ethernet socket
+typedef struct _z_raweth_ring_t _z_raweth_ring_t;
+
+// Precompiled lookup of the mapping entries
+typedef struct _zp_raweth_mapping_index_t _zp_raweth_mapping_index_t;
+
 typedef struct {
     const char *_interface;
     _z_sys_net_socket_t _sock;
+    _z_raweth_ring_t *_ring;
     _zp_raweth_mapping_array_t _mapping;
+    _zp_raweth_mapping_index_t *_mapping_index;
     _zp_raweth_whitelist_array_t _whitelist;
     uint16_t _vlan;
     uint16_t _ethtype;
@@ -91,6 +99,32 @@ size_t _z_send_raweth(const _z_sys_net_socket_t *sock, const void *buff, size_t
 size_t _z_receive_raweth(const _z_sys_net_socket_t *sock, void *buff, size_t buff_len, _z_slice_t *addr,
                          const _zp_raweth_whitelist_array_t *whitelist);
 z_result_t _z_close_raweth(_z_sys_net_socket_t *sock);
+
+/**
+ * Maps TPACKET_V3 receive and transmit rings on a raw ethernet socket. Returns NULL if they are disabled or not
+ * supported by the kernel, in which case frames are exchanged with :c:func:`_z_send_raweth` and
+ * :c:func:`_z_receive_raweth`.
+ */
+_z_raweth_ring_t *_z_raweth_ring_new(const _z_sys_net_socket_t *sock);
+/**
+ * Unmaps the rings, frames still queued for transmission are dropped.
+ */
+void _z_raweth_ring_free(_z_raweth_ring_t **ring);
+/**
+ * Queues a frame on the transmit ring, it is sent by the next :c:func:`_z_raweth_ring_flush`. Returns SIZE_MAX if the
+ * frame could not be queued.
+ */
+size_t _z_raweth_ring_send(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock, const void *buff, size_t buff_len);
+/**
+ * Sends all the queued frames with a single system call, and waits for their transmission.
+ */
+z_result_t _z_raweth_ring_flush(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock);
+/**
+ * Ring counterpart of :c:func:`_z_receive_raweth`, frames from unknown sources are skipped.
+ */
+size_t _z_raweth_ring_receive(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock, void *buff, size_t buff_len,
+                              _z_slice_t *addr, const _zp_raweth_whitelist_array_t *whitelist);
+
 uint16_t _z_raweth_ntohs(uint16_t val);
 uint16_t _z_raweth_htons(uint16_t val);
 
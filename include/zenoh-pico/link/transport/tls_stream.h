@@ -33,6 +33,9 @@ extern "C" {
 #include "mbedtls/net_sockets.h"
 #include "mbedtls/pk.h"
 #include "mbedtls/ssl.h"
+#if defined(MBEDTLS_SSL_TICKET_C)
+#include "mbedtls/ssl_ticket.h"
+#endif
 #include "mbedtls/x509_crt.h"
 
 typedef struct {
@@ -45,7 +48,12 @@ typedef struct {
     mbedtls_x509_crt _listen_cert;
     mbedtls_pk_context _client_key;
     mbedtls_x509_crt _client_cert;
+#if defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_context _ticket;  // Only set up on listening sockets issuing session tickets
+#endif
+    char *_session_key;  // Endpoint identifier in the session cache, NULL if the session is not to be cached
     bool _enable_mtls;
+    bool _resumed;  // The last client handshake resumed a cached session, without the server certificate
 } _z_tls_context_t;
 
 typedef struct {
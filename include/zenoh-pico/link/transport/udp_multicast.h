@@ -54,6 +54,14 @@ size_t _z_udp_multicast_read(const _z_sys_net_socket_t sock, uint8_t *ptr, size_
 size_t _z_udp_multicast_write(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len,
                               const _z_sys_net_endpoint_t rep);
 
+#if defined(ZENOH_LINUX)
+// Counterparts of the read functions for a socket with UDP_GRO enabled, see _z_udp_gro_new
+size_t _z_udp_multicast_read_gro(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr, size_t len,
+                                 const _z_sys_net_endpoint_t lep, _z_slice_t *ep);
+size_t _z_udp_multicast_read_exact_gro(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr, size_t len,
+                                       const _z_sys_net_endpoint_t lep, _z_slice_t *ep);
+#endif
+
 #endif
 
 #ifdef __cplusplus
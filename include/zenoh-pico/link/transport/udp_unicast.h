@@ -15,6 +15,7 @@
 #ifndef ZENOH_PICO_LINK_TRANSPORT_UDP_UNICAST_H
 #define ZENOH_PICO_LINK_TRANSPORT_UDP_UNICAST_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -25,11 +26,17 @@
 extern "C" {
 #endif
 
+// Datagrams coalesced by the kernel with UDP_GRO, handed out one at a time
+typedef struct _z_udp_gro_t _z_udp_gro_t;
+
 typedef struct {
     _z_sys_net_socket_t _sock;
     _z_sys_net_socket_t _msock;
     _z_sys_net_endpoint_t _rep;
     _z_sys_net_endpoint_t _lep;
+#if defined(ZENOH_LINUX)
+    _z_udp_gro_t *_gro;  // Set if receive offload is enabled on _sock
+#endif
 } _z_udp_socket_t;
 
 z_result_t _z_udp_unicast_address_valid(const _z_string_t *address);
@@ -48,6 +55,42 @@ size_t _z_udp_unicast_read_exact(_z_sys_net_socket_t sock, uint8_t *ptr, size_t
 size_t _z_udp_unicast_write(_z_sys_net_socket_t sock, const uint8_t *ptr, size_t len,
                             const _z_sys_net_endpoint_t endpoint);
 
+#if defined(ZENOH_LINUX)
+/**
+ * Returns true if the kernel can split a single send into several datagrams (UDP_SEGMENT, Linux 4.18).
+ */
+bool _z_udp_gso_supported(const _z_sys_net_socket_t sock);
+
+/**
+ * Sends ``len`` bytes as consecutive datagrams of ``segment`` bytes, the last one possibly shorter, with as few system
+ * calls as the kernel limits allow. If the kernel refuses a segmented send, the datagrams are sent one by one instead
+ * and ``offload_failed`` is set, so that the caller stops using segmentation offload on this socket.
+ *
+ * Returns the number of bytes sent, or ``SIZE_MAX`` on error.
+ */
+size_t _z_udp_write_segments(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len, size_t segment,
+                             const _z_sys_net_endpoint_t endpoint, bool *offload_failed);
+
+/**
+ * Enables UDP_GRO on the socket, so that a burst of datagrams from the same sender is received at once. Returns NULL if
+ * the kernel does not support it (Linux 5.0) or if memory is lacking, the socket then keeps receiving one datagram at a
+ * time.
+ */
+_z_udp_gro_t *_z_udp_gro_new(const _z_sys_net_socket_t sock);
+void _z_udp_gro_free(_z_udp_gro_t **gro);
+
+/**
+ * Reads the next datagram, from the coalesced datagrams received last or from the socket once they are consumed.
+ * ``raddr``, if not NULL, is set to the ``struct sockaddr_storage`` of the sender.
+ *
+ * Returns the datagram size, truncated to ``len``, or ``SIZE_MAX`` on error.
+ */
+size_t _z_udp_gro_read(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr, size_t len,
+                       const void **raddr);
+// Drops the datagrams left from the last reception
+void _z_udp_gro_discard(_z_udp_gro_t *gro);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_LINK_TRANSPORT_UNIXSOCK_H
+#define ZENOH_PICO_LINK_TRANSPORT_UNIXSOCK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/collections/string.h"
+#include "zenoh-pico/system/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Size of sun_path, including the terminating null byte, on the platforms with the smallest one (macOS and BSDs)
+#define _Z_UNIXSOCK_PATH_MAX 104
+
+typedef struct {
+    _z_sys_net_socket_t _sock;
+    // Null-terminated path of the socket file
+    char *_path;
+    // Set on listening sockets, which remove the socket file when closed
+    bool _bound;
+} _z_unixsock_socket_t;
+
+z_result_t _z_unixsock_address_valid(const _z_string_t *address);
+char *_z_unixsock_address_parse_path(const _z_string_t *address);
+
+// flawfinder: ignore
+z_result_t _z_unixsock_stream_open(_z_sys_net_socket_t *sock, const char *path, uint32_t tout);
+z_result_t _z_unixsock_stream_listen(_z_sys_net_socket_t *sock, const char *path);
+z_result_t _z_unixsock_stream_accept(const _z_sys_net_socket_t *sock_in, _z_sys_net_socket_t *sock_out);
+// flawfinder: ignore
+z_result_t _z_unixsock_dgram_open(_z_sys_net_socket_t *sock, const char *path, uint32_t tout);
+void _z_unixsock_close(_z_sys_net_socket_t *sock, const char *path, bool bound);
+
+// flawfinder: ignore
+size_t _z_unixsock_read(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len);
+size_t _z_unixsock_read_exact(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len);
+size_t _z_unixsock_write(_z_sys_net_socket_t sock, const uint8_t *ptr, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_LINK_TRANSPORT_UNIXSOCK_H */
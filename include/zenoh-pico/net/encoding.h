@@ -22,6 +22,9 @@ extern "C" {
 #endif
 
 #define _Z_ENCODING_ID_DEFAULT 0
+// Reserved schema of compressed payloads, followed by ';' and the original schema if there was one. Routers forward
+// the schema untouched, and the encoding id is left to the application.
+#define _Z_ENCODING_SCHEMA_COMPRESSED "@lz4"
 
 /**
  * A zenoh encoding.
@@ -246,6 +246,17 @@ z_result_t _z_undeclare_queryable(_z_queryable_t *qle);
 z_result_t _z_send_reply(const _z_query_t *query, const _z_session_rc_t *zsrc, const _z_declared_keyexpr_t *keyexpr,
                          _z_bytes_t *payload, _z_encoding_t *encoding, const z_sample_kind_t kind, bool is_express,
                          const _z_timestamp_t *timestamp, _z_bytes_t *attachment, _z_source_info_t *source_info);
+/**
+ * Send samples as replies to a query, batched together and flushed once.
+ *
+ * Parameters:
+ *     query: The query to reply to. The caller keeps its ownership.
+ *     samples: The samples to reply with, in order. The caller keeps their ownership.
+ *     count: The number of samples.
+ *     is_express: If true, each reply is sent on its own instead of being batched.
+ */
+z_result_t _z_send_replies(const _z_query_t *query, const _z_session_rc_t *zsrc, _z_sample_t *samples, size_t count,
+                           bool is_express);
 /**
  * Send a reply error to a query.
  *
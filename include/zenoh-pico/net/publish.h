@@ -38,6 +38,10 @@ typedef struct _z_publisher_t {
     bool _is_express;
     z_locality_t _allowed_destination;
     _z_write_filter_t _filter;
+#if Z_FEATURE_COMPRESSION == 1
+    // Only allocated for publishers declared with compression
+    struct _z_payload_compressor_t *_compressor;
+#endif
 } _z_publisher_t;
 
 #if Z_FEATURE_PUBLICATION == 1
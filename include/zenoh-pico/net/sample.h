@@ -19,6 +19,7 @@
 #include "zenoh-pico/net/encoding.h"
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/session/session.h"
+#include "zenoh-pico/utils/lz4.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -68,6 +69,29 @@ z_result_t _z_sample_copy_data(_z_sample_t *dst, const _z_declared_keyexpr_t *ke
                                const _z_source_info_t *source_info);
 z_result_t _z_sample_move(_z_sample_t *dst, _z_sample_t *src);
 
+#if Z_FEATURE_COMPRESSION == 1
+// Payload compression scratch space, allocated once per publisher declared with compression
+typedef struct _z_payload_compressor_t {
+    uint32_t _table[_Z_LZ4_TABLE_SIZE];
+    // Compressed payload, copied out only if smaller than the original. Grows to the largest payload compressed.
+    uint8_t *_buf;
+    size_t _capacity;
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_t _mutex;
+#endif
+} _z_payload_compressor_t;
+
+_z_payload_compressor_t *_z_payload_compressor_new(void);
+void _z_payload_compressor_free(_z_payload_compressor_t **c);
+
+// Replaces payload by its compressed form and prefixes the encoding schema with _Z_ENCODING_SCHEMA_COMPRESSED, if
+// payload is at least Z_COMPRESSION_THRESHOLD bytes long and compresses to something smaller. Leaves both untouched
+// otherwise. Without a compressor, scratch space is allocated for the call.
+z_result_t _z_sample_payload_compress(_z_payload_compressor_t *c, _z_bytes_t *payload, _z_encoding_t *encoding);
+// Reverts _z_sample_payload_compress, does nothing if the encoding schema is not the compressed one
+z_result_t _z_sample_payload_decompress(_z_bytes_t *payload, _z_encoding_t *encoding);
+#endif
+
 /**
  * Free a :c:type:`_z_sample_t`, including its internal fields.
  *
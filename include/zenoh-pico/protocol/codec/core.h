@@ -49,6 +49,7 @@ z_result_t _z_uint16_encode(_z_wbuf_t *buf, uint16_t v);
 z_result_t _z_uint16_decode(uint16_t *u16, _z_zbuf_t *buf);
 
 uint8_t _z_zint_len(uint64_t v);
+// Encodes v in buf and returns the encoded length. Up to 9 bytes of buf may be written, whatever the length.
 uint8_t _z_zint64_encode_buf(uint8_t *buf, uint64_t v);
 static inline uint8_t _z_zsize_encode_buf(uint8_t *buf, _z_zint_t v) { return _z_zint64_encode_buf(buf, (uint64_t)v); }
 
@@ -49,6 +49,9 @@ z_result_t _z_frame_decode(_z_t_msg_frame_t *msg, _z_zbuf_t *zbf, uint8_t header
 z_result_t _z_fragment_encode(_z_wbuf_t *wbf, uint8_t header, const _z_t_msg_fragment_t *msg);
 z_result_t _z_fragment_decode(_z_t_msg_fragment_t *msg, _z_zbuf_t *zbf, uint8_t header);
 
+z_result_t _z_t_oam_encode(_z_wbuf_t *wbf, uint8_t header, const _z_t_msg_oam_t *msg);
+z_result_t _z_t_oam_decode(_z_t_msg_oam_t *msg, _z_zbuf_t *zbf, uint8_t header);
+
 #if defined(Z_TEST_HOOKS)
 typedef z_result_t (*_z_transport_message_encode_override_fn)(_z_wbuf_t *wbf, const _z_transport_message_t *msg,
                                                               bool *handled);
@@ -31,6 +31,11 @@
 //       In any case, the length of a message must not exceed 65_535 bytes.
 #define _Z_MSG_LEN_ENC_SIZE 2
 
+// NOTE: When compression is negotiated at transport establishment, every batch starts with a one byte header, after
+//       the length on stream-oriented transports. If the C flag is set the rest of the batch is a single LZ4 block.
+#define _Z_BATCH_HEADER_SIZE 1
+#define _Z_BATCH_HEADER_C 0x01  // 1 << 0
+
 /*=============================*/
 /*       Message header        */
 /*=============================*/
@@ -331,6 +331,9 @@ typedef struct {
 #if Z_FEATURE_FRAGMENTATION == 1
     uint8_t _patch;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    bool _compression;
+#endif
 } _z_t_msg_init_t;
 void _z_t_msg_init_clear(_z_t_msg_init_t *msg);
 
@@ -499,6 +502,58 @@ typedef struct {
 } _z_t_msg_fragment_t;
 void _z_t_msg_fragment_clear(_z_t_msg_fragment_t *msg);
 
+/*------------------ OAM Message ------------------*/
+// The OAM message carries operations and management information of a transport, with the same layout as the
+// network OAM message. Nodes ignore the OAM messages whose id they do not know.
+//
+// Flags:
+// - E |: Encoding     The encoding of the body
+// - E/
+// - Z: Extensions     If Z==1 then zenoh extensions will follow.
+//
+//  7 6 5 4 3 2 1 0
+// +-+-+-+-+-+-+-+-+
+// |Z|ENC|  OAM    |
+// +-+-+-+---------+
+// ~    id:z16     ~
+// +---------------+
+// ~  [oam_exts]   ~ if Flag(Z)==1
+// +---------------+
+// %    length     % if ENC == Z64 || ENC == ZBuf
+// +---------------+
+// ~     [u8]      ~ if ENC == ZBuf
+// +---------------+
+//
+// The NACK body asks the node with the given id to send again the reliable frames and fragments it sent with
+// the SNs from sn to sn + count - 1:
+//
+//  7 6 5 4 3 2 1 0
+// +-+-+-+-+-+-+-+-+
+// |zid_len|X|X|X|X| (zid_len - 1)
+// +-------+-+-+-+-+
+// ~      [u8]     ~ -- ZenohID of the node that sent the frames
+// +---------------+
+// %      sn       %
+// +---------------+
+// %     count     %
+// +---------------+
+//
+#define _Z_T_OAM_ID_NACK 0x0010
+
+typedef struct {
+    _z_id_t _zid;
+    _z_zint_t _sn;
+    _z_zint_t _count;
+} _z_t_msg_oam_nack_t;
+
+typedef struct {
+    uint16_t _id;
+    union {
+        _z_t_msg_oam_nack_t _nack;
+    } _body;
+} _z_t_msg_oam_t;
+void _z_t_msg_oam_clear(_z_t_msg_oam_t *msg);
+
 /*------------------ Transport Message ------------------*/
 typedef union {
     _z_t_msg_join_t _join;
@@ -508,6 +563,7 @@ typedef union {
     _z_t_msg_keep_alive_t _keep_alive;
     _z_t_msg_frame_t _frame;
     _z_t_msg_fragment_t _fragment;
+    _z_t_msg_oam_t _oam;
 } _z_transport_body_t;
 
 typedef struct {
@@ -533,6 +589,7 @@ _z_transport_message_t _z_t_msg_make_fragment_header(_z_zint_t sn, z_reliability
                                                      bool first, bool drop);
 _z_transport_message_t _z_t_msg_make_fragment(_z_zint_t sn, _z_slice_t messages, z_reliability_t reliability,
                                               bool is_last, bool first, bool drop);
+_z_transport_message_t _z_t_msg_make_nack(_z_id_t zid, _z_zint_t sn, _z_zint_t count);
 
 /*------------------ Copy ------------------*/
 void _z_t_msg_copy(_z_transport_message_t *clone, _z_transport_message_t *msg);
@@ -542,6 +599,7 @@ void _z_t_msg_copy_open(_z_t_msg_open_t *clone, _z_t_msg_open_t *msg);
 void _z_t_msg_copy_close(_z_t_msg_close_t *clone, _z_t_msg_close_t *msg);
 void _z_t_msg_copy_keep_alive(_z_t_msg_keep_alive_t *clone, _z_t_msg_keep_alive_t *msg);
 void _z_t_msg_copy_frame(_z_t_msg_frame_t *clone, _z_t_msg_frame_t *msg);
+void _z_t_msg_copy_oam(_z_t_msg_oam_t *clone, _z_t_msg_oam_t *msg);
 
 typedef union {
     _z_s_msg_scout_t _scout;
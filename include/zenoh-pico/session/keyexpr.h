@@ -121,6 +121,43 @@ static inline size_t _z_keyexpr_size(_z_keyexpr_t *p) {
 
 _z_wireexpr_t _z_keyexpr_alias_to_wire(const _z_keyexpr_t *key);
 
+/*------------------ Precompiled matcher ------------------*/
+// Chunk boundaries and wildcards of a declared key expression, found once at declaration time. Matching a key without
+// wildcards against it then only scans that key, key expressions the matcher can not handle fall back to
+// _z_keyexpr_intersects/_z_keyexpr_includes.
+typedef enum {
+    _Z_KEYEXPR_MATCHER_GENERIC = 0,
+    _Z_KEYEXPR_MATCHER_EXACT,   // No wildcards
+    _Z_KEYEXPR_MATCHER_CHUNKS,  // * chunks and at most one ** chunk, no stardsl
+} _z_keyexpr_matcher_kind_t;
+
+// Either a * or ** chunk, or a run of consecutive chunks without wildcards, as offsets in the key expression
+typedef struct {
+    uint16_t _begin;
+    uint16_t _len;
+    bool _is_star;
+} _z_keyexpr_matcher_segment_t;
+
+typedef struct {
+    _z_keyexpr_matcher_segment_t *_segments;
+    uint16_t _len;
+    // Index of the ** segment, _len if there is none
+    uint16_t _double_star;
+    uint8_t _kind;
+} _z_keyexpr_matcher_t;
+
+static inline _z_keyexpr_matcher_t _z_keyexpr_matcher_null(void) {
+    _z_keyexpr_matcher_t m = {0};
+    return m;
+}
+
+// The matcher refers to key by offsets, it must be used with the same key afterwards
+z_result_t _z_keyexpr_matcher_compile(_z_keyexpr_matcher_t *m, const _z_keyexpr_t *key);
+void _z_keyexpr_matcher_clear(_z_keyexpr_matcher_t *m);
+bool _z_keyexpr_matcher_intersects(const _z_keyexpr_matcher_t *m, const _z_keyexpr_t *left,
+                                   const _z_keyexpr_t *right);
+bool _z_keyexpr_matcher_includes(const _z_keyexpr_matcher_t *m, const _z_keyexpr_t *left, const _z_keyexpr_t *right);
+
 typedef struct {
     _z_keyexpr_wire_declaration_rc_t _declaration;
     _z_keyexpr_t _inner;
@@ -17,9 +17,11 @@
 #define ZENOH_PICO_SESSION_KEYEXPR_MATCH_TEMPLATE_H
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "zenoh-pico/collections/cat.h"
+#include "zenoh-pico/utils/result.h"
 
 const char _Z_VERBATIM = '@';
 const char _Z_DELIMITER = '/';
@@ -54,8 +56,124 @@ static inline const char *_z_chunk_end(const char *begin, const char *end) {
     return sep ? sep : end;
 }
 
+// Chunk scans over 16-byte blocks with SSE2 or NEON, build with Z_KEYEXPR_SIMD=0 to keep the scalar loops only.
+// The block scans only skip bytes the scalar loops would have stepped over, which then resume where they stopped.
+#ifndef Z_KEYEXPR_SIMD
+#if (defined(ZENOH_COMPILER_GCC) || defined(ZENOH_COMPILER_CLANG)) && (defined(__SSE2__) || defined(__ARM_NEON))
+#define Z_KEYEXPR_SIMD 1
+#else
+#define Z_KEYEXPR_SIMD 0
+#endif
+#endif
+
+#if Z_KEYEXPR_SIMD == 1
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#define _Z_KE_BLOCK_LEN 16
+
+#if defined(__SSE2__)
+#define _Z_KE_BLOCK_BITS_PER_BYTE 1
+
+// Bit i is set when byte i of the block equals c
+static inline uint64_t _z_ke_block_find(const char *p, char c) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(const void *)p);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c)));
+}
+
+// Bit i is set when byte i of the blocks differ, or is a delimiter or stop in l
+static inline uint64_t _z_ke_block_stops(const char *l, const char *r, char stop) {
+    __m128i vl = _mm_loadu_si128((const __m128i *)(const void *)l);
+    __m128i vr = _mm_loadu_si128((const __m128i *)(const void *)r);
+    __m128i special = _mm_or_si128(_mm_cmpeq_epi8(vl, _mm_set1_epi8(_Z_DELIMITER)),
+                                   _mm_cmpeq_epi8(vl, _mm_set1_epi8(stop)));
+    __m128i same = _mm_andnot_si128(special, _mm_cmpeq_epi8(vl, vr));
+    return (uint32_t)_mm_movemask_epi8(same) ^ 0xffffu;
+}
+#else
+// NEON has no movemask, the byte mask is narrowed to a nibble per byte instead
+#define _Z_KE_BLOCK_BITS_PER_BYTE 4
+
+static inline uint64_t _z_ke_block_mask(uint8x16_t m) {
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+}
+
+static inline uint64_t _z_ke_block_find(const char *p, char c) {
+    return _z_ke_block_mask(vceqq_u8(vld1q_u8((const uint8_t *)p), vdupq_n_u8((uint8_t)c)));
+}
+
+static inline uint64_t _z_ke_block_stops(const char *l, const char *r, char stop) {
+    uint8x16_t vl = vld1q_u8((const uint8_t *)l);
+    uint8x16_t vr = vld1q_u8((const uint8_t *)r);
+    uint8x16_t special =
+        vorrq_u8(vceqq_u8(vl, vdupq_n_u8((uint8_t)_Z_DELIMITER)), vceqq_u8(vl, vdupq_n_u8((uint8_t)stop)));
+    return ~_z_ke_block_mask(vbicq_u8(vceqq_u8(vl, vr), special));
+}
+#endif
+
+static inline size_t _z_ke_block_first(uint64_t m) { return (size_t)__builtin_ctzll(m) / _Z_KE_BLOCK_BITS_PER_BYTE; }
+static inline size_t _z_ke_block_last(uint64_t m) {
+    return (size_t)(63 - __builtin_clzll(m)) / _Z_KE_BLOCK_BITS_PER_BYTE;
+}
+
+// Number of leading bytes, over whole blocks of the first n ones, that are equal in l and r and neither a delimiter
+// nor stop
+static inline size_t _z_chunk_common_prefix_len(const char *l, const char *r, size_t n, char stop) {
+    size_t i = 0;
+    while (i + _Z_KE_BLOCK_LEN <= n) {
+        uint64_t m = _z_ke_block_stops(l + i, r + i, stop);
+        if (m != 0) {
+            return i + _z_ke_block_first(m);
+        }
+        i += _Z_KE_BLOCK_LEN;
+    }
+    return i;
+}
+
+// Same as above for the trailing bytes of the n ones preceding lend and rend
+static inline size_t _z_chunk_common_suffix_len(const char *lend, const char *rend, size_t n, char stop) {
+    size_t i = 0;
+    while (i + _Z_KE_BLOCK_LEN <= n) {
+        uint64_t m = _z_ke_block_stops(lend - i - _Z_KE_BLOCK_LEN, rend - i - _Z_KE_BLOCK_LEN, stop);
+        if (m != 0) {
+            return i + _Z_KE_BLOCK_LEN - 1 - _z_ke_block_last(m);
+        }
+        i += _Z_KE_BLOCK_LEN;
+    }
+    return i;
+}
+#else
+static inline size_t _z_chunk_common_prefix_len(const char *l, const char *r, size_t n, char stop) {
+    _ZP_UNUSED(l);
+    _ZP_UNUSED(r);
+    _ZP_UNUSED(n);
+    _ZP_UNUSED(stop);
+    return 0;
+}
+
+static inline size_t _z_chunk_common_suffix_len(const char *lend, const char *rend, size_t n, char stop) {
+    _ZP_UNUSED(lend);
+    _ZP_UNUSED(rend);
+    _ZP_UNUSED(n);
+    _ZP_UNUSED(stop);
+    return 0;
+}
+#endif
+
 static inline const char *_z_chunk_begin(const char *begin, const char *end) {
     const char *last = end - 1;
+#if Z_KEYEXPR_SIMD == 1
+    while (last + 1 - begin >= _Z_KE_BLOCK_LEN) {
+        uint64_t m = _z_ke_block_find(last + 1 - _Z_KE_BLOCK_LEN, _Z_DELIMITER);
+        if (m != 0) {
+            return last + 2 - _Z_KE_BLOCK_LEN + _z_ke_block_last(m);
+        }
+        last -= _Z_KE_BLOCK_LEN;
+    }
+#endif
     while (begin <= last && *last != _Z_DELIMITER) {
         last--;
     }
@@ -233,6 +351,11 @@ _z_chunk_forward_match_data_t _ZP_CAT(_z_chunk_forward, _ZP_KE_MATCH_OP)(const c
         return result;
     }
     // at this stage we should only care about stardsl, as the presence of verbatim or wild is already checked.
+    size_t llen = (size_t)(lkend - lbegin);
+    size_t rlen = (size_t)(rkend - rbegin);
+    size_t common = _z_chunk_common_prefix_len(lbegin, rbegin, llen < rlen ? llen : rlen, _Z_DSL0);
+    lbegin += common;
+    rbegin += common;
     while (lbegin < lkend && rbegin < rkend && *lbegin != _Z_DELIMITER && *rbegin != _Z_DELIMITER) {
         if (*lbegin == _Z_DSL0) {
             return _ZP_CAT(_z_chunk_forward_backward, _ZP_KE_MATCH_OP)(lbegin + _Z_DSL_LEN, lkend, rbegin, rkend);
@@ -342,6 +465,11 @@ _z_chunk_backward_match_data_t _ZP_CAT(_z_chunk_backward, _ZP_KE_MATCH_OP)(const
         return result;
     }
 
+    size_t llen = (size_t)(lend - lkbegin);
+    size_t rlen = (size_t)(rend - rkbegin);
+    size_t common = _z_chunk_common_suffix_len(lend, rend, llen < rlen ? llen : rlen, _Z_DSL1);
+    llast -= common;
+    rlast -= common;
     while (llast >= lkbegin && rlast >= rkbegin && *llast != _Z_DELIMITER && *rlast != _Z_DELIMITER) {
         if (*llast == _Z_DSL1) {
             return _ZP_CAT(_z_chunk_backward_forward, _ZP_KE_MATCH_OP)(lkbegin, llast + 1 - _Z_DSL_LEN, rkbegin,
@@ -83,6 +83,7 @@ typedef void (*_z_closure_sample_callback_t)(_z_sample_t *sample, void *arg);
 
 typedef struct {
     _z_declared_keyexpr_t _key;
+    _z_keyexpr_matcher_t _matcher;
     uint32_t _id;
     z_locality_t _allowed_origin;
     _z_closure_sample_callback_t _callback;
@@ -122,6 +123,7 @@ typedef void (*_z_closure_query_callback_t)(_z_query_rc_t *query, void *arg);
 
 typedef struct {
     _z_declared_keyexpr_t _key;
+    _z_keyexpr_matcher_t _matcher;
     uint32_t _id;
     _z_closure_query_callback_t _callback;
     _z_drop_handler_t _dropper;
@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_SYSTEM_COMMON_ALLOCATOR_H
+#define ZENOH_PICO_SYSTEM_COMMON_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/system/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*------------------ Pool allocator ------------------*/
+
+#ifndef ZP_POOL_ALLOCATOR_MIN_BLOCK_SIZE
+#define ZP_POOL_ALLOCATOR_MIN_BLOCK_SIZE 16
+#endif
+#ifndef ZP_POOL_ALLOCATOR_CLASS_COUNT
+#define ZP_POOL_ALLOCATOR_CLASS_COUNT 8
+#endif
+
+/**
+ * A size-class pool allocator carving fixed-size blocks out of a caller-provided memory region.
+ *
+ * Block sizes are powers of two starting at ``ZP_POOL_ALLOCATOR_MIN_BLOCK_SIZE``, over
+ * ``ZP_POOL_ALLOCATOR_CLASS_COUNT`` classes. Freed blocks are kept on a free list per class and reused, so that
+ * allocations take constant time. Larger requests, and requests made once the region is exhausted, go to the
+ * fallback allocator if there is one.
+ */
+typedef struct {
+    uint8_t *_start;
+    uint8_t *_end;
+    uint8_t *_next;
+    void *_free_lists[ZP_POOL_ALLOCATOR_CLASS_COUNT];
+    zp_allocator_t _fallback;
+    bool _has_fallback;
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_t _mutex;
+#endif
+} zp_pool_allocator_t;
+
+/**
+ * Initializes a pool allocator over a memory region.
+ *
+ * Parameters:
+ *   pool: The pool allocator to initialize.
+ *   buffer: The memory region the blocks are carved from, which must outlive the pool.
+ *   len: The size of the memory region in bytes.
+ *   fallback: The allocator serving requests the pool cannot, or NULL to make them fail.
+ *
+ * Returns:
+ *   ``0`` if successful, or a ``negative value`` otherwise.
+ */
+z_result_t zp_pool_allocator_init(zp_pool_allocator_t *pool, void *buffer, size_t len, const zp_allocator_t *fallback);
+
+/**
+ * Returns the allocator interface of a pool allocator, to be installed with zp_allocator_set().
+ */
+zp_allocator_t zp_pool_allocator(zp_pool_allocator_t *pool);
+
+/**
+ * Releases the resources of a pool allocator. Blocks still allocated from its region become invalid.
+ */
+void zp_pool_allocator_clear(zp_pool_allocator_t *pool);
+
+/*------------------ Arena allocator ------------------*/
+
+/**
+ * A bump allocator over a caller-provided memory region, meant for short-lived scratch allocations.
+ *
+ * Allocations are served in sequence from the region. Freeing or growing the most recent allocation is done in place,
+ * other frees only release memory when the arena is reset.
+ */
+typedef struct {
+    uint8_t *_start;
+    size_t _capacity;
+    size_t _offset;
+    size_t _last;
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_t _mutex;
+#endif
+} zp_arena_allocator_t;
+
+/**
+ * Initializes an arena allocator over a memory region.
+ *
+ * Parameters:
+ *   arena: The arena allocator to initialize.
+ *   buffer: The memory region allocations are served from, which must outlive the arena.
+ *   len: The size of the memory region in bytes.
+ *
+ * Returns:
+ *   ``0`` if successful, or a ``negative value`` otherwise.
+ */
+z_result_t zp_arena_allocator_init(zp_arena_allocator_t *arena, void *buffer, size_t len);
+
+/**
+ * Returns the allocator interface of an arena allocator, to be installed with zp_allocator_set().
+ */
+zp_allocator_t zp_arena_allocator(zp_arena_allocator_t *arena);
+
+/**
+ * Releases all the allocations made from an arena at once.
+ */
+void zp_arena_allocator_reset(zp_arena_allocator_t *arena);
+
+/**
+ * Returns the number of bytes of the arena region currently in use.
+ */
+size_t zp_arena_allocator_used(zp_arena_allocator_t *arena);
+
+/**
+ * Releases the resources of an arena allocator. Blocks still allocated from its region become invalid.
+ */
+void zp_arena_allocator_clear(zp_arena_allocator_t *arena);
+
+/*------------------ Tracking allocator ------------------*/
+
+/**
+ * Heap usage statistics collected by a tracking allocator.
+ *
+ * Members:
+ *   size_t allocations: Number of blocks allocated. Resizing a block does not count as an allocation.
+ *   size_t frees: Number of blocks freed. Blocks still allocated (leaked, at the end of a program) are
+ *     ``allocations - frees``.
+ *   size_t current_bytes: Number of bytes currently allocated.
+ *   size_t peak_bytes: Highest value reached by ``current_bytes``.
+ */
+typedef struct {
+    size_t allocations;
+    size_t frees;
+    size_t current_bytes;
+    size_t peak_bytes;
+} zp_allocator_stats_t;
+
+/**
+ * An allocator forwarding to another one while recording heap usage statistics.
+ */
+typedef struct {
+    zp_allocator_t _inner;
+    zp_allocator_stats_t _stats;
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_t _mutex;
+#endif
+} zp_tracking_allocator_t;
+
+/**
+ * Initializes a tracking allocator.
+ *
+ * Parameters:
+ *   tracker: The tracking allocator to initialize.
+ *   inner: The allocator serving the requests, or NULL for the platform allocator.
+ *
+ * Returns:
+ *   ``0`` if successful, or a ``negative value`` otherwise.
+ */
+z_result_t zp_tracking_allocator_init(zp_tracking_allocator_t *tracker, const zp_allocator_t *inner);
+
+/**
+ * Returns the allocator interface of a tracking allocator, to be installed with zp_allocator_set().
+ */
+zp_allocator_t zp_tracking_allocator(zp_tracking_allocator_t *tracker);
+
+/**
+ * Returns a snapshot of the statistics recorded by a tracking allocator.
+ */
+zp_allocator_stats_t zp_tracking_allocator_stats(zp_tracking_allocator_t *tracker);
+
+/**
+ * Releases the resources of a tracking allocator.
+ */
+void zp_tracking_allocator_clear(zp_tracking_allocator_t *tracker);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_SYSTEM_COMMON_ALLOCATOR_H */
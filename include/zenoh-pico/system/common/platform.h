@@ -136,6 +136,10 @@ uint64_t z_random_u64(void);
 void z_random_fill(void *buf, size_t len);
 
 /*------------------ Memory ------------------*/
+// Platform allocator, used unless another one is installed with zp_allocator_set
+void *_z_malloc(size_t size);
+void *_z_realloc(void *ptr, size_t size);
+void _z_free(void *ptr);
 
 /**
  * Allocates memory of the specified size.
@@ -168,6 +172,42 @@ void *z_realloc(void *ptr, size_t size);
  */
 void z_free(void *ptr);
 
+/**
+ * A memory allocator, as a set of functions sharing a context.
+ *
+ * Members:
+ *   void *context: The state of the allocator, passed to each function.
+ *   void *(*alloc_fn)(void *context, size_t size): Allocates a block, as z_malloc().
+ *   void *(*realloc_fn)(void *context, void *ptr, size_t size): Resizes a block, as z_realloc().
+ *   void (*free_fn)(void *context, void *ptr): Frees a block, as z_free().
+ */
+typedef struct {
+    void *context;
+    void *(*alloc_fn)(void *context, size_t size);
+    void *(*realloc_fn)(void *context, void *ptr, size_t size);
+    void (*free_fn)(void *context, void *ptr);
+} zp_allocator_t;
+
+/**
+ * Installs the allocator behind z_malloc(), z_realloc() and z_free(), and so behind every heap allocation made by
+ * zenoh-pico.
+ *
+ * Since a block must be freed by the allocator that allocated it, the allocator must be installed before any zenoh-pico
+ * object is created and replaced only once all of them have been dropped.
+ *
+ * Parameters:
+ *   allocator: The allocator to install, copied. NULL restores the platform allocator.
+ *
+ * Returns:
+ *   ``0`` if successful, or a ``negative value`` if one of the allocator functions is missing.
+ */
+z_result_t zp_allocator_set(const zp_allocator_t *allocator);
+
+/**
+ * Returns the platform allocator, to be used for instance as the fallback of a custom allocator.
+ */
+zp_allocator_t zp_allocator_platform(void);
+
 #if Z_FEATURE_MULTI_THREAD == 0
 // dummy types for correct macros work
 typedef void *_z_task_t;
@@ -44,13 +44,16 @@ typedef struct timeval z_time_t;
 typedef struct {
     union {
 #if Z_FEATURE_LINK_TCP == 1 || Z_FEATURE_LINK_UDP_MULTICAST == 1 || Z_FEATURE_LINK_UDP_UNICAST == 1 || \
-    Z_FEATURE_RAWETH_TRANSPORT == 1 || Z_FEATURE_LINK_SERIAL == 1
+    Z_FEATURE_RAWETH_TRANSPORT == 1 || Z_FEATURE_LINK_SERIAL == 1 || Z_FEATURE_LINK_UNIXSOCK == 1
         int _fd;
 #endif
     };
 #if Z_FEATURE_LINK_TLS == 1
     void *_tls_sock;  // Pointer to _z_tls_socket_t
 #endif
+#if Z_FEATURE_LINK_SHM == 1
+    void *_shm_chan;  // Shared memory channel of connected sockets
+#endif
 } _z_sys_net_socket_t;
 
 typedef struct {
@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_SYSTEM_UNIX_IO_URING_H
+#define ZENOH_PICO_SYSTEM_UNIX_IO_URING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/transport/socket.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+/**
+ * Returns true if the calling thread can wait on sockets with io_uring. The ring is set up on first use and released
+ * when the thread exits; kernels without io_uring, or with io_uring disabled, make this return false.
+ */
+bool _z_io_uring_is_available(void);
+
+/**
+ * io_uring counterpart of :c:func:`_z_socket_wait_readable`, only valid if :c:func:`_z_io_uring_is_available` returned
+ * true on the calling thread.
+ *
+ * Requests stay armed between calls, so only the sockets that were read since the previous call are resubmitted. Non
+ * blocking sockets that the calling thread reads through :c:func:`_z_io_uring_recv` are then received by a multishot
+ * request into buffers shared with the kernel, without a system call per read.
+ */
+z_result_t _z_io_uring_wait_readable(_z_socket_wait_iter_t *iter, uint32_t timeout_ms);
+
+/**
+ * Reads the data received for a socket by a multishot request of the calling thread. Returns false if there is none
+ * and the socket is to be read with recv, else true with the number of bytes read, 0 if the peer closed the
+ * connection, or SIZE_MAX on error, in rb.
+ */
+bool _z_io_uring_recv(int fd, uint8_t *ptr, size_t len, size_t *rb);
+
+/**
+ * Sends a buffer on each of the given sockets, submitting the sends together. Returns the number of sockets the whole
+ * buffer was sent on, or SIZE_MAX if io_uring is not available on the calling thread and nothing was sent.
+ */
+size_t _z_io_uring_send(const uint8_t *ptr, size_t len, _z_sys_net_socket_t *const *sockets, size_t nb);
+
+/**
+ * Must be called after a socket that may have been waited on is closed, so that poll requests armed on a file
+ * descriptor number that is then reused are not mistaken for requests on the new socket.
+ */
+void _z_io_uring_socket_closed(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_SYSTEM_UNIX_IO_URING_H */
@@ -28,6 +28,10 @@ size_t _z_read_stream_size(_z_zbuf_t *zbuf);
 // Socket is assumed to be in blocking mode with a finite timeout.
 z_result_t _z_link_recv_t_msg(_z_transport_message_t *t_msg, const _z_link_t *zl, _z_sys_net_socket_t *socket,
                               z_clock_t recv_deadline);
+#if Z_FEATURE_COMPRESSION == 1
+// Strips the batch header of a transport with compression, replacing zbf by a view on the decompressed batch if needed
+z_result_t _z_transport_rx_decompress_batch(_z_transport_common_t *ztc, _z_zbuf_t *zbf);
+#endif
 
 #ifdef __cplusplus
 }
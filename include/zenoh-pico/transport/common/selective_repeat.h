@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_TRANSPORT_SELECTIVE_REPEAT_H
+#define ZENOH_PICO_TRANSPORT_SELECTIVE_REPEAT_H
+
+#include "zenoh-pico/transport/transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+_z_transport_tx_history_t *_z_transport_tx_history_new(size_t capacity);
+void _z_transport_tx_history_free(_z_transport_tx_history_t **h);
+
+/**
+ * Keeps a copy of a sent batch, evicting the oldest ones to make room. Batches larger than the history are not kept.
+ */
+void _z_transport_tx_history_push(_z_transport_tx_history_t *h, _z_zint_t sn, const uint8_t *buf, size_t len);
+
+/**
+ * Looks up the batch sent with a given SN, returns false if it is no longer kept.
+ *
+ * The batch is only returned in `batch` if it was not already sent again during the last half NACK interval, as all
+ * the peers of a multicast group that missed it report it at once.
+ */
+bool _z_transport_tx_history_get(_z_transport_tx_history_t *h, _z_zint_t sn, _z_slice_t *batch);
+
+// Reports `count` missing SNs starting at `sn`
+typedef void (*_z_transport_nack_f)(void *arg, _z_zint_t sn, _z_zint_t count);
+
+// Destination of the NACKs of a reorder window, used with `_z_transport_nack_send`
+typedef struct {
+    const _z_link_t *_link;
+    _z_id_t _zid;
+} _z_transport_nack_target_t;
+
+void _z_transport_nack_send(void *target, _z_zint_t sn, _z_zint_t count);
+
+typedef enum {
+    // The message is the next one, or an old one to drop, and is handled as usual
+    _Z_TRANSPORT_RX_HANDLE = 0,
+    // The message is ahead of a gap and was held
+    _Z_TRANSPORT_RX_HELD = 1,
+    // The message is too far ahead: the held ones are handled without waiting for the gap, then the message
+    _Z_TRANSPORT_RX_FLUSH = 2,
+} _z_transport_rx_verdict_t;
+
+_z_transport_rx_reorder_t *_z_transport_rx_reorder_new(size_t capacity);
+void _z_transport_rx_reorder_free(_z_transport_rx_reorder_t **r);
+void _z_transport_rx_reorder_reset(_z_transport_rx_reorder_t *r);
+
+/**
+ * Tells what to do with a reliable frame or fragment given the last SN received in order. A held message gets its
+ * own copy of its payload, the caller still clears the original one.
+ *
+ * The SNs missing before a held message are reported through `nack` the first time they are seen missing.
+ */
+_z_transport_rx_verdict_t _z_transport_rx_reorder_accept(_z_transport_rx_reorder_t *r, _z_zint_t sn_res,
+                                                         _z_zint_t last_sn, const _z_transport_message_t *t_msg,
+                                                         _z_transport_nack_f nack, void *arg);
+
+/**
+ * Moves out the held message with a given SN. A frame payload then points to `zbf`, to be cleared by the caller once
+ * the message is handled.
+ */
+bool _z_transport_rx_reorder_take(_z_transport_rx_reorder_t *r, _z_zint_t sn, _z_transport_message_t *t_msg,
+                                  _z_zbuf_t *zbf);
+
+/**
+ * Gets the SN of the oldest held message, returns false if none is held.
+ */
+bool _z_transport_rx_reorder_first(const _z_transport_rx_reorder_t *r, _z_zint_t sn_res, _z_zint_t last_sn,
+                                   _z_zint_t *sn);
+
+/**
+ * Reports the SNs still missing once per NACK interval. Returns true once the gap is given up on after
+ * Z_TRANSPORT_NACK_RETRIES reports, the held messages must then be handled without the missing ones.
+ */
+bool _z_transport_rx_reorder_poll(_z_transport_rx_reorder_t *r, _z_zint_t sn_res, _z_zint_t last_sn,
+                                  _z_transport_nack_f nack, void *arg);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_TRANSPORT_SELECTIVE_REPEAT_H */
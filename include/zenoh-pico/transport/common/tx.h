@@ -23,6 +23,21 @@
 extern "C" {
 #endif
 
+static inline bool _z_transport_tx_get_express_status(const _z_network_message_t *msg) {
+    switch (msg->_tag) {
+        case _Z_N_DECLARE:
+            return _Z_HAS_FLAG(msg->_body._declare._ext_qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
+        case _Z_N_PUSH:
+            return _Z_HAS_FLAG(msg->_body._push._qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
+        case _Z_N_REQUEST:
+            return _Z_HAS_FLAG(msg->_body._request._ext_qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
+        case _Z_N_RESPONSE:
+            return _Z_HAS_FLAG(msg->_body._response._ext_qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
+        default:
+            return false;
+    }
+}
+
 void __unsafe_z_prepare_wbuf(_z_wbuf_t *buf, uint8_t link_flow_capability);
 void __unsafe_z_finalize_wbuf(_z_wbuf_t *buf, uint8_t link_flow_capability);
 /*This function is unsafe because it operates in potentially concurrent
@@ -38,7 +53,17 @@ z_result_t _z_send_t_msg(_z_transport_t *zt, const _z_transport_message_t *t_msg
 z_result_t _z_link_send_t_msg(const _z_link_t *zl, const _z_transport_message_t *t_msg, _z_sys_net_socket_t *socket);
 z_result_t _z_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg, z_reliability_t reliability,
                          z_congestion_control_t cong_ctrl, void *peer);
+// Sends the messages in as few batches as they fit, flushed before returning
+z_result_t _z_send_n_msgs(_z_session_t *zn, const _z_network_message_t *n_msgs, size_t count,
+                          z_reliability_t reliability, z_congestion_control_t cong_ctrl);
 z_result_t _z_send_n_batch(_z_session_t *zn, z_congestion_control_t cong_ctrl);
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+/**
+ * Sends again the reliable batches of `count` SNs starting at `sn`, as reported missing by a peer. SNs that are no
+ * longer kept are sent as empty frames.
+ */
+z_result_t _z_transport_tx_retransmit(_z_transport_common_t *ztc, _z_zint_t sn, _z_zint_t count);
+#endif
 
 #ifdef __cplusplus
 }
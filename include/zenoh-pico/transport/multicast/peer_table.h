@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_MULTICAST_PEER_TABLE_H
+#define ZENOH_PICO_MULTICAST_PEER_TABLE_H
+
+#include "zenoh-pico/transport/transport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if Z_FEATURE_MULTICAST_TRANSPORT == 1 || Z_FEATURE_RAWETH_TRANSPORT == 1
+void _z_multicast_peer_table_init(_z_multicast_peer_table_t *table);
+void _z_multicast_peer_table_clear(_z_multicast_peer_table_t *table);
+
+/**
+ * Tracks a peer whose remote address and lease are set. Its first lease check is due one lease from now.
+ *
+ * The peer must stay at the same address until it is removed.
+ */
+z_result_t _z_multicast_peer_table_add(_z_multicast_peer_table_t *table, _z_transport_peer_multicast_t *peer);
+void _z_multicast_peer_table_remove(_z_multicast_peer_table_t *table, _z_transport_peer_multicast_t *peer);
+bool _z_multicast_peer_table_contains(const _z_transport_peer_multicast_t *peer);
+_z_transport_peer_multicast_t *_z_multicast_peer_table_find(const _z_multicast_peer_table_t *table,
+                                                            const _z_slice_t *remote_addr);
+
+/**
+ * Updates the lease of a tracked peer, bringing its next lease check forward if the lease got shorter.
+ */
+void _z_multicast_peer_table_set_lease(_z_multicast_peer_table_t *table, _z_transport_peer_multicast_t *peer,
+                                       _z_zint_t lease);
+_z_zint_t _z_multicast_peer_table_min_lease(_z_multicast_peer_table_t *table, _z_zint_t local_lease);
+
+/**
+ * Runs the lease checks that are due. A peer that received data since its previous check is given another lease,
+ * the others are removed from the table and expired is set.
+ *
+ * Returns the time in ms until the next check is due, at most max_wait.
+ */
+unsigned long _z_multicast_peer_table_check_leases(_z_multicast_peer_table_t *table, unsigned long max_wait,
+                                                   bool *expired);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_MULTICAST_PEER_TABLE_H */
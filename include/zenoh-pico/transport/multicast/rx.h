@@ -26,6 +26,13 @@ z_result_t _z_multicast_recv_t_msg(_z_transport_multicast_t *ztm, _z_transport_m
 z_result_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm, _z_transport_message_t *t_msg,
                                                  _z_slice_t *addr);
 z_result_t _z_multicast_update_rx_buffer(_z_transport_multicast_t *ztm);
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+/**
+ * Reports again the reliable messages still missing from each peer, or gives up on them once they were reported
+ * Z_TRANSPORT_NACK_RETRIES times and handles the messages held after them.
+ */
+z_result_t _z_multicast_poll_held(_z_transport_multicast_t *ztm);
+#endif
 
 #ifdef __cplusplus
 }
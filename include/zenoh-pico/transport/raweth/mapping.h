@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_RAWETH_MAPPING_H
+#define ZENOH_PICO_RAWETH_MAPPING_H
+
+#include "zenoh-pico/link/transport/raweth.h"
+#include "zenoh-pico/session/keyexpr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if Z_FEATURE_RAWETH_TRANSPORT == 1
+/**
+ * Precompiles the lookup of a destination mapping: entries without wildcards are hashed by key expression, the others
+ * are matched with precompiled matchers. Returns NULL if it could not be built, in which case the mapping is scanned.
+ *
+ * The index refers to the key expressions of the mapping, which must outlive it.
+ */
+_zp_raweth_mapping_index_t *_zp_raweth_mapping_index_new(const _zp_raweth_mapping_array_t *mapping);
+void _zp_raweth_mapping_index_free(_zp_raweth_mapping_index_t **index);
+
+/**
+ * Returns the position of the first entry of the mapping that intersects keyexpr, or SIZE_MAX if there is none.
+ */
+size_t _zp_raweth_mapping_index_find(const _zp_raweth_mapping_index_t *index,
+                                     const _zp_raweth_mapping_array_t *mapping, const _z_keyexpr_t *keyexpr);
+
+/**
+ * Entries found for the key expressions declared by the session, by resource id. Ids are reused once undeclared, so
+ * an id must be forgotten when it is declared or undeclared.
+ */
+bool _zp_raweth_mapping_index_cache_get(const _zp_raweth_mapping_index_t *index, uint16_t id, size_t *pos);
+void _zp_raweth_mapping_index_cache_insert(_zp_raweth_mapping_index_t *index, uint16_t id, size_t pos);
+void _zp_raweth_mapping_index_cache_forget(_zp_raweth_mapping_index_t *index, uint16_t id);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_RAWETH_MAPPING_H */
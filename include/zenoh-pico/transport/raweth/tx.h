@@ -26,6 +26,7 @@ z_result_t _z_raweth_link_send_t_msg(const _z_link_t *zl, const _z_transport_mes
 z_result_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *z_msg, z_reliability_t reliability,
                                 z_congestion_control_t cong_ctrl);
 z_result_t _z_raweth_send_t_msg(_z_transport_common_t *ztc, const _z_transport_message_t *t_msg);
+z_result_t _z_raweth_send_n_batch(_z_session_t *zn, z_congestion_control_t cong_ctrl);
 
 #ifdef __cplusplus
 }
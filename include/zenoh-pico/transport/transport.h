@@ -19,6 +19,7 @@
 #include <stdint.h>
 
 #include "zenoh-pico/collections/element.h"
+#include "zenoh-pico/collections/hashmap.h"
 #include "zenoh-pico/collections/refcount.h"
 #include "zenoh-pico/collections/slice.h"
 #include "zenoh-pico/collections/string.h"
@@ -28,6 +29,7 @@
 #include "zenoh-pico/protocol/definitions/transport.h"
 #include "zenoh-pico/runtime/runtime.h"
 #include "zenoh-pico/session/weak_session.h"
+#include "zenoh-pico/utils/lz4.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +49,47 @@ enum _z_batching_state_e {
 // Forward declaration to avoid cyclical include
 typedef _z_slist_t _z_resource_slist_t;
 
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+// Maximum number of batches kept in a TX history, whatever their size
+#define _Z_TRANSPORT_TX_HISTORY_RECORDS 64
+
+typedef struct {
+    _z_zint_t _sn;
+    size_t _offset;
+    size_t _len;
+    bool _resent;
+    z_clock_t _resent_time;
+} _z_transport_tx_record_t;
+
+// Last reliable batches sent on a datagram link, kept in a byte ring to be sent again if a peer misses them
+typedef struct {
+    uint8_t *_buf;
+    size_t _capacity;
+    size_t _head;
+    _z_transport_tx_record_t _records[_Z_TRANSPORT_TX_HISTORY_RECORDS];
+    size_t _first;
+    size_t _len;
+} _z_transport_tx_history_t;
+
+// Reliable message received after a gap, with its own copy of the frame payload
+typedef struct {
+    bool _used;
+    _z_transport_message_t _msg;
+    _z_zbuf_t _zbuf;
+} _z_transport_rx_held_t;
+
+// Reliable messages of a peer held until the missing ones before them are sent again
+typedef struct {
+    _z_transport_rx_held_t *_slots;
+    size_t _capacity;
+    size_t _held;
+    // First SN not reported missing yet, and state of the NACKs of the current gap
+    _z_zint_t _nack_next;
+    uint8_t _nack_rounds;
+    z_clock_t _nack_time;
+} _z_transport_rx_reorder_t;
+#endif
+
 typedef struct {
     _z_id_t _remote_zid;
     z_whatami_t _remote_whatami;
@@ -65,6 +108,9 @@ typedef struct {
     // Patch
     uint8_t _patch;
 #endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    _z_transport_rx_reorder_t *_rx_reorder;
+#endif
 } _z_transport_peer_common_t;
 
 #if Z_FEATURE_CONNECTIVITY == 1
@@ -95,6 +141,9 @@ typedef struct {
     // SN numbers
     _z_zint_t _sn_res;
     volatile _z_zint_t _lease;
+    // Next lease check, in ms of the peer table clock, and position in the lease heap
+    unsigned long _lease_deadline;
+    size_t _lease_heap_idx;
 } _z_transport_peer_multicast_t;
 
 size_t _z_transport_peer_multicast_size(const _z_transport_peer_multicast_t *src);
@@ -129,6 +178,9 @@ typedef struct {
     uint8_t flow_state;
     uint16_t flow_curr_size;
     _z_zbuf_t flow_buff;
+    // Position among the links to the same remote peer, and number of such links
+    uint16_t _link_idx;
+    uint16_t _link_nb;
 } _z_transport_peer_unicast_t;
 
 void _z_transport_peer_unicast_clear(_z_transport_peer_unicast_t *src);
@@ -142,6 +194,15 @@ _Z_SLIST_DEFINE(_z_transport_peer_unicast, _z_transport_peer_unicast_t, true)
 
 #define _Z_RES_POOL_INIT_SIZE 8  // Arbitrary small value
 
+typedef enum {
+    _Z_STRIPING_NONE = 0,
+    _Z_STRIPING_PRIORITY = 1,
+    _Z_STRIPING_KEYEXPR = 2,
+} _z_striping_mode_t;
+
+// Lane of the messages sent on every link of a peer
+#define _Z_STRIPING_LANE_ALL SIZE_MAX
+
 typedef enum _z_transport_state_t {
     _Z_TRANSPORT_STATE_CLOSED = 0,
     _Z_TRANSPORT_STATE_RECONNECTING = 1,
@@ -163,6 +224,21 @@ typedef struct _z_transport_tasks_t {
 } _z_transport_tasks_t;
 #endif
 
+#if Z_FEATURE_COMPRESSION == 1
+// Batch compression state, only allocated when compression was negotiated for the transport
+typedef struct {
+    uint32_t _table[_Z_LZ4_TABLE_SIZE];
+    // Compressed TX batch, copied back into the transport wbuf if smaller
+    uint8_t *_tx_buf;
+    size_t _tx_capacity;
+    // Decompressed RX batch
+    _z_zbuf_t _zbuf;
+} _z_transport_compression_t;
+
+_z_transport_compression_t *_z_transport_compression_new(size_t batch_size);
+void _z_transport_compression_free(_z_transport_compression_t **c);
+#endif
+
 typedef struct {
     _z_session_weak_t _session;
     _z_link_t *_link;
@@ -190,6 +266,24 @@ typedef struct {
 #if Z_FEATURE_AUTO_RECONNECT == 1
     _z_transport_tasks_t _tasks;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    _z_transport_compression_t *_compression;
+#endif
+#if Z_FEATURE_FRAGMENTATION == 1
+    // Gathers the fragments of a message for links with segmentation offload, allocated on first use
+    uint8_t *_tx_train_buf;
+#endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    // Only allocated when selective repeat is enabled, with the SN and reliability of the batch being built
+    _z_transport_tx_history_t *_tx_history;
+    _z_zint_t _tx_batch_sn;
+    bool _tx_batch_reliable;
+#endif
+#if Z_FEATURE_UNICAST_PEER == 1
+    // How messages are spread over the links to a same peer, and lane of the batch being built
+    uint8_t _striping;
+    size_t _tx_lane;
+#endif
 } _z_transport_common_t;
 
 // Send function prototype
@@ -233,6 +327,20 @@ typedef struct {
 
 #define _Z_MULTICAST_ADDR_BUFF_SIZE 32  // Arbitrary size that must be able to contain any link address.
 
+// Lookup structures over the peers of a multicast transport, which remain owned by its peer list
+typedef struct {
+    // Peers by remote address
+    _z_hashmap_t _by_addr;
+    // Binary min-heap of the peers, ordered by lease deadline
+    _z_transport_peer_multicast_t **_lease_heap;
+    size_t _lease_heap_len;
+    size_t _lease_heap_capacity;
+    z_clock_t _lease_clock;
+    // Shortest lease of the peers, recomputed when stale
+    _z_zint_t _min_lease;
+    bool _min_lease_stale;
+} _z_multicast_peer_table_t;
+
 typedef struct _z_transport_multicast_t {
     _z_transport_common_t _common;
     // Persistent source address associated with the current contents of _zbuf.
@@ -241,6 +349,7 @@ typedef struct _z_transport_multicast_t {
     _z_slice_t _zbuf_addr;
     // Known valid peers
     _z_transport_peer_multicast_slist_t *_peers;
+    _z_multicast_peer_table_t _peer_table;
     // T message send function
     _zp_f_send_tmsg _send_f;
 } _z_transport_multicast_t;
@@ -276,6 +385,9 @@ typedef struct {
 #if Z_FEATURE_FRAGMENTATION == 1
     uint8_t _patch;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    bool _compression;
+#endif
 } _z_transport_unicast_establish_param_t;
 
 typedef struct {
@@ -286,6 +398,7 @@ typedef struct {
 z_result_t _z_transport_peer_unicast_add(_z_transport_unicast_t *ztu, _z_transport_unicast_establish_param_t *param,
                                          _z_sys_net_socket_t socket, bool owns_socket,
                                          _z_transport_peer_unicast_t **output_peer);
+void _z_transport_peer_unicast_group_links(_z_transport_peer_unicast_slist_t *peers);
 _z_transport_common_t *_z_transport_get_common(_z_transport_t *zt);
 size_t _z_transport_get_peers_count(_z_transport_t *zt);
 z_result_t _z_transport_close(_z_transport_t *zt, uint8_t reason);
@@ -15,6 +15,7 @@
 #ifndef ZENOH_PICO_UTILS_LOGGING_H
 #define ZENOH_PICO_UTILS_LOGGING_H
 
+#include <stddef.h>
 #include <stdio.h>
 
 #include "zenoh-pico/system/common/platform.h"
@@ -47,6 +48,23 @@ extern "C" {
 #endif
 #endif
 
+#if Z_FEATURE_ASYNC_LOG == 1
+/*-------- Asynchronous logging backend --------*/
+// Once started, records are formatted by the caller into a preallocated ring and written to the sink by a background
+// task, so that logging never blocks on I/O. Records are dropped and counted when the ring is full. Before the backend
+// is started, or after it is stopped, records are written synchronously with ZENOH_LOG_PRINT.
+typedef void (*_z_log_sink_f)(const char *record, size_t len, void *arg);
+
+// A NULL sink writes the records with ZENOH_LOG_PRINT
+z_result_t _z_log_async_start(_z_log_sink_f sink, void *arg);
+// Writes the pending records before returning
+z_result_t _z_log_async_stop(void);
+size_t _z_log_async_dropped(void);
+void _z_log_write(const char *level, const char *func, bool newline, const char *fmt, ...);
+
+#define _Z_LOG(level, ...) _z_log_write(#level, __func__, true, __VA_ARGS__)
+#define _Z_LOG_NONL(level, ...) _z_log_write(#level, __func__, false, __VA_ARGS__)
+#else
 // Logging macros
 #define _Z_LOG(level, ...)                                               \
     do {                                                                 \
@@ -64,6 +82,7 @@ extern "C" {
         ZENOH_LOG_PRINT("[%s " #level " ::%s] ", __timestamp, __func__); \
         ZENOH_LOG_PRINT(__VA_ARGS__);                                    \
     } while (false)
+#endif
 // In debug build, if a level is not enabled, the following macro is used instead
 // in order to check that the arguments are valid and compile fine.
 #define _Z_CHECK_LOG(...)                        \
@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#ifndef ZENOH_PICO_UTILS_LZ4_H
+#define ZENOH_PICO_UTILS_LZ4_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zenoh-pico/utils/result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*-------- LZ4 block format codec --------*/
+// Blocks are compatible with the reference LZ4 implementation, without the frame format around them: the original
+// length has to be known by the decompressor. Matches are looked up in a single hash table of 1 << _Z_LZ4_HASH_LOG
+// entries, provided by the caller to keep the compressor off the stack.
+#ifndef _Z_LZ4_HASH_LOG
+#define _Z_LZ4_HASH_LOG 10
+#endif
+#define _Z_LZ4_TABLE_SIZE ((size_t)1 << _Z_LZ4_HASH_LOG)
+
+// Worst case compressed size of len bytes
+static inline size_t _z_lz4_compress_bound(size_t len) { return len + len / 255 + 16; }
+
+// Returns the compressed size, or 0 if it does not fit in dst_cap bytes. table holds _Z_LZ4_TABLE_SIZE entries.
+size_t _z_lz4_compress(uint8_t *dst, size_t dst_cap, const uint8_t *src, size_t len, uint32_t *table);
+// Fails on malformed blocks or if the decompressed data does not fit in dst_cap bytes
+z_result_t _z_lz4_decompress(uint8_t *dst, size_t dst_cap, const uint8_t *src, size_t len, size_t *out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZENOH_PICO_UTILS_LZ4_H */
@@ -332,6 +332,13 @@ static z_result_t _ze_admin_space_encode_link(_z_json_encoder_t *je, const _z_li
         case _Z_LINK_TYPE_RAWETH:
             _Z_RETURN_IF_ERR(_z_json_encoder_write_string(je, "raweth"));
             break;
+        case _Z_LINK_TYPE_UNIXSOCK:
+            _Z_RETURN_IF_ERR(_z_json_encoder_write_string(
+                je, (link->_cap._flow == Z_LINK_CAP_FLOW_STREAM) ? "unixsock-stream" : "unixsock-dgram"));
+            break;
+        case _Z_LINK_TYPE_SHM:
+            _Z_RETURN_IF_ERR(_z_json_encoder_write_string(je, "shm"));
+            break;
         default:
             return _Z_ERR_INVALID;
     }
@@ -76,6 +76,11 @@ z_result_t _ze_undeclare_advanced_publisher_clear(_ze_advanced_publisher_t *pub)
         _Z_ERROR_RETURN(_Z_ERR_ENTITY_UNKNOWN);
     }
 
+    // Cached samples alias the publisher keyexpr, release them first
+    if (pub->_cache != NULL) {
+        _ze_advanced_cache_free(&pub->_cache);
+    }
+
     z_result_t ret = z_undeclare_publisher(z_publisher_move(&pub->_publisher));
 
     if (pub->_has_liveliness) {
@@ -87,9 +92,6 @@ z_result_t _ze_undeclare_advanced_publisher_clear(_ze_advanced_publisher_t *pub)
         _ze_advanced_publisher_state_rc_drop(&pub->_state);
     }
 
-    if (pub->_cache != NULL) {
-        _ze_advanced_cache_free(&pub->_cache);
-    }
     *pub = _ze_advanced_publisher_null();
     return ret;
 }
@@ -1344,6 +1344,9 @@ void z_put_options_default(z_put_options_t *options) {
     options->reliability = Z_RELIABILITY_DEFAULT;
     options->source_info = NULL;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    options->compression = false;
+#endif
 }
 
 void z_delete_options_default(z_delete_options_t *options) {
@@ -1382,6 +1385,18 @@ z_result_t z_put(const z_loaned_session_t *zs, const z_loaned_keyexpr_t *keyexpr
     z_locality_t allowed_destination = z_locality_default();
 #if Z_FEATURE_LOCAL_SUBSCRIBER == 1
     allowed_destination = opt.allowed_destination;
+#endif
+#if Z_FEATURE_COMPRESSION == 1
+    _z_encoding_t default_encoding = _z_encoding_null();
+    if (opt.compression && (payload_bytes != NULL)) {
+        if (encoding == NULL) {
+            encoding = &default_encoding;
+        }
+        // Best effort, the payload is sent as is if it can't be compressed
+        if (_z_sample_payload_compress(NULL, payload_bytes, encoding) != _Z_RES_OK) {
+            _Z_WARN("Failed to compress payload, sending it uncompressed");
+        }
+    }
 #endif
     ret = _z_write(_Z_RC_IN_VAL(zs), keyexpr, payload_bytes, encoding, Z_SAMPLE_KIND_PUT, opt.congestion_control,
                    opt.priority, opt.is_express, opt.timestamp, attachment_bytes, reliability, source_info,
@@ -1429,6 +1444,9 @@ void z_publisher_options_default(z_publisher_options_t *options) {
 #ifdef Z_FEATURE_UNSTABLE_API
     options->reliability = Z_RELIABILITY_DEFAULT;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    options->compression = false;
+#endif
 }
 
 z_result_t z_declare_publisher(const z_loaned_session_t *zs, z_owned_publisher_t *pub,
@@ -1453,6 +1471,16 @@ z_result_t z_declare_publisher(const z_loaned_session_t *zs, z_owned_publisher_t
                              opt.congestion_control, opt.priority, opt.is_express, reliability, allowed_destination);
     _Z_SET_IF_OK(res, _z_write_filter_create(zs, &pub->_val._filter, &pub->_val._key, _Z_INTEREST_FLAG_SUBSCRIBERS,
                                              false, allowed_destination));
+#if Z_FEATURE_COMPRESSION == 1
+    // Compression scratch space is reused by every put of the publisher
+    if ((res == _Z_RES_OK) && opt.compression) {
+        pub->_val._compressor = _z_payload_compressor_new();
+        if (pub->_val._compressor == NULL) {
+            _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+            res = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+    }
+#endif
     if (res != _Z_RES_OK) {
         _z_publisher_drop(&pub->_val);
     }
@@ -1527,24 +1555,15 @@ z_result_t _z_publisher_put_impl(const z_loaned_publisher_t *pub, z_moved_bytes_
         _z_bytes_t *attachment_bytes = _z_bytes_from_moved(opt.attachment);
 #if Z_FEATURE_ADVANCED_PUBLICATION == 1
         if (cache != NULL) {
-            _z_timestamp_t local_timestamp = (opt.timestamp != NULL) ? *opt.timestamp : _z_timestamp_null();
-            _z_source_info_t local_source_info = (source_info != NULL) ? *source_info : _z_source_info_null();
-            _z_bytes_t local_payload = (payload_bytes != NULL) ? *payload_bytes : _z_bytes_null();
-            _z_bytes_t local_attachment = (attachment_bytes != NULL) ? *attachment_bytes : _z_bytes_null();
-
-            _z_sample_t sample;
-            z_result_t res = _z_sample_copy_data(
-                &sample, &pub->_key, &local_payload, &local_timestamp, &encoding, Z_SAMPLE_KIND_PUT,
+            // The cache aliases the publisher keyexpr, which outlives it, and shares the payload slices
+            _z_declared_keyexpr_t cache_key = pub->_key;
+            cache_key._inner = _z_keyexpr_alias(&pub->_key._inner);
+            z_result_t res = _ze_advanced_cache_add(
+                cache, &cache_key, payload_bytes, opt.timestamp, &encoding, Z_SAMPLE_KIND_PUT,
                 _z_n_qos_make(pub->_is_express, pub->_congestion_control == Z_CONGESTION_CONTROL_BLOCK, pub->_priority),
-                &local_attachment, reliability, &local_source_info);
-            if (res == _Z_RES_OK) {
-                res = _ze_advanced_cache_add(cache, &sample);
-                if (res != _Z_RES_OK) {
-                    _Z_ERROR("Failed to add sample to advanced publisher cache: %i", res);
-                    _z_sample_clear(&sample);
-                }
-            } else {
-                _Z_ERROR("Failed to create sample from data: %i", res);
+                attachment_bytes, reliability, source_info);
+            if (res != _Z_RES_OK) {
+                _Z_ERROR("Failed to add sample to advanced publisher cache: %i", res);
             }
         }
 #endif
@@ -1554,6 +1573,13 @@ z_result_t _z_publisher_put_impl(const z_loaned_publisher_t *pub, z_moved_bytes_
             session->_tp._type == _Z_TRANSPORT_MULTICAST_TYPE ||
 #endif
             !_z_write_filter_active(&pub->_filter)) {
+#if Z_FEATURE_COMPRESSION == 1
+            // Compressed after caching, late joiners get the original payload through queries
+            if ((pub->_compressor != NULL) && (payload_bytes != NULL) &&
+                (_z_sample_payload_compress(pub->_compressor, payload_bytes, &encoding) != _Z_RES_OK)) {
+                _Z_WARN("Failed to compress payload, sending it uncompressed");
+            }
+#endif
             // Write value
             ret = _z_write(session, &pub->_key, payload_bytes, &encoding, Z_SAMPLE_KIND_PUT, pub->_congestion_control,
                            pub->_priority, pub->_is_express, opt.timestamp, attachment_bytes, reliability, source_info,
@@ -1626,24 +1652,14 @@ z_result_t _z_publisher_delete_impl(const z_loaned_publisher_t *pub, const z_pub
     }
 #if Z_FEATURE_ADVANCED_PUBLICATION == 1
     if (cache != NULL) {
-        _z_timestamp_t cache_timestamp = (opt.timestamp != NULL) ? *opt.timestamp : _z_timestamp_null();
-        _z_source_info_t cache_source_info = (source_info != NULL) ? *source_info : _z_source_info_null();
-        _z_bytes_t payload_bytes = _z_bytes_null();
-        _z_bytes_t attachment_bytes = _z_bytes_null();
-
-        _z_sample_t sample;
-        z_result_t res = _z_sample_copy_data(
-            &sample, &pub->_key, &payload_bytes, &cache_timestamp, NULL, Z_SAMPLE_KIND_DELETE,
+        _z_declared_keyexpr_t cache_key = pub->_key;
+        cache_key._inner = _z_keyexpr_alias(&pub->_key._inner);
+        z_result_t res = _ze_advanced_cache_add(
+            cache, &cache_key, NULL, opt.timestamp, NULL, Z_SAMPLE_KIND_DELETE,
             _z_n_qos_make(pub->_is_express, pub->_congestion_control == Z_CONGESTION_CONTROL_BLOCK, pub->_priority),
-            &attachment_bytes, reliability, &cache_source_info);
-        if (res == _Z_RES_OK) {
-            res = _ze_advanced_cache_add(cache, &sample);
-            if (res != _Z_RES_OK) {
-                _Z_ERROR("Failed to add sample to advanced publisher cache: %i", res);
-                _z_sample_clear(&sample);
-            }
-        } else {
-            _Z_ERROR("Failed to create sample from data: %i", res);
+            NULL, reliability, source_info);
+        if (res != _Z_RES_OK) {
+            _Z_ERROR("Failed to add sample to advanced publisher cache: %i", res);
         }
     }
 #endif
@@ -2581,6 +2597,14 @@ void zp_spin_once(const z_loaned_session_t *zs) {
 }
 #endif
 
+#if Z_FEATURE_ASYNC_LOG == 1
+z_result_t zp_log_async_start(zp_log_sink_t sink, void *arg) { return _z_log_async_start(sink, arg); }
+
+z_result_t zp_log_async_stop(void) { return _z_log_async_stop(); }
+
+size_t zp_log_async_dropped(void) { return _z_log_async_dropped(); }
+#endif
+
 #ifdef Z_FEATURE_UNSTABLE_API
 z_reliability_t z_reliability_default(void) { return Z_RELIABILITY_DEFAULT; }
 #endif
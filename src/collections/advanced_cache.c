@@ -20,6 +20,8 @@
 #include <string.h>
 
 #include "zenoh-pico/api/primitives.h"
+#include "zenoh-pico/collections/seqnumber.h"
+#include "zenoh-pico/net/primitives.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 #include "zenoh-pico/utils/query_params.h"
@@ -119,93 +121,312 @@ static bool _ze_advanced_cache_range_contains(const _ze_advanced_cache_range_t *
             (range->end == _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_RANGE_UNBOUNDED || sn <= range->end));
 }
 
-static void _ze_advanced_cache_query_handler(z_loaned_query_t *query, void *ctx) {
-    _ze_advanced_cache_t *cache = (_ze_advanced_cache_t *)ctx;
+static inline _z_sample_t *_ze_advanced_cache_at(const _ze_advanced_cache_t *cache, size_t idx) {
+    return &cache->_slots[(cache->_head + idx) % cache->_capacity];
+}
 
-    z_view_string_t param_str;
-    z_query_parameters(query, &param_str);
+static inline bool _ze_advanced_cache_time_inverted(const _z_sample_t *prev, const _z_sample_t *next) {
+    return !_z_timestamp_check(&prev->timestamp) || !_z_timestamp_check(&next->timestamp) ||
+           next->timestamp.time < prev->timestamp.time;
+}
 
-    _ze_advanced_cache_query_parameters_t params;
-    _ze_advanced_cache_query_parse_parameters(&params, z_view_string_loan(&param_str));
+static size_t _ze_advanced_cache_count_time_disorder(const _ze_advanced_cache_t *cache) {
+    size_t count = 0;
+    for (size_t i = 1; i < cache->_len; i++) {
+        if (_ze_advanced_cache_time_inverted(_ze_advanced_cache_at(cache, i - 1), _ze_advanced_cache_at(cache, i))) {
+            count++;
+        }
+    }
+    return count;
+}
 
-    _z_time_since_epoch now;
-    z_result_t res = _z_get_time_since_epoch(&now);
-    if (res != _Z_RES_OK) {
-        _Z_ERROR("Dropped advanced cache query - failed to determine current system time: %i", res);
-        return;
+// Returns the first index in [lo, hi) whose sequence number is strictly greater than sn (or greater or equal if
+// inclusive is false). Requires entries in [lo, hi) to be in ascending sequence number order.
+static size_t _ze_advanced_cache_sn_search(const _ze_advanced_cache_t *cache, size_t lo, size_t hi, uint32_t sn,
+                                           bool inclusive) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint32_t mid_sn = _ze_advanced_cache_at(cache, mid)->source_info._source_sn;
+        if (mid_sn < sn || (inclusive && mid_sn == sn)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
     }
-    _z_ntp64_t now_ntp64 = _z_timestamp_ntp64_from_time(now.secs, now.nanos);
+    return lo;
+}
 
-#if Z_FEATURE_MULTI_THREAD == 1
-    res = _z_mutex_lock(&cache->_outbox_mutex);
-    if (res != _Z_RES_OK) {
-        _Z_ERROR("Dropped advanced cache query - failed to lock outbox mutex: %i", res);
+// Narrows [*lo, *hi) to the entries whose sequence number lies within range.
+static void _ze_advanced_cache_sn_bounds(const _ze_advanced_cache_t *cache, const _ze_advanced_cache_range_t *range,
+                                         size_t *lo, size_t *hi) {
+    if (cache->_len == 0) {
         return;
     }
-    res = _z_mutex_lock(&cache->_mutex);
-    if (res != _Z_RES_OK) {
-        _Z_ERROR("Dropped advanced cache query - failed to lock mutex: %i", res);
-        _z_mutex_unlock(&cache->_outbox_mutex);
+    uint32_t first = _ze_advanced_cache_at(cache, 0)->source_info._source_sn;
+    uint32_t last = _ze_advanced_cache_at(cache, cache->_len - 1)->source_info._source_sn;
+    if (last < first) {
+        // Sequence numbers wrapped around within the cache, entries are not ordered by absolute value
         return;
     }
-#endif
-    size_t cap = _z_sample_ring_capacity(&cache->_cache);
-    size_t max = (params.max != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_MAX_UNBOUNDED) ? params.max : cap;
-    if (max > cap) max = cap;
-    if (max > cache->_outbox_cap) max = cache->_outbox_cap;
+    size_t start = 0;
+    size_t end = cache->_len;
+    if ((size_t)(last - first) == cache->_len - 1) {
+        // Contiguous sequence numbers: index is the offset from the oldest sequence number
+        if (range->start != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_RANGE_UNBOUNDED && range->start > first) {
+            start = (size_t)(range->start - first);
+            if (start > cache->_len) start = cache->_len;
+        }
+        if (range->end != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_RANGE_UNBOUNDED) {
+            end = (range->end < first) ? 0 : (size_t)(range->end - first) + 1;
+            if (end > cache->_len) end = cache->_len;
+        }
+    } else {
+        if (range->start != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_RANGE_UNBOUNDED) {
+            start = _ze_advanced_cache_sn_search(cache, 0, cache->_len, (uint32_t)range->start, false);
+        }
+        if (range->end != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_RANGE_UNBOUNDED) {
+            end = _ze_advanced_cache_sn_search(cache, start, cache->_len, (uint32_t)range->end, true);
+        }
+    }
+    if (start > *lo) *lo = start;
+    if (end < *hi) *hi = end;
+}
+
+// Returns the first index in [lo, hi) whose timestamp satisfies bound if bound is a start bound, or violates it if
+// bound is an end bound. Requires entries in [lo, hi) to be in ascending timestamp order.
+static size_t _ze_advanced_cache_time_search(const _ze_advanced_cache_t *cache, size_t lo, size_t hi,
+                                             const _z_time_range_t *bound, bool is_start, _z_ntp64_t now) {
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        bool contained = _z_time_range_contains_at_time(bound, _ze_advanced_cache_at(cache, mid)->timestamp.time, now);
+        if (contained != is_start) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Narrows [*lo, *hi) to the entries whose timestamp lies within time.
+static void _ze_advanced_cache_time_bounds(const _ze_advanced_cache_t *cache, const _z_time_range_t *time,
+                                           _z_ntp64_t now, size_t *lo, size_t *hi) {
+    if (*lo >= *hi) {
+        return;
+    }
+    if (time->start.bound != _Z_TIME_BOUND_UNBOUNDED) {
+        _z_time_range_t bound = *time;
+        bound.end.bound = _Z_TIME_BOUND_UNBOUNDED;
+        *lo = _ze_advanced_cache_time_search(cache, *lo, *hi, &bound, true, now);
+    }
+    if (time->end.bound != _Z_TIME_BOUND_UNBOUNDED) {
+        _z_time_range_t bound = *time;
+        bound.start.bound = _Z_TIME_BOUND_UNBOUNDED;
+        *hi = _ze_advanced_cache_time_search(cache, *lo, *hi, &bound, false, now);
+    }
+}
+
+static bool _ze_advanced_cache_sample_matches(const _z_sample_t *sample,
+                                              const _ze_advanced_cache_query_parameters_t *params, bool range_filter,
+                                              bool time_filter, _z_ntp64_t now) {
+    if (range_filter && (!_z_source_info_check(&sample->source_info) ||
+                         !_ze_advanced_cache_range_contains(&params->range, sample->source_info._source_sn))) {
+        return false;
+    }
+    if (time_filter && (!_z_timestamp_check(&sample->timestamp) ||
+                        !_z_time_range_contains_at_time(&params->time, sample->timestamp.time, now))) {
+        return false;
+    }
+    return true;
+}
+
+static z_result_t _ze_advanced_cache_share_string(_z_string_t *dst, const _z_string_t *src) {
+    if (_z_slice_is_alloced(&src->_slice)) {
+        return _z_string_copy(dst, src);
+    }
+    *dst = _z_string_alias(*src);
+    return _Z_RES_OK;
+}
+
+// Takes a reference on each slice of src, reusing the slice vector already held by dst when it is large enough.
+static z_result_t _ze_advanced_cache_share_bytes(_z_bytes_t *dst, const _z_bytes_t *src) {
+    for (size_t i = 0; i < _z_bytes_num_slices(src); i++) {
+        _z_arc_slice_t s;
+        _Z_RETURN_IF_ERR(_z_arc_slice_copy(&s, _z_bytes_get_slice(src, i)));
+        _Z_CLEAN_RETURN_IF_ERR(_z_arc_slice_svec_append(&dst->_slices, &s, false), _z_arc_slice_drop(&s));
+    }
+    return _Z_RES_OK;
+}
+
+static z_result_t _ze_advanced_cache_store(_z_sample_t *slot, const _z_declared_keyexpr_t *key,
+                                           const _z_bytes_t *payload, const _z_timestamp_t *timestamp,
+                                           const _z_encoding_t *encoding, z_sample_kind_t kind, _z_qos_t qos,
+                                           const _z_bytes_t *attachment, z_reliability_t reliability,
+                                           const _z_source_info_t *source_info) {
+    _Z_RETURN_IF_ERR(_ze_advanced_cache_share_string(&slot->keyexpr._inner._keyexpr, &key->_inner._keyexpr));
+    if (!_Z_RC_IS_NULL(&key->_declaration)) {
+        slot->keyexpr._declaration = _z_keyexpr_wire_declaration_rc_clone(&key->_declaration);
+    }
+    if (encoding != NULL) {
+        slot->encoding.id = encoding->id;
+        _Z_RETURN_IF_ERR(_ze_advanced_cache_share_string(&slot->encoding.schema, &encoding->schema));
+    }
+    if (payload != NULL) {
+        _Z_RETURN_IF_ERR(_ze_advanced_cache_share_bytes(&slot->payload, payload));
+    }
+    if (attachment != NULL) {
+        _Z_RETURN_IF_ERR(_ze_advanced_cache_share_bytes(&slot->attachment, attachment));
+    }
+    slot->timestamp = (timestamp != NULL) ? *timestamp : _z_timestamp_null();
+    slot->source_info = (source_info != NULL) ? *source_info : _z_source_info_null();
+    slot->kind = kind;
+    slot->qos = qos;
+    slot->reliability = reliability;
+    return _Z_RES_OK;
+}
+
+// Takes references on the matching samples in [first, hi), at most count of them.
+static z_result_t _ze_advanced_cache_share_range(const _ze_advanced_cache_t *cache, size_t first, size_t hi,
+                                                 size_t count, const _ze_advanced_cache_query_parameters_t *params,
+                                                 bool range_filter, bool time_filter, _z_ntp64_t now,
+                                                 _z_sample_t *samples, size_t *shared) {
+    *shared = 0;
+    for (size_t idx = first; *shared < count && idx < hi; idx++) {
+        const _z_sample_t *src = _ze_advanced_cache_at(cache, idx);
+        if (!_ze_advanced_cache_sample_matches(src, params, range_filter, time_filter, now)) {
+            continue;
+        }
+        _z_sample_t *dst = &samples[*shared];
+        *dst = _z_sample_null();
+        _Z_CLEAN_RETURN_IF_ERR(
+            _ze_advanced_cache_store(dst, &src->keyexpr, &src->payload, &src->timestamp, &src->encoding, src->kind,
+                                     src->qos, &src->attachment, src->reliability, &src->source_info),
+            _z_sample_clear(dst));
+        (*shared)++;
+    }
+    return _Z_RES_OK;
+}
+
+z_result_t _ze_advanced_cache_collect(_ze_advanced_cache_t *cache, const _z_string_t *parameters, _z_ntp64_t now,
+                                      _z_sample_t **samples, size_t *count) {
+    *samples = NULL;
+    *count = 0;
+
+    _ze_advanced_cache_query_parameters_t params;
+    _ze_advanced_cache_query_parse_parameters(&params, parameters);
 
     const bool range_filter = (params.range.start != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_RANGE_UNBOUNDED) ||
                               (params.range.end != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_RANGE_UNBOUNDED);
     const bool time_filter =
         (params.time.start.bound != _Z_TIME_BOUND_UNBOUNDED) || (params.time.end.bound != _Z_TIME_BOUND_UNBOUNDED);
 
-    _z_sample_ring_reverse_iterator_t iter = _z_sample_ring_reverse_iterator_make(&cache->_cache);
+#if Z_FEATURE_MULTI_THREAD == 1
+    _Z_RETURN_IF_ERR(_z_mutex_lock(&cache->_mutex));
+#endif
+    size_t max = (params.max != _ZE_ADVANCED_CACHE_QUERY_PARAMETERS_MAX_UNBOUNDED) ? params.max : cache->_capacity;
+
+    // Restrict the scan to the candidate window when the cache ordering allows it
+    size_t lo = 0;
+    size_t hi = cache->_len;
+    if (range_filter && cache->_unsequenced == 0) {
+        _ze_advanced_cache_sn_bounds(cache, &params.range, &lo, &hi);
+    }
+    if (time_filter && cache->_time_disorder == 0) {
+        _ze_advanced_cache_time_bounds(cache, &params.time, now, &lo, &hi);
+    }
 
-    size_t to_send = 0;
-    while (max > 0 && _z_sample_ring_reverse_iterator_next(&iter)) {
-        _z_sample_t *sample = _z_sample_ring_reverse_iterator_value(&iter);
-        if (range_filter && (!_z_source_info_check(&sample->source_info) ||
-                             !_ze_advanced_cache_range_contains(&params.range, sample->source_info._source_sn))) {
-            continue;
-        }
-        if (time_filter && (!_z_timestamp_check(&sample->timestamp) ||
-                            !_z_time_range_contains_at_time(&params.time, sample->timestamp.time, now_ntp64))) {
-            continue;
+    // Find the oldest of the max newest matching samples
+    size_t first = hi;
+    size_t matching = 0;
+    while (matching < max && first > lo) {
+        first--;
+        if (_ze_advanced_cache_sample_matches(_ze_advanced_cache_at(cache, first), &params, range_filter, time_filter,
+                                              now)) {
+            matching++;
         }
+    }
 
-        res = _z_sample_copy(&cache->_outbox[to_send], sample);
-        if (res != _Z_RES_OK) {
-            _Z_ERROR("Sample dropped from advanced cache query reply - failed to copy sample: %i", res);
+    z_result_t ret = _Z_RES_OK;
+    if (matching > 0) {
+        _z_sample_t *out = (_z_sample_t *)z_malloc(sizeof(_z_sample_t) * matching);
+        if (out == NULL) {
+            _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+            ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
         } else {
-            to_send++;
-            max--;
+            size_t shared = 0;
+            ret = _ze_advanced_cache_share_range(cache, first, hi, matching, &params, range_filter, time_filter, now,
+                                                 out, &shared);
+            if (ret == _Z_RES_OK) {
+                *samples = out;
+                *count = shared;
+            } else {
+                for (size_t i = 0; i < shared; i++) {
+                    _z_sample_clear(&out[i]);
+                }
+                z_free(out);
+            }
         }
     }
-
 #if Z_FEATURE_MULTI_THREAD == 1
     _z_mutex_unlock(&cache->_mutex);
 #endif
+    return ret;
+}
+
+static void _ze_advanced_cache_query_handler(z_loaned_query_t *query, void *ctx) {
+    _ze_advanced_cache_t *cache = (_ze_advanced_cache_t *)ctx;
+
+    z_view_string_t param_str;
+    z_query_parameters(query, &param_str);
+
+    _z_time_since_epoch now;
+    z_result_t res = _z_get_time_since_epoch(&now);
+    if (res != _Z_RES_OK) {
+        _Z_ERROR("Dropped advanced cache query - failed to determine current system time: %i", res);
+        return;
+    }
+    _z_ntp64_t now_ntp64 = _z_timestamp_ntp64_from_time(now.secs, now.nanos);
+
+    // Replies are sent once the cache is unlocked, so that a blocked send does not stall publications
+    _z_sample_t *samples = NULL;
+    size_t count = 0;
+    res = _ze_advanced_cache_collect(cache, z_view_string_loan(&param_str), now_ntp64, &samples, &count);
+    if (res != _Z_RES_OK) {
+        _Z_ERROR("Dropped advanced cache query - failed to collect samples: %i", res);
+        return;
+    }
 
-    z_query_reply_options_t opt;
-    z_query_reply_options_default(&opt);
-    opt.congestion_control = cache->_congestion_control;
-    opt.priority = cache->_priority;
-    opt.is_express = cache->_is_express;
-
-    // Send samples in order
-    while (to_send > 0) {
-        to_send--;
-        _z_sample_t *sample = &cache->_outbox[to_send];
-        res = _z_query_reply_sample(query, sample, &opt);
-        _z_sample_clear(sample);
+    // Replies form a batch of their own, flushed once, without touching the session batch
+    _z_session_rc_t sess_rc = _z_session_weak_upgrade_if_open(&_Z_RC_IN_VAL(query)->_zn);
+    if (_Z_RC_IS_NULL(&sess_rc)) {
+        _Z_ERROR("Dropped advanced cache query - session closed");
+    } else {
+        res = _z_send_replies(_Z_RC_IN_VAL(query), &sess_rc, samples, count, cache->_is_express);
         if (res != _Z_RES_OK) {
-            _Z_ERROR("Sample dropped from advanced cache query reply - failed to send sample: %i", res);
+            _Z_ERROR("Samples dropped from advanced cache query reply - failed to send replies: %i", res);
         }
+        _z_session_rc_drop(&sess_rc);
     }
+    for (size_t i = 0; i < count; i++) {
+        _z_sample_clear(&samples[i]);
+    }
+    if (samples != NULL) {
+        z_free(samples);
+    }
+}
 
-#if Z_FEATURE_MULTI_THREAD == 1
-    _z_mutex_unlock(&cache->_outbox_mutex);
-#endif
+static void _ze_advanced_cache_clear_slots(_ze_advanced_cache_t *cache) {
+    // Slots past the live window may still hold slice vectors kept for reuse
+    for (size_t i = 0; i < cache->_capacity; i++) {
+        _z_sample_clear(&cache->_slots[i]);
+    }
+    z_free(cache->_slots);
+    cache->_slots = NULL;
+    cache->_capacity = 0;
+    cache->_head = 0;
+    cache->_len = 0;
+    cache->_unsequenced = 0;
+    cache->_time_disorder = 0;
 }
 
 static z_result_t _ze_advanced_cache_init(_ze_advanced_cache_t *cache, const z_loaned_session_t *zs,
@@ -215,14 +436,16 @@ static z_result_t _ze_advanced_cache_init(_ze_advanced_cache_t *cache, const z_l
         _Z_ERROR_RETURN(_Z_ERR_INVALID);
     }
 
-    _Z_RETURN_IF_ERR(_z_sample_ring_init(&cache->_cache, options.max_samples));
-    cache->_outbox_cap = options.max_samples;
-    cache->_outbox = (_z_sample_t *)z_malloc(sizeof(_z_sample_t) * cache->_outbox_cap);
-    if (cache->_outbox == NULL) {
-        _z_sample_ring_clear(&cache->_cache);
+    cache->_slots = (_z_sample_t *)z_malloc(sizeof(_z_sample_t) * options.max_samples);
+    if (cache->_slots == NULL) {
         _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
     }
-    memset(cache->_outbox, 0, sizeof(_z_sample_t) * cache->_outbox_cap);
+    memset(cache->_slots, 0, sizeof(_z_sample_t) * options.max_samples);
+    cache->_capacity = options.max_samples;
+    cache->_head = 0;
+    cache->_len = 0;
+    cache->_unsequenced = 0;
+    cache->_time_disorder = 0;
 
     cache->_congestion_control = options.congestion_control;
     cache->_priority = options.priority;
@@ -231,19 +454,14 @@ static z_result_t _ze_advanced_cache_init(_ze_advanced_cache_t *cache, const z_l
     z_owned_keyexpr_t ke;
     z_internal_keyexpr_null(&ke);
     if (suffix != NULL) {
-        _Z_CLEAN_RETURN_IF_ERR(z_keyexpr_join(&ke, keyexpr, suffix), _z_sample_ring_clear(&cache->_cache);
-                               z_free(cache->_outbox); cache->_outbox = NULL);
+        _Z_CLEAN_RETURN_IF_ERR(z_keyexpr_join(&ke, keyexpr, suffix), _ze_advanced_cache_clear_slots(cache));
     } else {
-        _Z_CLEAN_RETURN_IF_ERR(z_keyexpr_clone(&ke, keyexpr), _z_sample_ring_clear(&cache->_cache);
-                               z_free(cache->_outbox); cache->_outbox = NULL);
+        _Z_CLEAN_RETURN_IF_ERR(z_keyexpr_clone(&ke, keyexpr), _ze_advanced_cache_clear_slots(cache));
     }
 
 #if Z_FEATURE_MULTI_THREAD == 1
     _Z_CLEAN_RETURN_IF_ERR(_z_mutex_init(&cache->_mutex), z_keyexpr_drop(z_keyexpr_move(&ke));
-                           _z_sample_ring_clear(&cache->_cache); z_free(cache->_outbox); cache->_outbox = NULL);
-    _Z_CLEAN_RETURN_IF_ERR(_z_mutex_init(&cache->_outbox_mutex), z_keyexpr_drop(z_keyexpr_move(&ke));
-                           _z_sample_ring_clear(&cache->_cache); z_free(cache->_outbox); cache->_outbox = NULL;
-                           _z_mutex_drop(&cache->_mutex));
+                           _ze_advanced_cache_clear_slots(cache));
 #endif
 
     z_result_t res = _Z_RES_OK;
@@ -252,12 +470,9 @@ static z_result_t _ze_advanced_cache_init(_ze_advanced_cache_t *cache, const z_l
         res = z_liveliness_declare_token(zs, &cache->_liveliness, z_keyexpr_loan(&ke), NULL);
         if (res != _Z_RES_OK) {
             z_keyexpr_drop(z_keyexpr_move(&ke));
-            _z_sample_ring_clear(&cache->_cache);
-            z_free(cache->_outbox);
-            cache->_outbox = NULL;
+            _ze_advanced_cache_clear_slots(cache);
 #if Z_FEATURE_MULTI_THREAD == 1
             _z_mutex_drop(&cache->_mutex);
-            _z_mutex_drop(&cache->_outbox_mutex);
 #endif
             _Z_ERROR_RETURN(res);
         }
@@ -269,12 +484,9 @@ static z_result_t _ze_advanced_cache_init(_ze_advanced_cache_t *cache, const z_l
     if (res != _Z_RES_OK) {
         z_keyexpr_drop(z_keyexpr_move(&ke));
         z_liveliness_token_drop(z_liveliness_token_move(&cache->_liveliness));
-        _z_sample_ring_clear(&cache->_cache);
-        z_free(cache->_outbox);
-        cache->_outbox = NULL;
+        _ze_advanced_cache_clear_slots(cache);
 #if Z_FEATURE_MULTI_THREAD == 1
         _z_mutex_drop(&cache->_mutex);
-        _z_mutex_drop(&cache->_outbox_mutex);
 #endif
         _Z_ERROR_RETURN(res);
     }
@@ -283,12 +495,9 @@ static z_result_t _ze_advanced_cache_init(_ze_advanced_cache_t *cache, const z_l
         z_keyexpr_drop(z_keyexpr_move(&ke));
         z_liveliness_token_drop(z_liveliness_token_move(&cache->_liveliness));
         z_closure_query_drop(z_closure_query_move(&callback));
-        _z_sample_ring_clear(&cache->_cache);
-        z_free(cache->_outbox);
-        cache->_outbox = NULL;
+        _ze_advanced_cache_clear_slots(cache);
 #if Z_FEATURE_MULTI_THREAD == 1
         _z_mutex_drop(&cache->_mutex);
-        _z_mutex_drop(&cache->_outbox_mutex);
 #endif
         _Z_ERROR_RETURN(res);
     }
@@ -315,25 +524,83 @@ _ze_advanced_cache_t *_ze_advanced_cache_new(const z_loaned_session_t *zs, const
     return cache;
 }
 
-z_result_t _ze_advanced_cache_add(_ze_advanced_cache_t *cache, _z_sample_t *sample) {
-    if (cache == NULL || sample == NULL) {
-        _Z_ERROR_RETURN(_Z_ERR_INVALID);
+// Drops the references held by a slot, but keeps its slice vectors allocated for the next sample stored in it.
+static void _ze_advanced_cache_release_slot(_z_sample_t *slot) {
+    _z_declared_keyexpr_clear(&slot->keyexpr);
+    _z_encoding_clear(&slot->encoding);
+    _z_arc_slice_svec_reset(&slot->payload._slices);
+    _z_arc_slice_svec_reset(&slot->attachment._slices);
+    _z_bytes_t payload = slot->payload;
+    _z_bytes_t attachment = slot->attachment;
+    *slot = _z_sample_null();
+    slot->payload = payload;
+    slot->attachment = attachment;
+}
+
+static void _ze_advanced_cache_evict_oldest(_ze_advanced_cache_t *cache) {
+    _z_sample_t *oldest = _ze_advanced_cache_at(cache, 0);
+    if (cache->_len > 1 && _ze_advanced_cache_time_inverted(oldest, _ze_advanced_cache_at(cache, 1))) {
+        cache->_time_disorder--;
     }
-    _z_sample_t *s = (_z_sample_t *)z_malloc(sizeof(_z_sample_t));
-    if (s == NULL) {
-        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    if (!_z_source_info_check(&oldest->source_info)) {
+        cache->_unsequenced--;
+    }
+    _ze_advanced_cache_release_slot(oldest);
+    cache->_head = (cache->_head + 1) % cache->_capacity;
+    cache->_len--;
+}
+
+z_result_t _ze_advanced_cache_add(_ze_advanced_cache_t *cache, const _z_declared_keyexpr_t *key,
+                                  const _z_bytes_t *payload, const _z_timestamp_t *timestamp,
+                                  const _z_encoding_t *encoding, z_sample_kind_t kind, _z_qos_t qos,
+                                  const _z_bytes_t *attachment, z_reliability_t reliability,
+                                  const _z_source_info_t *source_info) {
+    if (cache == NULL || key == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_INVALID);
     }
-    _Z_CLEAN_RETURN_IF_ERR(_z_sample_move(s, sample), z_free((void *)s));
 
 #if Z_FEATURE_MULTI_THREAD == 1
-    _Z_CLEAN_RETURN_IF_ERR(_z_mutex_lock(&cache->_mutex), z_free((void *)s));
+    _Z_RETURN_IF_ERR(_z_mutex_lock(&cache->_mutex));
 #endif
-    _z_sample_ring_push_force_drop(&cache->_cache, s);
+    if (cache->_len == cache->_capacity) {
+        _ze_advanced_cache_evict_oldest(cache);
+    }
+    size_t idx = cache->_len;
+    _z_sample_t *slot = _ze_advanced_cache_at(cache, idx);
+    z_result_t ret = _ze_advanced_cache_store(slot, key, payload, timestamp, encoding, kind, qos, attachment,
+                                              reliability, source_info);
+    if (ret != _Z_RES_OK) {
+        _ze_advanced_cache_release_slot(slot);
+    } else {
+        cache->_len++;
+        if (!_z_source_info_check(&slot->source_info)) {
+            cache->_unsequenced++;
+        } else {
+            // Concurrent puts may reach the cache out of sequence number order, restore it
+            while (idx > 0) {
+                _z_sample_t *prev = _ze_advanced_cache_at(cache, idx - 1);
+                if (!_z_source_info_check(&prev->source_info) ||
+                    _z_seqnumber_diff(slot->source_info._source_sn, prev->source_info._source_sn) >= 0) {
+                    break;
+                }
+                _z_sample_t tmp = *prev;
+                *prev = *slot;
+                *slot = tmp;
+                slot = prev;
+                idx--;
+            }
+        }
+        if (idx + 1 < cache->_len) {
+            cache->_time_disorder = _ze_advanced_cache_count_time_disorder(cache);
+        } else if (idx > 0 && _ze_advanced_cache_time_inverted(_ze_advanced_cache_at(cache, idx - 1), slot)) {
+            cache->_time_disorder++;
+        }
+    }
 #if Z_FEATURE_MULTI_THREAD == 1
     _z_mutex_unlock(&cache->_mutex);
 #endif
 
-    return _Z_RES_OK;
+    return ret;
 }
 
 void _ze_advanced_cache_free(_ze_advanced_cache_t **pcache) {
@@ -343,17 +610,13 @@ void _ze_advanced_cache_free(_ze_advanced_cache_t **pcache) {
         z_liveliness_token_drop(z_liveliness_token_move(&cache->_liveliness));
 
 #if Z_FEATURE_MULTI_THREAD == 1
-        _z_mutex_lock(&cache->_outbox_mutex);
         _z_mutex_lock(&cache->_mutex);
 #endif
-        _z_sample_ring_clear(&cache->_cache);
-        z_free(cache->_outbox);
+        _ze_advanced_cache_clear_slots(cache);
 
 #if Z_FEATURE_MULTI_THREAD == 1
         _z_mutex_unlock(&cache->_mutex);
         _z_mutex_drop(&cache->_mutex);
-        _z_mutex_unlock(&cache->_outbox_mutex);
-        _z_mutex_drop(&cache->_outbox_mutex);
 #endif
 
         z_free(cache);
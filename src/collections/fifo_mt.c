@@ -21,10 +21,12 @@
 
 /*-------- Fifo Buffer Multithreaded --------*/
 z_result_t _z_fifo_mt_init(_z_fifo_mt_t *fifo, size_t capacity) {
-    _Z_RETURN_IF_ERR(_z_fifo_init(&fifo->_fifo, capacity))
-    fifo->is_closed = false;
+    _Z_RETURN_IF_ERR(_z_mpmc_queue_init(&fifo->_queue, capacity))
+    _z_atomic_bool_init(&fifo->_is_closed, false);
 
 #if Z_FEATURE_MULTI_THREAD == 1
+    _z_atomic_size_init(&fifo->_pull_waiters, 0);
+    _z_atomic_size_init(&fifo->_push_waiters, 0);
     _Z_RETURN_IF_ERR(_z_mutex_init(&fifo->_mutex))
     _Z_RETURN_IF_ERR(_z_condvar_init(&fifo->_cv_not_full))
     _Z_RETURN_IF_ERR(_z_condvar_init(&fifo->_cv_not_empty))
@@ -57,7 +59,7 @@ void _z_fifo_mt_clear(_z_fifo_mt_t *fifo, z_element_free_f free_f) {
     _z_condvar_drop(&fifo->_cv_not_empty);
 #endif
 
-    _z_fifo_clear(&fifo->_fifo, free_f);
+    _z_mpmc_queue_clear(&fifo->_queue, free_f);
 }
 
 void _z_fifo_mt_free(_z_fifo_mt_t *fifo, z_element_free_f free_f) {
@@ -65,6 +67,24 @@ void _z_fifo_mt_free(_z_fifo_mt_t *fifo, z_element_free_f free_f) {
     z_free(fifo);
 }
 
+#if Z_FEATURE_MULTI_THREAD == 1
+// Wakes up a thread parked on cv, or all of them, if any. Parking threads count themselves as waiters before checking
+// the queue a last time, and the fences on both sides ensure that either they see the change or the count is seen here.
+static z_result_t _z_fifo_mt_wake(_z_fifo_mt_t *f, _z_atomic_size_t *waiters, _z_condvar_t *cv, bool all) {
+    _z_atomic_thread_fence(_z_memory_order_seq_cst);
+    if (_z_atomic_size_load(waiters, _z_memory_order_relaxed) > 0) {
+        _Z_RETURN_IF_ERR(_z_mutex_lock(&f->_mutex))
+        if (all) {
+            _Z_RETURN_IF_ERR(_z_condvar_signal_all(cv))
+        } else {
+            _Z_RETURN_IF_ERR(_z_condvar_signal(cv))
+        }
+        _Z_RETURN_IF_ERR(_z_mutex_unlock(&f->_mutex))
+    }
+    return _Z_RES_OK;
+}
+#endif
+
 z_result_t _z_fifo_mt_push(const void *elem, void *context, z_element_free_f element_free) {
     _ZP_UNUSED(element_free);
     if (elem == NULL || context == NULL) {
@@ -74,87 +94,102 @@ z_result_t _z_fifo_mt_push(const void *elem, void *context, z_element_free_f ele
     _z_fifo_mt_t *f = (_z_fifo_mt_t *)context;
 
 #if Z_FEATURE_MULTI_THREAD == 1
-    _Z_RETURN_IF_ERR(_z_mutex_lock(&f->_mutex))
-    while (elem != NULL) {
-        elem = _z_fifo_push(&f->_fifo, (void *)elem);
-        if (elem != NULL) {
-            _Z_RETURN_IF_ERR(_z_condvar_wait(&f->_cv_not_full, &f->_mutex))
-        } else {
-            _Z_RETURN_IF_ERR(_z_condvar_signal(&f->_cv_not_empty))
+    if (!_z_mpmc_queue_push(&f->_queue, (void *)elem)) {
+        // Park until a consumer makes room
+        _Z_RETURN_IF_ERR(_z_mutex_lock(&f->_mutex))
+        _z_atomic_size_fetch_add(&f->_push_waiters, 1, _z_memory_order_relaxed);
+        _z_atomic_thread_fence(_z_memory_order_seq_cst);
+        z_result_t ret = _Z_RES_OK;
+        while (ret == _Z_RES_OK && !_z_mpmc_queue_push(&f->_queue, (void *)elem)) {
+            ret = _z_condvar_wait(&f->_cv_not_full, &f->_mutex);
         }
+        _z_atomic_size_fetch_sub(&f->_push_waiters, 1, _z_memory_order_relaxed);
+        _Z_RETURN_IF_ERR(_z_mutex_unlock(&f->_mutex))
+        _Z_RETURN_IF_ERR(ret)
     }
-    _Z_RETURN_IF_ERR(_z_mutex_unlock(&f->_mutex))
+    _Z_RETURN_IF_ERR(_z_fifo_mt_wake(f, &f->_pull_waiters, &f->_cv_not_empty, false))
 #else   // Z_FEATURE_MULTI_THREAD == 1
-    _z_fifo_push_drop(&f->_fifo, (void *)elem, element_free);
+    if (!_z_mpmc_queue_push(&f->_queue, (void *)elem)) {
+        void *dropped = (void *)elem;
+        element_free(&dropped);
+    }
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
     return _Z_RES_OK;
 }
 
 z_result_t _z_fifo_mt_close(_z_fifo_mt_t *fifo) {
+    _z_atomic_bool_store(&fifo->_is_closed, true, _z_memory_order_release);
 #if Z_FEATURE_MULTI_THREAD == 1
     _Z_RETURN_IF_ERR(_z_mutex_lock(&fifo->_mutex))
-    fifo->is_closed = true;
     _Z_RETURN_IF_ERR(_z_condvar_signal_all(&fifo->_cv_not_empty))
     _Z_RETURN_IF_ERR(_z_mutex_unlock(&fifo->_mutex))
-#else
-    fifo->is_closed = true;
 #endif
     return _Z_RES_OK;
 }
 
-z_result_t _z_fifo_mt_pull(void *dst, void *context, z_element_move_f element_move) {
+z_result_t _z_fifo_mt_pull_batch(void *dst, size_t elem_size, size_t max, size_t *count, void *context,
+                                 z_element_move_f element_move) {
     _z_fifo_mt_t *f = (_z_fifo_mt_t *)context;
 
+    size_t pos = 0;
+    size_t n = _z_mpmc_queue_claim(&f->_queue, max, &pos);
 #if Z_FEATURE_MULTI_THREAD == 1
-    void *src = NULL;
-    _Z_RETURN_IF_ERR(_z_mutex_lock(&f->_mutex))
-    while (src == NULL) {
-        src = _z_fifo_pull(&f->_fifo);
-        if (src == NULL) {
-            if (f->is_closed) break;
-            _Z_RETURN_IF_ERR(_z_condvar_wait(&f->_cv_not_empty, &f->_mutex))
-        } else {
-            _Z_RETURN_IF_ERR(_z_condvar_signal(&f->_cv_not_full))
+    if (n == 0 && max > 0 && !_z_atomic_bool_load(&f->_is_closed, _z_memory_order_acquire)) {
+        // Park until a producer sees the waiter count and signals
+        _Z_RETURN_IF_ERR(_z_mutex_lock(&f->_mutex))
+        _z_atomic_size_fetch_add(&f->_pull_waiters, 1, _z_memory_order_relaxed);
+        _z_atomic_thread_fence(_z_memory_order_seq_cst);
+        z_result_t ret = _Z_RES_OK;
+        while (ret == _Z_RES_OK) {
+            n = _z_mpmc_queue_claim(&f->_queue, max, &pos);
+            if (n > 0 || _z_atomic_bool_load(&f->_is_closed, _z_memory_order_acquire)) {
+                break;
+            }
+            ret = _z_condvar_wait(&f->_cv_not_empty, &f->_mutex);
         }
-    }
-    _Z_RETURN_IF_ERR(_z_mutex_unlock(&f->_mutex))
-    if (f->is_closed && src == NULL) return _Z_RES_CHANNEL_CLOSED;
-    element_move(dst, src);
-#else   // Z_FEATURE_MULTI_THREAD == 1
-    void *src = _z_fifo_pull(&f->_fifo);
-    if (src != NULL) {
-        element_move(dst, src);
-    } else if (f->is_closed) {
-        return _Z_RES_CHANNEL_CLOSED;
+        _z_atomic_size_fetch_sub(&f->_pull_waiters, 1, _z_memory_order_relaxed);
+        _Z_RETURN_IF_ERR(_z_mutex_unlock(&f->_mutex))
+        _Z_RETURN_IF_ERR(ret)
     }
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
+    *count = n;
+    if (n == 0) {
+        return _z_atomic_bool_load(&f->_is_closed, _z_memory_order_acquire) ? _Z_RES_CHANNEL_CLOSED : _Z_RES_OK;
+    }
+    _z_mpmc_queue_take_n(&f->_queue, pos, n, dst, elem_size, element_move);
+#if Z_FEATURE_MULTI_THREAD == 1
+    _Z_RETURN_IF_ERR(_z_fifo_mt_wake(f, &f->_push_waiters, &f->_cv_not_full, n > 1))
+#endif
     return _Z_RES_OK;
 }
 
-z_result_t _z_fifo_mt_try_pull(void *dst, void *context, z_element_move_f element_move) {
+z_result_t _z_fifo_mt_try_pull_batch(void *dst, size_t elem_size, size_t max, size_t *count, void *context,
+                                     z_element_move_f element_move) {
     _z_fifo_mt_t *f = (_z_fifo_mt_t *)context;
 
+    size_t pos = 0;
+    *count = _z_mpmc_queue_claim(&f->_queue, max, &pos);
+    if (*count > 0) {
+        _z_mpmc_queue_take_n(&f->_queue, pos, *count, dst, elem_size, element_move);
 #if Z_FEATURE_MULTI_THREAD == 1
-    void *src = NULL;
-    _Z_RETURN_IF_ERR(_z_mutex_lock(&f->_mutex))
-    src = _z_fifo_pull(&f->_fifo);
-    if (src != NULL) {
-        _Z_RETURN_IF_ERR(_z_condvar_signal(&f->_cv_not_full))
-    }
-    _Z_RETURN_IF_ERR(_z_mutex_unlock(&f->_mutex))
-#else   // Z_FEATURE_MULTI_THREAD == 1
-    void *src = _z_fifo_pull(&f->_fifo);
-#endif  // Z_FEATURE_MULTI_THREAD == 1
-
-    if (src != NULL) {
-        element_move(dst, src);
-    } else if (f->is_closed) {
+        _Z_RETURN_IF_ERR(_z_fifo_mt_wake(f, &f->_push_waiters, &f->_cv_not_full, *count > 1))
+#endif
+    } else if (_z_atomic_bool_load(&f->_is_closed, _z_memory_order_acquire)) {
         return _Z_RES_CHANNEL_CLOSED;
     } else {
         return _Z_RES_CHANNEL_NODATA;
     }
-
     return _Z_RES_OK;
 }
+
+z_result_t _z_fifo_mt_pull(void *dst, void *context, z_element_move_f element_move) {
+    size_t count = 0;
+    return _z_fifo_mt_pull_batch(dst, 0, 1, &count, context, element_move);
+}
+
+z_result_t _z_fifo_mt_try_pull(void *dst, void *context, z_element_move_f element_move) {
+    size_t count = 0;
+    return _z_fifo_mt_try_pull_batch(dst, 0, 1, &count, context, element_move);
+}
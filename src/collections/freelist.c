@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/collections/freelist.h"
+
+#include "zenoh-pico/utils/logging.h"
+
+// Prefix of the blocks, holding the list they belong to. It is padded to the strictest alignment of the scalar types,
+// so that the element following it is suitably aligned.
+typedef union {
+    _z_freelist_t *owner;
+    long long ll;
+    long double ld;
+} _z_freelist_header_t;
+
+static void _z_freelist_block_free(void **block) {
+    z_free(*block);
+    *block = NULL;
+}
+
+z_result_t _z_freelist_init(_z_freelist_t *fl, size_t elem_size, size_t max_len) {
+    fl->_elem_size = elem_size;
+    return _z_mpmc_queue_init(&fl->_blocks, max_len);
+}
+
+void _z_freelist_clear(_z_freelist_t *fl) { _z_mpmc_queue_clear(&fl->_blocks, _z_freelist_block_free); }
+
+void *_z_freelist_get(_z_freelist_t *fl) {
+    _z_freelist_header_t *header = (_z_freelist_header_t *)_z_mpmc_queue_pull(&fl->_blocks);
+    if (header == NULL) {
+        header = (_z_freelist_header_t *)z_malloc(sizeof(_z_freelist_header_t) + fl->_elem_size);
+        if (header == NULL) {
+            _Z_ERROR("z_malloc failed");
+            return NULL;
+        }
+    }
+    header->owner = fl;
+    return header + 1;
+}
+
+void _z_freelist_release(void *elem) {
+    if (elem == NULL) {
+        return;
+    }
+    _z_freelist_header_t *header = (_z_freelist_header_t *)elem - 1;
+    // Over the retention bound
+    if (!_z_mpmc_queue_push(&header->owner->_blocks, header)) {
+        z_free(header);
+    }
+}
+
+void _z_freelist_release_n(void **elems, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    _z_freelist_t *fl = ((_z_freelist_header_t *)elems[0] - 1)->owner;
+    for (size_t i = 0; i < n; i++) {
+        elems[i] = (_z_freelist_header_t *)elems[i] - 1;
+    }
+    // Over the retention bound
+    for (size_t i = _z_mpmc_queue_push_n(&fl->_blocks, elems, n); i < n; i++) {
+        z_free(elems[i]);
+    }
+}
+
+size_t _z_freelist_len(_z_freelist_t *fl) { return _z_mpmc_queue_len(&fl->_blocks); }
@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/collections/mpmc_queue.h"
+
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/utils/logging.h"
+
+// Signed distance between two positions, correct across wrap-around
+static inline ptrdiff_t _z_mpmc_queue_diff(size_t a, size_t b) { return (ptrdiff_t)(a - b); }
+
+z_result_t _z_mpmc_queue_init(_z_mpmc_queue_t *q, size_t capacity) {
+    if (capacity == 0) {
+        _Z_ERROR_RETURN(_Z_ERR_INVALID);
+    }
+    size_t slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    q->_slots = (_z_mpmc_queue_slot_t *)z_malloc(slots * sizeof(_z_mpmc_queue_slot_t));
+    if (q->_slots == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    for (size_t i = 0; i < slots; i++) {
+        _z_atomic_size_init(&q->_slots[i]._seq, i);
+        q->_slots[i]._val = NULL;
+    }
+    q->_mask = slots - 1;
+    q->_capacity = capacity;
+    _z_atomic_size_init(&q->_w_pos, 0);
+    _z_atomic_size_init(&q->_r_pos, 0);
+    return _Z_RES_OK;
+}
+
+void _z_mpmc_queue_clear(_z_mpmc_queue_t *q, z_element_free_f free_f) {
+    if (q->_slots == NULL) {
+        return;
+    }
+    void *e = _z_mpmc_queue_pull(q);
+    while (e != NULL) {
+        free_f(&e);
+        e = _z_mpmc_queue_pull(q);
+    }
+    z_free(q->_slots);
+    q->_slots = NULL;
+    q->_mask = 0;
+    q->_capacity = 0;
+}
+
+size_t _z_mpmc_queue_capacity(const _z_mpmc_queue_t *q) { return q->_capacity; }
+
+size_t _z_mpmc_queue_len(_z_mpmc_queue_t *q) {
+    size_t r_pos = _z_atomic_size_load(&q->_r_pos, _z_memory_order_acquire);
+    size_t w_pos = _z_atomic_size_load(&q->_w_pos, _z_memory_order_acquire);
+    ptrdiff_t len = _z_mpmc_queue_diff(w_pos, r_pos);
+    return (len > 0) ? (size_t)len : 0;
+}
+
+bool _z_mpmc_queue_push(_z_mpmc_queue_t *q, void *e) {
+    _z_mpmc_queue_slot_t *slot;
+    size_t pos = _z_atomic_size_load(&q->_w_pos, _z_memory_order_relaxed);
+    for (;;) {
+        slot = &q->_slots[pos & q->_mask];
+        size_t seq = _z_atomic_size_load(&slot->_seq, _z_memory_order_acquire);
+        ptrdiff_t diff = _z_mpmc_queue_diff(seq, pos);
+        if (diff == 0) {
+            // The slot is free, but the queue may hold capacity elements already when it is not a power of two
+            size_t r_pos = _z_atomic_size_load(&q->_r_pos, _z_memory_order_acquire);
+            if (_z_mpmc_queue_diff(pos, r_pos) >= (ptrdiff_t)q->_capacity) {
+                return false;
+            }
+            if (_z_atomic_size_compare_exchange_weak(&q->_w_pos, &pos, pos + 1, _z_memory_order_relaxed,
+                                                     _z_memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The slot still holds the element pushed one lap ago
+            return false;
+        } else {
+            pos = _z_atomic_size_load(&q->_w_pos, _z_memory_order_relaxed);
+        }
+    }
+    slot->_val = e;
+    _z_atomic_size_store(&slot->_seq, pos + 1, _z_memory_order_release);
+    return true;
+}
+
+size_t _z_mpmc_queue_push_n(_z_mpmc_queue_t *q, void **e, size_t n) {
+    if (n == 0) {
+        return 0;
+    }
+    size_t start = _z_atomic_size_load(&q->_w_pos, _z_memory_order_relaxed);
+    size_t k = 0;
+    for (;;) {
+        // Count the slots free from the current position on, within the capacity
+        size_t r_pos = _z_atomic_size_load(&q->_r_pos, _z_memory_order_acquire);
+        ptrdiff_t room = (ptrdiff_t)q->_capacity - _z_mpmc_queue_diff(start, r_pos);
+        k = 0;
+        while ((k < n) && ((ptrdiff_t)k < room)) {
+            size_t p = start + k;
+            size_t seq = _z_atomic_size_load(&q->_slots[p & q->_mask]._seq, _z_memory_order_acquire);
+            if (_z_mpmc_queue_diff(seq, p) != 0) {
+                break;
+            }
+            k++;
+        }
+        if (k == 0) {
+            size_t seq = _z_atomic_size_load(&q->_slots[start & q->_mask]._seq, _z_memory_order_acquire);
+            if ((room <= 0) || (_z_mpmc_queue_diff(seq, start) < 0)) {
+                return 0;
+            }
+            // Another producer moved past this position
+            start = _z_atomic_size_load(&q->_w_pos, _z_memory_order_relaxed);
+            continue;
+        }
+        if (_z_atomic_size_compare_exchange_weak(&q->_w_pos, &start, start + k, _z_memory_order_relaxed,
+                                                 _z_memory_order_relaxed)) {
+            break;
+        }
+    }
+    for (size_t i = 0; i < k; i++) {
+        _z_mpmc_queue_slot_t *slot = &q->_slots[(start + i) & q->_mask];
+        slot->_val = e[i];
+        _z_atomic_size_store(&slot->_seq, start + i + 1, _z_memory_order_release);
+    }
+    return k;
+}
+
+void _z_mpmc_queue_push_force_drop(_z_mpmc_queue_t *q, void *e, z_element_free_f free_f) {
+    while (!_z_mpmc_queue_push(q, e)) {
+        void *old = _z_mpmc_queue_pull(q);
+        if (old != NULL) {
+            free_f(&old);
+        }
+    }
+}
+
+void *_z_mpmc_queue_pull(_z_mpmc_queue_t *q) {
+    _z_mpmc_queue_slot_t *slot;
+    size_t pos = _z_atomic_size_load(&q->_r_pos, _z_memory_order_relaxed);
+    for (;;) {
+        slot = &q->_slots[pos & q->_mask];
+        size_t seq = _z_atomic_size_load(&slot->_seq, _z_memory_order_acquire);
+        ptrdiff_t diff = _z_mpmc_queue_diff(seq, pos + 1);
+        if (diff == 0) {
+            if (_z_atomic_size_compare_exchange_weak(&q->_r_pos, &pos, pos + 1, _z_memory_order_relaxed,
+                                                     _z_memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Nothing was pushed at this position yet
+            return NULL;
+        } else {
+            pos = _z_atomic_size_load(&q->_r_pos, _z_memory_order_relaxed);
+        }
+    }
+    void *e = slot->_val;
+    slot->_val = NULL;
+    // Frees the slot for the position one lap ahead
+    _z_atomic_size_store(&slot->_seq, pos + q->_mask + 1, _z_memory_order_release);
+    return e;
+}
+
+size_t _z_mpmc_queue_claim(_z_mpmc_queue_t *q, size_t max, size_t *pos) {
+    if (max == 0) {
+        return 0;
+    }
+    size_t start = _z_atomic_size_load(&q->_r_pos, _z_memory_order_relaxed);
+    for (;;) {
+        // Count the elements ready from the current position on
+        size_t n = 0;
+        while (n < max) {
+            size_t p = start + n;
+            size_t seq = _z_atomic_size_load(&q->_slots[p & q->_mask]._seq, _z_memory_order_acquire);
+            if (_z_mpmc_queue_diff(seq, p + 1) != 0) {
+                break;
+            }
+            n++;
+        }
+        if (n == 0) {
+            size_t seq = _z_atomic_size_load(&q->_slots[start & q->_mask]._seq, _z_memory_order_acquire);
+            if (_z_mpmc_queue_diff(seq, start + 1) < 0) {
+                return 0;
+            }
+            // Another consumer moved past this position
+            start = _z_atomic_size_load(&q->_r_pos, _z_memory_order_relaxed);
+            continue;
+        }
+        if (_z_atomic_size_compare_exchange_weak(&q->_r_pos, &start, start + n, _z_memory_order_relaxed,
+                                                 _z_memory_order_relaxed)) {
+            *pos = start;
+            return n;
+        }
+    }
+}
+
+void *_z_mpmc_queue_take(_z_mpmc_queue_t *q, size_t pos) {
+    _z_mpmc_queue_slot_t *slot = &q->_slots[pos & q->_mask];
+    void *e = slot->_val;
+    slot->_val = NULL;
+    _z_atomic_size_store(&slot->_seq, pos + q->_mask + 1, _z_memory_order_release);
+    return e;
+}
+
+void _z_mpmc_queue_take_n(_z_mpmc_queue_t *q, size_t pos, size_t n, void *dst, size_t elem_size,
+                          z_element_move_f move_f) {
+    for (size_t i = 0; i < n; i++) {
+        move_f((uint8_t *)dst + i * elem_size, _z_mpmc_queue_take(q, pos + i));
+    }
+}
@@ -20,13 +20,14 @@
 
 /*-------- Ring Buffer Multithreaded --------*/
 z_result_t _z_ring_mt_init(_z_ring_mt_t *ring, size_t capacity) {
-    _Z_RETURN_IF_ERR(_z_ring_init(&ring->_ring, capacity))
+    _Z_RETURN_IF_ERR(_z_mpmc_queue_init(&ring->_queue, capacity))
 
 #if Z_FEATURE_MULTI_THREAD == 1
+    _z_atomic_size_init(&ring->_pull_waiters, 0);
     _Z_RETURN_IF_ERR(_z_mutex_init(&ring->_mutex))
     _Z_RETURN_IF_ERR(_z_condvar_init(&ring->_cv_not_empty))
 #endif
-    ring->is_closed = false;
+    _z_atomic_bool_init(&ring->_is_closed, false);
     return _Z_RES_OK;
 }
 
@@ -40,6 +41,7 @@ _z_ring_mt_t *_z_ring_mt_new(size_t capacity) {
     z_result_t ret = _z_ring_mt_init(ring, capacity);
     if (ret != _Z_RES_OK) {
         _Z_ERROR("_z_ring_mt_init failed: %i", ret);
+        z_free(ring);
         return NULL;
     }
 
@@ -52,7 +54,7 @@ void _z_ring_mt_clear(_z_ring_mt_t *ring, z_element_free_f free_f) {
     _z_condvar_drop(&ring->_cv_not_empty);
 #endif
 
-    _z_ring_clear(&ring->_ring, free_f);
+    _z_mpmc_queue_clear(&ring->_queue, free_f);
 }
 
 void _z_ring_mt_free(_z_ring_mt_t *ring, z_element_free_f free_f) {
@@ -67,80 +69,86 @@ z_result_t _z_ring_mt_push(const void *elem, void *context, z_element_free_f ele
     }
 
     _z_ring_mt_t *r = (_z_ring_mt_t *)context;
+    _z_mpmc_queue_push_force_drop(&r->_queue, (void *)elem, element_free);
 
 #if Z_FEATURE_MULTI_THREAD == 1
-    _Z_RETURN_IF_ERR(_z_mutex_lock(&r->_mutex))
-#endif
-
-    _z_ring_push_force_drop(&r->_ring, (void *)elem, element_free);
-
-#if Z_FEATURE_MULTI_THREAD == 1
-    _Z_RETURN_IF_ERR(_z_condvar_signal(&r->_cv_not_empty))
-    _Z_RETURN_IF_ERR(_z_mutex_unlock(&r->_mutex))
+    // Only take the lock if a consumer is parked, pairs with the fence in _z_ring_mt_pull
+    _z_atomic_thread_fence(_z_memory_order_seq_cst);
+    if (_z_atomic_size_load(&r->_pull_waiters, _z_memory_order_relaxed) > 0) {
+        _Z_RETURN_IF_ERR(_z_mutex_lock(&r->_mutex))
+        _Z_RETURN_IF_ERR(_z_condvar_signal(&r->_cv_not_empty))
+        _Z_RETURN_IF_ERR(_z_mutex_unlock(&r->_mutex))
+    }
 #endif
     return _Z_RES_OK;
 }
 
 z_result_t _z_ring_mt_close(_z_ring_mt_t *ring) {
+    _z_atomic_bool_store(&ring->_is_closed, true, _z_memory_order_release);
 #if Z_FEATURE_MULTI_THREAD == 1
     _Z_RETURN_IF_ERR(_z_mutex_lock(&ring->_mutex))
-    ring->is_closed = true;
     _Z_RETURN_IF_ERR(_z_condvar_signal_all(&ring->_cv_not_empty))
     _Z_RETURN_IF_ERR(_z_mutex_unlock(&ring->_mutex))
-#else
-    ring->is_closed = true;
 #endif
     return _Z_RES_OK;
 }
 
-z_result_t _z_ring_mt_pull(void *dst, void *context, z_element_move_f element_move) {
+z_result_t _z_ring_mt_pull_batch(void *dst, size_t elem_size, size_t max, size_t *count, void *context,
+                                 z_element_move_f element_move) {
     _z_ring_mt_t *r = (_z_ring_mt_t *)context;
 
+    size_t pos = 0;
+    size_t n = _z_mpmc_queue_claim(&r->_queue, max, &pos);
 #if Z_FEATURE_MULTI_THREAD == 1
-    void *src = NULL;
-    _Z_RETURN_IF_ERR(_z_mutex_lock(&r->_mutex))
-    while (src == NULL) {
-        src = _z_ring_pull(&r->_ring);
-        if (src == NULL) {
-            if (r->is_closed) break;
-            _Z_RETURN_IF_ERR(_z_condvar_wait(&r->_cv_not_empty, &r->_mutex))
+    if (n == 0 && max > 0 && !_z_atomic_bool_load(&r->_is_closed, _z_memory_order_acquire)) {
+        // Park until a producer sees the waiter count and signals
+        _Z_RETURN_IF_ERR(_z_mutex_lock(&r->_mutex))
+        _z_atomic_size_fetch_add(&r->_pull_waiters, 1, _z_memory_order_relaxed);
+        _z_atomic_thread_fence(_z_memory_order_seq_cst);
+        z_result_t ret = _Z_RES_OK;
+        while (ret == _Z_RES_OK) {
+            n = _z_mpmc_queue_claim(&r->_queue, max, &pos);
+            if (n > 0 || _z_atomic_bool_load(&r->_is_closed, _z_memory_order_acquire)) {
+                break;
+            }
+            ret = _z_condvar_wait(&r->_cv_not_empty, &r->_mutex);
         }
+        _z_atomic_size_fetch_sub(&r->_pull_waiters, 1, _z_memory_order_relaxed);
+        _Z_RETURN_IF_ERR(_z_mutex_unlock(&r->_mutex))
+        _Z_RETURN_IF_ERR(ret)
     }
-    _Z_RETURN_IF_ERR(_z_mutex_unlock(&r->_mutex))
-#else   // Z_FEATURE_MULTI_THREAD == 1
-    void *src = _z_ring_pull(&r->_ring);
 #endif  // Z_FEATURE_MULTI_THREAD == 1
 
-    if (r->is_closed && src == NULL) {
-        return _Z_RES_CHANNEL_CLOSED;
-    }
-
-    if (src != NULL) {
-        element_move(dst, src);
+    *count = n;
+    if (n == 0) {
+        return _z_atomic_bool_load(&r->_is_closed, _z_memory_order_acquire) ? _Z_RES_CHANNEL_CLOSED : _Z_RES_OK;
     }
-
+    _z_mpmc_queue_take_n(&r->_queue, pos, n, dst, elem_size, element_move);
     return _Z_RES_OK;
 }
 
-z_result_t _z_ring_mt_try_pull(void *dst, void *context, z_element_move_f element_move) {
+z_result_t _z_ring_mt_try_pull_batch(void *dst, size_t elem_size, size_t max, size_t *count, void *context,
+                                     z_element_move_f element_move) {
     _z_ring_mt_t *r = (_z_ring_mt_t *)context;
 
-#if Z_FEATURE_MULTI_THREAD == 1
-    _Z_RETURN_IF_ERR(_z_mutex_lock(&r->_mutex))
-#endif
-
-    void *src = _z_ring_pull(&r->_ring);
-
-#if Z_FEATURE_MULTI_THREAD == 1
-    _Z_RETURN_IF_ERR(_z_mutex_unlock(&r->_mutex))
-#endif
-
-    if (src != NULL) {
-        element_move(dst, src);
-    } else if (r->is_closed) {
+    size_t pos = 0;
+    *count = _z_mpmc_queue_claim(&r->_queue, max, &pos);
+    if (*count > 0) {
+        _z_mpmc_queue_take_n(&r->_queue, pos, *count, dst, elem_size, element_move);
+    } else if (_z_atomic_bool_load(&r->_is_closed, _z_memory_order_acquire)) {
         return _Z_RES_CHANNEL_CLOSED;
     } else {
         return _Z_RES_CHANNEL_NODATA;
     }
     return _Z_RES_OK;
 }
+
+z_result_t _z_ring_mt_pull(void *dst, void *context, z_element_move_f element_move) {
+    size_t count = 0;
+    return _z_ring_mt_pull_batch(dst, 0, 1, &count, context, element_move);
+}
+
+z_result_t _z_ring_mt_try_pull(void *dst, void *context, z_element_move_f element_move) {
+    size_t count = 0;
+    return _z_ring_mt_try_pull_batch(dst, 0, 1, &count, context, element_move);
+}
@@ -20,6 +20,7 @@
 
 #include "zenoh-pico/system/platform.h"
 #include "zenoh-pico/utils/endianness.h"
+#include "zenoh-pico/utils/hash.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 #include "zenoh-pico/utils/result.h"
@@ -146,4 +147,13 @@ bool _z_slice_eq(const _z_slice_t *left, const _z_slice_t *right) {
     return memcmp(left->start, right->start, left->len) == 0;
 }
 
+size_t _z_slice_hash(const _z_slice_t *s) {
+    size_t hash = (size_t)_Z_FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < s->len; i++) {
+        hash ^= s->start[i];
+        hash *= _Z_FNV_PRIME;
+    }
+    return hash;
+}
+
 bool _z_slice_is_alloced(const _z_slice_t *s) { return !_z_delete_context_is_null(&s->_delete_context); }
@@ -17,6 +17,7 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "zenoh-pico/utils/hash.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
@@ -100,6 +101,16 @@ bool _z_string_equals(const _z_string_t *left, const _z_string_t *right) {
     return (strncmp(_z_string_data(left), _z_string_data(right), _z_string_len(left)) == 0);
 }
 
+size_t _z_string_hash(const _z_string_t *s) {
+    size_t hash = (size_t)_Z_FNV_OFFSET_BASIS;
+    const uint8_t *data = (const uint8_t *)_z_string_data(s);
+    for (size_t i = 0; i < _z_string_len(s); i++) {
+        hash ^= data[i];
+        hash *= _Z_FNV_PRIME;
+    }
+    return hash;
+}
+
 _z_string_t _z_string_convert_bytes_le(const _z_slice_t *bs) {
     _z_string_t s = _z_string_null();
     size_t len = bs->len * (size_t)2;
@@ -33,6 +33,14 @@ z_result_t _z_open_socket(const _z_string_t *locator, const _z_config_t *session
 #if Z_FEATURE_LINK_TLS == 1
     } else if (_z_endpoint_tls_valid(&ep) == _Z_RES_OK) {
         ret = _z_new_peer_tls(&ep, socket, session_cfg);
+#endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+    } else if (_z_endpoint_unixsock_stream_valid(&ep) == _Z_RES_OK) {
+        ret = _z_new_peer_unixsock_stream(&ep, socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+    } else if (_z_endpoint_shm_valid(&ep) == _Z_RES_OK) {
+        ret = _z_new_peer_shm(&ep, socket);
 #endif
     } else {
         _Z_ERROR_LOG(_Z_ERR_CONFIG_LOCATOR_SCHEMA_UNKNOWN);
@@ -51,6 +59,8 @@ z_result_t _z_open_link(_z_link_t *zl, const _z_string_t *locator, const _z_conf
     _z_endpoint_t ep;
     ret = _z_endpoint_from_string(&ep, locator);
     if (ret == _Z_RES_OK) {
+        zl->_write_segments_f = NULL;
+        zl->_write_sockets_f = NULL;
         // Create transport link
         if (_z_endpoint_tcp_valid(&ep) == _Z_RES_OK) {
             ret = _z_new_link_tcp(zl, &ep);
@@ -79,6 +89,18 @@ z_result_t _z_open_link(_z_link_t *zl, const _z_string_t *locator, const _z_conf
             if (_z_endpoint_tls_valid(&ep) == _Z_RES_OK) {
             ret = _z_new_link_tls(zl, &ep, session_cfg);
         } else
+#endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+            if (_z_endpoint_unixsock_stream_valid(&ep) == _Z_RES_OK) {
+            ret = _z_new_link_unixsock_stream(zl, &ep);
+        } else if (_z_endpoint_unixsock_dgram_valid(&ep) == _Z_RES_OK) {
+            ret = _z_new_link_unixsock_dgram(zl, &ep);
+        } else
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+            if (_z_endpoint_shm_valid(&ep) == _Z_RES_OK) {
+            ret = _z_new_link_shm(zl, &ep);
+        } else
 #endif
         {
             _Z_ERROR_LOG(_Z_ERR_CONFIG_LOCATOR_SCHEMA_UNKNOWN);
@@ -112,6 +134,8 @@ z_result_t _z_listen_link(_z_link_t *zl, const _z_string_t *locator, const _z_co
     _z_endpoint_t ep;
     ret = _z_endpoint_from_string(&ep, locator);
     if (ret == _Z_RES_OK) {
+        zl->_write_segments_f = NULL;
+        zl->_write_sockets_f = NULL;
         // Create transport link
         if (_z_endpoint_tcp_valid(&ep) == _Z_RES_OK) {
             ret = _z_new_link_tcp(zl, &ep);
@@ -130,6 +154,16 @@ z_result_t _z_listen_link(_z_link_t *zl, const _z_string_t *locator, const _z_co
             if (_z_endpoint_bt_valid(&ep) == _Z_RES_OK) {
             ret = _z_new_link_bt(zl, ep);
         } else
+#endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+            if (_z_endpoint_unixsock_stream_valid(&ep) == _Z_RES_OK) {
+            ret = _z_new_link_unixsock_stream(zl, &ep);
+        } else
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+            if (_z_endpoint_shm_valid(&ep) == _Z_RES_OK) {
+            ret = _z_new_link_shm(zl, &ep);
+        } else
 #endif
             if (_z_endpoint_raweth_valid(&ep) == _Z_RES_OK) {
             ret = _z_new_link_raweth(zl, ep);
@@ -229,6 +263,23 @@ z_result_t _z_link_send_wbuf(const _z_link_t *link, const _z_wbuf_t *wbf, _z_sys
     return ret;
 }
 
+void _z_link_send_wbuf_sockets(const _z_link_t *link, const _z_wbuf_t *wbf, _z_sys_net_socket_t *const *sockets,
+                               size_t nb) {
+    if ((link->_write_sockets_f != NULL) && (nb > 1) && (_z_wbuf_len_iosli(wbf) == 1)) {
+        _z_slice_t bs = _z_iosli_to_bytes(_z_wbuf_get_iosli(wbf, 0));
+        size_t sent = link->_write_sockets_f(link, bs.start, bs.len, sockets, nb);
+        if (sent != SIZE_MAX) {
+            if (sent != nb) {
+                _Z_ERROR_LOG(_Z_ERR_TRANSPORT_TX_FAILED);
+            }
+            return;
+        }
+    }
+    for (size_t i = 0; i < nb; i++) {
+        (void)_z_link_send_wbuf(link, wbf, sockets[i]);
+    }
+}
+
 const _z_sys_net_socket_t *_z_link_get_socket(const _z_link_t *link) {
     switch (link->_type) {
 #if Z_FEATURE_LINK_TCP == 1
@@ -258,6 +309,14 @@ const _z_sys_net_socket_t *_z_link_get_socket(const _z_link_t *link) {
 #if Z_FEATURE_RAWETH_TRANSPORT == 1
         case _Z_LINK_TYPE_RAWETH:
             return &link->_socket._raweth._sock;
+#endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+        case _Z_LINK_TYPE_UNIXSOCK:
+            return &link->_socket._unixsock._sock;
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        case _Z_LINK_TYPE_SHM:
+            return &link->_socket._shm._sock;
 #endif
         default:
             _Z_INFO("Unknown link type");
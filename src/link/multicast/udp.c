@@ -58,6 +58,19 @@ z_result_t _z_f_link_open_udp_multicast(_z_link_t *self) {
                                  iface);
 }
 
+#if defined(ZENOH_LINUX) && Z_FEATURE_UDP_OFFLOAD == 1
+size_t _z_f_link_write_segments_udp_multicast(const _z_link_t *self, const uint8_t *ptr, size_t len, size_t segment) {
+    bool offload_failed = false;
+    size_t wb =
+        _z_udp_write_segments(self->_socket._udp._msock, ptr, len, segment, self->_socket._udp._rep, &offload_failed);
+    if (offload_failed) {
+        // Writes are serialized by the transport tx mutex
+        ((_z_link_t *)self)->_write_segments_f = NULL;
+    }
+    return wb;
+}
+#endif
+
 z_result_t _z_f_link_listen_udp_multicast(_z_link_t *self) {
     z_result_t ret = _Z_RES_OK;
 
@@ -67,11 +80,24 @@ z_result_t _z_f_link_listen_udp_multicast(_z_link_t *self) {
                                   join);
     ret |= _z_udp_multicast_open(&self->_socket._udp._msock, self->_socket._udp._rep, &self->_socket._udp._lep,
                                  Z_CONFIG_SOCKET_TIMEOUT, iface);
+#if defined(ZENOH_LINUX) && Z_FEATURE_UDP_OFFLOAD == 1
+    if (ret == _Z_RES_OK) {
+        if (_z_udp_gso_supported(self->_socket._udp._msock)) {
+            self->_write_segments_f = _z_f_link_write_segments_udp_multicast;
+        }
+        self->_socket._udp._gro = _z_udp_gro_new(self->_socket._udp._sock);
+    }
+#endif
 
     return ret;
 }
 
 void _z_f_link_close_udp_multicast(_z_link_t *self) {
+#if defined(ZENOH_LINUX)
+    if (self->_socket._udp._gro != NULL) {
+        _z_udp_gro_free(&self->_socket._udp._gro);
+    }
+#endif
     _z_udp_multicast_close(&self->_socket._udp._sock, &self->_socket._udp._msock, self->_socket._udp._rep,
                            self->_socket._udp._lep);
 }
@@ -92,12 +118,24 @@ size_t _z_f_link_write_all_udp_multicast(const _z_link_t *self, const uint8_t *p
 }
 
 size_t _z_f_link_read_udp_multicast(const _z_link_t *self, uint8_t *ptr, size_t len, _z_slice_t *addr) {
+#if defined(ZENOH_LINUX)
+    if (self->_socket._udp._gro != NULL) {
+        return _z_udp_multicast_read_gro(self->_socket._udp._sock, self->_socket._udp._gro, ptr, len,
+                                         self->_socket._udp._lep, addr);
+    }
+#endif
     return _z_udp_multicast_read(self->_socket._udp._sock, ptr, len, self->_socket._udp._lep, addr);
 }
 
 size_t _z_f_link_read_exact_udp_multicast(const _z_link_t *self, uint8_t *ptr, size_t len, _z_slice_t *addr,
                                           _z_sys_net_socket_t *socket) {
     _ZP_UNUSED(socket);
+#if defined(ZENOH_LINUX)
+    if (self->_socket._udp._gro != NULL) {
+        return _z_udp_multicast_read_exact_gro(self->_socket._udp._sock, self->_socket._udp._gro, ptr, len,
+                                               self->_socket._udp._lep, addr);
+    }
+#endif
     return _z_udp_multicast_read_exact(self->_socket._udp._sock, ptr, len, self->_socket._udp._lep, addr);
 }
 
@@ -117,6 +155,9 @@ z_result_t _z_new_link_udp_multicast(_z_link_t *zl, _z_endpoint_t endpoint) {
     zl->_endpoint = endpoint;
     z_result_t ret = _z_udp_multicast_endpoint_init_from_address(&zl->_socket._udp._rep, &endpoint._locator._address);
     memset(&zl->_socket._udp._lep, 0, sizeof(zl->_socket._udp._lep));
+#if defined(ZENOH_LINUX)
+    zl->_socket._udp._gro = NULL;
+#endif
 
     zl->_open_f = _z_f_link_open_udp_multicast;
     zl->_listen_f = _z_f_link_listen_udp_multicast;
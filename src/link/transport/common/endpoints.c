@@ -80,7 +80,15 @@ z_result_t _z_socket_get_endpoints(const _z_sys_net_socket_t *sock, char *local,
 #include "zenoh-pico/system/platform.h"
 #include "zenoh-pico/utils/logging.h"
 
-static z_result_t _z_sockaddr_to_endpoint(const struct sockaddr *addr, char *dst, size_t dst_len) {
+#if defined(ZP_PLATFORM_SOCKET_POSIX) && Z_FEATURE_LINK_UNIXSOCK == 1
+#include <stdio.h>
+#include <string.h>
+#include <sys/un.h>
+#endif
+
+static z_result_t _z_sockaddr_to_endpoint(const struct sockaddr *addr, socklen_t addr_len, char *dst,
+                                          size_t dst_len) {
+    _ZP_UNUSED(addr_len);
     if (addr->sa_family == AF_INET) {
         const struct sockaddr_in *addr4 = (const struct sockaddr_in *)addr;
         const uint8_t *bytes = (const uint8_t *)&addr4->sin_addr;
@@ -89,6 +97,22 @@ static z_result_t _z_sockaddr_to_endpoint(const struct sockaddr *addr, char *dst
         const struct sockaddr_in6 *addr6 = (const struct sockaddr_in6 *)addr;
         const uint8_t *bytes = (const uint8_t *)&addr6->sin6_addr;
         return _z_ip_port_to_endpoint(bytes, sizeof(addr6->sin6_addr), ntohs(addr6->sin6_port), dst, dst_len);
+#if defined(ZP_PLATFORM_SOCKET_POSIX) && Z_FEATURE_LINK_UNIXSOCK == 1
+    } else if (addr->sa_family == AF_UNIX) {
+        // Unnamed and abstract sockets have no path, their endpoint address is left empty
+        const struct sockaddr_un *addr_un = (const struct sockaddr_un *)addr;
+        size_t path_offset = offsetof(struct sockaddr_un, sun_path);
+        size_t path_len = ((size_t)addr_len > path_offset) ? (size_t)addr_len - path_offset : 0;
+        const char *path_end = (const char *)memchr(addr_un->sun_path, '\0', path_len);
+        if (path_end != NULL) {
+            path_len = (size_t)(path_end - addr_un->sun_path);
+        }
+        int written = snprintf(dst, dst_len, "%.*s", (int)path_len, addr_un->sun_path);
+        if ((written < 0) || ((size_t)written >= dst_len)) {
+            _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+        }
+        return _Z_RES_OK;
+#endif
     } else {
         _Z_ERROR_RETURN(_Z_ERR_INVALID);
     }
@@ -113,8 +137,9 @@ z_result_t _z_socket_get_endpoints(const _z_sys_net_socket_t *sock, char *local,
     if (getpeername(sock->_fd, (struct sockaddr *)&remote_addr, &remote_addr_len) != 0) {
         _Z_ERROR_RETURN(_Z_ERR_GENERIC);
     }
-    _Z_RETURN_IF_ERR(_z_sockaddr_to_endpoint((const struct sockaddr *)&local_addr, local, local_len));
-    _Z_RETURN_IF_ERR(_z_sockaddr_to_endpoint((const struct sockaddr *)&remote_addr, remote, remote_len));
+    _Z_RETURN_IF_ERR(_z_sockaddr_to_endpoint((const struct sockaddr *)&local_addr, local_addr_len, local, local_len));
+    _Z_RETURN_IF_ERR(
+        _z_sockaddr_to_endpoint((const struct sockaddr *)&remote_addr, remote_addr_len, remote, remote_len));
     return _Z_RES_OK;
 }
 
@@ -0,0 +1,523 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/link/transport/shm.h"
+
+#if defined(ZENOH_LINUX) && Z_FEATURE_LINK_SHM == 1
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "zenoh-pico/collections/atomic.h"
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/transport/unixsock.h"
+#include "zenoh-pico/utils/logging.h"
+
+#define _Z_SHM_MAGIC 0x7a73686dU  // "zshm"
+#define _Z_SHM_VERSION 1U
+#define _Z_SHM_CACHE_LINE 64U
+#define _Z_SHM_FD_NB 3
+
+/**
+ * Single producer single consumer byte ring control block, followed in the segment by Z_SHM_RING_SIZE bytes of data.
+ *
+ * Members:
+ *   _z_atomic_size_t _head: Total number of bytes written, only updated by the producer.
+ *   _z_atomic_size_t _tail: Total number of bytes read, only updated by the consumer.
+ *   _z_atomic_bool_t _waiting: Set by the consumer before sleeping, the producer then rings the doorbell.
+ *   _z_atomic_bool_t _closed: Set by either side when the channel is closed.
+ */
+typedef struct {
+    _z_atomic_size_t _head;
+    _z_atomic_size_t _tail;
+    _z_atomic_bool_t _waiting;
+    _z_atomic_bool_t _closed;
+} _z_shm_ring_t;
+
+typedef struct {
+    uint32_t _magic;
+    uint32_t _version;
+    uint64_t _ring_size;
+} _z_shm_header_t;
+
+/**
+ * Process local view of a channel: one ring per direction, each with an eventfd used as doorbell. The receive doorbell
+ * is the file descriptor of the socket the channel is attached to, so that it can be waited on like any other socket.
+ */
+typedef struct {
+    void *_segment;
+    size_t _segment_size;
+    _z_shm_ring_t *_rx;
+    _z_shm_ring_t *_tx;
+    int _rx_doorbell;
+    int _tx_doorbell;
+} _z_shm_channel_t;
+
+static size_t _z_shm_align(size_t size) { return (size + _Z_SHM_CACHE_LINE - 1) & ~(size_t)(_Z_SHM_CACHE_LINE - 1); }
+
+static size_t _z_shm_ring_offset(size_t idx) {
+    return _z_shm_align(sizeof(_z_shm_header_t)) +
+           idx * (_z_shm_align(sizeof(_z_shm_ring_t)) + _z_shm_align(Z_SHM_RING_SIZE));
+}
+
+static size_t _z_shm_segment_size(void) { return _z_shm_ring_offset(2); }
+
+static _z_shm_ring_t *_z_shm_ring_get(void *segment, size_t idx) {
+    return (_z_shm_ring_t *)((uint8_t *)segment + _z_shm_ring_offset(idx));
+}
+
+static uint8_t *_z_shm_ring_data(_z_shm_ring_t *ring) {
+    return (uint8_t *)ring + _z_shm_align(sizeof(_z_shm_ring_t));
+}
+
+static void _z_shm_doorbell_ring(int fd) {
+    uint64_t one = 1;
+    ssize_t wb = write(fd, &one, sizeof(one));
+    _ZP_UNUSED(wb);
+}
+
+static void _z_shm_doorbell_clear(int fd) {
+    struct pollfd pfd = {.fd = fd, .events = POLLIN};
+    if ((poll(&pfd, 1, 0) > 0) && ((pfd.revents & POLLIN) != 0)) {
+        uint64_t count;
+        ssize_t rb = read(fd, &count, sizeof(count));
+        _ZP_UNUSED(rb);
+    }
+}
+
+static void _z_shm_ring_notify(_z_shm_ring_t *ring, int doorbell) {
+    bool expected = true;
+    if (_z_atomic_bool_compare_exchange_strong(&ring->_waiting, &expected, false, _z_memory_order_seq_cst,
+                                               _z_memory_order_seq_cst)) {
+        _z_shm_doorbell_ring(doorbell);
+    }
+}
+
+static size_t _z_shm_ring_pending(_z_shm_ring_t *ring) {
+    return _z_atomic_size_load(&ring->_head, _z_memory_order_seq_cst) -
+           _z_atomic_size_load(&ring->_tail, _z_memory_order_relaxed);
+}
+
+// The counters live in memory the other process can write to, a ring they do not describe is closed
+static bool _z_shm_ring_check(_z_shm_ring_t *ring, size_t used) {
+    if (used > Z_SHM_RING_SIZE) {
+        _Z_ERROR("Shared memory ring corrupted, %zu bytes used out of %zu", used, (size_t)Z_SHM_RING_SIZE);
+        _z_atomic_bool_store(&ring->_closed, true, _z_memory_order_seq_cst);
+        return false;
+    }
+    return true;
+}
+
+static size_t _z_shm_ring_pop(_z_shm_ring_t *ring, uint8_t *ptr, size_t len) {
+    size_t tail = _z_atomic_size_load(&ring->_tail, _z_memory_order_relaxed);
+    size_t avail = _z_atomic_size_load(&ring->_head, _z_memory_order_acquire) - tail;
+    if (!_z_shm_ring_check(ring, avail)) {
+        return 0;
+    }
+    size_t n = (avail < len) ? avail : len;
+    if (n > 0) {
+        const uint8_t *data = _z_shm_ring_data(ring);
+        size_t pos = tail % Z_SHM_RING_SIZE;
+        size_t first = (n < Z_SHM_RING_SIZE - pos) ? n : Z_SHM_RING_SIZE - pos;
+        memcpy(ptr, &data[pos], first);
+        memcpy(&ptr[first], data, n - first);
+        _z_atomic_size_store(&ring->_tail, tail + n, _z_memory_order_release);
+    }
+    return n;
+}
+
+static size_t _z_shm_ring_push(_z_shm_ring_t *ring, const uint8_t *ptr, size_t len) {
+    size_t head = _z_atomic_size_load(&ring->_head, _z_memory_order_relaxed);
+    size_t used = head - _z_atomic_size_load(&ring->_tail, _z_memory_order_acquire);
+    if (!_z_shm_ring_check(ring, used)) {
+        return 0;
+    }
+    size_t space = Z_SHM_RING_SIZE - used;
+    size_t n = (space < len) ? space : len;
+    if (n > 0) {
+        uint8_t *data = _z_shm_ring_data(ring);
+        size_t pos = head % Z_SHM_RING_SIZE;
+        size_t first = (n < Z_SHM_RING_SIZE - pos) ? n : Z_SHM_RING_SIZE - pos;
+        memcpy(&data[pos], ptr, first);
+        memcpy(data, &ptr[first], n - first);
+        // Ordered with the load of _waiting in _z_shm_ring_notify
+        _z_atomic_size_store(&ring->_head, head + n, _z_memory_order_seq_cst);
+    }
+    return n;
+}
+
+static void _z_shm_channel_free(_z_shm_channel_t **chan) {
+    _z_shm_channel_t *ptr = *chan;
+    if (ptr != NULL) {
+        if (ptr->_segment != NULL) {
+            munmap(ptr->_segment, ptr->_segment_size);
+        }
+        if (ptr->_rx_doorbell >= 0) {
+            close(ptr->_rx_doorbell);
+        }
+        if (ptr->_tx_doorbell >= 0) {
+            close(ptr->_tx_doorbell);
+        }
+        z_free(ptr);
+        *chan = NULL;
+    }
+}
+
+static _z_shm_channel_t *_z_shm_channel_new(void) {
+    _z_shm_channel_t *chan = (_z_shm_channel_t *)z_malloc(sizeof(_z_shm_channel_t));
+    if (chan != NULL) {
+        chan->_segment = NULL;
+        chan->_segment_size = 0;
+        chan->_rx = NULL;
+        chan->_tx = NULL;
+        chan->_rx_doorbell = -1;
+        chan->_tx_doorbell = -1;
+    }
+    return chan;
+}
+
+static z_result_t _z_shm_channel_map(_z_shm_channel_t *chan, int fd, size_t rx_idx) {
+    void *segment = mmap(NULL, _z_shm_segment_size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (segment == MAP_FAILED) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    chan->_segment = segment;
+    chan->_segment_size = _z_shm_segment_size();
+    chan->_rx = _z_shm_ring_get(segment, rx_idx);
+    chan->_tx = _z_shm_ring_get(segment, 1 - rx_idx);
+    return _Z_RES_OK;
+}
+
+static void _z_shm_channel_attach(_z_shm_channel_t *chan, _z_sys_net_socket_t *sock) {
+    sock->_fd = chan->_rx_doorbell;
+    sock->_shm_chan = chan;
+}
+
+// Create the segment with a unique name and unlink it right away, it lives as long as it is mapped
+static int _z_shm_segment_create(void) {
+    static _z_atomic_size_t counter = {0};
+    char name[64];
+    snprintf(name, sizeof(name), "/zenoh-pico-%d-%zu", (int)getpid(),
+             _z_atomic_size_fetch_add(&counter, 1, _z_memory_order_relaxed));
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return -1;
+    }
+    shm_unlink(name);
+    if (ftruncate(fd, (off_t)_z_shm_segment_size()) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void _z_shm_segment_init(void *segment) {
+    _z_shm_header_t *hdr = (_z_shm_header_t *)segment;
+    hdr->_magic = _Z_SHM_MAGIC;
+    hdr->_version = _Z_SHM_VERSION;
+    hdr->_ring_size = Z_SHM_RING_SIZE;
+    for (size_t i = 0; i < 2; i++) {
+        _z_shm_ring_t *ring = _z_shm_ring_get(segment, i);
+        _z_atomic_size_init(&ring->_head, 0);
+        _z_atomic_size_init(&ring->_tail, 0);
+        _z_atomic_bool_init(&ring->_waiting, false);
+        _z_atomic_bool_init(&ring->_closed, false);
+    }
+}
+
+static bool _z_shm_segment_check(int fd) {
+    struct stat st;
+    if ((fstat(fd, &st) < 0) || ((size_t)st.st_size != _z_shm_segment_size())) {
+        return false;
+    }
+    _z_shm_header_t hdr;
+    if (pread(fd, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr)) {
+        return false;
+    }
+    return (hdr._magic == _Z_SHM_MAGIC) && (hdr._version == _Z_SHM_VERSION) && (hdr._ring_size == Z_SHM_RING_SIZE);
+}
+
+static z_result_t _z_shm_send_fds(int sock_fd, const int fds[_Z_SHM_FD_NB]) {
+    uint8_t version = (uint8_t)_Z_SHM_VERSION;
+    struct iovec iov = {.iov_base = &version, .iov_len = sizeof(version)};
+    union {
+        char buf[CMSG_SPACE(sizeof(int) * _Z_SHM_FD_NB)];
+        struct cmsghdr align;
+    } ctrl;
+    memset(&ctrl, 0, sizeof(ctrl));
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = ctrl.buf;
+    msg.msg_controllen = sizeof(ctrl.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * _Z_SHM_FD_NB);
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * _Z_SHM_FD_NB);
+    if (sendmsg(sock_fd, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof(version)) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_shm_recv_fds(int sock_fd, int fds[_Z_SHM_FD_NB]) {
+    uint8_t version = 0;
+    struct iovec iov = {.iov_base = &version, .iov_len = sizeof(version)};
+    union {
+        char buf[CMSG_SPACE(sizeof(int) * _Z_SHM_FD_NB)];
+        struct cmsghdr align;
+    } ctrl;
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = ctrl.buf;
+    msg.msg_controllen = sizeof(ctrl.buf);
+    if (recvmsg(sock_fd, &msg, MSG_CMSG_CLOEXEC) != (ssize_t)sizeof(version)) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if ((cmsg == NULL) || (cmsg->cmsg_level != SOL_SOCKET) || (cmsg->cmsg_type != SCM_RIGHTS) ||
+        (cmsg->cmsg_len != CMSG_LEN(sizeof(int) * _Z_SHM_FD_NB))) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * _Z_SHM_FD_NB);
+    if ((version != _Z_SHM_VERSION) || ((msg.msg_flags & MSG_CTRUNC) != 0)) {
+        for (size_t i = 0; i < _Z_SHM_FD_NB; i++) {
+            close(fds[i]);
+        }
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    return _Z_RES_OK;
+}
+
+// The connecting side creates the segment and both doorbells, then hands them over through the Unix socket
+z_result_t _z_shm_open(_z_sys_net_socket_t *sock, const char *path, uint32_t tout) {
+    sock->_fd = -1;
+    sock->_shm_chan = NULL;
+    _z_sys_net_socket_t rdv = {0};
+    _Z_RETURN_IF_ERR(_z_unixsock_stream_open(&rdv, path, tout));
+
+    z_result_t ret = _Z_RES_OK;
+    _z_shm_channel_t *chan = _z_shm_channel_new();
+    int seg_fd = _z_shm_segment_create();
+    if ((chan == NULL) || (seg_fd < 0)) {
+        _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    }
+    if (ret == _Z_RES_OK) {
+        chan->_rx_doorbell = eventfd(0, EFD_CLOEXEC);
+        chan->_tx_doorbell = eventfd(0, EFD_CLOEXEC);
+        if ((chan->_rx_doorbell < 0) || (chan->_tx_doorbell < 0)) {
+            _Z_ERROR_LOG(_Z_ERR_GENERIC);
+            ret = _Z_ERR_GENERIC;
+        }
+    }
+    // Ring 0 carries data from the connecting side to the accepting side
+    _Z_SET_IF_OK(ret, _z_shm_channel_map(chan, seg_fd, 1));
+    if (ret == _Z_RES_OK) {
+        _z_shm_segment_init(chan->_segment);
+        int fds[_Z_SHM_FD_NB] = {seg_fd, chan->_tx_doorbell, chan->_rx_doorbell};
+        ret = _z_shm_send_fds(rdv._fd, fds);
+    }
+    if (ret == _Z_RES_OK) {
+        // The listener may only accept the rendezvous on its next accept attempt
+        z_clock_t deadline = z_clock_now();
+        z_clock_advance_ms(&deadline, Z_TRANSPORT_CONNECT_TIMEOUT);
+        uint8_t ack = 0;
+        size_t rb = _z_unixsock_read(rdv, &ack, sizeof(ack));
+        while (rb == SIZE_MAX) {
+            z_clock_t now = z_clock_now();
+            if (zp_clock_elapsed_ms_since(&deadline, &now) == 0) {
+                break;
+            }
+            rb = _z_unixsock_read(rdv, &ack, sizeof(ack));
+        }
+        if ((rb != sizeof(ack)) || (ack != (uint8_t)_Z_SHM_VERSION)) {
+            _Z_DEBUG("No shared memory handshake acknowledgement from %s", path);
+            _Z_ERROR_LOG(_Z_ERR_GENERIC);
+            ret = _Z_ERR_GENERIC;
+        }
+    }
+    if (seg_fd >= 0) {
+        close(seg_fd);
+    }
+    _z_unixsock_close(&rdv, NULL, false);
+    if (ret != _Z_RES_OK) {
+        _z_shm_channel_free(&chan);
+        return ret;
+    }
+    _z_shm_channel_attach(chan, sock);
+    return _Z_RES_OK;
+}
+
+z_result_t _z_shm_listen(_z_sys_net_socket_t *sock, const char *path) {
+    sock->_shm_chan = NULL;
+    return _z_unixsock_stream_listen(sock, path);
+}
+
+z_result_t _z_shm_accept(const _z_sys_net_socket_t *sock_in, _z_sys_net_socket_t *sock_out) {
+    sock_out->_fd = -1;
+    sock_out->_shm_chan = NULL;
+    _z_sys_net_socket_t rdv = {0};
+    _Z_RETURN_IF_ERR(_z_unixsock_stream_accept(sock_in, &rdv));
+
+    int fds[_Z_SHM_FD_NB] = {-1, -1, -1};
+    z_result_t ret = _z_shm_recv_fds(rdv._fd, fds);
+    _z_shm_channel_t *chan = NULL;
+    if (ret == _Z_RES_OK) {
+        chan = _z_shm_channel_new();
+        if (chan == NULL) {
+            close(fds[1]);
+            close(fds[2]);
+            _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+            ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        } else {
+            chan->_rx_doorbell = fds[1];
+            chan->_tx_doorbell = fds[2];
+        }
+    }
+    if ((ret == _Z_RES_OK) && !_z_shm_segment_check(fds[0])) {
+        _Z_INFO("Refusing shared memory segment with a different layout");
+        _Z_ERROR_LOG(_Z_ERR_GENERIC);
+        ret = _Z_ERR_GENERIC;
+    }
+    _Z_SET_IF_OK(ret, _z_shm_channel_map(chan, fds[0], 0));
+    if (ret == _Z_RES_OK) {
+        uint8_t ack = (uint8_t)_Z_SHM_VERSION;
+        if (_z_unixsock_write(rdv, &ack, sizeof(ack)) != sizeof(ack)) {
+            _Z_ERROR_LOG(_Z_ERR_GENERIC);
+            ret = _Z_ERR_GENERIC;
+        }
+    }
+    if (fds[0] >= 0) {
+        close(fds[0]);
+    }
+    _z_unixsock_close(&rdv, NULL, false);
+    if (ret != _Z_RES_OK) {
+        _z_shm_channel_free(&chan);
+        return ret;
+    }
+    _z_shm_channel_attach(chan, sock_out);
+    return _Z_RES_OK;
+}
+
+void _z_close_shm_socket(_z_sys_net_socket_t *sock) {
+    _z_shm_channel_t *chan = (_z_shm_channel_t *)sock->_shm_chan;
+    if (chan == NULL) {
+        return;
+    }
+    _z_atomic_bool_store(&chan->_tx->_closed, true, _z_memory_order_seq_cst);
+    _z_atomic_bool_store(&chan->_rx->_closed, true, _z_memory_order_seq_cst);
+    // Wake up the remote reader so that it notices the channel is closed
+    _z_shm_doorbell_ring(chan->_tx_doorbell);
+    _z_shm_channel_free(&chan);
+    sock->_shm_chan = NULL;
+    sock->_fd = -1;
+}
+
+void _z_shm_close(_z_sys_net_socket_t *sock, const char *path, bool bound) {
+    if (sock->_shm_chan != NULL) {
+        _z_close_shm_socket(sock);
+    } else {
+        _z_unixsock_close(sock, path, bound);
+    }
+}
+
+size_t _z_shm_read(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    _z_shm_channel_t *chan = (_z_shm_channel_t *)sock._shm_chan;
+    if (chan == NULL) {
+        return SIZE_MAX;
+    }
+    _z_shm_ring_t *ring = chan->_rx;
+    for (;;) {
+        size_t n = _z_shm_ring_pop(ring, ptr, len);
+        if (n > 0) {
+            if (_z_shm_ring_pending(ring) > 0) {
+                // Keep the doorbell readable until the ring is drained
+                _z_shm_doorbell_ring(chan->_rx_doorbell);
+            }
+            return n;
+        }
+        if (_z_atomic_bool_load(&ring->_closed, _z_memory_order_acquire)) {
+            return 0;
+        }
+        // Clear the doorbell before arming it, a write landing in between then rings it again
+        _z_shm_doorbell_clear(chan->_rx_doorbell);
+        _z_atomic_bool_store(&ring->_waiting, true, _z_memory_order_seq_cst);
+        if (_z_shm_ring_pending(ring) > 0) {
+            continue;
+        }
+        int flags = fcntl(chan->_rx_doorbell, F_GETFL, 0);
+        if ((flags < 0) || ((flags & O_NONBLOCK) != 0)) {
+            return SIZE_MAX;
+        }
+        struct pollfd pfd = {.fd = chan->_rx_doorbell, .events = POLLIN};
+        if (poll(&pfd, 1, (int)Z_CONFIG_SOCKET_TIMEOUT) <= 0) {
+            return SIZE_MAX;
+        }
+    }
+}
+
+size_t _z_shm_read_exact(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    size_t n = 0;
+    do {
+        size_t rb = _z_shm_read(sock, &ptr[n], len - n);
+        if ((rb == SIZE_MAX) || (rb == 0)) {
+            n = rb;
+            break;
+        }
+        n += rb;
+    } while (n != len);
+    return n;
+}
+
+size_t _z_shm_write(_z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
+    _z_shm_channel_t *chan = (_z_shm_channel_t *)sock._shm_chan;
+    if (chan == NULL) {
+        return SIZE_MAX;
+    }
+    _z_shm_ring_t *ring = chan->_tx;
+    size_t n = 0;
+    uint32_t waited = 0;
+    while (n < len) {
+        if (_z_atomic_bool_load(&ring->_closed, _z_memory_order_acquire)) {
+            return SIZE_MAX;
+        }
+        size_t wb = _z_shm_ring_push(ring, &ptr[n], len - n);
+        if (wb > 0) {
+            n += wb;
+            waited = 0;
+            _z_shm_ring_notify(ring, chan->_tx_doorbell);
+        } else if (waited >= Z_TRANSPORT_LEASE) {
+            // The reader is gone or stuck, give up like a socket send timeout would
+            return SIZE_MAX;
+        } else {
+            // The ring is full, the reader has been woken up already and frees space as it goes
+            z_sleep_ms(1);
+            waited++;
+        }
+    }
+    return n;
+}
+
+#endif /* defined(ZENOH_LINUX) && Z_FEATURE_LINK_SHM == 1 */
@@ -29,6 +29,7 @@
 #include <unistd.h>
 
 #include "zenoh-pico/config.h"
+#include "zenoh-pico/system/platform/unix/io_uring.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
@@ -262,6 +263,12 @@ static void _z_tcp_posix_close(_z_sys_net_socket_t *sock) {
 }
 
 static size_t _z_tcp_posix_read(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+    size_t received = 0;
+    if (_z_io_uring_recv(sock._fd, ptr, len, &received)) {
+        return received;
+    }
+#endif
     ssize_t rb = recv(sock._fd, ptr, len, 0);
     if (rb < (ssize_t)0) {
         if (errno != EAGAIN) {
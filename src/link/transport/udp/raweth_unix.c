@@ -23,10 +23,12 @@
 #include <net/if.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -93,18 +95,15 @@ size_t _z_send_raweth(const _z_sys_net_socket_t *sock, const void *buff, size_t
     return (size_t)wb;
 }
 
-size_t _z_receive_raweth(const _z_sys_net_socket_t *sock, void *buff, size_t buff_len, _z_slice_t *addr,
-                         const _zp_raweth_whitelist_array_t *whitelist) {
-    // Read from socket
-    ssize_t bytesRead = recvfrom(sock->_fd, buff, buff_len, 0, NULL, NULL);
-    if ((bytesRead <= 0) || (bytesRead < (ssize_t)sizeof(_zp_eth_header_t))) {
-        return SIZE_MAX;
+static bool _z_raweth_accept_frame(const uint8_t *frame, size_t len, _z_slice_t *addr,
+                                   const _zp_raweth_whitelist_array_t *whitelist) {
+    if (len < sizeof(_zp_eth_header_t)) {
+        return false;
     }
-    bool is_valid = true;
+    const _zp_eth_header_t *header = (const _zp_eth_header_t *)frame;
     // Address filtering (only if there is a whitelist)
     if (_zp_raweth_whitelist_array_len(whitelist) > 0) {
-        is_valid = false;
-        const _zp_eth_header_t *header = (_zp_eth_header_t *)buff;
+        bool is_valid = false;
         for (size_t i = 0; i < _zp_raweth_whitelist_array_len(whitelist); i++) {
             const _zp_raweth_whitelist_entry_t *entry = _zp_raweth_whitelist_array_get(whitelist, i);
             if (memcmp(&header->smac, entry->_mac, _ZP_MAC_ADDR_LENGTH) == 0) {
@@ -112,20 +111,229 @@ size_t _z_receive_raweth(const _z_sys_net_socket_t *sock, void *buff, size_t buf
                 break;
             }
         }
-    }
-    // Ignore packet from unknown sources
-    if (!is_valid) {
-        return SIZE_MAX;
+        // Ignore packet from unknown sources
+        if (!is_valid) {
+            return false;
+        }
     }
     // Copy sender mac if needed
     if (addr != NULL) {
-        uint8_t *header_addr = (uint8_t *)buff;
-        addr->len = sizeof(ETH_ALEN);
-        (void)memcpy((uint8_t *)addr->start, (header_addr + ETH_ALEN), sizeof(ETH_ALEN));
+        addr->len = _ZP_MAC_ADDR_LENGTH;
+        (void)memcpy((uint8_t *)addr->start, header->smac, _ZP_MAC_ADDR_LENGTH);
+    }
+    return true;
+}
+
+size_t _z_receive_raweth(const _z_sys_net_socket_t *sock, void *buff, size_t buff_len, _z_slice_t *addr,
+                         const _zp_raweth_whitelist_array_t *whitelist) {
+    // Read from socket
+    ssize_t bytesRead = recvfrom(sock->_fd, buff, buff_len, 0, NULL, NULL);
+    if ((bytesRead <= 0) || !_z_raweth_accept_frame((const uint8_t *)buff, (size_t)bytesRead, addr, whitelist)) {
+        return SIZE_MAX;
     }
     return (size_t)bytesRead;
 }
 
+#if Z_RAWETH_RING_BLOCK_NB > 0
+// Each transmit slot holds one ethernet frame, vlan tag included, after its descriptor
+#define _Z_RAWETH_RING_FRAME_SIZE 2048
+#define _Z_RAWETH_RING_FRAME_NB ((Z_RAWETH_RING_BLOCK_SIZE / _Z_RAWETH_RING_FRAME_SIZE) * Z_RAWETH_RING_BLOCK_NB)
+// TPACKET_ALIGN masks with an int, align in size_t to stay clear of sign conversions
+#define _Z_RAWETH_RING_TX_DATA_OFFSET \
+    ((sizeof(struct tpacket3_hdr) + (size_t)TPACKET_ALIGNMENT - 1) & ~((size_t)TPACKET_ALIGNMENT - 1))
+#define _Z_RAWETH_RING_LEN ((size_t)Z_RAWETH_RING_BLOCK_SIZE * Z_RAWETH_RING_BLOCK_NB)
+
+#if (Z_RAWETH_RING_BLOCK_SIZE % _Z_RAWETH_RING_FRAME_SIZE) != 0
+#error "Z_RAWETH_RING_BLOCK_SIZE must be a multiple of 2048, the size of a ring frame"
+#endif
+
+struct _z_raweth_ring_t {
+    // Receive ring followed by the transmit ring
+    uint8_t *_map;
+    // Receive ring: blocks of frames handed over by the kernel once full or timed out
+    size_t _rx_block;
+    const struct tpacket3_hdr *_rx_frame;  // Next frame of the current block, NULL if not handed over yet
+    uint32_t _rx_left;
+    // Transmit ring: one frame per slot
+    size_t _tx_head;
+    size_t _tx_pending;
+};
+
+static void _z_raweth_ring_release(const _z_sys_net_socket_t *sock, int ring_opt) {
+    struct tpacket_req3 req;
+    memset(&req, 0, sizeof(req));
+    (void)setsockopt(sock->_fd, SOL_PACKET, ring_opt, &req, sizeof(req));
+}
+
+_z_raweth_ring_t *_z_raweth_ring_new(const _z_sys_net_socket_t *sock) {
+    int version = TPACKET_V3;
+    if (setsockopt(sock->_fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) != 0) {
+        _Z_DEBUG("TPACKET_V3 not supported, using system calls");
+        return NULL;
+    }
+    // The kernel rejects blocks that are not made of whole pages
+    long page_size = sysconf(_SC_PAGESIZE);
+    if ((page_size <= 0) || ((Z_RAWETH_RING_BLOCK_SIZE % page_size) != 0)) {
+        _Z_DEBUG("Z_RAWETH_RING_BLOCK_SIZE is not a multiple of the page size, using system calls");
+        return NULL;
+    }
+    // Skip malformed frames instead of stalling the transmit ring
+    int loss = 1;
+    (void)setsockopt(sock->_fd, SOL_PACKET, PACKET_LOSS, &loss, sizeof(loss));
+    struct tpacket_req3 req;
+    memset(&req, 0, sizeof(req));
+    req.tp_block_size = Z_RAWETH_RING_BLOCK_SIZE;
+    req.tp_block_nr = Z_RAWETH_RING_BLOCK_NB;
+    req.tp_frame_size = _Z_RAWETH_RING_FRAME_SIZE;
+    req.tp_frame_nr = _Z_RAWETH_RING_FRAME_NB;
+    // The transmit ring has no block timeout
+    if (setsockopt(sock->_fd, SOL_PACKET, PACKET_TX_RING, &req, sizeof(req)) != 0) {
+        _Z_DEBUG("TPACKET_V3 transmit ring not supported, using system calls");
+        return NULL;
+    }
+    req.tp_retire_blk_tov = Z_RAWETH_RING_BLOCK_TIMEOUT;
+    if (setsockopt(sock->_fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) != 0) {
+        _Z_DEBUG("TPACKET_V3 receive ring not supported, using system calls");
+        _z_raweth_ring_release(sock, PACKET_TX_RING);
+        return NULL;
+    }
+    _z_raweth_ring_t *ring = (_z_raweth_ring_t *)z_malloc(sizeof(_z_raweth_ring_t));
+    void *map = MAP_FAILED;
+    if (ring != NULL) {
+        map = mmap(NULL, 2 * _Z_RAWETH_RING_LEN, PROT_READ | PROT_WRITE, MAP_SHARED, sock->_fd, 0);
+    }
+    if (map == MAP_FAILED) {
+        _Z_DEBUG("Failed to map raweth rings, using system calls");
+        z_free(ring);
+        _z_raweth_ring_release(sock, PACKET_RX_RING);
+        _z_raweth_ring_release(sock, PACKET_TX_RING);
+        return NULL;
+    }
+    memset(ring, 0, sizeof(_z_raweth_ring_t));
+    ring->_map = (uint8_t *)map;
+    return ring;
+}
+
+void _z_raweth_ring_free(_z_raweth_ring_t **ring) {
+    _z_raweth_ring_t *ptr = *ring;
+    if (ptr == NULL) {
+        return;
+    }
+    (void)munmap(ptr->_map, 2 * _Z_RAWETH_RING_LEN);
+    z_free(ptr);
+    *ring = NULL;
+}
+
+static struct tpacket3_hdr *_z_raweth_ring_tx_frame(_z_raweth_ring_t *ring, size_t idx) {
+    return (struct tpacket3_hdr *)(ring->_map + _Z_RAWETH_RING_LEN + (idx * _Z_RAWETH_RING_FRAME_SIZE));
+}
+
+size_t _z_raweth_ring_send(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock, const void *buff, size_t buff_len) {
+    if (buff_len > (_Z_RAWETH_RING_FRAME_SIZE - _Z_RAWETH_RING_TX_DATA_OFFSET)) {
+        return SIZE_MAX;
+    }
+    struct tpacket3_hdr *frame = _z_raweth_ring_tx_frame(ring, ring->_tx_head);
+    if (__atomic_load_n(&frame->tp_status, __ATOMIC_ACQUIRE) != TP_STATUS_AVAILABLE) {
+        // Ring full, wait for the queued frames to go out
+        if ((_z_raweth_ring_flush(ring, sock) != _Z_RES_OK) ||
+            (__atomic_load_n(&frame->tp_status, __ATOMIC_ACQUIRE) != TP_STATUS_AVAILABLE)) {
+            return SIZE_MAX;
+        }
+    }
+    (void)memcpy((uint8_t *)frame + _Z_RAWETH_RING_TX_DATA_OFFSET, buff, buff_len);
+    frame->tp_len = (uint32_t)buff_len;
+    frame->tp_next_offset = 0;
+    __atomic_store_n(&frame->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+    ring->_tx_head = (ring->_tx_head + 1) % _Z_RAWETH_RING_FRAME_NB;
+    ring->_tx_pending++;
+    return buff_len;
+}
+
+z_result_t _z_raweth_ring_flush(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock) {
+    if (ring->_tx_pending == 0) {
+        return _Z_RES_OK;
+    }
+    ring->_tx_pending = 0;
+    // Blocks until the kernel is done with all the frames
+    if (send(sock->_fd, NULL, 0, 0) < 0) {
+        _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_TX_FAILED);
+    }
+    return _Z_RES_OK;
+}
+
+size_t _z_raweth_ring_receive(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock, void *buff, size_t buff_len,
+                              _z_slice_t *addr, const _zp_raweth_whitelist_array_t *whitelist) {
+    for (;;) {
+        struct tpacket_block_desc *block =
+            (struct tpacket_block_desc *)(ring->_map + (ring->_rx_block * Z_RAWETH_RING_BLOCK_SIZE));
+        if (ring->_rx_frame == NULL) {
+            if ((__atomic_load_n(&block->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0) {
+                // Wait for the kernel to hand the block over, giving the read task a chance to stop
+                struct pollfd pfd = {.fd = sock->_fd, .events = POLLIN, .revents = 0};
+                if (poll(&pfd, 1, (int)Z_CONFIG_SOCKET_TIMEOUT) <= 0) {
+                    return SIZE_MAX;
+                }
+                continue;
+            }
+            ring->_rx_frame = (const struct tpacket3_hdr *)((uint8_t *)block + block->hdr.bh1.offset_to_first_pkt);
+            ring->_rx_left = block->hdr.bh1.num_pkts;
+        }
+        size_t len = SIZE_MAX;
+        if (ring->_rx_left > 0) {
+            const struct tpacket3_hdr *frame = ring->_rx_frame;
+            const uint8_t *data = (const uint8_t *)frame + frame->tp_mac;
+            if (_z_raweth_accept_frame(data, frame->tp_snaplen, addr, whitelist)) {
+                len = (frame->tp_snaplen < buff_len) ? frame->tp_snaplen : buff_len;
+                (void)memcpy(buff, data, len);
+            }
+            ring->_rx_frame = (const struct tpacket3_hdr *)((const uint8_t *)frame + frame->tp_next_offset);
+            ring->_rx_left--;
+        }
+        if (ring->_rx_left == 0) {
+            // Give the block back to the kernel
+            __atomic_store_n(&block->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+            ring->_rx_block = (ring->_rx_block + 1) % Z_RAWETH_RING_BLOCK_NB;
+            ring->_rx_frame = NULL;
+        }
+        if (len != SIZE_MAX) {
+            return len;
+        }
+    }
+}
+#else
+_z_raweth_ring_t *_z_raweth_ring_new(const _z_sys_net_socket_t *sock) {
+    _ZP_UNUSED(sock);
+    return NULL;
+}
+
+void _z_raweth_ring_free(_z_raweth_ring_t **ring) { *ring = NULL; }
+
+size_t _z_raweth_ring_send(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock, const void *buff, size_t buff_len) {
+    _ZP_UNUSED(ring);
+    _ZP_UNUSED(sock);
+    _ZP_UNUSED(buff);
+    _ZP_UNUSED(buff_len);
+    return SIZE_MAX;
+}
+
+z_result_t _z_raweth_ring_flush(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock) {
+    _ZP_UNUSED(ring);
+    _ZP_UNUSED(sock);
+    _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_NOT_AVAILABLE);
+}
+
+size_t _z_raweth_ring_receive(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock, void *buff, size_t buff_len,
+                              _z_slice_t *addr, const _zp_raweth_whitelist_array_t *whitelist) {
+    _ZP_UNUSED(ring);
+    _ZP_UNUSED(sock);
+    _ZP_UNUSED(buff);
+    _ZP_UNUSED(buff_len);
+    _ZP_UNUSED(addr);
+    _ZP_UNUSED(whitelist);
+    return SIZE_MAX;
+}
+#endif  // Z_RAWETH_RING_BLOCK_NB > 0
+
 uint16_t _z_raweth_ntohs(uint16_t val) { return ntohs(val); }
 
 uint16_t _z_raweth_htons(uint16_t val) { return htons(val); }
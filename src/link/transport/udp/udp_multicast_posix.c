@@ -324,62 +324,85 @@ void _z_close_udp_multicast(_z_sys_net_socket_t *sockrecv, _z_sys_net_socket_t *
     }
 }
 
-size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len, const _z_sys_net_endpoint_t lep,
-                             _z_slice_t *addr) {
-    struct sockaddr_storage raddr;
-    unsigned int replen = sizeof(struct sockaddr_storage);
-
-    ssize_t rb = 0;
-    do {
-        rb = recvfrom(sock._fd, ptr, len, 0, (struct sockaddr *)&raddr, &replen);
-        if (rb < (ssize_t)0) {
-            return SIZE_MAX;
+// Returns true if the datagram was not sent by the local endpoint, and then fills addr with the sender address
+static bool _z_udp_multicast_posix_is_remote(const struct sockaddr_storage *raddr, const _z_sys_net_endpoint_t lep,
+                                             _z_slice_t *addr) {
+    if (lep._iptcp->ai_family == AF_INET) {
+        struct sockaddr_in *a = ((struct sockaddr_in *)lep._iptcp->ai_addr);
+        const struct sockaddr_in *b = ((const struct sockaddr_in *)raddr);
+        if (!((a->sin_port == b->sin_port) && (a->sin_addr.s_addr == b->sin_addr.s_addr))) {
+            if (addr != NULL) {
+                assert(addr->len >= sizeof(in_addr_t) + sizeof(in_port_t));
+                addr->len = sizeof(in_addr_t) + sizeof(in_port_t);
+                // flawfinder: ignore
+                (void)memcpy((uint8_t *)addr->start, &b->sin_addr.s_addr, sizeof(in_addr_t));
+                // flawfinder: ignore
+                (void)memcpy((uint8_t *)(addr->start + sizeof(in_addr_t)), &b->sin_port, sizeof(in_port_t));
+            }
+            return true;
         }
+    } else if (lep._iptcp->ai_family == AF_INET6) {
+        struct sockaddr_in6 *a = ((struct sockaddr_in6 *)lep._iptcp->ai_addr);
+        const struct sockaddr_in6 *b = ((const struct sockaddr_in6 *)raddr);
+        if (!((a->sin6_port == b->sin6_port) &&
+              (memcmp(a->sin6_addr.s6_addr, b->sin6_addr.s6_addr, sizeof(struct in6_addr)) == 0))) {
+            if (addr != NULL) {
+                assert(addr->len >= sizeof(struct in6_addr) + sizeof(in_port_t));
+                addr->len = sizeof(struct in6_addr) + sizeof(in_port_t);
+                // flawfinder: ignore
+                (void)memcpy((uint8_t *)addr->start, &b->sin6_addr.s6_addr, sizeof(struct in6_addr));
+                // flawfinder: ignore
+                (void)memcpy((uint8_t *)(addr->start + sizeof(struct in6_addr)), &b->sin6_port, sizeof(in_port_t));
+            }
+            return true;
+        }
+    }
+    return false;
+}
 
-        if (lep._iptcp->ai_family == AF_INET) {
-            struct sockaddr_in *a = ((struct sockaddr_in *)lep._iptcp->ai_addr);
-            struct sockaddr_in *b = ((struct sockaddr_in *)&raddr);
-            if (!((a->sin_port == b->sin_port) && (a->sin_addr.s_addr == b->sin_addr.s_addr))) {
-                if (addr != NULL) {
-                    assert(addr->len >= sizeof(in_addr_t) + sizeof(in_port_t));
-                    addr->len = sizeof(in_addr_t) + sizeof(in_port_t);
-                    // flawfinder: ignore
-                    (void)memcpy((uint8_t *)addr->start, &b->sin_addr.s_addr, sizeof(in_addr_t));
-                    // flawfinder: ignore
-                    (void)memcpy((uint8_t *)(addr->start + sizeof(in_addr_t)), &b->sin_port, sizeof(in_port_t));
-                }
-                break;
+static size_t _z_udp_multicast_posix_recv(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr, size_t len,
+                                          const _z_sys_net_endpoint_t lep, _z_slice_t *addr) {
+    size_t rb = 0;
+    do {
+#if defined(ZENOH_LINUX)
+        if (gro != NULL) {
+            const void *raddr = NULL;
+            rb = _z_udp_gro_read(sock, gro, ptr, len, &raddr);
+            if (rb == SIZE_MAX) {
+                return SIZE_MAX;
             }
-        } else if (lep._iptcp->ai_family == AF_INET6) {
-            struct sockaddr_in6 *a = ((struct sockaddr_in6 *)lep._iptcp->ai_addr);
-            struct sockaddr_in6 *b = ((struct sockaddr_in6 *)&raddr);
-            if (!((a->sin6_port == b->sin6_port) &&
-                  (memcmp(a->sin6_addr.s6_addr, b->sin6_addr.s6_addr, sizeof(struct in6_addr)) == 0))) {
-                if (addr != NULL) {
-                    assert(addr->len >= sizeof(struct in6_addr) + sizeof(in_port_t));
-                    addr->len = sizeof(struct in6_addr) + sizeof(in_port_t);
-                    // flawfinder: ignore
-                    (void)memcpy((uint8_t *)addr->start, &b->sin6_addr.s6_addr, sizeof(struct in6_addr));
-                    // flawfinder: ignore
-                    (void)memcpy((uint8_t *)(addr->start + sizeof(struct in6_addr)), &b->sin6_port, sizeof(in_port_t));
-                }
+            if (_z_udp_multicast_posix_is_remote((const struct sockaddr_storage *)raddr, lep, addr)) {
                 break;
             }
-        } else {
+            // The kernel only coalesces datagrams of a same sender, the rest of our own batch can be dropped
+            _z_udp_gro_discard(gro);
             continue;
         }
+#else
+        _ZP_UNUSED(gro);
+#endif
+        struct sockaddr_storage raddr;
+        unsigned int replen = sizeof(struct sockaddr_storage);
+        ssize_t ret = recvfrom(sock._fd, ptr, len, 0, (struct sockaddr *)&raddr, &replen);
+        if (ret < (ssize_t)0) {
+            return SIZE_MAX;
+        }
+        rb = (size_t)ret;
+        if (_z_udp_multicast_posix_is_remote(&raddr, lep, addr)) {
+            break;
+        }
     } while (1);
 
-    return (size_t)rb;
+    return rb;
 }
 
-size_t _z_read_exact_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len,
-                                   const _z_sys_net_endpoint_t lep, _z_slice_t *addr) {
+static size_t _z_udp_multicast_posix_recv_exact(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr,
+                                                size_t len, const _z_sys_net_endpoint_t lep, _z_slice_t *addr) {
     size_t n = 0;
     uint8_t *pos = &ptr[0];
 
     do {
-        size_t rb = _z_read_udp_multicast(sock, pos, len - n, lep, addr);
+        size_t rb = _z_udp_multicast_posix_recv(sock, gro, pos, len - n, lep, addr);
         if ((rb == SIZE_MAX) || (rb == 0)) {
             n = rb;
             break;
@@ -392,6 +415,16 @@ size_t _z_read_exact_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr,
     return n;
 }
 
+size_t _z_read_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len, const _z_sys_net_endpoint_t lep,
+                             _z_slice_t *addr) {
+    return _z_udp_multicast_posix_recv(sock, NULL, ptr, len, lep, addr);
+}
+
+size_t _z_read_exact_udp_multicast(const _z_sys_net_socket_t sock, uint8_t *ptr, size_t len,
+                                   const _z_sys_net_endpoint_t lep, _z_slice_t *addr) {
+    return _z_udp_multicast_posix_recv_exact(sock, NULL, ptr, len, lep, addr);
+}
+
 size_t _z_send_udp_multicast(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len,
                              const _z_sys_net_endpoint_t rep) {
     return (size_t)sendto(sock._fd, ptr, len, 0, rep._iptcp->ai_addr, rep._iptcp->ai_addrlen);
@@ -433,4 +466,16 @@ size_t _z_udp_multicast_write(const _z_sys_net_socket_t sock, const uint8_t *ptr
     return _z_send_udp_multicast(sock, ptr, len, rep);
 }
 
+#if defined(ZENOH_LINUX)
+size_t _z_udp_multicast_read_gro(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr, size_t len,
+                                 const _z_sys_net_endpoint_t lep, _z_slice_t *ep) {
+    return _z_udp_multicast_posix_recv(sock, gro, ptr, len, lep, ep);
+}
+
+size_t _z_udp_multicast_read_exact_gro(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr, size_t len,
+                                       const _z_sys_net_endpoint_t lep, _z_slice_t *ep) {
+    return _z_udp_multicast_posix_recv_exact(sock, gro, ptr, len, lep, ep);
+}
+#endif
+
 #endif
@@ -16,6 +16,7 @@
 
 #if defined(ZP_PLATFORM_SOCKET_POSIX)
 
+#include <errno.h>
 #include <netdb.h>
 #include <stddef.h>
 #include <string.h>
@@ -26,6 +27,35 @@
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
+#if defined(ZENOH_LINUX)
+#include <netinet/in.h>
+#include <netinet/udp.h>
+
+#ifndef SOL_UDP
+#define SOL_UDP IPPROTO_UDP
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+// Kernel limits of a single segmented send: number of segments and IPv4 datagram payload
+#define _Z_UDP_GSO_MAX_SEGMENTS 64
+#define _Z_UDP_GSO_MAX_LEN 65507
+// Largest coalesced reception, bounded by the size of an IP packet
+#define _Z_UDP_GRO_BUF_SIZE 65535
+
+struct _z_udp_gro_t {
+    struct sockaddr_storage _raddr;
+    size_t _len;
+    size_t _pos;
+    size_t _segment;
+    uint8_t _buf[_Z_UDP_GRO_BUF_SIZE];
+};
+#endif
+
 static z_result_t _z_udp_posix_endpoint_init(_z_sys_net_endpoint_t *ep, const char *s_address, const char *s_port) {
     z_result_t ret = _Z_RES_OK;
 
@@ -121,6 +151,162 @@ static size_t _z_udp_posix_write(_z_sys_net_socket_t sock, const uint8_t *ptr, s
     return (size_t)sendto(sock._fd, ptr, len, 0, endpoint._iptcp->ai_addr, endpoint._iptcp->ai_addrlen);
 }
 
+#if defined(ZENOH_LINUX)
+bool _z_udp_gso_supported(const _z_sys_net_socket_t sock) {
+    int segment = 0;
+    socklen_t len = sizeof(segment);
+    return getsockopt(sock._fd, SOL_UDP, UDP_SEGMENT, &segment, &len) == 0;
+}
+
+static ssize_t _z_udp_posix_send_segments(int fd, const uint8_t *ptr, size_t len, uint16_t segment,
+                                          const struct addrinfo *addr) {
+    struct iovec iov = {.iov_base = (void *)ptr, .iov_len = len};
+    union {
+        char buf[CMSG_SPACE(sizeof(uint16_t))];
+        struct cmsghdr align;
+    } control;
+    memset(&control, 0, sizeof(control));
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = addr->ai_addr;
+    msg.msg_namelen = addr->ai_addrlen;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+    memcpy(CMSG_DATA(cmsg), &segment, sizeof(uint16_t));
+    return sendmsg(fd, &msg, 0);
+}
+
+// Sends the datagrams of a chunk one by one
+static bool _z_udp_posix_send_each(int fd, const uint8_t *ptr, size_t len, size_t segment,
+                                   const struct addrinfo *addr) {
+    for (size_t n = 0; n < len; n += segment) {
+        size_t dlen = ((len - n) < segment) ? (len - n) : segment;
+        if (sendto(fd, ptr + n, dlen, 0, addr->ai_addr, addr->ai_addrlen) != (ssize_t)dlen) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t _z_udp_write_segments(const _z_sys_net_socket_t sock, const uint8_t *ptr, size_t len, size_t segment,
+                             const _z_sys_net_endpoint_t endpoint, bool *offload_failed) {
+    *offload_failed = false;
+    if ((segment == 0) || (segment > UINT16_MAX)) {
+        return SIZE_MAX;
+    }
+    size_t per_send = _Z_UDP_GSO_MAX_LEN / segment;
+    if (per_send > _Z_UDP_GSO_MAX_SEGMENTS) {
+        per_send = _Z_UDP_GSO_MAX_SEGMENTS;
+    }
+    size_t chunk_max = per_send * segment;
+    size_t n = 0;
+    while (n < len) {
+        size_t chunk = ((len - n) < chunk_max) ? (len - n) : chunk_max;
+        bool sent = false;
+        if ((chunk > segment) && !*offload_failed) {
+            sent = _z_udp_posix_send_segments(sock._fd, ptr + n, chunk, (uint16_t)segment, endpoint._iptcp) ==
+                   (ssize_t)chunk;
+            if (!sent) {
+                // E.g. EINVAL when the segment does not fit in the path MTU, or EIO without checksum offload
+                _Z_DEBUG("Segmented send failed with errno %d, sending datagrams one by one", errno);
+            }
+        }
+        if (!sent) {
+            if (!_z_udp_posix_send_each(sock._fd, ptr + n, chunk, segment, endpoint._iptcp)) {
+                return SIZE_MAX;
+            }
+            // The datagrams went through on their own, so the offload is what failed
+            *offload_failed = *offload_failed || (chunk > segment);
+        }
+        n += chunk;
+    }
+    return n;
+}
+
+_z_udp_gro_t *_z_udp_gro_new(const _z_sys_net_socket_t sock) {
+    int on = 1;
+    if (setsockopt(sock._fd, SOL_UDP, UDP_GRO, &on, sizeof(on)) != 0) {
+        return NULL;
+    }
+    _z_udp_gro_t *gro = (_z_udp_gro_t *)z_malloc(sizeof(_z_udp_gro_t));
+    if (gro == NULL) {
+        on = 0;
+        (void)setsockopt(sock._fd, SOL_UDP, UDP_GRO, &on, sizeof(on));
+        return NULL;
+    }
+    gro->_len = 0;
+    gro->_pos = 0;
+    gro->_segment = 0;
+    return gro;
+}
+
+void _z_udp_gro_free(_z_udp_gro_t **gro) {
+    z_free(*gro);
+    *gro = NULL;
+}
+
+static size_t _z_udp_posix_gro_recv(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro) {
+    struct iovec iov = {.iov_base = gro->_buf, .iov_len = sizeof(gro->_buf)};
+    union {
+        char buf[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &gro->_raddr;
+    msg.msg_namelen = sizeof(gro->_raddr);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    ssize_t rb = recvmsg(sock._fd, &msg, 0);
+    if (rb < 0) {
+        return SIZE_MAX;
+    }
+    gro->_len = (size_t)rb;
+    gro->_pos = 0;
+    // Without the control message, a single datagram was received
+    gro->_segment = (size_t)rb;
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if ((cmsg->cmsg_level == SOL_UDP) && (cmsg->cmsg_type == UDP_GRO)) {
+            int segment = 0;
+            memcpy(&segment, CMSG_DATA(cmsg), sizeof(int));
+            if (segment > 0) {
+                gro->_segment = (size_t)segment;
+            }
+        }
+    }
+    return gro->_len;
+}
+
+size_t _z_udp_gro_read(const _z_sys_net_socket_t sock, _z_udp_gro_t *gro, uint8_t *ptr, size_t len,
+                       const void **raddr) {
+    if (gro->_pos >= gro->_len) {
+        if (_z_udp_posix_gro_recv(sock, gro) == SIZE_MAX) {
+            return SIZE_MAX;
+        }
+    }
+    size_t left = gro->_len - gro->_pos;
+    size_t datagram = (left < gro->_segment) ? left : gro->_segment;
+    size_t copied = (datagram < len) ? datagram : len;
+    memcpy(ptr, &gro->_buf[gro->_pos], copied);
+    gro->_pos += datagram;
+    if (raddr != NULL) {
+        *raddr = &gro->_raddr;
+    }
+    return copied;
+}
+
+void _z_udp_gro_discard(_z_udp_gro_t *gro) { gro->_pos = gro->_len; }
+#endif
+
 z_result_t _z_udp_unicast_endpoint_init(_z_sys_net_endpoint_t *ep, const char *address, const char *port) {
     return _z_udp_posix_endpoint_init(ep, address, port);
 }
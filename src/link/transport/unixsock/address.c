@@ -0,0 +1,39 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/transport/unixsock.h"
+
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+
+// The whole address is the path of the socket file, e.g. unixsock-stream//tmp/zenoh.sock
+char *_z_unixsock_address_parse_path(const _z_string_t *address) {
+    size_t len = _z_string_len(address);
+    if ((len == 0) || (len >= _Z_UNIXSOCK_PATH_MAX) || (memchr(_z_string_data(address), '\0', len) != NULL)) {
+        return NULL;
+    }
+    return _z_str_n_clone(_z_string_data(address), len);
+}
+
+z_result_t _z_unixsock_address_valid(const _z_string_t *address) {
+    char *path = _z_unixsock_address_parse_path(address);
+    z_result_t ret = (path != NULL) ? _Z_RES_OK : _Z_ERR_CONFIG_LOCATOR_INVALID;
+
+    z_free(path);
+    return ret;
+}
+
+#endif
@@ -0,0 +1,220 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/link/transport/unixsock.h"
+
+#if defined(ZP_PLATFORM_SOCKET_POSIX) && Z_FEATURE_LINK_UNIXSOCK == 1
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/utils/logging.h"
+#include "zenoh-pico/utils/pointers.h"
+
+static z_result_t _z_unixsock_posix_addr(struct sockaddr_un *addr, const char *path) {
+    size_t len = strlen(path);
+    if ((len == 0) || (len >= sizeof(addr->sun_path))) {
+        _Z_ERROR_RETURN(_Z_ERR_CONFIG_LOCATOR_INVALID);
+    }
+    (void)memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    (void)memcpy(addr->sun_path, path, len);
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_unixsock_posix_set_options(int fd, uint32_t tout) {
+    z_time_t tv;
+    tv.tv_sec = (time_t)(tout / (uint32_t)1000);
+    tv.tv_usec = (suseconds_t)((tout % (uint32_t)1000) * (uint32_t)1000);
+    if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, (char *)&tv, sizeof(tv)) < 0) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+#if defined(ZENOH_MACOS) || defined(ZENOH_BSD)
+    int nosigpipe_val = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, (void *)&nosigpipe_val, sizeof(int));
+#endif
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_unixsock_posix_open(_z_sys_net_socket_t *sock, int type, const char *path, uint32_t tout) {
+    struct sockaddr_un addr;
+    _Z_RETURN_IF_ERR(_z_unixsock_posix_addr(&addr, path));
+
+    sock->_fd = socket(AF_UNIX, type, 0);
+    if (sock->_fd == -1) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    z_result_t ret = _z_unixsock_posix_set_options(sock->_fd, tout);
+    if ((ret == _Z_RES_OK) && (type == SOCK_DGRAM)) {
+        // The peer needs an address to reply to, let the kernel pick an unused abstract one
+#if defined(ZENOH_LINUX)
+        struct sockaddr_un local = {.sun_family = AF_UNIX};
+        if (bind(sock->_fd, (struct sockaddr *)&local, sizeof(sa_family_t)) < 0) {
+            _Z_ERROR_LOG(_Z_ERR_GENERIC);
+            ret = _Z_ERR_GENERIC;
+        }
+#else
+        _Z_ERROR_LOG(_Z_ERR_TRANSPORT_NOT_AVAILABLE);
+        ret = _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+#endif
+    }
+    if ((ret == _Z_RES_OK) && (connect(sock->_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)) {
+        _Z_DEBUG("connect() failed for %s: %s", path, strerror(errno));
+        _Z_ERROR_LOG(_Z_ERR_GENERIC);
+        ret = _Z_ERR_GENERIC;
+    }
+    if (ret != _Z_RES_OK) {
+        close(sock->_fd);
+        sock->_fd = -1;
+    }
+    return ret;
+}
+
+static z_result_t _z_unixsock_posix_stream_listen(_z_sys_net_socket_t *sock, const char *path) {
+    struct sockaddr_un addr;
+    _Z_RETURN_IF_ERR(_z_unixsock_posix_addr(&addr, path));
+
+    sock->_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock->_fd == -1) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    z_result_t ret = _Z_RES_OK;
+#if defined(ZENOH_MACOS) || defined(ZENOH_BSD)
+    int nosigpipe_val = 1;
+    setsockopt(sock->_fd, SOL_SOCKET, SO_NOSIGPIPE, (void *)&nosigpipe_val, sizeof(int));
+#endif
+    // An existing socket file is left untouched, it may belong to a running process
+    if (bind(sock->_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        _Z_DEBUG("bind() failed for %s: %s", path, strerror(errno));
+        _Z_ERROR_LOG(_Z_ERR_GENERIC);
+        ret = _Z_ERR_GENERIC;
+    } else if (listen(sock->_fd, Z_LISTEN_MAX_CONNECTION_NB) < 0) {
+        _Z_DEBUG("listen() failed for %s: %s", path, strerror(errno));
+        _Z_ERROR_LOG(_Z_ERR_GENERIC);
+        ret = _Z_ERR_GENERIC;
+        unlink(path);
+    }
+    if (ret != _Z_RES_OK) {
+        close(sock->_fd);
+        sock->_fd = -1;
+    }
+    return ret;
+}
+
+static z_result_t _z_unixsock_posix_stream_accept(const _z_sys_net_socket_t *sock_in, _z_sys_net_socket_t *sock_out) {
+    sock_out->_fd = -1;
+    int con_socket = accept(sock_in->_fd, NULL, NULL);
+    if (con_socket < 0) {
+        if (errno == EBADF) {
+            _Z_ERROR_RETURN(_Z_ERR_INVALID);
+        } else {
+            _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+        }
+    }
+    if (_z_unixsock_posix_set_options(con_socket, Z_CONFIG_SOCKET_TIMEOUT) != _Z_RES_OK) {
+        close(con_socket);
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    sock_out->_fd = con_socket;
+    return _Z_RES_OK;
+}
+
+static void _z_unixsock_posix_close(_z_sys_net_socket_t *sock, const char *path, bool bound) {
+    if (sock->_fd >= 0) {
+        shutdown(sock->_fd, SHUT_RDWR);
+        close(sock->_fd);
+        sock->_fd = -1;
+        if (bound && (path != NULL)) {
+            unlink(path);
+        }
+    }
+}
+
+static size_t _z_unixsock_posix_read(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    ssize_t rb = recv(sock._fd, ptr, len, 0);
+    if (rb < (ssize_t)0) {
+        if (errno != EAGAIN) {
+            _Z_DEBUG("Errno: %d\n", errno);
+        }
+        return SIZE_MAX;
+    }
+    return (size_t)rb;
+}
+
+static size_t _z_unixsock_posix_read_exact(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    size_t n = 0;
+    uint8_t *pos = &ptr[0];
+
+    do {
+        size_t rb = _z_unixsock_posix_read(sock, pos, len - n);
+        if ((rb == SIZE_MAX) || (rb == 0)) {
+            n = rb;
+            break;
+        }
+
+        n += rb;
+        pos = _z_ptr_u8_offset(pos, (ptrdiff_t)rb);
+    } while (n != len);
+
+    return n;
+}
+
+static size_t _z_unixsock_posix_write(_z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
+#if defined(ZENOH_LINUX)
+    return (size_t)send(sock._fd, ptr, len, MSG_NOSIGNAL);
+#else
+    return (size_t)send(sock._fd, ptr, len, 0);
+#endif
+}
+
+z_result_t _z_unixsock_stream_open(_z_sys_net_socket_t *sock, const char *path, uint32_t tout) {
+    return _z_unixsock_posix_open(sock, SOCK_STREAM, path, tout);
+}
+
+z_result_t _z_unixsock_stream_listen(_z_sys_net_socket_t *sock, const char *path) {
+    return _z_unixsock_posix_stream_listen(sock, path);
+}
+
+z_result_t _z_unixsock_stream_accept(const _z_sys_net_socket_t *sock_in, _z_sys_net_socket_t *sock_out) {
+    return _z_unixsock_posix_stream_accept(sock_in, sock_out);
+}
+
+z_result_t _z_unixsock_dgram_open(_z_sys_net_socket_t *sock, const char *path, uint32_t tout) {
+    return _z_unixsock_posix_open(sock, SOCK_DGRAM, path, tout);
+}
+
+void _z_unixsock_close(_z_sys_net_socket_t *sock, const char *path, bool bound) {
+    _z_unixsock_posix_close(sock, path, bound);
+}
+
+size_t _z_unixsock_read(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    return _z_unixsock_posix_read(sock, ptr, len);
+}
+
+size_t _z_unixsock_read_exact(_z_sys_net_socket_t sock, uint8_t *ptr, size_t len) {
+    return _z_unixsock_posix_read_exact(sock, ptr, len);
+}
+
+size_t _z_unixsock_write(_z_sys_net_socket_t sock, const uint8_t *ptr, size_t len) {
+    return _z_unixsock_posix_write(sock, ptr, len);
+}
+
+#endif /* defined(ZP_PLATFORM_SOCKET_POSIX) && Z_FEATURE_LINK_UNIXSOCK == 1 */
@@ -17,8 +17,11 @@
 #if Z_FEATURE_LINK_TLS == 1
 
 #include <errno.h>
+#include <netdb.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -36,8 +39,11 @@
 #include "mbedtls/version.h"
 #include "mbedtls/x509.h"
 #include "mbedtls/x509_crt.h"
+#include "zenoh-pico/collections/atomic.h"
+#include "zenoh-pico/collections/string.h"
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/link/config/tls.h"
+#include "zenoh-pico/system/platform.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
@@ -151,6 +157,214 @@ static bool _z_opt_is_true(const char *val) {
     return !(c == '0' || c == 'n' || c == 'N' || c == 'f' || c == 'F');
 }
 
+/*------------------ Client session cache ------------------*/
+#define _Z_TLS_SESSION_DIGEST_SIZE 32
+
+static int _z_tls_session_digest_crt(mbedtls_md_context_t *md, const mbedtls_x509_crt *crt) {
+    int ret = 0;
+    for (; (ret == 0) && (crt != NULL) && (crt->raw.len > 0); crt = crt->next) {
+        ret = mbedtls_md_update(md, crt->raw.p, crt->raw.len);
+    }
+    return ret;
+}
+
+// Digest of what the server was verified with and of what the client proved its identity with
+static bool _z_tls_session_digest(const _z_tls_context_t *ctx, bool verify_name,
+                                  unsigned char digest[_Z_TLS_SESSION_DIGEST_SIZE]) {
+    const mbedtls_md_info_t *info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    if (info == NULL) {
+        return false;
+    }
+    mbedtls_md_context_t md;
+    mbedtls_md_init(&md);
+    const unsigned char flags[2] = {verify_name ? 1 : 0, ctx->_enable_mtls ? 1 : 0};
+    // Certificates are DER encoded, so that their concatenation is unambiguous
+    int ret = mbedtls_md_setup(&md, info, 0);
+    if (ret == 0) {
+        ret = mbedtls_md_starts(&md);
+    }
+    if (ret == 0) {
+        ret = mbedtls_md_update(&md, flags, sizeof(flags));
+    }
+    if (ret == 0) {
+        ret = _z_tls_session_digest_crt(&md, &ctx->_ca_cert);
+    }
+    if ((ret == 0) && ctx->_enable_mtls) {
+        ret = _z_tls_session_digest_crt(&md, &ctx->_client_cert);
+    }
+    if (ret == 0) {
+        ret = mbedtls_md_finish(&md, digest);
+    }
+    mbedtls_md_free(&md);
+    return ret == 0;
+}
+
+// Sessions are identified by the server name they were verified against, the address they were established with and
+// the verification and identity settings of the link, so that a link never resumes a session it could not establish
+static char *_z_tls_session_key_new(const _z_tls_context_t *ctx, const char *hostname,
+                                    const _z_sys_net_endpoint_t *rep, bool verify_name) {
+    char host[NI_MAXHOST];
+    char serv[NI_MAXSERV];
+    if (getnameinfo(rep->_iptcp->ai_addr, rep->_iptcp->ai_addrlen, host, sizeof(host), serv, sizeof(serv),
+                    NI_NUMERICHOST | NI_NUMERICSERV) != 0) {
+        return NULL;
+    }
+    unsigned char digest[_Z_TLS_SESSION_DIGEST_SIZE];
+    if (!_z_tls_session_digest(ctx, verify_name, digest)) {
+        return NULL;
+    }
+    size_t len = strlen(hostname) + strlen(host) + strlen(serv) + (2 * sizeof(digest)) + 4;
+    char *key = (char *)z_malloc(len);
+    if (key != NULL) {
+        int n = snprintf(key, len, "%s/%s:%s/", hostname, host, serv);
+        for (size_t i = 0; i < sizeof(digest); i++) {
+            n += snprintf(&key[n], len - (size_t)n, "%02x", digest[i]);
+        }
+    }
+    return key;
+}
+
+#if Z_TLS_SESSION_CACHE_SIZE > 0
+typedef struct {
+    char *_key;  // NULL if the entry is free
+    mbedtls_ssl_session _session;
+    uint32_t _last_use;
+} _z_tls_session_entry_t;
+
+static _z_tls_session_entry_t _z_tls_session_cache[Z_TLS_SESSION_CACHE_SIZE];
+static uint32_t _z_tls_session_clock = 0;
+#if Z_FEATURE_MULTI_THREAD == 1
+#define _Z_TLS_SESSION_MUTEX_UNINIT 0
+#define _Z_TLS_SESSION_MUTEX_INITIALIZING 1
+#define _Z_TLS_SESSION_MUTEX_READY 2
+
+static _z_mutex_t _z_tls_session_mutex;
+static _z_atomic_size_t _z_tls_session_mutex_state = {_Z_TLS_SESSION_MUTEX_UNINIT};
+#endif
+
+static inline void _z_tls_session_cache_lock(void) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    // There is no static mutex initializer on all platforms, so the first link to use the cache initializes it
+    size_t state = _Z_TLS_SESSION_MUTEX_UNINIT;
+    if (_z_atomic_size_compare_exchange_strong(&_z_tls_session_mutex_state, &state, _Z_TLS_SESSION_MUTEX_INITIALIZING,
+                                               _z_memory_order_acquire, _z_memory_order_acquire)) {
+        if (_z_mutex_init(&_z_tls_session_mutex) != _Z_RES_OK) {
+            _Z_ERROR("Failed to initialize the TLS session cache mutex");
+        }
+        _z_atomic_size_store(&_z_tls_session_mutex_state, _Z_TLS_SESSION_MUTEX_READY, _z_memory_order_release);
+    } else {
+        while (_z_atomic_size_load(&_z_tls_session_mutex_state, _z_memory_order_acquire) !=
+               _Z_TLS_SESSION_MUTEX_READY) {
+            (void)z_sleep_ms(1);
+        }
+    }
+    (void)_z_mutex_lock(&_z_tls_session_mutex);
+#endif
+}
+
+static inline void _z_tls_session_cache_unlock(void) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    (void)_z_mutex_unlock(&_z_tls_session_mutex);
+#endif
+}
+
+// Must be called with the cache locked
+static _z_tls_session_entry_t *_z_tls_session_cache_get(const char *key) {
+    for (size_t i = 0; i < Z_TLS_SESSION_CACHE_SIZE; i++) {
+        if ((_z_tls_session_cache[i]._key != NULL) && (strcmp(_z_tls_session_cache[i]._key, key) == 0)) {
+            return &_z_tls_session_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// Must be called with the cache locked
+static void _z_tls_session_entry_clear(_z_tls_session_entry_t *entry) {
+    z_free(entry->_key);
+    entry->_key = NULL;
+    mbedtls_ssl_session_free(&entry->_session);
+}
+
+static bool _z_tls_session_cache_load(const char *key, mbedtls_ssl_context *ssl) {
+    bool loaded = false;
+    _z_tls_session_cache_lock();
+    _z_tls_session_entry_t *entry = _z_tls_session_cache_get(key);
+    if (entry != NULL) {
+        loaded = mbedtls_ssl_set_session(ssl, &entry->_session) == 0;
+        entry->_last_use = ++_z_tls_session_clock;
+    }
+    _z_tls_session_cache_unlock();
+    return loaded;
+}
+
+static void _z_tls_session_cache_store(const char *key, const mbedtls_ssl_context *ssl) {
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+    // Fails if there is nothing to resume yet, e.g. no TLS 1.3 ticket received, or if the session was already stored
+    if (mbedtls_ssl_get_session(ssl, &session) != 0) {
+        mbedtls_ssl_session_free(&session);
+        return;
+    }
+
+    _z_tls_session_cache_lock();
+    _z_tls_session_entry_t *entry = _z_tls_session_cache_get(key);
+    if (entry == NULL) {
+        // Take a free entry, else evict the least recently used one
+        for (size_t i = 0; i < Z_TLS_SESSION_CACHE_SIZE; i++) {
+            _z_tls_session_entry_t *curr = &_z_tls_session_cache[i];
+            if (curr->_key == NULL) {
+                entry = curr;
+                break;
+            }
+            if ((entry == NULL) || (curr->_last_use < entry->_last_use)) {
+                entry = curr;
+            }
+        }
+        _z_tls_session_entry_clear(entry);
+        entry->_key = _z_str_clone(key);
+    }
+    if (entry->_key != NULL) {
+        mbedtls_ssl_session_free(&entry->_session);
+        entry->_session = session;
+        entry->_last_use = ++_z_tls_session_clock;
+    } else {
+        mbedtls_ssl_session_free(&session);
+    }
+    _z_tls_session_cache_unlock();
+}
+
+static void _z_tls_session_cache_remove(const char *key) {
+    _z_tls_session_cache_lock();
+    _z_tls_session_entry_t *entry = _z_tls_session_cache_get(key);
+    if (entry != NULL) {
+        _z_tls_session_entry_clear(entry);
+    }
+    _z_tls_session_cache_unlock();
+}
+#else
+static bool _z_tls_session_cache_load(const char *key, mbedtls_ssl_context *ssl) {
+    _ZP_UNUSED(key);
+    _ZP_UNUSED(ssl);
+    return false;
+}
+
+static void _z_tls_session_cache_store(const char *key, const mbedtls_ssl_context *ssl) {
+    _ZP_UNUSED(key);
+    _ZP_UNUSED(ssl);
+}
+
+static void _z_tls_session_cache_remove(const char *key) { _ZP_UNUSED(key); }
+#endif
+
+// Only called on full handshakes, as a resumed session does not carry the server certificate
+static int _z_tls_verify_full_handshake(void *ctx, mbedtls_x509_crt *crt, int depth, uint32_t *flags) {
+    _ZP_UNUSED(crt);
+    _ZP_UNUSED(depth);
+    _ZP_UNUSED(flags);
+    ((_z_tls_context_t *)ctx)->_resumed = false;
+    return 0;
+}
+
 static int _z_tls_bio_send(void *ctx, const unsigned char *buf, size_t len) {
     int fd = *(int *)ctx;
     ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
@@ -193,7 +407,12 @@ static _z_tls_context_t *_z_tls_context_new(void) {
     mbedtls_x509_crt_init(&ctx->_listen_cert);
     mbedtls_pk_init(&ctx->_client_key);
     mbedtls_x509_crt_init(&ctx->_client_cert);
+#if defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_init(&ctx->_ticket);
+#endif
+    ctx->_session_key = NULL;
     ctx->_enable_mtls = false;
+    ctx->_resumed = false;
 #ifdef ZENOH_LOG_TRACE
     mbedtls_debug_set_threshold(4);
     mbedtls_ssl_conf_dbg(&ctx->_ssl_config, _z_tls_debug, NULL);
@@ -221,6 +440,10 @@ static void _z_tls_context_free(_z_tls_context_t **ctx) {
         mbedtls_x509_crt_free(&(*ctx)->_listen_cert);
         mbedtls_pk_free(&(*ctx)->_client_key);
         mbedtls_x509_crt_free(&(*ctx)->_client_cert);
+#if defined(MBEDTLS_SSL_TICKET_C)
+        mbedtls_ssl_ticket_free(&(*ctx)->_ticket);
+#endif
+        z_free((*ctx)->_session_key);
         z_free(*ctx);
         *ctx = NULL;
     }
@@ -372,6 +595,12 @@ z_result_t _z_open_tls(_z_tls_socket_t *sock, const _z_sys_net_endpoint_t *rep,
     if (mtls_opt != NULL && _z_opt_is_true(mtls_opt)) {
         enable_mtls = true;
     }
+
+    bool cache_session = false;
+    const char *cache_opt = _z_str_intmap_get(config, TLS_CONFIG_SESSION_CACHE_KEY);
+    if (cache_opt != NULL && _z_opt_is_true(cache_opt)) {
+        cache_session = true;
+    }
     sock->_tls_ctx = _z_tls_context_new();
     if (sock->_tls_ctx == NULL) {
         _Z_ERROR("Failed to create TLS context");
@@ -419,6 +648,14 @@ z_result_t _z_open_tls(_z_tls_socket_t *sock, const _z_sys_net_endpoint_t *rep,
     mbedtls_ssl_conf_authmode(&sock->_tls_ctx->_ssl_config,
                               verify_name ? MBEDTLS_SSL_VERIFY_REQUIRED : MBEDTLS_SSL_VERIFY_OPTIONAL);
     mbedtls_ssl_conf_rng(&sock->_tls_ctx->_ssl_config, mbedtls_hmac_drbg_random, &sock->_tls_ctx->_hmac_drbg);
+    mbedtls_ssl_conf_verify(&sock->_tls_ctx->_ssl_config, _z_tls_verify_full_handshake, sock->_tls_ctx);
+#if defined(MBEDTLS_SSL_TLS1_3_SIGNAL_NEW_SESSION_TICKETS_ENABLED)
+    if (cache_session) {
+        // Have TLS 1.3 tickets, received after the handshake, reported by mbedtls_ssl_read so that they are cached
+        mbedtls_ssl_conf_tls13_enable_signal_new_session_tickets(&sock->_tls_ctx->_ssl_config,
+                                                                 MBEDTLS_SSL_TLS1_3_SIGNAL_NEW_SESSION_TICKETS_ENABLED);
+    }
+#endif
 
     if (enable_mtls) {
         int own_ret = mbedtls_ssl_conf_own_cert(&sock->_tls_ctx->_ssl_config, &sock->_tls_ctx->_client_cert,
@@ -454,17 +691,36 @@ z_result_t _z_open_tls(_z_tls_socket_t *sock, const _z_sys_net_endpoint_t *rep,
         return _Z_ERR_GENERIC;
     }
 
+    bool resuming = false;
+    if (cache_session) {
+        sock->_tls_ctx->_session_key = _z_tls_session_key_new(sock->_tls_ctx, hostname, rep, verify_name);
+        if (sock->_tls_ctx->_session_key != NULL) {
+            resuming = _z_tls_session_cache_load(sock->_tls_ctx->_session_key, &sock->_tls_ctx->_ssl);
+        }
+        if (resuming) {
+            _Z_DEBUG("Resuming TLS session with %s", sock->_tls_ctx->_session_key);
+        }
+    }
+    sock->_tls_ctx->_resumed = resuming;
+
     mbedtls_ssl_set_bio(&sock->_tls_ctx->_ssl, &sock->_sock._fd, _z_tls_bio_send, _z_tls_bio_recv, NULL);
 
     while ((mbedret = mbedtls_ssl_handshake(&sock->_tls_ctx->_ssl)) != 0) {
         if (mbedret != MBEDTLS_ERR_SSL_WANT_READ && mbedret != MBEDTLS_ERR_SSL_WANT_WRITE) {
             _Z_ERROR("TLS handshake failed: -0x%04x", -mbedret);
+            if (resuming) {
+                _z_tls_session_cache_remove(sock->_tls_ctx->_session_key);
+            }
             _z_tcp_close(&sock->_sock);
             _z_tls_context_free(&sock->_tls_ctx);
             return _Z_ERR_GENERIC;
         }
     }
 
+    if (resuming && !sock->_tls_ctx->_resumed) {
+        _Z_DEBUG("TLS session with %s not resumed, the server ran a full handshake", sock->_tls_ctx->_session_key);
+    }
+
     uint32_t ignored_flags = verify_name ? 0u : MBEDTLS_X509_BADCERT_CN_MISMATCH;
     uint32_t verify_result = mbedtls_ssl_get_verify_result(&sock->_tls_ctx->_ssl);
     if (verify_result != 0) {
@@ -479,9 +735,31 @@ z_result_t _z_open_tls(_z_tls_socket_t *sock, const _z_sys_net_endpoint_t *rep,
         }
     }
 
+    if (sock->_tls_ctx->_session_key != NULL) {
+        _z_tls_session_cache_store(sock->_tls_ctx->_session_key, &sock->_tls_ctx->_ssl);
+    }
     return _Z_RES_OK;
 }
 
+// Session tickets are an optimization: listening goes on without them if they cannot be set up
+static void _z_tls_setup_session_tickets(_z_tls_context_t *ctx, uint32_t lifetime) {
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    int ret = mbedtls_ssl_ticket_setup(&ctx->_ticket, mbedtls_hmac_drbg_random, &ctx->_hmac_drbg,
+                                       MBEDTLS_CIPHER_AES_256_GCM, lifetime);
+    if (ret != 0) {
+        _Z_WARN("Failed to set up TLS session tickets: -0x%04x", -ret);
+        return;
+    }
+    mbedtls_ssl_conf_session_tickets_cb(&ctx->_ssl_config, mbedtls_ssl_ticket_write, mbedtls_ssl_ticket_parse,
+                                        &ctx->_ticket);
+    _Z_DEBUG("Issuing TLS session tickets valid for %u s", (unsigned)lifetime);
+#else
+    _ZP_UNUSED(ctx);
+    _ZP_UNUSED(lifetime);
+    _Z_WARN("Mbed TLS is built without session tickets support, ignoring '%s'", TLS_CONFIG_SESSION_TICKET_LIFETIME_STR);
+#endif
+}
+
 z_result_t _z_listen_tls(_z_tls_socket_t *sock, const _z_sys_net_endpoint_t *rep, const _z_str_intmap_t *config) {
     if ((rep == NULL) || (rep->_iptcp == NULL)) {
         _Z_ERROR("Invalid lower TCP endpoint for TLS listen");
@@ -553,6 +831,14 @@ z_result_t _z_listen_tls(_z_tls_socket_t *sock, const _z_sys_net_endpoint_t *rep
                               enable_mtls ? MBEDTLS_SSL_VERIFY_REQUIRED : MBEDTLS_SSL_VERIFY_NONE);
     mbedtls_ssl_conf_rng(&sock->_tls_ctx->_ssl_config, mbedtls_hmac_drbg_random, &sock->_tls_ctx->_hmac_drbg);
 
+    const char *lifetime_str = _z_str_intmap_get(config, TLS_CONFIG_SESSION_TICKET_LIFETIME_KEY);
+    if (lifetime_str != NULL) {
+        uint32_t lifetime = (uint32_t)strtoul(lifetime_str, NULL, 10);
+        if (lifetime > 0) {
+            _z_tls_setup_session_tickets(sock->_tls_ctx, lifetime);
+        }
+    }
+
     return _Z_RES_OK;
 }
 
@@ -659,6 +945,10 @@ void _z_close_tls_socket(_z_sys_net_socket_t *socket) {
 
 void _z_close_tls(_z_tls_socket_t *sock) {
     if (sock->_tls_ctx != NULL) {
+        // A TLS 1.3 session can only be resumed with a ticket received after the handshake
+        if (sock->_tls_ctx->_session_key != NULL) {
+            _z_tls_session_cache_store(sock->_tls_ctx->_session_key, &sock->_tls_ctx->_ssl);
+        }
         mbedtls_ssl_close_notify(&sock->_tls_ctx->_ssl);
         _z_tls_context_free(&sock->_tls_ctx);
     }
@@ -681,6 +971,15 @@ size_t _z_read_tls(const _z_tls_socket_t *sock, uint8_t *ptr, size_t len) {
         return 0;
     }
 
+#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+    if (ret == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET) {
+        if (sock->_tls_ctx->_session_key != NULL) {
+            _z_tls_session_cache_store(sock->_tls_ctx->_session_key, &sock->_tls_ctx->_ssl);
+        }
+        return 0;
+    }
+#endif
+
     if (ret == 0 || ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY || ret == MBEDTLS_ERR_SSL_CONN_EOF) {
         return SIZE_MAX;
     }
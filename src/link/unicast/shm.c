@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdlib.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/manager.h"
+#include "zenoh-pico/link/transport/shm.h"
+#include "zenoh-pico/link/transport/unixsock.h"
+
+#if Z_FEATURE_LINK_SHM == 1
+
+z_result_t _z_endpoint_shm_valid(_z_endpoint_t *endpoint) {
+    _z_string_t shm_str = _z_string_alias_str(SHM_SCHEMA);
+    if (!_z_string_equals(&endpoint->_locator._protocol, &shm_str)) {
+        _Z_ERROR_LOG(_Z_ERR_CONFIG_LOCATOR_INVALID);
+        return _Z_ERR_CONFIG_LOCATOR_INVALID;
+    }
+
+    // The address is the path of the Unix socket used to set up the channel
+    z_result_t ret = _z_unixsock_address_valid(&endpoint->_locator._address);
+    if (ret != _Z_RES_OK) {
+        _Z_ERROR_LOG(_Z_ERR_CONFIG_LOCATOR_INVALID);
+    }
+    return ret;
+}
+
+z_result_t _z_f_link_open_shm(_z_link_t *zl) {
+    return _z_shm_open(&zl->_socket._shm._sock, zl->_socket._shm._path, Z_CONFIG_SOCKET_TIMEOUT);
+}
+
+z_result_t _z_f_link_listen_shm(_z_link_t *zl) {
+    z_result_t ret = _z_shm_listen(&zl->_socket._shm._sock, zl->_socket._shm._path);
+    zl->_socket._shm._bound = (ret == _Z_RES_OK);
+    return ret;
+}
+
+void _z_f_link_close_shm(_z_link_t *zl) {
+    _z_shm_close(&zl->_socket._shm._sock, zl->_socket._shm._path, zl->_socket._shm._bound);
+    zl->_socket._shm._bound = false;
+}
+
+void _z_f_link_free_shm(_z_link_t *zl) {
+    z_free(zl->_socket._shm._path);
+    zl->_socket._shm._path = NULL;
+}
+
+size_t _z_f_link_write_shm(const _z_link_t *zl, const uint8_t *ptr, size_t len, _z_sys_net_socket_t *socket) {
+    if (socket != NULL) {
+        return _z_shm_write(*socket, ptr, len);
+    } else {
+        return _z_shm_write(zl->_socket._shm._sock, ptr, len);
+    }
+}
+
+size_t _z_f_link_write_all_shm(const _z_link_t *zl, const uint8_t *ptr, size_t len) {
+    return _z_shm_write(zl->_socket._shm._sock, ptr, len);
+}
+
+size_t _z_f_link_read_shm(const _z_link_t *zl, uint8_t *ptr, size_t len, _z_slice_t *addr) {
+    _ZP_UNUSED(addr);
+    return _z_shm_read(zl->_socket._shm._sock, ptr, len);
+}
+
+size_t _z_f_link_read_exact_shm(const _z_link_t *zl, uint8_t *ptr, size_t len, _z_slice_t *addr,
+                                _z_sys_net_socket_t *socket) {
+    _ZP_UNUSED(addr);
+    if (socket != NULL) {
+        return _z_shm_read_exact(*socket, ptr, len);
+    } else {
+        return _z_shm_read_exact(zl->_socket._shm._sock, ptr, len);
+    }
+}
+
+size_t _z_f_link_shm_read_socket(const _z_sys_net_socket_t socket, uint8_t *ptr, size_t len) {
+    return _z_shm_read(socket, ptr, len);
+}
+
+uint16_t _z_get_link_mtu_shm(void) {
+    // Batches are length-prefixed on 16 bits on stream links
+    return 65535;
+}
+
+z_result_t _z_new_peer_shm(_z_endpoint_t *endpoint, _z_sys_net_socket_t *socket) {
+    char *path = _z_unixsock_address_parse_path(&endpoint->_locator._address);
+    if (path == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_CONFIG_LOCATOR_INVALID);
+    }
+    z_result_t ret = _z_shm_open(socket, path, Z_CONFIG_SOCKET_TIMEOUT);
+    z_free(path);
+    return ret;
+}
+
+z_result_t _z_new_link_shm(_z_link_t *zl, _z_endpoint_t *endpoint) {
+    zl->_type = _Z_LINK_TYPE_SHM;
+    zl->_cap._transport = Z_LINK_CAP_TRANSPORT_UNICAST;
+    zl->_cap._flow = Z_LINK_CAP_FLOW_STREAM;
+    zl->_cap._is_reliable = true;
+
+    zl->_mtu = _z_get_link_mtu_shm();
+
+    zl->_endpoint = *endpoint;
+    zl->_socket._shm._sock._fd = -1;
+    zl->_socket._shm._sock._shm_chan = NULL;
+    zl->_socket._shm._bound = false;
+    zl->_socket._shm._path = _z_unixsock_address_parse_path(&endpoint->_locator._address);
+    z_result_t ret = (zl->_socket._shm._path != NULL) ? _Z_RES_OK : _Z_ERR_CONFIG_LOCATOR_INVALID;
+
+    zl->_open_f = _z_f_link_open_shm;
+    zl->_listen_f = _z_f_link_listen_shm;
+    zl->_close_f = _z_f_link_close_shm;
+    zl->_free_f = _z_f_link_free_shm;
+
+    zl->_write_f = _z_f_link_write_shm;
+    zl->_write_all_f = _z_f_link_write_all_shm;
+    zl->_read_f = _z_f_link_read_shm;
+    zl->_read_exact_f = _z_f_link_read_exact_shm;
+    zl->_read_socket_f = _z_f_link_shm_read_socket;
+
+    return ret;
+}
+#endif
@@ -19,6 +19,7 @@
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/link/manager.h"
 #include "zenoh-pico/link/transport/tcp.h"
+#include "zenoh-pico/system/platform/unix/io_uring.h"
 
 #if Z_FEATURE_LINK_TCP == 1
 
@@ -60,6 +61,14 @@ size_t _z_f_link_write_tcp(const _z_link_t *zl, const uint8_t *ptr, size_t len,
     }
 }
 
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+size_t _z_f_link_write_sockets_tcp(const _z_link_t *zl, const uint8_t *ptr, size_t len,
+                                   _z_sys_net_socket_t *const *sockets, size_t nb) {
+    _ZP_UNUSED(zl);
+    return _z_io_uring_send(ptr, len, sockets, nb);
+}
+#endif
+
 size_t _z_f_link_write_all_tcp(const _z_link_t *zl, const uint8_t *ptr, size_t len) {
     return _z_tcp_write(zl->_socket._tcp._sock, ptr, len);
 }
@@ -123,6 +132,9 @@ z_result_t _z_new_link_tcp(_z_link_t *zl, _z_endpoint_t *endpoint) {
     zl->_read_f = _z_f_link_read_tcp;
     zl->_read_exact_f = _z_f_link_read_exact_tcp;
     zl->_read_socket_f = _z_f_link_tcp_read_socket;
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+    zl->_write_sockets_f = _z_f_link_write_sockets_tcp;
+#endif
 
     return ret;
 }
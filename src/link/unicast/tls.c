@@ -68,7 +68,9 @@ static _z_config_t _z_tls_merge_config(_z_str_intmap_t *endpoint_cfg, const _z_c
                    {TLS_CONFIG_CONNECT_PRIVATE_KEY_BASE64_KEY, Z_CONFIG_TLS_CONNECT_PRIVATE_KEY_BASE64_KEY},
                    {TLS_CONFIG_CONNECT_CERTIFICATE_KEY, Z_CONFIG_TLS_CONNECT_CERTIFICATE_KEY},
                    {TLS_CONFIG_CONNECT_CERTIFICATE_BASE64_KEY, Z_CONFIG_TLS_CONNECT_CERTIFICATE_BASE64_KEY},
-                   {TLS_CONFIG_VERIFY_NAME_ON_CONNECT_KEY, Z_CONFIG_TLS_VERIFY_NAME_ON_CONNECT_KEY}};
+                   {TLS_CONFIG_VERIFY_NAME_ON_CONNECT_KEY, Z_CONFIG_TLS_VERIFY_NAME_ON_CONNECT_KEY},
+                   {TLS_CONFIG_SESSION_CACHE_KEY, Z_CONFIG_TLS_SESSION_CACHE_KEY},
+                   {TLS_CONFIG_SESSION_TICKET_LIFETIME_KEY, Z_CONFIG_TLS_SESSION_TICKET_LIFETIME_KEY}};
 
     for (size_t i = 0; i < sizeof(mapping) / sizeof(mapping[0]); i++) {
         if (_z_config_get(&cfg, mapping[i].locator_key) != NULL) {
@@ -37,6 +37,19 @@ z_result_t _z_endpoint_udp_unicast_valid(_z_endpoint_t *endpoint) {
     return ret;
 }
 
+#if defined(ZENOH_LINUX) && Z_FEATURE_UDP_OFFLOAD == 1
+size_t _z_f_link_write_segments_udp_unicast(const _z_link_t *self, const uint8_t *ptr, size_t len, size_t segment) {
+    bool offload_failed = false;
+    size_t wb =
+        _z_udp_write_segments(self->_socket._udp._sock, ptr, len, segment, self->_socket._udp._rep, &offload_failed);
+    if (offload_failed) {
+        // Writes are serialized by the transport tx mutex
+        ((_z_link_t *)self)->_write_segments_f = NULL;
+    }
+    return wb;
+}
+#endif
+
 z_result_t _z_f_link_open_udp_unicast(_z_link_t *self) {
     uint32_t tout = Z_CONFIG_SOCKET_TIMEOUT;
     char *tout_as_str = _z_str_intmap_get(&self->_endpoint._config, UDP_CONFIG_TOUT_KEY);
@@ -44,7 +57,13 @@ z_result_t _z_f_link_open_udp_unicast(_z_link_t *self) {
         tout = (uint32_t)strtoul(tout_as_str, NULL, 10);
     }
 
-    return _z_udp_unicast_open(&self->_socket._udp._sock, self->_socket._udp._rep, tout);
+    z_result_t ret = _z_udp_unicast_open(&self->_socket._udp._sock, self->_socket._udp._rep, tout);
+#if defined(ZENOH_LINUX) && Z_FEATURE_UDP_OFFLOAD == 1
+    if ((ret == _Z_RES_OK) && _z_udp_gso_supported(self->_socket._udp._sock)) {
+        self->_write_segments_f = _z_f_link_write_segments_udp_unicast;
+    }
+#endif
+    return ret;
 }
 
 z_result_t _z_f_link_listen_udp_unicast(_z_link_t *self) {
@@ -107,6 +126,10 @@ z_result_t _z_new_link_udp_unicast(_z_link_t *zl, _z_endpoint_t endpoint) {
 
     zl->_endpoint = endpoint;
     z_result_t ret = _z_udp_unicast_endpoint_init_from_address(&zl->_socket._udp._rep, &endpoint._locator._address);
+#if defined(ZENOH_LINUX)
+    // Receive offload is not enabled: datagrams are read with _read_socket_f, which has no per-link state
+    zl->_socket._udp._gro = NULL;
+#endif
 
     zl->_open_f = _z_f_link_open_udp_unicast;
     zl->_listen_f = _z_f_link_listen_udp_unicast;
@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdlib.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/manager.h"
+#include "zenoh-pico/link/transport/unixsock.h"
+
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+
+static z_result_t _z_endpoint_unixsock_valid(_z_endpoint_t *endpoint, const char *schema) {
+    _z_string_t schema_str = _z_string_alias_str(schema);
+    if (!_z_string_equals(&endpoint->_locator._protocol, &schema_str)) {
+        _Z_ERROR_LOG(_Z_ERR_CONFIG_LOCATOR_INVALID);
+        return _Z_ERR_CONFIG_LOCATOR_INVALID;
+    }
+
+    z_result_t ret = _z_unixsock_address_valid(&endpoint->_locator._address);
+    if (ret != _Z_RES_OK) {
+        _Z_ERROR_LOG(_Z_ERR_CONFIG_LOCATOR_INVALID);
+    }
+    return ret;
+}
+
+z_result_t _z_endpoint_unixsock_stream_valid(_z_endpoint_t *endpoint) {
+    return _z_endpoint_unixsock_valid(endpoint, UNIXSOCK_STREAM_SCHEMA);
+}
+
+z_result_t _z_endpoint_unixsock_dgram_valid(_z_endpoint_t *endpoint) {
+    return _z_endpoint_unixsock_valid(endpoint, UNIXSOCK_DGRAM_SCHEMA);
+}
+
+z_result_t _z_f_link_open_unixsock_stream(_z_link_t *zl) {
+    return _z_unixsock_stream_open(&zl->_socket._unixsock._sock, zl->_socket._unixsock._path,
+                                   Z_CONFIG_SOCKET_TIMEOUT);
+}
+
+z_result_t _z_f_link_open_unixsock_dgram(_z_link_t *zl) {
+    return _z_unixsock_dgram_open(&zl->_socket._unixsock._sock, zl->_socket._unixsock._path, Z_CONFIG_SOCKET_TIMEOUT);
+}
+
+z_result_t _z_f_link_listen_unixsock_stream(_z_link_t *zl) {
+    z_result_t ret = _z_unixsock_stream_listen(&zl->_socket._unixsock._sock, zl->_socket._unixsock._path);
+    zl->_socket._unixsock._bound = (ret == _Z_RES_OK);
+    return ret;
+}
+
+z_result_t _z_f_link_listen_unixsock_dgram(_z_link_t *zl) {
+    _ZP_UNUSED(zl);
+    _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_NOT_AVAILABLE);
+}
+
+void _z_f_link_close_unixsock(_z_link_t *zl) {
+    _z_unixsock_close(&zl->_socket._unixsock._sock, zl->_socket._unixsock._path, zl->_socket._unixsock._bound);
+    zl->_socket._unixsock._bound = false;
+}
+
+void _z_f_link_free_unixsock(_z_link_t *zl) {
+    z_free(zl->_socket._unixsock._path);
+    zl->_socket._unixsock._path = NULL;
+}
+
+size_t _z_f_link_write_unixsock(const _z_link_t *zl, const uint8_t *ptr, size_t len, _z_sys_net_socket_t *socket) {
+    if (socket != NULL) {
+        return _z_unixsock_write(*socket, ptr, len);
+    } else {
+        return _z_unixsock_write(zl->_socket._unixsock._sock, ptr, len);
+    }
+}
+
+size_t _z_f_link_write_all_unixsock(const _z_link_t *zl, const uint8_t *ptr, size_t len) {
+    return _z_unixsock_write(zl->_socket._unixsock._sock, ptr, len);
+}
+
+size_t _z_f_link_read_unixsock(const _z_link_t *zl, uint8_t *ptr, size_t len, _z_slice_t *addr) {
+    _ZP_UNUSED(addr);
+    return _z_unixsock_read(zl->_socket._unixsock._sock, ptr, len);
+}
+
+size_t _z_f_link_read_exact_unixsock(const _z_link_t *zl, uint8_t *ptr, size_t len, _z_slice_t *addr,
+                                     _z_sys_net_socket_t *socket) {
+    _ZP_UNUSED(addr);
+    if (socket != NULL) {
+        return _z_unixsock_read_exact(*socket, ptr, len);
+    } else {
+        return _z_unixsock_read_exact(zl->_socket._unixsock._sock, ptr, len);
+    }
+}
+
+size_t _z_f_link_unixsock_read_socket(const _z_sys_net_socket_t socket, uint8_t *ptr, size_t len) {
+    return _z_unixsock_read(socket, ptr, len);
+}
+
+uint16_t _z_get_link_mtu_unixsock(void) {
+    // Datagrams of this size fit in the default socket buffers
+    return 65535;
+}
+
+z_result_t _z_new_peer_unixsock_stream(_z_endpoint_t *endpoint, _z_sys_net_socket_t *socket) {
+    char *path = _z_unixsock_address_parse_path(&endpoint->_locator._address);
+    if (path == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_CONFIG_LOCATOR_INVALID);
+    }
+    z_result_t ret = _z_unixsock_stream_open(socket, path, Z_CONFIG_SOCKET_TIMEOUT);
+    z_free(path);
+    return ret;
+}
+
+static z_result_t _z_new_link_unixsock(_z_link_t *zl, _z_endpoint_t *endpoint, _z_link_cap_flow_t flow) {
+    zl->_type = _Z_LINK_TYPE_UNIXSOCK;
+    zl->_cap._transport = Z_LINK_CAP_TRANSPORT_UNICAST;
+    zl->_cap._flow = flow;
+    // Unix datagram sockets neither lose nor reorder datagrams, senders block when the receiver is full
+    zl->_cap._is_reliable = true;
+
+    zl->_mtu = _z_get_link_mtu_unixsock();
+
+    zl->_endpoint = *endpoint;
+    zl->_socket._unixsock._sock._fd = -1;
+    zl->_socket._unixsock._bound = false;
+    zl->_socket._unixsock._path = _z_unixsock_address_parse_path(&endpoint->_locator._address);
+    z_result_t ret = (zl->_socket._unixsock._path != NULL) ? _Z_RES_OK : _Z_ERR_CONFIG_LOCATOR_INVALID;
+
+    if (flow == Z_LINK_CAP_FLOW_STREAM) {
+        zl->_open_f = _z_f_link_open_unixsock_stream;
+        zl->_listen_f = _z_f_link_listen_unixsock_stream;
+    } else {
+        zl->_open_f = _z_f_link_open_unixsock_dgram;
+        zl->_listen_f = _z_f_link_listen_unixsock_dgram;
+    }
+    zl->_close_f = _z_f_link_close_unixsock;
+    zl->_free_f = _z_f_link_free_unixsock;
+
+    zl->_write_f = _z_f_link_write_unixsock;
+    zl->_write_all_f = _z_f_link_write_all_unixsock;
+    zl->_read_f = _z_f_link_read_unixsock;
+    zl->_read_exact_f = _z_f_link_read_exact_unixsock;
+    zl->_read_socket_f = _z_f_link_unixsock_read_socket;
+
+    return ret;
+}
+
+z_result_t _z_new_link_unixsock_stream(_z_link_t *zl, _z_endpoint_t *endpoint) {
+    return _z_new_link_unixsock(zl, endpoint, Z_LINK_CAP_FLOW_STREAM);
+}
+
+z_result_t _z_new_link_unixsock_dgram(_z_link_t *zl, _z_endpoint_t *endpoint) {
+    return _z_new_link_unixsock(zl, endpoint, Z_LINK_CAP_FLOW_DATAGRAM);
+}
+#endif
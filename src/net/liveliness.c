@@ -145,8 +145,9 @@ z_result_t _z_liveliness_subscription_trigger_history(_z_session_t *zn, const _z
     // TODO: add support for local tokens
     _z_keyexpr_intmap_iterator_t iter = _z_keyexpr_intmap_iterator_make(&zn->_remote_tokens);
     while (_z_keyexpr_intmap_iterator_next(&iter)) {
-        if (_z_keyexpr_intersects(&sub->_key._inner, _z_keyexpr_intmap_iterator_value(&iter))) {
-            tokens_list = _z_keyexpr_slist_push(tokens_list, _z_keyexpr_intmap_iterator_value(&iter));
+        const _z_keyexpr_t *token = _z_keyexpr_intmap_iterator_value(&iter);
+        if (_z_keyexpr_matcher_intersects(&sub->_matcher, &sub->_key._inner, token)) {
+            tokens_list = _z_keyexpr_slist_push(tokens_list, token);
         }
     }
     _z_session_mutex_unlock(zn);
@@ -177,6 +178,7 @@ z_result_t _z_register_liveliness_subscriber(uint32_t *out_sub_id, const _z_sess
     s._arg = arg;
     s._allowed_origin = z_locality_default();
     _Z_CLEAN_RETURN_IF_ERR(_z_declared_keyexpr_declare(zn, &s._key, keyexpr), _z_subscription_clear(&s));
+    _Z_CLEAN_RETURN_IF_ERR(_z_keyexpr_matcher_compile(&s._matcher, &s._key._inner), _z_subscription_clear(&s));
     _Z_CLEAN_RETURN_IF_ERR(
         _z_sync_group_create_notifier(&_Z_RC_IN_VAL(zn)->_callback_drop_sync_group, &s._session_callback_drop_notifier),
         _z_subscription_clear(&s));
@@ -162,6 +162,9 @@ z_result_t _z_undeclare_publisher(_z_publisher_t *pub) {
     _z_declared_keyexpr_clear(&pub->_key);
     _z_session_weak_drop(&pub->_zn);
     _z_encoding_clear(&pub->_encoding);
+#if Z_FEATURE_COMPRESSION == 1
+    _z_payload_compressor_free(&pub->_compressor);
+#endif
     *pub = _z_publisher_null();
     return _Z_RES_OK;
 }
@@ -218,6 +221,7 @@ z_result_t _z_register_subscriber(uint32_t *sub_id, const _z_session_rc_t *zn, c
     s._allowed_origin = allowed_origin;
     _Z_CLEAN_RETURN_IF_ERR(_z_declared_keyexpr_declare_non_wild_prefix(zn, &s._key, keyexpr),
                            _z_subscription_clear(&s));
+    _Z_CLEAN_RETURN_IF_ERR(_z_keyexpr_matcher_compile(&s._matcher, &s._key._inner), _z_subscription_clear(&s));
     _Z_CLEAN_RETURN_IF_ERR(
         _z_sync_group_create_notifier(&_Z_RC_IN_VAL(zn)->_callback_drop_sync_group, &s._session_callback_drop_notifier),
         _z_subscription_clear(&s));
@@ -330,6 +334,7 @@ z_result_t _z_register_queryable(uint32_t *queryable_id, const _z_session_rc_t *
     q._allowed_origin = allowed_origin;
     _Z_CLEAN_RETURN_IF_ERR(_z_declared_keyexpr_declare_non_wild_prefix(zn, &q._key, keyexpr),
                            _z_session_queryable_clear(&q));
+    _Z_CLEAN_RETURN_IF_ERR(_z_keyexpr_matcher_compile(&q._matcher, &q._key._inner), _z_session_queryable_clear(&q));
     _Z_CLEAN_RETURN_IF_ERR(
         _z_sync_group_create_notifier(&_Z_RC_IN_VAL(zn)->_callback_drop_sync_group, &q._session_callback_drop_notifier),
         _z_session_queryable_clear(&q));
@@ -429,6 +434,27 @@ z_result_t _z_undeclare_queryable(_z_queryable_t *qle) {
     return ret;
 }
 
+static z_result_t _z_make_reply(_z_zenoh_message_t *z_msg, const _z_query_t *query, _z_session_t *zn,
+                                const _z_declared_keyexpr_t *keyexpr, _z_bytes_t *payload, _z_encoding_t *encoding,
+                                const z_sample_kind_t kind, _z_n_qos_t qos, const _z_timestamp_t *timestamp,
+                                _z_bytes_t *att, _z_source_info_t *source_info) {
+    _z_wireexpr_t wireexpr = _z_declared_keyexpr_alias_to_wire(keyexpr, zn);
+    switch (kind) {
+        case Z_SAMPLE_KIND_PUT:
+            _z_n_msg_make_reply_ok_put(z_msg, &zn->_local_zid, query->_request_id, &wireexpr, Z_RELIABILITY_DEFAULT,
+                                       Z_CONSOLIDATION_MODE_DEFAULT, qos, timestamp, source_info, payload, encoding,
+                                       att);
+            break;
+        case Z_SAMPLE_KIND_DELETE:
+            _z_n_msg_make_reply_ok_del(z_msg, &zn->_local_zid, query->_request_id, &wireexpr, Z_RELIABILITY_DEFAULT,
+                                       Z_CONSOLIDATION_MODE_DEFAULT, qos, timestamp, source_info, att);
+            break;
+        default:
+            _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    return _Z_RES_OK;
+}
+
 z_result_t _z_send_reply(const _z_query_t *query, const _z_session_rc_t *zsrc, const _z_declared_keyexpr_t *keyexpr,
                          _z_bytes_t *payload, _z_encoding_t *encoding, const z_sample_kind_t kind, bool is_express,
                          const _z_timestamp_t *timestamp, _z_bytes_t *att, _z_source_info_t *source_info) {
@@ -446,21 +472,9 @@ z_result_t _z_send_reply(const _z_query_t *query, const _z_session_rc_t *zsrc, c
                                                 source_info);
     }
 
-    _z_wireexpr_t wireexpr = _z_declared_keyexpr_alias_to_wire(keyexpr, _Z_RC_IN_VAL(zsrc));
     _z_zenoh_message_t z_msg;
-    switch (kind) {
-        case Z_SAMPLE_KIND_PUT:
-            _z_n_msg_make_reply_ok_put(&z_msg, &zn->_local_zid, query->_request_id, &wireexpr, Z_RELIABILITY_DEFAULT,
-                                       Z_CONSOLIDATION_MODE_DEFAULT, qos, timestamp, source_info, payload, encoding,
-                                       att);
-            break;
-        case Z_SAMPLE_KIND_DELETE:
-            _z_n_msg_make_reply_ok_del(&z_msg, &zn->_local_zid, query->_request_id, &wireexpr, Z_RELIABILITY_DEFAULT,
-                                       Z_CONSOLIDATION_MODE_DEFAULT, qos, timestamp, source_info, att);
-            break;
-        default:
-            _Z_ERROR_RETURN(_Z_ERR_GENERIC);
-    }
+    _Z_RETURN_IF_ERR(
+        _z_make_reply(&z_msg, query, zn, keyexpr, payload, encoding, kind, qos, timestamp, att, source_info));
     // Send message on network
     if (_z_send_n_msg(zn, &z_msg, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK, NULL) != _Z_RES_OK) {
         _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_TX_FAILED);
@@ -469,6 +483,51 @@ z_result_t _z_send_reply(const _z_query_t *query, const _z_session_rc_t *zsrc, c
     return _Z_RES_OK;
 }
 
+z_result_t _z_send_replies(const _z_query_t *query, const _z_session_rc_t *zsrc, _z_sample_t *samples, size_t count,
+                           bool is_express) {
+    _z_session_t *zn = _Z_RC_IN_VAL(zsrc);
+    _Z_DEBUG("send_replies: rid=%jd count=%zu", (intmax_t)query->_request_id, count);
+    _z_n_qos_t qos =
+        _z_n_qos_create(is_express, _z_n_qos_get_congestion_control(query->_qos), _z_n_qos_get_priority(query->_qos));
+    if (query->_is_local) {
+        for (size_t i = 0; i < count; i++) {
+            _z_sample_t *s = &samples[i];
+            _Z_RETURN_IF_ERR(_z_send_reply(query, zsrc, &s->keyexpr, &s->payload, &s->encoding, s->kind, is_express,
+                                           &s->timestamp, &s->attachment, &s->source_info));
+        }
+        return _Z_RES_OK;
+    }
+    if (count == 0) {
+        return _Z_RES_OK;
+    }
+
+    // The batch belongs to this call, replies are encoded together when it is sent
+    _z_zenoh_message_t *z_msgs = (_z_zenoh_message_t *)z_malloc(sizeof(_z_zenoh_message_t) * count);
+    if (z_msgs == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    size_t len = 0;
+    for (size_t i = 0; i < count; i++) {
+        _z_sample_t *s = &samples[i];
+        if (!query->_anyke && !_z_declared_keyexpr_intersects(&query->_key, &s->keyexpr)) {
+            _Z_ERROR("Reply dropped - key expression does not match the query");
+            continue;
+        }
+        if (_z_make_reply(&z_msgs[len], query, zn, &s->keyexpr, &s->payload, &s->encoding, s->kind, qos,
+                          &s->timestamp, &s->attachment, &s->source_info) == _Z_RES_OK) {
+            len++;
+        }
+    }
+    z_result_t ret = _Z_RES_OK;
+    if (_z_send_n_msgs(zn, z_msgs, len, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK) != _Z_RES_OK) {
+        _Z_ERROR_LOG(_Z_ERR_TRANSPORT_TX_FAILED);
+        ret = _Z_ERR_TRANSPORT_TX_FAILED;
+    }
+    // Messages alias the samples, only the array is freed
+    z_free(z_msgs);
+    return ret;
+}
+
 z_result_t _z_send_reply_err(const _z_query_t *query, const _z_session_rc_t *zsrc, _z_bytes_t *payload,
                              _z_encoding_t *encoding) {
     z_result_t ret = _Z_RES_OK;
@@ -14,7 +14,9 @@
 #include "zenoh-pico/net/sample.h"
 
 #include "zenoh-pico/session/utils.h"
+#include "zenoh-pico/utils/endianness.h"
 #include "zenoh-pico/utils/logging.h"
+#include "zenoh-pico/utils/lz4.h"
 
 void _z_sample_steal_data(_z_sample_t *dst, _z_keyexpr_t *key, _z_bytes_t *payload, const _z_timestamp_t *timestamp,
                           _z_encoding_t *encoding, z_sample_kind_t kind, _z_qos_t qos, _z_bytes_t *attachment,
@@ -97,3 +99,215 @@ _z_sample_t _z_sample_duplicate(const _z_sample_t *src) {
     _z_sample_copy(&dst, src);
     return dst;
 }
+
+#if Z_FEATURE_COMPRESSION == 1
+// Compressed payloads start with their original length, followed by a single LZ4 block
+#define _Z_COMPRESSION_HEADER_LEN 4
+// Maximum ratio of an LZ4 block, bounds the memory a corrupted header can make us allocate
+#define _Z_COMPRESSION_MAX_RATIO 255
+
+// Gets a contiguous view of payload, copied into *buf when it spans several slices
+static z_result_t _z_sample_payload_view(const _z_bytes_t *payload, _z_slice_t *view, uint8_t **buf) {
+    *buf = NULL;
+    *view = _z_bytes_try_get_contiguous(payload);
+    if (_z_slice_check(view)) {
+        return _Z_RES_OK;
+    }
+    size_t len = _z_bytes_len(payload);
+    *buf = (uint8_t *)z_malloc(len);
+    if (*buf == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    _z_bytes_to_buf(payload, *buf, len);
+    *view = _z_slice_alias_buf(*buf, len);
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_sample_payload_replace(_z_bytes_t *payload, _z_slice_t *s, size_t len) {
+    s->len = len;
+    _z_bytes_t b;
+    _Z_RETURN_IF_ERR(_z_bytes_from_slice(&b, s));
+    _z_bytes_drop(payload);
+    *payload = b;
+    return _Z_RES_OK;
+}
+
+#if Z_FEATURE_MULTI_THREAD == 1
+#define _Z_COMPRESSOR_LOCK(c) _z_mutex_lock(&(c)->_mutex)
+#define _Z_COMPRESSOR_UNLOCK(c) _z_mutex_unlock(&(c)->_mutex)
+#else
+#define _Z_COMPRESSOR_LOCK(c)
+#define _Z_COMPRESSOR_UNLOCK(c)
+#endif
+
+_z_payload_compressor_t *_z_payload_compressor_new(void) {
+    _z_payload_compressor_t *c = (_z_payload_compressor_t *)z_malloc(sizeof(_z_payload_compressor_t));
+    if (c == NULL) {
+        _Z_ERROR("z_malloc failed");
+        return NULL;
+    }
+    c->_buf = NULL;
+    c->_capacity = 0;
+#if Z_FEATURE_MULTI_THREAD == 1
+    if (_z_mutex_init(&c->_mutex) != _Z_RES_OK) {
+        z_free(c);
+        return NULL;
+    }
+#endif
+    return c;
+}
+
+void _z_payload_compressor_free(_z_payload_compressor_t **c) {
+    _z_payload_compressor_t *ptr = *c;
+    if (ptr != NULL) {
+#if Z_FEATURE_MULTI_THREAD == 1
+        _z_mutex_drop(&ptr->_mutex);
+#endif
+        z_free(ptr->_buf);
+        z_free(ptr);
+        *c = NULL;
+    }
+}
+
+static bool _z_encoding_is_compressed(const _z_encoding_t *encoding) {
+    size_t prefix_len = strlen(_Z_ENCODING_SCHEMA_COMPRESSED);
+    size_t len = _z_string_len(&encoding->schema);
+    const char *schema = _z_string_data(&encoding->schema);
+    return (len >= prefix_len) && (memcmp(schema, _Z_ENCODING_SCHEMA_COMPRESSED, prefix_len) == 0) &&
+           ((len == prefix_len) || (schema[prefix_len] == ';'));
+}
+
+// Builds the schema of the compressed form, the reserved one followed by the original if there is one
+static z_result_t _z_encoding_compressed_schema(const _z_encoding_t *encoding, _z_string_t *schema) {
+    _z_string_t prefix = _z_string_alias_str(_Z_ENCODING_SCHEMA_COMPRESSED);
+    if (!_z_string_check(&encoding->schema)) {
+        *schema = prefix;
+        return _Z_RES_OK;
+    }
+    return _z_string_concat(schema, &prefix, &encoding->schema, ";", 1);
+}
+
+static z_result_t _z_sample_payload_compress_into(_z_payload_compressor_t *c, const _z_slice_t *src, _z_slice_t *dst) {
+    // Only worth sending if strictly smaller than the original payload
+    size_t cap = src->len - _Z_COMPRESSION_HEADER_LEN - 1;
+    if (c->_capacity < cap) {
+        z_free(c->_buf);
+        c->_buf = (uint8_t *)z_malloc(cap);
+        c->_capacity = (c->_buf != NULL) ? cap : 0;
+        if (c->_buf == NULL) {
+            _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        }
+    }
+    size_t out_len = _z_lz4_compress(c->_buf, cap, src->start, src->len, c->_table);
+    if (out_len == 0) {
+        return _Z_RES_OK;
+    }
+    *dst = _z_slice_make(_Z_COMPRESSION_HEADER_LEN + out_len);
+    if (!_z_slice_check(dst)) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    uint8_t *out = (uint8_t *)dst->start;
+    _z_le_store32((uint32_t)src->len, out);
+    memcpy(out + _Z_COMPRESSION_HEADER_LEN, c->_buf, out_len);
+    return _Z_RES_OK;
+}
+
+z_result_t _z_sample_payload_compress(_z_payload_compressor_t *c, _z_bytes_t *payload, _z_encoding_t *encoding) {
+    size_t len = _z_bytes_len(payload);
+    if ((len < Z_COMPRESSION_THRESHOLD) || (len <= _Z_COMPRESSION_HEADER_LEN + 1) || ((uint64_t)len > UINT32_MAX)) {
+        return _Z_RES_OK;
+    }
+    _z_payload_compressor_t *tmp = NULL;
+    if (c == NULL) {
+        tmp = _z_payload_compressor_new();
+        if (tmp == NULL) {
+            _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        }
+        c = tmp;
+    }
+    _z_slice_t src;
+    uint8_t *buf;
+    z_result_t ret = _z_sample_payload_view(payload, &src, &buf);
+    _z_slice_t dst = _z_slice_null();
+    if (ret == _Z_RES_OK) {
+        _Z_COMPRESSOR_LOCK(c);
+        ret = _z_sample_payload_compress_into(c, &src, &dst);
+        _Z_COMPRESSOR_UNLOCK(c);
+        z_free(buf);
+    }
+    // The schema is built first, so that the payload is never replaced without it
+    _z_string_t schema = _z_string_null();
+    if ((ret == _Z_RES_OK) && _z_slice_check(&dst)) {
+        ret = _z_encoding_compressed_schema(encoding, &schema);
+        if (ret == _Z_RES_OK) {
+            // The payload owns dst from here on
+            ret = _z_sample_payload_replace(payload, &dst, dst.len);
+            if (ret == _Z_RES_OK) {
+                _z_string_clear(&encoding->schema);
+                encoding->schema = schema;
+            } else {
+                _z_string_clear(&schema);
+            }
+        } else {
+            _z_slice_clear(&dst);
+        }
+    } else {
+        _z_slice_clear(&dst);
+    }
+    _z_payload_compressor_free(&tmp);
+    return ret;
+}
+
+z_result_t _z_sample_payload_decompress(_z_bytes_t *payload, _z_encoding_t *encoding) {
+    if (!_z_encoding_is_compressed(encoding)) {
+        return _Z_RES_OK;
+    }
+    size_t len = _z_bytes_len(payload);
+    if (len < _Z_COMPRESSION_HEADER_LEN + 1) {
+        _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+    }
+    // The original schema follows the reserved one and its separator
+    size_t prefix_len = strlen(_Z_ENCODING_SCHEMA_COMPRESSED);
+    size_t schema_len = _z_string_len(&encoding->schema);
+    _z_string_t schema = _z_string_null();
+    if (schema_len > prefix_len + 1) {
+        _Z_RETURN_IF_ERR(
+            _z_string_copy_substring(&schema, &encoding->schema, prefix_len + 1, schema_len - prefix_len - 1));
+    }
+    _z_slice_t src;
+    uint8_t *buf;
+    _Z_CLEAN_RETURN_IF_ERR(_z_sample_payload_view(payload, &src, &buf), _z_string_clear(&schema));
+    size_t orig_len = _z_le_load32(src.start);
+    z_result_t ret = _Z_RES_OK;
+    _z_slice_t dst = _z_slice_null();
+    if ((orig_len == 0) || (orig_len / _Z_COMPRESSION_MAX_RATIO > len)) {
+        _Z_ERROR_LOG(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+        ret = _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
+    } else {
+        dst = _z_slice_make(orig_len);
+        if (!_z_slice_check(&dst)) {
+            _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+            ret = _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+        }
+    }
+    if (ret == _Z_RES_OK) {
+        size_t out_len = 0;
+        ret = _z_lz4_decompress((uint8_t *)dst.start, orig_len, src.start + _Z_COMPRESSION_HEADER_LEN,
+                                len - _Z_COMPRESSION_HEADER_LEN, &out_len);
+        if ((ret == _Z_RES_OK) && (out_len != orig_len)) {
+            _Z_ERROR_LOG(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+            ret = _Z_ERR_MESSAGE_DESERIALIZATION_FAILED;
+        }
+    }
+    z_free(buf);
+    if (ret != _Z_RES_OK) {
+        _z_slice_clear(&dst);
+        _z_string_clear(&schema);
+        return ret;
+    }
+    _Z_CLEAN_RETURN_IF_ERR(_z_sample_payload_replace(payload, &dst, orig_len), _z_string_clear(&schema));
+    _z_string_clear(&encoding->schema);
+    encoding->schema = schema;
+    return _Z_RES_OK;
+}
+#endif
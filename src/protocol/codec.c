@@ -15,6 +15,7 @@
 #include "zenoh-pico/protocol/codec.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/utils/endianness.h"
@@ -98,55 +99,96 @@ z_result_t _z_uint16_decode(uint16_t *u16, _z_zbuf_t *zbf) {
 // Zint is a variable int composed of up to 9 bytes.
 // The msb of the 8 first bytes has meaning: (1: the zint continue, 0: end of the zint)
 #define VLE_LEN 9
-#define VLE_LEN1_MASK (UINT64_MAX << (7 * 1))
-#define VLE_LEN2_MASK (UINT64_MAX << (7 * 2))
-#define VLE_LEN3_MASK (UINT64_MAX << (7 * 3))
-#define VLE_LEN4_MASK (UINT64_MAX << (7 * 4))
-#define VLE_LEN5_MASK (UINT64_MAX << (7 * 5))
-#define VLE_LEN6_MASK (UINT64_MAX << (7 * 6))
-#define VLE_LEN7_MASK (UINT64_MAX << (7 * 7))
-#define VLE_LEN8_MASK (UINT64_MAX << (7 * 8))
+// Continuation bits of the first 8 bytes of a zint loaded as a little endian word
+#define VLE_CONT_MASK UINT64_C(0x8080808080808080)
+
+// Count leading/trailing zeros of a non-zero word
+#if defined(ZENOH_COMPILER_GCC) || defined(ZENOH_COMPILER_CLANG)
+static inline uint8_t _z_clz64(uint64_t v) { return (uint8_t)__builtin_clzll(v); }
+static inline uint8_t _z_ctz64(uint64_t v) { return (uint8_t)__builtin_ctzll(v); }
+#else
+static inline uint8_t _z_clz64(uint64_t v) {
+    uint8_t n = 0;
+    while ((v & (UINT64_C(1) << 63)) == 0) {
+        v <<= 1;
+        n++;
+    }
+    return n;
+}
+static inline uint8_t _z_ctz64(uint64_t v) {
+    uint8_t n = 0;
+    while ((v & 1) == 0) {
+        v >>= 1;
+        n++;
+    }
+    return n;
+}
+#endif
+
+// Loads and stores 8 zint bytes as a little endian word, in a single access on little endian hosts
+static inline uint64_t _z_zint_load_word(const uint8_t *src) {
+#if defined(ZENOH_ENDIANNNESS_LITTLE)
+    uint64_t w;
+    memcpy(&w, src, sizeof(w));
+    return w;
+#else
+    return _z_le_load64(src);
+#endif
+}
 
-uint8_t _z_zint_len(uint64_t v) {
-    if ((v & VLE_LEN1_MASK) == 0) {
-        return 1;
-    } else if ((v & VLE_LEN2_MASK) == 0) {
-        return 2;
-    } else if ((v & VLE_LEN3_MASK) == 0) {
-        return 3;
-    } else if ((v & VLE_LEN4_MASK) == 0) {
-        return 4;
-    } else if ((v & VLE_LEN5_MASK) == 0) {
-        return 5;
-    } else if ((v & VLE_LEN6_MASK) == 0) {
-        return 6;
-    } else if ((v & VLE_LEN7_MASK) == 0) {
-        return 7;
-    } else if ((v & VLE_LEN8_MASK) == 0) {
-        return 8;
-    } else {
-        return 9;
+static inline void _z_zint_store_word(uint64_t w, uint8_t *dst) {
+#if defined(ZENOH_ENDIANNNESS_LITTLE)
+    memcpy(dst, &w, sizeof(w));
+#else
+    _z_le_store64(w, dst);
+#endif
+}
+
+// Gathers the 7-bit groups of up to 8 zint bytes into the value they encode
+static inline uint64_t _z_zint_compact(uint64_t w) {
+    uint64_t v = 0;
+    for (uint8_t k = 0; k < 8; k++) {
+        v |= (w >> k) & (UINT64_C(0x7f) << (7 * k));
     }
+    return v;
 }
 
-uint8_t _z_zint64_encode_buf(uint8_t *buf, uint64_t v) {
-    uint64_t lv = v;
-    uint8_t len = 0;
-    size_t start = 0;
-    while ((lv & VLE_LEN1_MASK) != 0) {
-        uint8_t c = (uint8_t)((lv & 0x7f) | 0x80);
-        buf[start++] = c;
-        len++;
-        lv = lv >> (uint64_t)7;
+// Spreads the low 56 bits of a value into the 7-bit groups of 8 zint bytes, without the continuation bits
+static inline uint64_t _z_zint_spread(uint64_t v) {
+    uint64_t w = 0;
+    for (uint8_t k = 0; k < 8; k++) {
+        w |= (v << k) & (UINT64_C(0x7f) << (8 * k));
     }
-    if (len != VLE_LEN) {
-        uint8_t c = (lv & 0xff);
-        buf[start++] = c;
+    return w;
+}
+
+uint8_t _z_zint_len(uint64_t v) {
+    // One byte per 7 significant bits, the 9th byte holding the last 8 bits
+    uint8_t bits = (uint8_t)(64 - _z_clz64(v | 1));
+    uint8_t len = (uint8_t)((bits + 6) / 7);
+    return (len > VLE_LEN) ? VLE_LEN : len;
+}
+
+uint8_t _z_zint64_encode_buf(uint8_t *buf, uint64_t v) {
+    uint8_t len = _z_zint_len(v);
+    if (len == VLE_LEN) {
+        _z_zint_store_word(_z_zint_spread(v) | VLE_CONT_MASK, buf);
+        buf[VLE_LEN - 1] = (uint8_t)(v >> 56);
+    } else {
+        // Continuation bits on all bytes but the last one
+        uint64_t cont = VLE_CONT_MASK & ((UINT64_C(1) << (8 * (len - 1))) - 1);
+        _z_zint_store_word(_z_zint_spread(v) | cont, buf);
     }
-    return (uint8_t)start;
+    return len;
 }
 
 z_result_t _z_zint64_encode(_z_wbuf_t *wbf, uint64_t v) {
+    _z_iosli_t *ios = _z_wbuf_get_iosli(wbf, wbf->_w_idx);
+    if (_z_iosli_writable(ios) >= VLE_LEN) {
+        // Encode in place, the bytes written past the zint are overwritten by the next writes
+        ios->_w_pos += _z_zint64_encode_buf(ios->_buf + ios->_w_pos, v);
+        return _Z_RES_OK;
+    }
     uint8_t buf[VLE_LEN];
     size_t len = _z_zint64_encode_buf(buf, v);
     return _z_wbuf_write_bytes(wbf, buf, 0, len);
@@ -185,6 +227,30 @@ z_result_t _z_zsize_decode_with_reader(_z_zint_t *zint, __z_single_byte_reader_t
 z_result_t _z_uint8_decode_reader(uint8_t *zint, void *context) { return _z_uint8_decode(zint, (_z_zbuf_t *)context); }
 
 z_result_t _z_zint64_decode(uint64_t *zint, _z_zbuf_t *zbf) {
+    size_t readable = _z_zbuf_len(zbf);
+    if (readable > 0 && (*_z_zbuf_get_rptr(zbf) & 0x80) == 0) {
+        // Most zints (headers, ids, small lengths) fit in one byte
+        *zint = _z_zbuf_read(zbf);
+        return _Z_RES_OK;
+    }
+    if (readable >= VLE_LEN - 1) {
+        // Load 8 bytes at once and find the last byte of the zint from their continuation bits
+        const uint8_t *ptr = _z_zbuf_get_rptr(zbf);
+        uint64_t w = _z_zint_load_word(ptr);
+        uint64_t stops = ~w & VLE_CONT_MASK;
+        if (stops != 0) {
+            uint8_t last = _z_ctz64(stops);
+            // Keep the bits up to the continuation bit of the last byte
+            *zint = _z_zint_compact(w & (stops ^ (stops - 1)));
+            _z_zbuf_set_rpos(zbf, _z_zbuf_get_rpos(zbf) + (size_t)(last + 1) / 8);
+            return _Z_RES_OK;
+        } else if (readable >= VLE_LEN) {
+            *zint = _z_zint_compact(w) | ((uint64_t)ptr[VLE_LEN - 1] << 56);
+            _z_zbuf_set_rpos(zbf, _z_zbuf_get_rpos(zbf) + VLE_LEN);
+            return _Z_RES_OK;
+        }
+    }
+
     *zint = 0;
     uint8_t b = 0;
     _Z_RETURN_IF_ERR(_z_uint8_decode(&b, zbf));
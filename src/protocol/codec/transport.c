@@ -203,6 +203,22 @@ z_result_t _z_init_encode(_z_wbuf_t *wbf, uint8_t header, const _z_t_msg_init_t
         _Z_RETURN_IF_ERR(_z_slice_encode(wbf, &msg->_cookie))
     }
 
+#if Z_FEATURE_COMPRESSION == 1
+    if (msg->_compression) {
+        if (_Z_HAS_FLAG(header, _Z_FLAG_T_Z)) {
+#if Z_FEATURE_FRAGMENTATION == 1
+            bool has_patch = msg->_patch != _Z_NO_PATCH;
+#else
+            bool has_patch = false;
+#endif
+            _Z_RETURN_IF_ERR(_z_uint8_encode(wbf, _Z_MSG_EXT_ID_INIT_COMPRESSION | _Z_MSG_EXT_MORE(has_patch)));
+        } else {
+            _Z_DEBUG("Attempted to serialize Compression extension, but the header extension flag was unset");
+            ret |= _Z_ERR_MESSAGE_SERIALIZATION_FAILED;
+        }
+    }
+#endif
+
 #if Z_FEATURE_FRAGMENTATION == 1
     if (msg->_patch != _Z_NO_PATCH) {
         if (_Z_HAS_FLAG(header, _Z_FLAG_T_Z)) {
@@ -226,6 +242,11 @@ z_result_t _z_init_decode_ext(_z_msg_ext_t *extension, void *ctx) {
     } else if (_Z_EXT_FULL_ID(extension->_header) == _Z_MSG_EXT_ID_INIT_PATCH) {
         _z_t_msg_init_t *msg = (_z_t_msg_init_t *)ctx;
         msg->_patch = (uint8_t)extension->_body._zint._val;
+#endif
+#if Z_FEATURE_COMPRESSION == 1
+    } else if (_Z_EXT_FULL_ID(extension->_header) == _Z_MSG_EXT_ID_INIT_COMPRESSION) {
+        _z_t_msg_init_t *msg = (_z_t_msg_init_t *)ctx;
+        msg->_compression = true;
 #endif
     } else if (_Z_MSG_EXT_IS_MANDATORY(extension->_header)) {
         _Z_ERROR_LOG(_Z_ERR_MESSAGE_EXTENSION_MANDATORY_AND_UNKNOWN);
@@ -465,6 +486,81 @@ z_result_t _z_fragment_decode(_z_t_msg_fragment_t *msg, _z_zbuf_t *zbf, uint8_t
     return ret;
 }
 
+/*------------------ OAM Message ------------------*/
+static size_t _z_t_oam_nack_len(const _z_t_msg_oam_nack_t *msg) {
+    return (size_t)1 + _z_id_len(msg->_zid) + _z_zint_len(msg->_sn) + _z_zint_len(msg->_count);
+}
+
+z_result_t _z_t_oam_encode(_z_wbuf_t *wbf, uint8_t header, const _z_t_msg_oam_t *msg) {
+    _Z_DEBUG("Encoding _Z_MID_T_OAM");
+    _Z_RETURN_IF_ERR(_z_zint16_encode(wbf, msg->_id));
+    if (_Z_HAS_FLAG(header, _Z_FLAG_T_Z) || (_Z_EXT_ENC(header) != _Z_MSG_EXT_ENC_ZBUF)) {
+        _Z_ERROR_RETURN(_Z_ERR_MESSAGE_SERIALIZATION_FAILED);
+    }
+    switch (msg->_id) {
+        case _Z_T_OAM_ID_NACK: {
+            const _z_t_msg_oam_nack_t *nack = &msg->_body._nack;
+            uint8_t zidlen = _z_id_len(nack->_zid);
+            _Z_RETURN_IF_ERR(_z_zsize_encode(wbf, _z_t_oam_nack_len(nack)));
+            _Z_RETURN_IF_ERR(_z_uint8_encode(wbf, (uint8_t)(((zidlen - 1) & 0x0F) << 4)));
+            _Z_RETURN_IF_ERR(_z_wbuf_write_bytes(wbf, nack->_zid.id, 0, zidlen));
+            _Z_RETURN_IF_ERR(_z_zsize_encode(wbf, nack->_sn));
+            _Z_RETURN_IF_ERR(_z_zsize_encode(wbf, nack->_count));
+        } break;
+        default:
+            _Z_ERROR_RETURN(_Z_ERR_MESSAGE_SERIALIZATION_FAILED);
+    }
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_t_oam_nack_decode(_z_t_msg_oam_nack_t *msg, _z_zbuf_t *zbf) {
+    uint8_t cbyte = 0;
+    _Z_RETURN_IF_ERR(_z_uint8_decode(&cbyte, zbf));
+    uint8_t zidlen = ((cbyte & 0xF0) >> 4) + (uint8_t)1;
+    msg->_zid = _z_id_empty();
+    if (_z_zbuf_len(zbf) < zidlen) {
+        _Z_INFO("Invalid zid length received");
+        _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+    }
+    _z_zbuf_read_bytes(zbf, msg->_zid.id, 0, zidlen);
+    _Z_RETURN_IF_ERR(_z_zsize_decode(&msg->_sn, zbf));
+    return _z_zsize_decode(&msg->_count, zbf);
+}
+
+z_result_t _z_t_oam_decode(_z_t_msg_oam_t *msg, _z_zbuf_t *zbf, uint8_t header) {
+    _Z_DEBUG("Decoding _Z_MID_T_OAM");
+    *msg = (_z_t_msg_oam_t){0};
+    _Z_RETURN_IF_ERR(_z_zint16_decode(&msg->_id, zbf));
+    if (_Z_HAS_FLAG(header, _Z_FLAG_T_Z)) {
+        _Z_RETURN_IF_ERR(_z_msg_ext_skip_non_mandatories(zbf, 0x00));
+    }
+    switch (_Z_EXT_ENC(header)) {
+        case _Z_MSG_EXT_ENC_UNIT: {
+            return _Z_RES_OK;
+        } break;
+        case _Z_MSG_EXT_ENC_ZINT: {
+            _z_zint_t val = 0;
+            return _z_zsize_decode(&val, zbf);
+        } break;
+        case _Z_MSG_EXT_ENC_ZBUF: {
+            _z_zint_t len = 0;
+            _Z_RETURN_IF_ERR(_z_zsize_decode(&len, zbf));
+            if (_z_zbuf_len(zbf) < len) {
+                _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+            }
+            // Bodies of unknown OAM messages are skipped
+            _z_zbuf_t body = _z_zbuf_view(zbf, len);
+            _z_zbuf_set_rpos(zbf, _z_zbuf_get_rpos(zbf) + len);
+            if (msg->_id == _Z_T_OAM_ID_NACK) {
+                return _z_t_oam_nack_decode(&msg->_body._nack, &body);
+            }
+            return _Z_RES_OK;
+        } break;
+        default:
+            _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+    }
+}
+
 /*------------------ Transport Extensions Message ------------------*/
 z_result_t _z_extensions_encode(_z_wbuf_t *wbf, uint8_t header, const _z_msg_ext_vec_t *v_ext) {
     (void)(header);
@@ -536,6 +632,9 @@ z_result_t _z_transport_message_encode(_z_wbuf_t *wbf, const _z_transport_messag
         case _Z_MID_T_CLOSE: {
             return _z_close_encode(wbf, msg->_header, &msg->_body._close);
         } break;
+        case _Z_MID_T_OAM: {
+            return _z_t_oam_encode(wbf, msg->_header, &msg->_body._oam);
+        } break;
         default: {
             _Z_INFO("WARNING: Trying to encode session message with unknown ID(%d)", _Z_MID(msg->_header));
             _Z_ERROR_RETURN(_Z_ERR_MESSAGE_TRANSPORT_UNKNOWN);
@@ -568,6 +667,9 @@ z_result_t _z_transport_message_decode(_z_transport_message_t *msg, _z_zbuf_t *z
         case _Z_MID_T_CLOSE: {
             return _z_close_decode(&msg->_body._close, zbf, msg->_header);
         } break;
+        case _Z_MID_T_OAM: {
+            return _z_t_oam_decode(&msg->_body._oam, zbf, msg->_header);
+        } break;
         default: {
             _Z_INFO("WARNING: Trying to decode session message with unknown ID(0x%x) (header=0x%x)", mid, msg->_header);
             _Z_ERROR_RETURN(_Z_ERR_MESSAGE_TRANSPORT_UNKNOWN);
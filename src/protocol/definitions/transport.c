@@ -48,6 +48,8 @@ void _z_t_msg_frame_clear(_z_t_msg_frame_t *msg) {
 
 void _z_t_msg_fragment_clear(_z_t_msg_fragment_t *msg) { _z_slice_clear(&msg->_payload); }
 
+void _z_t_msg_oam_clear(_z_t_msg_oam_t *msg) { _ZP_UNUSED(msg); }
+
 void _z_t_msg_clear(_z_transport_message_t *msg) {
     uint8_t mid = _Z_MID(msg->_header);
     switch (mid) {
@@ -79,6 +81,10 @@ void _z_t_msg_clear(_z_transport_message_t *msg) {
             _z_t_msg_fragment_clear(&msg->_body._fragment);
         } break;
 
+        case _Z_MID_T_OAM: {
+            _z_t_msg_oam_clear(&msg->_body._oam);
+        } break;
+
         default: {
             _Z_INFO("WARNING: Trying to clear transport message with unknown ID(%d)", mid);
         } break;
@@ -146,6 +152,9 @@ _z_transport_message_t _z_t_msg_make_init_syn(z_whatami_t whatami, _z_id_t zid)
 #if Z_FEATURE_FRAGMENTATION == 1
     msg._body._init._patch = _Z_CURRENT_PATCH;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    msg._body._init._compression = false;
+#endif
 
     if ((msg._body._init._batch_size != _Z_DEFAULT_UNICAST_BATCH_SIZE) ||
         (msg._body._init._seq_num_res != _Z_DEFAULT_RESOLUTION_SIZE) ||
@@ -177,6 +186,9 @@ _z_transport_message_t _z_t_msg_make_init_ack(z_whatami_t whatami, _z_id_t zid,
 #if Z_FEATURE_FRAGMENTATION == 1
     msg._body._init._patch = _Z_CURRENT_PATCH;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    msg._body._init._compression = false;
+#endif
 
     if ((msg._body._init._batch_size != _Z_DEFAULT_UNICAST_BATCH_SIZE) ||
         (msg._body._init._seq_num_res != _Z_DEFAULT_RESOLUTION_SIZE) ||
@@ -297,6 +309,19 @@ _z_transport_message_t _z_t_msg_make_fragment(_z_zint_t sn, _z_slice_t payload,
     return msg;
 }
 
+/*------------------ OAM Message ------------------*/
+_z_transport_message_t _z_t_msg_make_nack(_z_id_t zid, _z_zint_t sn, _z_zint_t count) {
+    _z_transport_message_t msg;
+    msg._header = _Z_MID_T_OAM | _Z_MSG_EXT_ENC_ZBUF;
+
+    msg._body._oam._id = _Z_T_OAM_ID_NACK;
+    msg._body._oam._body._nack._zid = zid;
+    msg._body._oam._body._nack._sn = sn;
+    msg._body._oam._body._nack._count = count;
+
+    return msg;
+}
+
 void _z_t_msg_copy_fragment(_z_t_msg_fragment_t *clone, _z_t_msg_fragment_t *msg) {
     clone->_payload = msg->_payload;
     _z_slice_copy(&clone->_payload, &msg->_payload);
@@ -304,6 +329,8 @@ void _z_t_msg_copy_fragment(_z_t_msg_fragment_t *clone, _z_t_msg_fragment_t *msg
     clone->drop = msg->drop;
 }
 
+void _z_t_msg_copy_oam(_z_t_msg_oam_t *clone, _z_t_msg_oam_t *msg) { *clone = *msg; }
+
 void _z_t_msg_copy_join(_z_t_msg_join_t *clone, _z_t_msg_join_t *msg) {
     clone->_version = msg->_version;
     clone->_whatami = msg->_whatami;
@@ -389,6 +416,10 @@ void _z_t_msg_copy(_z_transport_message_t *clone, _z_transport_message_t *msg) {
             _z_t_msg_copy_fragment(&clone->_body._fragment, &msg->_body._fragment);
         } break;
 
+        case _Z_MID_T_OAM: {
+            _z_t_msg_copy_oam(&clone->_body._oam, &msg->_body._oam);
+        } break;
+
         default: {
             _Z_INFO("WARNING: Trying to copy transport message with unknown ID(%d)", mid);
         } break;
@@ -574,7 +574,7 @@ bool _z_keyexpr_intersects(const _z_keyexpr_t *left, const _z_keyexpr_t *right)
     const char *right_start = _z_string_data(&right->_keyexpr);
 
     // fast path for identical key expressions, do we really need it ?
-    if ((left_len == right_len) && (strncmp(left_start, right_start, left_len) == 0)) {
+    if ((left_len == right_len) && (memcmp(left_start, right_start, left_len) == 0)) {
         return true;
     }
 
@@ -588,9 +588,161 @@ bool _z_keyexpr_includes(const _z_keyexpr_t *left, const _z_keyexpr_t *right) {
     const char *right_start = _z_string_data(&right->_keyexpr);
 
     // fast path for identical key expressions, do we really need it ?
-    if ((left_len == right_len) && (strncmp(left_start, right_start, left_len) == 0)) {
+    if ((left_len == right_len) && (memcmp(left_start, right_start, left_len) == 0)) {
         return true;
     }
 
     return _z_keyexpr_forward_includes(left_start, left_start + left_len, right_start, right_start + right_len, true);
 }
+
+z_result_t _z_keyexpr_matcher_compile(_z_keyexpr_matcher_t *m, const _z_keyexpr_t *key) {
+    *m = _z_keyexpr_matcher_null();
+    size_t len = _z_string_len(&key->_keyexpr);
+    const char *begin = _z_string_data(&key->_keyexpr);
+    const char *end = begin + len;
+    if (len == 0 || len > UINT16_MAX) {
+        return _Z_RES_OK;
+    }
+    if (memchr(begin, _Z_STAR, len) == NULL) {
+        m->_kind = _Z_KEYEXPR_MATCHER_EXACT;
+        return _Z_RES_OK;
+    }
+    if (memchr(begin, _Z_DSL0, len) != NULL) {
+        return _Z_RES_OK;
+    }
+    size_t chunks = 1;
+    for (const char *c = (const char *)memchr(begin, _Z_DELIMITER, len); c != NULL;
+         c = (const char *)memchr(c + 1, _Z_DELIMITER, (size_t)(end - c - 1))) {
+        chunks++;
+    }
+    m->_segments = (_z_keyexpr_matcher_segment_t *)z_malloc(chunks * sizeof(_z_keyexpr_matcher_segment_t));
+    if (m->_segments == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    uint16_t n = 0;
+    m->_double_star = UINT16_MAX;
+    const char *cbegin = begin;
+    for (;;) {
+        const char *cend = _z_chunk_end(cbegin, end);
+        _z_keyexpr_matcher_segment_t *prev = n > 0 ? &m->_segments[n - 1] : NULL;
+        bool is_star = cend == cbegin + 1 && *cbegin == _Z_STAR;
+        if (_z_keyexpr_is_double_star(cbegin, cend)) {
+            if (m->_double_star != UINT16_MAX) {
+                _z_keyexpr_matcher_clear(m);
+                return _Z_RES_OK;
+            }
+            m->_double_star = n;
+            m->_segments[n++] = (_z_keyexpr_matcher_segment_t){._begin = (uint16_t)(cbegin - begin), ._len = 2};
+        } else if (is_star) {
+            m->_segments[n++] =
+                (_z_keyexpr_matcher_segment_t){._begin = (uint16_t)(cbegin - begin), ._len = 1, ._is_star = true};
+        } else if (prev != NULL && !prev->_is_star && n - 1 != m->_double_star) {
+            // Consecutive verbatim chunks are compared at once, with the delimiters between them
+            prev->_len = (uint16_t)(cend - begin - prev->_begin);
+        } else {
+            m->_segments[n++] =
+                (_z_keyexpr_matcher_segment_t){._begin = (uint16_t)(cbegin - begin), ._len = (uint16_t)(cend - cbegin)};
+        }
+        if (cend == end) {
+            break;
+        }
+        cbegin = cend + _Z_DELIMITER_LEN;
+    }
+    m->_len = n;
+    if (m->_double_star == UINT16_MAX) {
+        m->_double_star = n;
+    }
+    m->_kind = _Z_KEYEXPR_MATCHER_CHUNKS;
+    return _Z_RES_OK;
+}
+
+void _z_keyexpr_matcher_clear(_z_keyexpr_matcher_t *m) {
+    z_free(m->_segments);
+    *m = _z_keyexpr_matcher_null();
+}
+
+// Whether the compiled key expression matches right, which has no wildcards
+static bool _z_keyexpr_matcher_matches(const _z_keyexpr_matcher_t *m, const _z_keyexpr_t *left, const char *rbegin,
+                                       const char *rend) {
+    const char *lbegin = _z_string_data(&left->_keyexpr);
+    if (m->_kind == _Z_KEYEXPR_MATCHER_EXACT) {
+        return _z_string_len(&left->_keyexpr) == (size_t)(rend - rbegin) &&
+               memcmp(lbegin, rbegin, (size_t)(rend - rbegin)) == 0;
+    }
+    // Segments preceding the ** one match the first chunks of right
+    bool remaining = true;
+    for (uint16_t i = 0; i < m->_double_star; i++) {
+        const _z_keyexpr_matcher_segment_t *seg = &m->_segments[i];
+        const char *cend;
+        if (!remaining) {
+            return false;
+        } else if (seg->_is_star) {
+            cend = _z_chunk_end(rbegin, rend);
+            if (cend == rbegin || *rbegin == _Z_VERBATIM) {
+                return false;
+            }
+        } else {
+            if ((size_t)(rend - rbegin) < seg->_len || memcmp(lbegin + seg->_begin, rbegin, seg->_len) != 0) {
+                return false;
+            }
+            cend = rbegin + seg->_len;
+            if (cend != rend && *cend != _Z_DELIMITER) {
+                return false;
+            }
+        }
+        remaining = cend != rend;
+        if (remaining) {
+            rbegin = cend + _Z_DELIMITER_LEN;
+        }
+    }
+    if (m->_double_star == m->_len) {
+        return !remaining;
+    }
+    // Segments following it match the last chunks, without overlapping the ones already matched
+    for (uint16_t i = (uint16_t)(m->_len - 1); i > m->_double_star; i--) {
+        const _z_keyexpr_matcher_segment_t *seg = &m->_segments[i];
+        const char *cbegin;
+        if (!remaining) {
+            return false;
+        } else if (seg->_is_star) {
+            cbegin = _z_chunk_begin(rbegin, rend);
+            if (cbegin == rend || *cbegin == _Z_VERBATIM) {
+                return false;
+            }
+        } else {
+            if ((size_t)(rend - rbegin) < seg->_len || memcmp(lbegin + seg->_begin, rend - seg->_len, seg->_len) != 0) {
+                return false;
+            }
+            cbegin = rend - seg->_len;
+            if (cbegin != rbegin && *(cbegin - 1) != _Z_DELIMITER) {
+                return false;
+            }
+        }
+        remaining = cbegin != rbegin;
+        if (remaining) {
+            rend = cbegin - _Z_DELIMITER_LEN;
+        }
+    }
+    // ** matches whatever is left, unless it has verbatim chunks
+    return !remaining || _z_keyexpr_get_next_verbatim_chunk(rbegin, rend) == NULL;
+}
+
+bool _z_keyexpr_matcher_intersects(const _z_keyexpr_matcher_t *m, const _z_keyexpr_t *left,
+                                   const _z_keyexpr_t *right) {
+    size_t right_len = _z_string_len(&right->_keyexpr);
+    const char *right_start = _z_string_data(&right->_keyexpr);
+    if (m->_kind == _Z_KEYEXPR_MATCHER_GENERIC || memchr(right_start, _Z_STAR, right_len) != NULL) {
+        return _z_keyexpr_intersects(left, right);
+    }
+    return _z_keyexpr_matcher_matches(m, left, right_start, right_start + right_len);
+}
+
+bool _z_keyexpr_matcher_includes(const _z_keyexpr_matcher_t *m, const _z_keyexpr_t *left, const _z_keyexpr_t *right) {
+    size_t right_len = _z_string_len(&right->_keyexpr);
+    const char *right_start = _z_string_data(&right->_keyexpr);
+    if (m->_kind == _Z_KEYEXPR_MATCHER_GENERIC || memchr(right_start, _Z_STAR, right_len) != NULL) {
+        return _z_keyexpr_includes(left, right);
+    }
+    // Both relations are the same when right has no wildcards
+    return _z_keyexpr_matcher_matches(m, left, right_start, right_start + right_len);
+}
@@ -72,6 +72,7 @@ void _z_session_queryable_clear(_z_session_queryable_t *qle) {
         qle->_dropper(qle->_arg);
         qle->_dropper = NULL;
     }
+    _z_keyexpr_matcher_clear(&qle->_matcher);
     _z_declared_keyexpr_clear(&qle->_key);
     _z_sync_group_notifier_drop(&qle->_session_callback_drop_notifier);
     _z_sync_group_notifier_drop(&qle->_queryable_callback_drop_notifier);
@@ -123,7 +124,7 @@ static z_result_t __unsafe_z_get_session_queryables_by_key(_z_session_t *zn, con
         const _z_session_queryable_t *qle_val = _Z_RC_IN_VAL(qle);
         bool origin_allowed = is_remote ? _z_locality_allows_remote(qle_val->_allowed_origin)
                                         : _z_locality_allows_local(qle_val->_allowed_origin);
-        if (origin_allowed && _z_keyexpr_intersects(&qle_val->_key._inner, key)) {
+        if (origin_allowed && _z_keyexpr_matcher_intersects(&qle_val->_matcher, &qle_val->_key._inner, key)) {
             _z_session_queryable_rc_t qle_clone = _z_session_queryable_rc_clone(qle);
             _Z_CLEAN_RETURN_IF_ERR(_z_session_queryable_rc_svec_append(qle_infos, &qle_clone, false),
                                    _z_session_queryable_rc_svec_clear(qle_infos));
@@ -68,6 +68,7 @@ void _z_subscription_clear(_z_subscription_t *sub) {
         sub->_dropper(sub->_arg);
         sub->_dropper = NULL;
     }
+    _z_keyexpr_matcher_clear(&sub->_matcher);
     _z_declared_keyexpr_clear(&sub->_key);
     _z_sync_group_notifier_drop(&sub->_session_callback_drop_notifier);
     _z_sync_group_notifier_drop(&sub->_subscriber_callback_drop_notifier);
@@ -121,7 +122,7 @@ static z_result_t __unsafe_z_get_subscriptions_by_key(_z_session_t *zn, _z_subsc
         const _z_subscription_t *sub_val = _Z_RC_IN_VAL(sub);
         bool origin_allowed = is_remote ? _z_locality_allows_remote(sub_val->_allowed_origin)
                                         : _z_locality_allows_local(sub_val->_allowed_origin);
-        if (origin_allowed && _z_keyexpr_intersects(&sub_val->_key._inner, key)) {
+        if (origin_allowed && _z_keyexpr_matcher_intersects(&sub_val->_matcher, &sub_val->_key._inner, key)) {
             _z_subscription_rc_t sub_clone = _z_subscription_rc_clone(sub);
             _Z_CLEAN_RETURN_IF_ERR(_z_subscription_rc_svec_append(sub_infos, &sub_clone, false),
                                    _z_subscription_rc_svec_clear(sub_infos));
@@ -281,6 +282,16 @@ z_result_t _z_trigger_subscriptions_impl(_z_session_t *zn, _z_subscriber_kind_t
     _z_sample_t sample;
     _z_sample_steal_data(&sample, &sub_infos.ke, payload, timestamp, encoding, sample_kind, qos, attachment,
                          reliability, source_info);
+#if Z_FEATURE_COMPRESSION == 1
+    // A payload that cannot be decompressed only costs its sample, the connection it came from is kept
+    if (sub_nb > 0) {
+        z_result_t res = _z_sample_payload_decompress(&sample.payload, &sample.encoding);
+        if (res != _Z_RES_OK) {
+            _Z_WARN("Dropping sample with a malformed compressed payload: %i", res);
+            sub_nb = 0;
+        }
+    }
+#endif
     // Parse subscription infos svec
     if (sub_nb == 1) {
         _z_subscription_t *sub_info = _Z_RC_IN_VAL(_z_subscription_rc_svec_get(subs, 0));
@@ -47,11 +47,11 @@ uint64_t z_random_u64(void) {
 void z_random_fill(void *buf, size_t len) { esp_fill_random(buf, len); }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) { return heap_caps_malloc(size, MALLOC_CAP_8BIT); }
+void *_z_malloc(size_t size) { return heap_caps_malloc(size, MALLOC_CAP_8BIT); }
 
-void *z_realloc(void *ptr, size_t size) { return heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT); }
+void *_z_realloc(void *ptr, size_t size) { return heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT); }
 
-void z_free(void *ptr) { heap_caps_free(ptr); }
+void _z_free(void *ptr) { heap_caps_free(ptr); }
 
 #if Z_FEATURE_MULTI_THREAD == 1
 // This wrapper is only used for ESP32.
@@ -0,0 +1,386 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/system/common/allocator.h"
+
+#include <string.h>
+
+#include "zenoh-pico/utils/logging.h"
+
+// Prefix of the blocks handed out by the allocators below. It is padded to the strictest alignment of the scalar
+// types, so that the block following it is suitably aligned for any of them.
+typedef union {
+    size_t size;
+    void *ptr;
+    long long ll;
+    long double ld;
+} _zp_allocator_header_t;
+
+#define _ZP_ALLOCATOR_HEADER_SIZE sizeof(_zp_allocator_header_t)
+
+static inline size_t _zp_allocator_round_up(size_t size) {
+    size_t rem = size % _ZP_ALLOCATOR_HEADER_SIZE;
+    return (rem == 0) ? size : size + (_ZP_ALLOCATOR_HEADER_SIZE - rem);
+}
+
+static inline _zp_allocator_header_t *_zp_allocator_header(void *ptr) { return (_zp_allocator_header_t *)ptr - 1; }
+
+// Aligns the start of a caller-provided region, returns the usable length
+static size_t _zp_allocator_align_region(uint8_t **start, size_t len) {
+    size_t misalign = (uintptr_t)*start % _ZP_ALLOCATOR_HEADER_SIZE;
+    size_t skip = (misalign == 0) ? 0 : _ZP_ALLOCATOR_HEADER_SIZE - misalign;
+    if (skip > len) {
+        return 0;
+    }
+    *start += skip;
+    return len - skip;
+}
+
+#if Z_FEATURE_MULTI_THREAD == 1
+#define _ZP_ALLOCATOR_LOCK(m) _z_mutex_lock(m)
+#define _ZP_ALLOCATOR_UNLOCK(m) _z_mutex_unlock(m)
+#else
+#define _ZP_ALLOCATOR_LOCK(m)
+#define _ZP_ALLOCATOR_UNLOCK(m)
+#endif
+
+/*------------------ Pool allocator ------------------*/
+static inline size_t _zp_pool_class_size(size_t cls) { return (size_t)ZP_POOL_ALLOCATOR_MIN_BLOCK_SIZE << cls; }
+
+static bool _zp_pool_class_of(size_t size, size_t *cls) {
+    for (size_t i = 0; i < ZP_POOL_ALLOCATOR_CLASS_COUNT; i++) {
+        if (size <= _zp_pool_class_size(i)) {
+            *cls = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline bool _zp_pool_owns(const zp_pool_allocator_t *pool, const void *ptr) {
+    return (const uint8_t *)ptr >= pool->_start && (const uint8_t *)ptr < pool->_end;
+}
+
+static void *_zp_pool_alloc(void *context, size_t size) {
+    zp_pool_allocator_t *pool = (zp_pool_allocator_t *)context;
+    if (size == 0) {
+        return NULL;
+    }
+    void *block = NULL;
+    size_t cls;
+    if (_zp_pool_class_of(size, &cls)) {
+        _ZP_ALLOCATOR_LOCK(&pool->_mutex);
+        if (pool->_free_lists[cls] != NULL) {
+            block = pool->_free_lists[cls];
+            pool->_free_lists[cls] = *(void **)block;
+        } else {
+            size_t footprint = _ZP_ALLOCATOR_HEADER_SIZE + _zp_allocator_round_up(_zp_pool_class_size(cls));
+            if ((size_t)(pool->_end - pool->_next) >= footprint) {
+                _zp_allocator_header_t *header = (_zp_allocator_header_t *)pool->_next;
+                header->size = cls;
+                block = header + 1;
+                pool->_next += footprint;
+            }
+        }
+        _ZP_ALLOCATOR_UNLOCK(&pool->_mutex);
+    }
+    if (block == NULL && pool->_has_fallback) {
+        block = pool->_fallback.alloc_fn(pool->_fallback.context, size);
+    }
+    return block;
+}
+
+static void _zp_pool_free(void *context, void *ptr) {
+    zp_pool_allocator_t *pool = (zp_pool_allocator_t *)context;
+    if (ptr == NULL) {
+        return;
+    }
+    if (_zp_pool_owns(pool, ptr)) {
+        size_t cls = _zp_allocator_header(ptr)->size;
+        _ZP_ALLOCATOR_LOCK(&pool->_mutex);
+        *(void **)ptr = pool->_free_lists[cls];
+        pool->_free_lists[cls] = ptr;
+        _ZP_ALLOCATOR_UNLOCK(&pool->_mutex);
+    } else if (pool->_has_fallback) {
+        pool->_fallback.free_fn(pool->_fallback.context, ptr);
+    } else {
+        _Z_ERROR("Pool allocator: freeing a block it does not own");
+    }
+}
+
+static void *_zp_pool_realloc(void *context, void *ptr, size_t size) {
+    zp_pool_allocator_t *pool = (zp_pool_allocator_t *)context;
+    if (ptr == NULL) {
+        return _zp_pool_alloc(context, size);
+    }
+    if (size == 0) {
+        _zp_pool_free(context, ptr);
+        return NULL;
+    }
+    if (!_zp_pool_owns(pool, ptr)) {
+        return pool->_has_fallback ? pool->_fallback.realloc_fn(pool->_fallback.context, ptr, size) : NULL;
+    }
+    size_t block_size = _zp_pool_class_size(_zp_allocator_header(ptr)->size);
+    if (size <= block_size) {
+        return ptr;
+    }
+    void *block = _zp_pool_alloc(context, size);
+    if (block != NULL) {
+        memcpy(block, ptr, block_size);
+        _zp_pool_free(context, ptr);
+    }
+    return block;
+}
+
+z_result_t zp_pool_allocator_init(zp_pool_allocator_t *pool, void *buffer, size_t len, const zp_allocator_t *fallback) {
+    if (pool == NULL || (buffer == NULL && len > 0)) {
+        _Z_ERROR_RETURN(_Z_ERR_INVALID);
+    }
+    memset(pool, 0, sizeof(zp_pool_allocator_t));
+    uint8_t *start = (uint8_t *)buffer;
+    len = (start != NULL) ? _zp_allocator_align_region(&start, len) : 0;
+    pool->_start = start;
+    pool->_end = start + len;
+    pool->_next = start;
+    if (fallback != NULL) {
+        pool->_fallback = *fallback;
+        pool->_has_fallback = true;
+    }
+#if Z_FEATURE_MULTI_THREAD == 1
+    _Z_RETURN_IF_ERR(_z_mutex_init(&pool->_mutex));
+#endif
+    return _Z_RES_OK;
+}
+
+zp_allocator_t zp_pool_allocator(zp_pool_allocator_t *pool) {
+    zp_allocator_t allocator = {
+        .context = pool, .alloc_fn = _zp_pool_alloc, .realloc_fn = _zp_pool_realloc, .free_fn = _zp_pool_free};
+    return allocator;
+}
+
+void zp_pool_allocator_clear(zp_pool_allocator_t *pool) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_drop(&pool->_mutex);
+#endif
+    memset(pool, 0, sizeof(zp_pool_allocator_t));
+}
+
+/*------------------ Arena allocator ------------------*/
+// _last is the offset of the most recent allocation still live, it equals _offset when there is none
+
+static void *_zp_arena_alloc_locked(zp_arena_allocator_t *arena, size_t size) {
+    if (size == 0 || size > arena->_capacity) {
+        return NULL;
+    }
+    size_t footprint = _ZP_ALLOCATOR_HEADER_SIZE + _zp_allocator_round_up(size);
+    if (arena->_capacity - arena->_offset < footprint) {
+        return NULL;
+    }
+    _zp_allocator_header_t *header = (_zp_allocator_header_t *)(arena->_start + arena->_offset);
+    header->size = size;
+    arena->_last = arena->_offset;
+    arena->_offset += footprint;
+    return header + 1;
+}
+
+static inline bool _zp_arena_is_last(const zp_arena_allocator_t *arena, void *ptr) {
+    return arena->_last < arena->_offset && (uint8_t *)_zp_allocator_header(ptr) == arena->_start + arena->_last;
+}
+
+static void *_zp_arena_alloc(void *context, size_t size) {
+    zp_arena_allocator_t *arena = (zp_arena_allocator_t *)context;
+    _ZP_ALLOCATOR_LOCK(&arena->_mutex);
+    void *block = _zp_arena_alloc_locked(arena, size);
+    _ZP_ALLOCATOR_UNLOCK(&arena->_mutex);
+    return block;
+}
+
+static void _zp_arena_free(void *context, void *ptr) {
+    zp_arena_allocator_t *arena = (zp_arena_allocator_t *)context;
+    if (ptr == NULL) {
+        return;
+    }
+    _ZP_ALLOCATOR_LOCK(&arena->_mutex);
+    if (_zp_arena_is_last(arena, ptr)) {
+        arena->_offset = arena->_last;
+    }
+    _ZP_ALLOCATOR_UNLOCK(&arena->_mutex);
+}
+
+static void *_zp_arena_realloc(void *context, void *ptr, size_t size) {
+    zp_arena_allocator_t *arena = (zp_arena_allocator_t *)context;
+    if (ptr == NULL) {
+        return _zp_arena_alloc(context, size);
+    }
+    if (size == 0) {
+        _zp_arena_free(context, ptr);
+        return NULL;
+    }
+    void *block = NULL;
+    _ZP_ALLOCATOR_LOCK(&arena->_mutex);
+    _zp_allocator_header_t *header = _zp_allocator_header(ptr);
+    if (_zp_arena_is_last(arena, ptr) && size <= arena->_capacity &&
+        arena->_capacity - arena->_last - _ZP_ALLOCATOR_HEADER_SIZE >= _zp_allocator_round_up(size)) {
+        // Resize in place
+        header->size = size;
+        arena->_offset = arena->_last + _ZP_ALLOCATOR_HEADER_SIZE + _zp_allocator_round_up(size);
+        block = ptr;
+    } else {
+        size_t old_size = header->size;
+        block = _zp_arena_alloc_locked(arena, size);
+        if (block != NULL) {
+            memcpy(block, ptr, (old_size < size) ? old_size : size);
+        }
+    }
+    _ZP_ALLOCATOR_UNLOCK(&arena->_mutex);
+    return block;
+}
+
+z_result_t zp_arena_allocator_init(zp_arena_allocator_t *arena, void *buffer, size_t len) {
+    if (arena == NULL || (buffer == NULL && len > 0)) {
+        _Z_ERROR_RETURN(_Z_ERR_INVALID);
+    }
+    memset(arena, 0, sizeof(zp_arena_allocator_t));
+    uint8_t *start = (uint8_t *)buffer;
+    arena->_capacity = (start != NULL) ? _zp_allocator_align_region(&start, len) : 0;
+    arena->_start = start;
+#if Z_FEATURE_MULTI_THREAD == 1
+    _Z_RETURN_IF_ERR(_z_mutex_init(&arena->_mutex));
+#endif
+    return _Z_RES_OK;
+}
+
+zp_allocator_t zp_arena_allocator(zp_arena_allocator_t *arena) {
+    zp_allocator_t allocator = {
+        .context = arena, .alloc_fn = _zp_arena_alloc, .realloc_fn = _zp_arena_realloc, .free_fn = _zp_arena_free};
+    return allocator;
+}
+
+void zp_arena_allocator_reset(zp_arena_allocator_t *arena) {
+    _ZP_ALLOCATOR_LOCK(&arena->_mutex);
+    arena->_offset = 0;
+    arena->_last = 0;
+    _ZP_ALLOCATOR_UNLOCK(&arena->_mutex);
+}
+
+size_t zp_arena_allocator_used(zp_arena_allocator_t *arena) {
+    _ZP_ALLOCATOR_LOCK(&arena->_mutex);
+    size_t used = arena->_offset;
+    _ZP_ALLOCATOR_UNLOCK(&arena->_mutex);
+    return used;
+}
+
+void zp_arena_allocator_clear(zp_arena_allocator_t *arena) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_drop(&arena->_mutex);
+#endif
+    memset(arena, 0, sizeof(zp_arena_allocator_t));
+}
+
+/*------------------ Tracking allocator ------------------*/
+static void *_zp_tracking_alloc(void *context, size_t size) {
+    zp_tracking_allocator_t *tracker = (zp_tracking_allocator_t *)context;
+    if (size == 0 || size > SIZE_MAX - _ZP_ALLOCATOR_HEADER_SIZE) {
+        return NULL;
+    }
+    _zp_allocator_header_t *header = (_zp_allocator_header_t *)tracker->_inner.alloc_fn(
+        tracker->_inner.context, _ZP_ALLOCATOR_HEADER_SIZE + size);
+    if (header == NULL) {
+        return NULL;
+    }
+    header->size = size;
+    _ZP_ALLOCATOR_LOCK(&tracker->_mutex);
+    tracker->_stats.allocations++;
+    tracker->_stats.current_bytes += size;
+    if (tracker->_stats.current_bytes > tracker->_stats.peak_bytes) {
+        tracker->_stats.peak_bytes = tracker->_stats.current_bytes;
+    }
+    _ZP_ALLOCATOR_UNLOCK(&tracker->_mutex);
+    return header + 1;
+}
+
+static void _zp_tracking_free(void *context, void *ptr) {
+    zp_tracking_allocator_t *tracker = (zp_tracking_allocator_t *)context;
+    if (ptr == NULL) {
+        return;
+    }
+    _zp_allocator_header_t *header = _zp_allocator_header(ptr);
+    _ZP_ALLOCATOR_LOCK(&tracker->_mutex);
+    tracker->_stats.frees++;
+    tracker->_stats.current_bytes -= header->size;
+    _ZP_ALLOCATOR_UNLOCK(&tracker->_mutex);
+    tracker->_inner.free_fn(tracker->_inner.context, header);
+}
+
+static void *_zp_tracking_realloc(void *context, void *ptr, size_t size) {
+    zp_tracking_allocator_t *tracker = (zp_tracking_allocator_t *)context;
+    if (ptr == NULL) {
+        return _zp_tracking_alloc(context, size);
+    }
+    if (size == 0) {
+        _zp_tracking_free(context, ptr);
+        return NULL;
+    }
+    if (size > SIZE_MAX - _ZP_ALLOCATOR_HEADER_SIZE) {
+        return NULL;
+    }
+    size_t old_size = _zp_allocator_header(ptr)->size;
+    _zp_allocator_header_t *header = (_zp_allocator_header_t *)tracker->_inner.realloc_fn(
+        tracker->_inner.context, _zp_allocator_header(ptr), _ZP_ALLOCATOR_HEADER_SIZE + size);
+    if (header == NULL) {
+        return NULL;
+    }
+    header->size = size;
+    _ZP_ALLOCATOR_LOCK(&tracker->_mutex);
+    tracker->_stats.current_bytes = tracker->_stats.current_bytes - old_size + size;
+    if (tracker->_stats.current_bytes > tracker->_stats.peak_bytes) {
+        tracker->_stats.peak_bytes = tracker->_stats.current_bytes;
+    }
+    _ZP_ALLOCATOR_UNLOCK(&tracker->_mutex);
+    return header + 1;
+}
+
+z_result_t zp_tracking_allocator_init(zp_tracking_allocator_t *tracker, const zp_allocator_t *inner) {
+    if (tracker == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_INVALID);
+    }
+    memset(tracker, 0, sizeof(zp_tracking_allocator_t));
+    tracker->_inner = (inner != NULL) ? *inner : zp_allocator_platform();
+#if Z_FEATURE_MULTI_THREAD == 1
+    _Z_RETURN_IF_ERR(_z_mutex_init(&tracker->_mutex));
+#endif
+    return _Z_RES_OK;
+}
+
+zp_allocator_t zp_tracking_allocator(zp_tracking_allocator_t *tracker) {
+    zp_allocator_t allocator = {.context = tracker,
+                                .alloc_fn = _zp_tracking_alloc,
+                                .realloc_fn = _zp_tracking_realloc,
+                                .free_fn = _zp_tracking_free};
+    return allocator;
+}
+
+zp_allocator_stats_t zp_tracking_allocator_stats(zp_tracking_allocator_t *tracker) {
+    _ZP_ALLOCATOR_LOCK(&tracker->_mutex);
+    zp_allocator_stats_t stats = tracker->_stats;
+    _ZP_ALLOCATOR_UNLOCK(&tracker->_mutex);
+    return stats;
+}
+
+void zp_tracking_allocator_clear(zp_tracking_allocator_t *tracker) {
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_drop(&tracker->_mutex);
+#endif
+    memset(tracker, 0, sizeof(zp_tracking_allocator_t));
+}
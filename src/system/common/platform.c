@@ -14,6 +14,50 @@
 #include "zenoh-pico/system/common/platform.h"
 
 #include "zenoh-pico/api/olv_macros.h"
+#include "zenoh-pico/utils/logging.h"
+
+/*------------------ Memory ------------------*/
+static void *_z_platform_alloc(void *context, size_t size) {
+    _ZP_UNUSED(context);
+    return _z_malloc(size);
+}
+
+static void *_z_platform_realloc(void *context, void *ptr, size_t size) {
+    _ZP_UNUSED(context);
+    return _z_realloc(ptr, size);
+}
+
+static void _z_platform_free(void *context, void *ptr) {
+    _ZP_UNUSED(context);
+    _z_free(ptr);
+}
+
+static zp_allocator_t _z_allocator = {
+    .context = NULL, .alloc_fn = _z_platform_alloc, .realloc_fn = _z_platform_realloc, .free_fn = _z_platform_free};
+
+zp_allocator_t zp_allocator_platform(void) {
+    zp_allocator_t allocator = {
+        .context = NULL, .alloc_fn = _z_platform_alloc, .realloc_fn = _z_platform_realloc, .free_fn = _z_platform_free};
+    return allocator;
+}
+
+z_result_t zp_allocator_set(const zp_allocator_t *allocator) {
+    if (allocator == NULL) {
+        _z_allocator = zp_allocator_platform();
+        return _Z_RES_OK;
+    }
+    if (allocator->alloc_fn == NULL || allocator->realloc_fn == NULL || allocator->free_fn == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_INVALID);
+    }
+    _z_allocator = *allocator;
+    return _Z_RES_OK;
+}
+
+void *z_malloc(size_t size) { return _z_allocator.alloc_fn(_z_allocator.context, size); }
+
+void *z_realloc(void *ptr, size_t size) { return _z_allocator.realloc_fn(_z_allocator.context, ptr, size); }
+
+void z_free(void *ptr) { _z_allocator.free_fn(_z_allocator.context, ptr); }
 
 #if Z_FEATURE_MULTI_THREAD == 1
 
@@ -39,11 +39,11 @@ void z_random_fill(void *buf, size_t len) {
 }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) { return malloc(size); }
+void *_z_malloc(size_t size) { return malloc(size); }
 
-void *z_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
+void *_z_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
 
-void z_free(void *ptr) { free(ptr); }
+void _z_free(void *ptr) { free(ptr); }
 
 #if Z_FEATURE_MULTI_THREAD == 1
 /*------------------ Task ------------------*/
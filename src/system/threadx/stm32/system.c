@@ -40,7 +40,7 @@ void z_random_fill(void *buf, size_t len) {
 }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) {
+void *_z_malloc(size_t size) {
     void *ptr = NULL;
 
     uint8_t r = tx_byte_allocate(pthreadx_byte_pool, &ptr, size, TX_WAIT_FOREVER);
@@ -50,12 +50,12 @@ void *z_malloc(size_t size) {
     return ptr;
 }
 
-void *z_realloc(void *ptr, size_t size) {
+void *_z_realloc(void *ptr, size_t size) {
     // realloc not implemented
     return NULL;
 }
 
-void z_free(void *ptr) { tx_byte_release(ptr); }
+void _z_free(void *ptr) { tx_byte_release(ptr); }
 
 #if Z_FEATURE_MULTI_THREAD == 1
 
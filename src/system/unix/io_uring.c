@@ -0,0 +1,798 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/system/platform/unix/io_uring.h"
+
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+
+#include <endian.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "zenoh-pico/collections/atomic.h"
+#include "zenoh-pico/system/common/platform.h"
+#include "zenoh-pico/utils/logging.h"
+
+#define _Z_IO_URING_ENTRIES 64U
+// user_data of removal and cancellation requests, socket requests always have a non-zero generation in their upper half
+#define _Z_IO_URING_TAG_REMOVE 0U
+// user_data of send requests, told apart from removal requests by this bit of their lower half
+#define _Z_IO_URING_TAG_SEND 0x80000000U
+// Sends submitted by a single system call, so that their completions fit in the completion queue
+#define _Z_IO_URING_SEND_BATCH (_Z_IO_URING_ENTRIES / 2U)
+#define _Z_IO_URING_BUF_GROUP 0U
+#define _Z_IO_URING_NO_BUF UINT16_MAX
+// Attempts at waiting for the cancellation of the receive requests before the ring is released
+#define _Z_IO_URING_CANCEL_WAIT_NB 100U
+
+#if (Z_IO_URING_RECV_BUFFER_NB == 0) || ((Z_IO_URING_RECV_BUFFER_NB & (Z_IO_URING_RECV_BUFFER_NB - 1)) != 0) || \
+    (Z_IO_URING_RECV_BUFFER_NB > 32768)
+#error "Z_IO_URING_RECV_BUFFER_NB must be a power of 2, at most 32768"
+#endif
+
+typedef enum {
+    _Z_IO_URING_SOCK_IDLE = 0,
+    _Z_IO_URING_SOCK_ARMED = 1,
+    _Z_IO_URING_SOCK_READY = 2,
+    _Z_IO_URING_SOCK_CANCELING = 3,
+} _z_io_uring_sock_state_t;
+
+typedef enum {
+    _Z_IO_URING_MODE_POLL = 0,
+    _Z_IO_URING_MODE_RECV = 1,
+} _z_io_uring_sock_mode_t;
+
+/**
+ * Request of a socket, indexed by its file descriptor number.
+ *
+ * Members:
+ *   uint64_t _ino: Inode of the socket the request was made for, 0 if unknown, to tell it apart from a later socket
+ *     with the same descriptor number.
+ *   uint32_t _gen: Generation of the last request, part of its user_data so that completions of removed requests are
+ *     told apart from completions of the current one.
+ *   uint32_t _round: Last call of :c:func:`_z_io_uring_wait_readable` the file descriptor was part of.
+ *   int _err: Error that ended the receive request, reported once its data has been read.
+ *   uint16_t _head: First buffer of received data not read yet, _Z_IO_URING_NO_BUF if none.
+ *   uint16_t _tail: Last buffer of received data.
+ *   uint32_t _offset: Number of bytes of the first buffer already read.
+ *   uint8_t _state: A :c:type:`_z_io_uring_sock_state_t`.
+ *   uint8_t _mode: A :c:type:`_z_io_uring_sock_mode_t`, poll requests until the waiting thread reads the socket.
+ *   bool _recv_candidate: The socket was read by the waiting thread, its data can be received by a multishot request.
+ *   bool _eof: The peer closed the connection, reported once the received data has been read.
+ */
+typedef struct {
+    uint64_t _ino;
+    uint32_t _gen;
+    uint32_t _round;
+    int _err;
+    uint16_t _head;
+    uint16_t _tail;
+    uint32_t _offset;
+    uint8_t _state;
+    uint8_t _mode;
+    bool _recv_candidate;
+    bool _eof;
+} _z_io_uring_sock_t;
+
+typedef struct {
+    int _fd;
+    void *_sq_ring;
+    size_t _sq_ring_size;
+    void *_cq_ring;
+    size_t _cq_ring_size;
+    struct io_uring_sqe *_sqes;
+    size_t _sqes_size;
+    unsigned *_sq_tail;
+    unsigned *_sq_mask;
+    unsigned *_sq_array;
+    unsigned *_cq_head;
+    unsigned *_cq_tail;
+    unsigned *_cq_mask;
+    struct io_uring_cqe *_cqes;
+    unsigned _to_submit;
+    unsigned _sq_entries;
+
+    _z_io_uring_sock_t *_socks;
+    size_t _socks_len;
+    uint32_t _round;
+    size_t _close_epoch;
+
+    // Provided buffers of the multishot receive requests, set up when the first one is made
+    struct io_uring_buf *_br;
+    size_t _br_size;
+    uint8_t *_bufs;
+    uint32_t _buf_len[Z_IO_URING_RECV_BUFFER_NB];
+    uint16_t _buf_next[Z_IO_URING_RECV_BUFFER_NB];
+    uint16_t _br_tail;
+    size_t _bufs_free;
+    bool _recv_unsupported;
+
+    // Completions of the sends in progress
+    size_t _send_len;
+    size_t _sends_done;
+    size_t _sends_ok;
+} _z_io_uring_t;
+
+// Bumped on every socket close, see _z_io_uring_socket_closed
+static _z_atomic_size_t _z_io_uring_close_epoch = {0};
+
+static pthread_once_t _z_io_uring_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t _z_io_uring_key;
+static bool _z_io_uring_key_valid = false;
+// Thread specific value of threads where io_uring could not be set up, so that it is only tried once
+static char _z_io_uring_unsupported;
+
+static int _z_io_uring_setup(unsigned entries, struct io_uring_params *params) {
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int _z_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, const void *arg,
+                             size_t arg_size) {
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, arg_size);
+}
+
+static int _z_io_uring_register(int fd, unsigned opcode, const void *arg, unsigned nr_args) {
+    return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static void _z_io_uring_reap(_z_io_uring_t *ring);
+static z_result_t _z_io_uring_push(_z_io_uring_t *ring, const struct io_uring_sqe *sqe);
+
+// Submits the queued requests and waits for min_complete completions, or at most timeout_ms
+static z_result_t _z_io_uring_submit_and_wait(_z_io_uring_t *ring, unsigned min_complete, uint32_t timeout_ms) {
+    struct __kernel_timespec ts = {
+        .tv_sec = (long long)(timeout_ms / 1000U),
+        .tv_nsec = (long long)((timeout_ms % 1000U) * 1000000U),
+    };
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    arg.sigmask_sz = _NSIG / 8;
+    arg.ts = (uint64_t)(uintptr_t)&ts;
+    int ret = _z_io_uring_enter(ring->_fd, ring->_to_submit, min_complete,
+                                IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    if (ret >= 0) {
+        ring->_to_submit -= (unsigned)ret;
+    } else if ((errno != ETIME) && (errno != EINTR)) {
+        _Z_DEBUG("io_uring_enter failed, errno %d", errno);
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    _z_io_uring_reap(ring);
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_io_uring_cancel(_z_io_uring_t *ring, const _z_io_uring_sock_t *sock, int fd) {
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = (sock->_mode == _Z_IO_URING_MODE_POLL) ? IORING_OP_POLL_REMOVE : IORING_OP_ASYNC_CANCEL;
+    sqe.fd = -1;
+    sqe.addr = ((uint64_t)sock->_gen << 32) | (uint32_t)fd;
+    sqe.user_data = _Z_IO_URING_TAG_REMOVE;
+    return _z_io_uring_push(ring, &sqe);
+}
+
+// Receive requests write to the provided buffers until they end, so they are all canceled before the buffers are freed
+static void _z_io_uring_cancel_recvs(_z_io_uring_t *ring) {
+    bool pending = false;
+    for (size_t fd = 0; fd < ring->_socks_len; fd++) {
+        _z_io_uring_sock_t *sock = &ring->_socks[fd];
+        if ((sock->_mode == _Z_IO_URING_MODE_RECV) && (sock->_state == _Z_IO_URING_SOCK_ARMED) &&
+            (_z_io_uring_cancel(ring, sock, (int)fd) == _Z_RES_OK)) {
+            sock->_state = _Z_IO_URING_SOCK_CANCELING;
+        }
+        pending = pending || (sock->_state == _Z_IO_URING_SOCK_CANCELING);
+    }
+    for (unsigned i = 0; pending && (i < _Z_IO_URING_CANCEL_WAIT_NB); i++) {
+        if (_z_io_uring_submit_and_wait(ring, 1, 10) != _Z_RES_OK) {
+            break;
+        }
+        pending = false;
+        for (size_t fd = 0; fd < ring->_socks_len; fd++) {
+            pending = pending || (ring->_socks[fd]._state == _Z_IO_URING_SOCK_CANCELING);
+        }
+    }
+}
+
+static void _z_io_uring_free(_z_io_uring_t *ring) {
+    if ((ring->_br != NULL) && (ring->_fd >= 0)) {
+        _z_io_uring_cancel_recvs(ring);
+    }
+    if (ring->_sqes != NULL) {
+        munmap(ring->_sqes, ring->_sqes_size);
+    }
+    if ((ring->_cq_ring != NULL) && (ring->_cq_ring != ring->_sq_ring)) {
+        munmap(ring->_cq_ring, ring->_cq_ring_size);
+    }
+    if (ring->_sq_ring != NULL) {
+        munmap(ring->_sq_ring, ring->_sq_ring_size);
+    }
+    if (ring->_fd >= 0) {
+        close(ring->_fd);
+    }
+    if (ring->_br != NULL) {
+        munmap(ring->_br, ring->_br_size);
+    }
+    z_free(ring->_bufs);
+    z_free(ring->_socks);
+    z_free(ring);
+}
+
+static void _z_io_uring_thread_exit(void *arg) {
+    if (arg != &_z_io_uring_unsupported) {
+        _z_io_uring_free((_z_io_uring_t *)arg);
+    }
+}
+
+static void _z_io_uring_key_init(void) {
+    _z_io_uring_key_valid = (pthread_key_create(&_z_io_uring_key, _z_io_uring_thread_exit) == 0);
+}
+
+static _z_io_uring_t *_z_io_uring_new(void) {
+    _z_io_uring_t *ring = (_z_io_uring_t *)z_malloc(sizeof(_z_io_uring_t));
+    if (ring == NULL) {
+        return NULL;
+    }
+    memset(ring, 0, sizeof(_z_io_uring_t));
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring->_fd = _z_io_uring_setup(_Z_IO_URING_ENTRIES, &params);
+    if (ring->_fd < 0) {
+        _Z_DEBUG("io_uring is not available (errno %d), using select", errno);
+        z_free(ring);
+        return NULL;
+    }
+    // Waiting with a timeout needs IORING_FEAT_EXT_ARG (Linux 5.11)
+    if ((params.features & IORING_FEAT_EXT_ARG) == 0) {
+        _Z_DEBUG("io_uring does not support waiting with a timeout, using select");
+        _z_io_uring_free(ring);
+        return NULL;
+    }
+
+    ring->_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+        if (ring->_cq_ring_size > ring->_sq_ring_size) {
+            ring->_sq_ring_size = ring->_cq_ring_size;
+        }
+        ring->_cq_ring_size = ring->_sq_ring_size;
+    }
+    void *sq_ring = mmap(NULL, ring->_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->_fd,
+                         IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) {
+        _z_io_uring_free(ring);
+        return NULL;
+    }
+    ring->_sq_ring = sq_ring;
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+        ring->_cq_ring = sq_ring;
+    } else {
+        void *cq_ring = mmap(NULL, ring->_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->_fd,
+                             IORING_OFF_CQ_RING);
+        if (cq_ring == MAP_FAILED) {
+            _z_io_uring_free(ring);
+            return NULL;
+        }
+        ring->_cq_ring = cq_ring;
+    }
+    ring->_sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    void *sqes =
+        mmap(NULL, ring->_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->_fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        _z_io_uring_free(ring);
+        return NULL;
+    }
+    ring->_sqes = (struct io_uring_sqe *)sqes;
+
+    uint8_t *sq = (uint8_t *)ring->_sq_ring;
+    uint8_t *cq = (uint8_t *)ring->_cq_ring;
+    ring->_sq_tail = (unsigned *)(void *)(sq + params.sq_off.tail);
+    ring->_sq_mask = (unsigned *)(void *)(sq + params.sq_off.ring_mask);
+    ring->_sq_array = (unsigned *)(void *)(sq + params.sq_off.array);
+    ring->_cq_head = (unsigned *)(void *)(cq + params.cq_off.head);
+    ring->_cq_tail = (unsigned *)(void *)(cq + params.cq_off.tail);
+    ring->_cq_mask = (unsigned *)(void *)(cq + params.cq_off.ring_mask);
+    ring->_cqes = (struct io_uring_cqe *)(void *)(cq + params.cq_off.cqes);
+    ring->_sq_entries = params.sq_entries;
+    ring->_close_epoch = _z_atomic_size_load(&_z_io_uring_close_epoch, _z_memory_order_acquire);
+    return ring;
+}
+
+// Returns the ring of the calling thread, set up on first use if create is true
+static _z_io_uring_t *_z_io_uring_get(bool create) {
+    (void)pthread_once(&_z_io_uring_key_once, _z_io_uring_key_init);
+    if (!_z_io_uring_key_valid) {
+        return NULL;
+    }
+    void *value = pthread_getspecific(_z_io_uring_key);
+    if ((value == NULL) && create) {
+        value = _z_io_uring_new();
+        if (value == NULL) {
+            value = &_z_io_uring_unsupported;
+        }
+        if (pthread_setspecific(_z_io_uring_key, value) != 0) {
+            _z_io_uring_thread_exit(value);
+            return NULL;
+        }
+    }
+    return ((value == NULL) || (value == &_z_io_uring_unsupported)) ? NULL : (_z_io_uring_t *)value;
+}
+
+// Submits the queued requests without waiting for any completion
+static z_result_t _z_io_uring_flush(_z_io_uring_t *ring) {
+    while (ring->_to_submit > 0) {
+        int ret = _z_io_uring_enter(ring->_fd, ring->_to_submit, 0, 0, NULL, 0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            _Z_DEBUG("io_uring_enter failed, errno %d", errno);
+            _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+        }
+        ring->_to_submit -= (unsigned)ret;
+    }
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_io_uring_push(_z_io_uring_t *ring, const struct io_uring_sqe *sqe) {
+    if (ring->_to_submit == ring->_sq_entries) {
+        _Z_RETURN_IF_ERR(_z_io_uring_flush(ring));
+    }
+    // Only this thread produces submissions, the kernel only reads the tail
+    unsigned tail = *ring->_sq_tail;
+    unsigned idx = tail & *ring->_sq_mask;
+    ring->_sqes[idx] = *sqe;
+    ring->_sq_array[idx] = idx;
+    __atomic_store_n(ring->_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->_to_submit++;
+    return _Z_RES_OK;
+}
+
+// Hands a buffer back to the kernel, for the receive requests to fill it again
+static void _z_io_uring_buf_recycle(_z_io_uring_t *ring, uint16_t bid) {
+    struct io_uring_buf *buf = &ring->_br[ring->_br_tail & (Z_IO_URING_RECV_BUFFER_NB - 1U)];
+    buf->addr = (uint64_t)(uintptr_t)&ring->_bufs[(size_t)bid * Z_IO_URING_RECV_BUFFER_SIZE];
+    buf->len = Z_IO_URING_RECV_BUFFER_SIZE;
+    buf->bid = bid;
+    ring->_br_tail++;
+    // The tail of the buffer ring overlays the reserved field of its first entry
+    __atomic_store_n(&ring->_br[0].resv, ring->_br_tail, __ATOMIC_RELEASE);
+    ring->_bufs_free++;
+}
+
+static bool _z_io_uring_bufs_init(_z_io_uring_t *ring) {
+    size_t br_size = Z_IO_URING_RECV_BUFFER_NB * sizeof(struct io_uring_buf);
+    // Buffer rings must be page aligned, anonymous mappings are zero-filled
+    void *br = mmap(NULL, br_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (br == MAP_FAILED) {
+        return false;
+    }
+    ring->_bufs = (uint8_t *)z_malloc((size_t)Z_IO_URING_RECV_BUFFER_NB * Z_IO_URING_RECV_BUFFER_SIZE);
+    if (ring->_bufs == NULL) {
+        munmap(br, br_size);
+        return false;
+    }
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)br;
+    reg.ring_entries = Z_IO_URING_RECV_BUFFER_NB;
+    reg.bgid = _Z_IO_URING_BUF_GROUP;
+    // Provided buffer rings need Linux 5.19
+    if (_z_io_uring_register(ring->_fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+        _Z_DEBUG("io_uring buffer rings are not available (errno %d), using poll requests", errno);
+        z_free(ring->_bufs);
+        ring->_bufs = NULL;
+        munmap(br, br_size);
+        return false;
+    }
+    ring->_br = (struct io_uring_buf *)br;
+    ring->_br_size = br_size;
+    for (uint16_t bid = 0; bid < Z_IO_URING_RECV_BUFFER_NB; bid++) {
+        _z_io_uring_buf_recycle(ring, bid);
+    }
+    return true;
+}
+
+static void _z_io_uring_sock_push_buf(_z_io_uring_t *ring, _z_io_uring_sock_t *sock, uint16_t bid, uint32_t len) {
+    ring->_buf_len[bid] = len;
+    ring->_buf_next[bid] = _Z_IO_URING_NO_BUF;
+    if (sock->_head == _Z_IO_URING_NO_BUF) {
+        sock->_head = bid;
+    } else {
+        ring->_buf_next[sock->_tail] = bid;
+    }
+    sock->_tail = bid;
+}
+
+static void _z_io_uring_sock_release_bufs(_z_io_uring_t *ring, _z_io_uring_sock_t *sock) {
+    while (sock->_head != _Z_IO_URING_NO_BUF) {
+        uint16_t bid = sock->_head;
+        sock->_head = ring->_buf_next[bid];
+        _z_io_uring_buf_recycle(ring, bid);
+    }
+    sock->_offset = 0;
+}
+
+static void _z_io_uring_sock_reset(_z_io_uring_sock_t *sock) {
+    sock->_ino = 0;
+    sock->_err = 0;
+    sock->_head = _Z_IO_URING_NO_BUF;
+    sock->_tail = _Z_IO_URING_NO_BUF;
+    sock->_offset = 0;
+    sock->_state = _Z_IO_URING_SOCK_IDLE;
+    sock->_mode = _Z_IO_URING_MODE_POLL;
+    sock->_recv_candidate = false;
+    sock->_eof = false;
+}
+
+static uint64_t _z_io_uring_tag(int fd, uint32_t gen) { return ((uint64_t)gen << 32) | (uint32_t)fd; }
+
+static uint32_t _z_io_uring_next_gen(_z_io_uring_sock_t *sock) {
+    sock->_gen++;
+    if (sock->_gen == 0) {
+        sock->_gen = 1;
+    }
+    return sock->_gen;
+}
+
+static uint64_t _z_io_uring_ino(int fd) {
+    struct stat st;
+    return (fstat(fd, &st) == 0) ? (uint64_t)st.st_ino : 0;
+}
+
+static bool _z_io_uring_is_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return (flags != -1) && ((flags & O_NONBLOCK) != 0);
+}
+
+static z_result_t _z_io_uring_arm_poll(_z_io_uring_t *ring, int fd) {
+    _z_io_uring_sock_t *sock = &ring->_socks[fd];
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_POLL_ADD;
+    sqe.fd = fd;
+    sqe.user_data = _z_io_uring_tag(fd, _z_io_uring_next_gen(sock));
+#if __BYTE_ORDER == __BIG_ENDIAN
+    sqe.poll32_events = ((uint32_t)POLLIN << 16) | ((uint32_t)POLLIN >> 16);
+#else
+    sqe.poll32_events = POLLIN;
+#endif
+    sock->_state = _Z_IO_URING_SOCK_ARMED;
+    return _z_io_uring_push(ring, &sqe);
+}
+
+static z_result_t _z_io_uring_arm_recv(_z_io_uring_t *ring, int fd) {
+    _z_io_uring_sock_t *sock = &ring->_socks[fd];
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_RECV;
+    sqe.fd = fd;
+    sqe.ioprio = IORING_RECV_MULTISHOT;
+    sqe.flags = IOSQE_BUFFER_SELECT;
+    sqe.buf_group = _Z_IO_URING_BUF_GROUP;
+    sqe.user_data = _z_io_uring_tag(fd, _z_io_uring_next_gen(sock));
+    sock->_state = _Z_IO_URING_SOCK_ARMED;
+    return _z_io_uring_push(ring, &sqe);
+}
+
+static z_result_t _z_io_uring_arm(_z_io_uring_t *ring, int fd) {
+    _z_io_uring_sock_t *sock = &ring->_socks[fd];
+    if (sock->_ino == 0) {
+        sock->_ino = _z_io_uring_ino(fd);
+    }
+    if (sock->_mode == _Z_IO_URING_MODE_POLL) {
+        // Sockets read by this thread receive into the provided buffers, unless a read may block on them
+        bool use_recv = sock->_recv_candidate && !ring->_recv_unsupported && _z_io_uring_is_nonblocking(fd);
+        if (use_recv && (ring->_br == NULL) && !_z_io_uring_bufs_init(ring)) {
+            ring->_recv_unsupported = true;
+            use_recv = false;
+        }
+        if (!use_recv) {
+            sock->_recv_candidate = false;
+            // Sockets reported readable are polled again: the request completes right away if data is still pending
+            return (sock->_state != _Z_IO_URING_SOCK_ARMED) ? _z_io_uring_arm_poll(ring, fd) : _Z_RES_OK;
+        }
+        if (sock->_state == _Z_IO_URING_SOCK_ARMED) {
+            _Z_RETURN_IF_ERR(_z_io_uring_cancel(ring, sock, fd));
+        }
+        sock->_mode = _Z_IO_URING_MODE_RECV;
+        sock->_state = _Z_IO_URING_SOCK_IDLE;
+    }
+    // Requests that ran out of buffers are made again once some were read
+    if ((sock->_state == _Z_IO_URING_SOCK_IDLE) && !sock->_eof && (ring->_bufs_free > 0)) {
+        return _z_io_uring_arm_recv(ring, fd);
+    }
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_io_uring_disarm(_z_io_uring_t *ring, int fd) {
+    _z_io_uring_sock_t *sock = &ring->_socks[fd];
+    _Z_RETURN_IF_ERR(_z_io_uring_cancel(ring, sock, fd));
+    // Data received until the receive request ends is kept for the next reads
+    sock->_state = (sock->_mode == _Z_IO_URING_MODE_POLL) ? _Z_IO_URING_SOCK_IDLE : _Z_IO_URING_SOCK_CANCELING;
+    return _Z_RES_OK;
+}
+
+static bool _z_io_uring_sock_ready(const _z_io_uring_sock_t *sock) {
+    if (sock->_mode == _Z_IO_URING_MODE_POLL) {
+        return sock->_state == _Z_IO_URING_SOCK_READY;
+    }
+    // A receive request that ended may have left data in the socket, the read that follows then uses recv
+    return (sock->_head != _Z_IO_URING_NO_BUF) || sock->_eof || (sock->_err != 0) ||
+           (sock->_state == _Z_IO_URING_SOCK_IDLE);
+}
+
+static z_result_t _z_io_uring_reserve(_z_io_uring_t *ring, int fd) {
+    size_t len = (size_t)fd + 1;
+    if (len <= ring->_socks_len) {
+        return _Z_RES_OK;
+    }
+    if (len < 2 * ring->_socks_len) {
+        len = 2 * ring->_socks_len;
+    }
+    _z_io_uring_sock_t *socks = (_z_io_uring_sock_t *)z_realloc(ring->_socks, len * sizeof(_z_io_uring_sock_t));
+    if (socks == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    for (size_t fd_idx = ring->_socks_len; fd_idx < len; fd_idx++) {
+        socks[fd_idx]._gen = 0;
+        socks[fd_idx]._round = 0;
+        _z_io_uring_sock_reset(&socks[fd_idx]);
+    }
+    ring->_socks = socks;
+    ring->_socks_len = len;
+    return _Z_RES_OK;
+}
+
+static void _z_io_uring_handle_recv(_z_io_uring_t *ring, _z_io_uring_sock_t *sock, const struct io_uring_cqe *cqe) {
+    if ((cqe->flags & IORING_CQE_F_MORE) != 0) {
+        return;
+    }
+    sock->_state = _Z_IO_URING_SOCK_IDLE;
+    if (cqe->res == 0) {
+        sock->_eof = true;
+    } else if ((cqe->res == -EINVAL) && (sock->_head == _Z_IO_URING_NO_BUF)) {
+        // Multishot receive requests need Linux 6.0
+        _Z_DEBUG("io_uring multishot receive is not available, using poll requests");
+        ring->_recv_unsupported = true;
+        sock->_mode = _Z_IO_URING_MODE_POLL;
+        sock->_recv_candidate = false;
+    } else if ((cqe->res < 0) && (cqe->res != -ENOBUFS) && (cqe->res != -ECANCELED)) {
+        sock->_err = -cqe->res;
+    }
+}
+
+static void _z_io_uring_reap(_z_io_uring_t *ring) {
+    // Only this thread consumes completions, the kernel only reads the head
+    unsigned head = *ring->_cq_head;
+    unsigned tail = __atomic_load_n(ring->_cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail) {
+        const struct io_uring_cqe *cqe = &ring->_cqes[head & *ring->_cq_mask];
+        head++;
+        uint32_t gen = (uint32_t)(cqe->user_data >> 32);
+        uint32_t low = (uint32_t)cqe->user_data;
+        if (gen == 0) {
+            if ((low & _Z_IO_URING_TAG_SEND) != 0) {
+                ring->_sends_done++;
+                if ((cqe->res >= 0) && ((size_t)cqe->res == ring->_send_len)) {
+                    ring->_sends_ok++;
+                } else {
+                    _Z_DEBUG("io_uring send failed, result %d", cqe->res);
+                }
+            }
+            continue;
+        }
+        // Completions of removal requests and of removed or re-armed requests are ignored, the data they carry is
+        // dropped. Errors such as a closed descriptor are reported as readable, the read that follows then fails.
+        _z_io_uring_sock_t *sock = NULL;
+        if ((low < ring->_socks_len) && (ring->_socks[low]._gen == gen)) {
+            sock = &ring->_socks[low];
+        }
+        if ((cqe->flags & IORING_CQE_F_BUFFER) != 0) {
+            uint16_t bid = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+            ring->_bufs_free--;
+            if ((sock != NULL) && (sock->_mode == _Z_IO_URING_MODE_RECV) && (cqe->res > 0)) {
+                _z_io_uring_sock_push_buf(ring, sock, bid, (uint32_t)cqe->res);
+            } else {
+                _z_io_uring_buf_recycle(ring, bid);
+            }
+        }
+        if (sock == NULL) {
+            continue;
+        }
+        if (sock->_mode == _Z_IO_URING_MODE_RECV) {
+            _z_io_uring_handle_recv(ring, sock, cqe);
+        } else if (sock->_state == _Z_IO_URING_SOCK_ARMED) {
+            sock->_state = _Z_IO_URING_SOCK_READY;
+        }
+    }
+    __atomic_store_n(ring->_cq_head, head, __ATOMIC_RELEASE);
+}
+
+// Drops the requests and the received data of the sockets closed since the last call
+static z_result_t _z_io_uring_forget_closed(_z_io_uring_t *ring) {
+    for (size_t fd = 0; fd < ring->_socks_len; fd++) {
+        _z_io_uring_sock_t *sock = &ring->_socks[fd];
+        if ((sock->_ino == 0) || (_z_io_uring_ino((int)fd) == sock->_ino)) {
+            continue;
+        }
+        // The descriptor number may now belong to another socket
+        if (sock->_state == _Z_IO_URING_SOCK_ARMED) {
+            _Z_RETURN_IF_ERR(_z_io_uring_cancel(ring, sock, (int)fd));
+        }
+        _z_io_uring_sock_release_bufs(ring, sock);
+        // Late completions of the requests made for the closed socket are ignored
+        (void)_z_io_uring_next_gen(sock);
+        _z_io_uring_sock_reset(sock);
+    }
+    return _Z_RES_OK;
+}
+
+bool _z_io_uring_is_available(void) { return _z_io_uring_get(true) != NULL; }
+
+z_result_t _z_io_uring_wait_readable(_z_socket_wait_iter_t *iter, uint32_t timeout_ms) {
+    _z_io_uring_t *ring = _z_io_uring_get(true);
+    if (ring == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+
+    size_t epoch = _z_atomic_size_load(&_z_io_uring_close_epoch, _z_memory_order_acquire);
+    if (epoch != ring->_close_epoch) {
+        ring->_close_epoch = epoch;
+        _Z_RETURN_IF_ERR(_z_io_uring_forget_closed(ring));
+    }
+
+    ring->_round++;
+    bool has_sockets = false;
+    bool has_ready = false;
+    _z_socket_wait_iter_reset(iter);
+    while (_z_socket_wait_iter_next(iter)) {
+        const _z_sys_net_socket_t *sock = _z_socket_wait_iter_get_socket(iter);
+        _z_socket_wait_iter_set_ready(iter, false);
+        if (sock->_fd < 0) {
+            continue;
+        }
+        _Z_RETURN_IF_ERR(_z_io_uring_reserve(ring, sock->_fd));
+        ring->_socks[sock->_fd]._round = ring->_round;
+        _Z_RETURN_IF_ERR(_z_io_uring_arm(ring, sock->_fd));
+        has_ready = has_ready || _z_io_uring_sock_ready(&ring->_socks[sock->_fd]);
+        has_sockets = true;
+    }
+    for (size_t fd = 0; fd < ring->_socks_len; fd++) {
+        if ((ring->_socks[fd]._round != ring->_round) && (ring->_socks[fd]._state == _Z_IO_URING_SOCK_ARMED)) {
+            _Z_RETURN_IF_ERR(_z_io_uring_disarm(ring, (int)fd));
+        }
+    }
+
+    if (!has_sockets) {
+        return _z_io_uring_flush(ring);
+    }
+
+    // Queued requests are submitted and completions awaited in a single system call, that does not wait if some data
+    // was already received
+    _Z_RETURN_IF_ERR(_z_io_uring_submit_and_wait(ring, has_ready ? 0U : 1U, timeout_ms));
+
+    _z_socket_wait_iter_reset(iter);
+    while (_z_socket_wait_iter_next(iter)) {
+        const _z_sys_net_socket_t *sock = _z_socket_wait_iter_get_socket(iter);
+        bool ready = (sock->_fd >= 0) && ((size_t)sock->_fd < ring->_socks_len) &&
+                     _z_io_uring_sock_ready(&ring->_socks[sock->_fd]);
+        _z_socket_wait_iter_set_ready(iter, ready);
+    }
+    return _Z_RES_OK;
+}
+
+bool _z_io_uring_recv(int fd, uint8_t *ptr, size_t len, size_t *rb) {
+    _z_io_uring_t *ring = _z_io_uring_get(false);
+    if ((ring == NULL) || (fd < 0) || ((size_t)fd >= ring->_socks_len)) {
+        return false;
+    }
+    _z_io_uring_sock_t *sock = &ring->_socks[fd];
+    if (sock->_mode == _Z_IO_URING_MODE_POLL) {
+        // Only the sockets this thread waits on are received into its buffers
+        if (sock->_state != _Z_IO_URING_SOCK_IDLE) {
+            sock->_recv_candidate = !ring->_recv_unsupported;
+        }
+        return false;
+    }
+
+    _z_io_uring_reap(ring);
+    size_t n = 0;
+    while ((n < len) && (sock->_head != _Z_IO_URING_NO_BUF)) {
+        uint16_t bid = sock->_head;
+        size_t chunk = ring->_buf_len[bid] - sock->_offset;
+        if (chunk > len - n) {
+            chunk = len - n;
+        }
+        // flawfinder: ignore
+        memcpy(&ptr[n], &ring->_bufs[((size_t)bid * Z_IO_URING_RECV_BUFFER_SIZE) + sock->_offset], chunk);
+        n += chunk;
+        sock->_offset += (uint32_t)chunk;
+        if (sock->_offset == ring->_buf_len[bid]) {
+            sock->_head = ring->_buf_next[bid];
+            sock->_offset = 0;
+            _z_io_uring_buf_recycle(ring, bid);
+        }
+    }
+    if (n > 0) {
+        *rb = n;
+    } else if (sock->_err != 0) {
+        errno = sock->_err;
+        sock->_err = 0;
+        *rb = SIZE_MAX;
+    } else if (sock->_eof) {
+        *rb = 0;
+    } else if (sock->_state != _Z_IO_URING_SOCK_IDLE) {
+        // Data that arrives now is received by the request, as the socket does not block, recv would fail the same way
+        errno = EAGAIN;
+        *rb = SIZE_MAX;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+size_t _z_io_uring_send(const uint8_t *ptr, size_t len, _z_sys_net_socket_t *const *sockets, size_t nb) {
+    _z_io_uring_t *ring = _z_io_uring_get(true);
+    if ((ring == NULL) || (len > (size_t)INT32_MAX)) {
+        return SIZE_MAX;
+    }
+    size_t sent = 0;
+    for (size_t i = 0; i < nb; i += _Z_IO_URING_SEND_BATCH) {
+        size_t batch = ((nb - i) < _Z_IO_URING_SEND_BATCH) ? (nb - i) : _Z_IO_URING_SEND_BATCH;
+        ring->_send_len = len;
+        ring->_sends_done = 0;
+        ring->_sends_ok = 0;
+        size_t queued = 0;
+        for (size_t j = 0; j < batch; j++) {
+            struct io_uring_sqe sqe;
+            memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_SEND;
+            sqe.fd = sockets[i + j]->_fd;
+            sqe.addr = (uint64_t)(uintptr_t)ptr;
+            sqe.len = (uint32_t)len;
+            // Sockets that would block fail the send, like a send on a non-blocking socket
+            sqe.msg_flags = MSG_NOSIGNAL | MSG_DONTWAIT;
+            sqe.user_data = _Z_IO_URING_TAG_SEND;
+            if (_z_io_uring_push(ring, &sqe) != _Z_RES_OK) {
+                break;
+            }
+            queued++;
+        }
+        // The buffer must stay valid until every send of the batch completed
+        while (ring->_sends_done < queued) {
+            if (_z_io_uring_submit_and_wait(ring, 1, Z_CONFIG_SOCKET_TIMEOUT) != _Z_RES_OK) {
+                break;
+            }
+        }
+        sent += ring->_sends_ok;
+    }
+    return sent;
+}
+
+void _z_io_uring_socket_closed(void) {
+    _z_atomic_size_fetch_add(&_z_io_uring_close_epoch, 1, _z_memory_order_release);
+}
+
+#endif
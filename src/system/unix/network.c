@@ -33,6 +33,7 @@
 #include "zenoh-pico/config.h"
 #include "zenoh-pico/link/transport/socket.h"
 #include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/system/platform/unix/io_uring.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
@@ -53,9 +54,17 @@ void _z_socket_close(_z_sys_net_socket_t *sock) {
         close(sock->_fd);
         sock->_fd = -1;
     }
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+    _z_io_uring_socket_closed();
+#endif
 }
 
 z_result_t _z_socket_wait_readable(_z_socket_wait_iter_t *iter, uint32_t timeout_ms) {
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+    if (_z_io_uring_is_available()) {
+        return _z_io_uring_wait_readable(iter, timeout_ms);
+    }
+#endif
     fd_set read_fds;
     int max_fd = 0;
     bool has_sockets = false;
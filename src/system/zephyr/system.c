@@ -52,14 +52,14 @@ uint64_t z_random_u64(void) {
 void z_random_fill(void *buf, size_t len) { sys_rand_get(buf, len); }
 
 /*------------------ Memory ------------------*/
-void *z_malloc(size_t size) { return k_malloc(size); }
+void *_z_malloc(size_t size) { return k_malloc(size); }
 
-void *z_realloc(void *ptr, size_t size) {
+void *_z_realloc(void *ptr, size_t size) {
     // k_realloc not implemented in Zephyr
     return NULL;
 }
 
-void z_free(void *ptr) { k_free(ptr); }
+void _z_free(void *ptr) { k_free(ptr); }
 
 #if Z_FEATURE_MULTI_THREAD == 1
 
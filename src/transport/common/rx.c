@@ -32,6 +32,39 @@ size_t _z_read_stream_size(_z_zbuf_t *zbuf) {
     return _z_host_le_load16(stream_size);
 }
 
+#if Z_FEATURE_COMPRESSION == 1
+z_result_t _z_transport_rx_decompress_batch(_z_transport_common_t *ztc, _z_zbuf_t *zbf) {
+    _z_transport_compression_t *c = ztc->_compression;
+    if (c == NULL) {
+        return _Z_RES_OK;
+    }
+    if (_z_zbuf_len(zbf) < _Z_BATCH_HEADER_SIZE) {
+        _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+    }
+    uint8_t header = _z_zbuf_read(zbf);
+    if (!_Z_HAS_FLAG(header, _Z_BATCH_HEADER_C)) {
+        return _Z_RES_OK;
+    }
+    // Messages of the previous batch may still be referenced by the user
+    if (_z_zbuf_get_ref_count(&c->_zbuf) != 1) {
+        size_t capacity = _z_zbuf_capacity(&c->_zbuf);
+        _z_zbuf_t new_zbuf = _z_zbuf_make(capacity);
+        if (_z_zbuf_capacity(&new_zbuf) != capacity) {
+            _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        }
+        _z_zbuf_clear(&c->_zbuf);
+        c->_zbuf = new_zbuf;
+    }
+    _z_zbuf_reset(&c->_zbuf);
+    size_t len = 0;
+    _Z_RETURN_IF_ERR(_z_lz4_decompress(_z_zbuf_get_wptr(&c->_zbuf), _z_zbuf_capacity(&c->_zbuf),
+                                       _z_zbuf_get_rptr(zbf), _z_zbuf_len(zbf), &len));
+    _z_zbuf_set_wpos(&c->_zbuf, len);
+    *zbf = _z_zbuf_view(&c->_zbuf, len);
+    return _Z_RES_OK;
+}
+#endif
+
 z_result_t _z_link_recv_t_msg_cap_flow_stream(const _z_link_t *zl, _z_zbuf_t *zbf, _z_sys_net_socket_t *socket) {
     // Read the message length
     size_t read = _z_link_recv_exact_zbuf(zl, zbf, _Z_MSG_LEN_ENC_SIZE, NULL, socket);
@@ -0,0 +1,304 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/transport/common/selective_repeat.h"
+
+#include <string.h>
+
+#include "zenoh-pico/transport/common/tx.h"
+#include "zenoh-pico/transport/utils.h"
+#include "zenoh-pico/utils/logging.h"
+
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+
+/*------------------ TX history ------------------*/
+_z_transport_tx_history_t *_z_transport_tx_history_new(size_t capacity) {
+    _z_transport_tx_history_t *h = (_z_transport_tx_history_t *)z_malloc(sizeof(_z_transport_tx_history_t));
+    if (h == NULL) {
+        return NULL;
+    }
+    memset(h, 0, sizeof(_z_transport_tx_history_t));
+    h->_buf = (uint8_t *)z_malloc(capacity);
+    if (h->_buf == NULL) {
+        z_free(h);
+        return NULL;
+    }
+    h->_capacity = capacity;
+    return h;
+}
+
+void _z_transport_tx_history_free(_z_transport_tx_history_t **h) {
+    _z_transport_tx_history_t *ptr = *h;
+    if (ptr != NULL) {
+        z_free(ptr->_buf);
+        z_free(ptr);
+        *h = NULL;
+    }
+}
+
+static inline _z_transport_tx_record_t *_z_transport_tx_history_oldest(_z_transport_tx_history_t *h) {
+    return (h->_len > 0) ? &h->_records[h->_first] : NULL;
+}
+
+static inline void _z_transport_tx_history_pop(_z_transport_tx_history_t *h) {
+    h->_first = (h->_first + 1) % _Z_TRANSPORT_TX_HISTORY_RECORDS;
+    h->_len--;
+}
+
+void _z_transport_tx_history_push(_z_transport_tx_history_t *h, _z_zint_t sn, const uint8_t *buf, size_t len) {
+    if ((len == 0) || (len > h->_capacity)) {
+        return;
+    }
+    size_t start = h->_head;
+    _z_transport_tx_record_t *oldest;
+    if (len > h->_capacity - start) {
+        // Wrap around, the batches left at the end of the ring are the oldest ones
+        while (((oldest = _z_transport_tx_history_oldest(h)) != NULL) && (oldest->_offset >= start)) {
+            _z_transport_tx_history_pop(h);
+        }
+        start = 0;
+    }
+    while (((oldest = _z_transport_tx_history_oldest(h)) != NULL) && (oldest->_offset < start + len) &&
+           (oldest->_offset + oldest->_len > start)) {
+        _z_transport_tx_history_pop(h);
+    }
+    if (h->_len == _Z_TRANSPORT_TX_HISTORY_RECORDS) {
+        _z_transport_tx_history_pop(h);
+    }
+    memcpy(&h->_buf[start], buf, len);
+    _z_transport_tx_record_t *rec = &h->_records[(h->_first + h->_len) % _Z_TRANSPORT_TX_HISTORY_RECORDS];
+    rec->_sn = sn;
+    rec->_offset = start;
+    rec->_len = len;
+    rec->_resent = false;
+    h->_len++;
+    h->_head = start + len;
+}
+
+bool _z_transport_tx_history_get(_z_transport_tx_history_t *h, _z_zint_t sn, _z_slice_t *batch) {
+    *batch = _z_slice_null();
+    for (size_t i = 0; i < h->_len; i++) {
+        _z_transport_tx_record_t *rec = &h->_records[(h->_first + i) % _Z_TRANSPORT_TX_HISTORY_RECORDS];
+        if (rec->_sn != sn) {
+            continue;
+        }
+        if (rec->_resent && (z_clock_elapsed_ms(&rec->_resent_time) < (Z_TRANSPORT_NACK_INTERVAL / 2))) {
+            return true;
+        }
+        rec->_resent = true;
+        rec->_resent_time = z_clock_now();
+        *batch = _z_slice_alias_buf(&h->_buf[rec->_offset], rec->_len);
+        return true;
+    }
+    return false;
+}
+
+/*------------------ NACK ------------------*/
+void _z_transport_nack_send(void *target, _z_zint_t sn, _z_zint_t count) {
+    _z_transport_nack_target_t *t = (_z_transport_nack_target_t *)target;
+    _z_transport_message_t nack = _z_t_msg_make_nack(t->_zid, sn, count);
+    if (_z_link_send_t_msg(t->_link, &nack, NULL) != _Z_RES_OK) {
+        _Z_INFO("Failed to report %u missing reliable messages", (unsigned int)count);
+    }
+}
+
+/*------------------ RX reorder window ------------------*/
+_z_transport_rx_reorder_t *_z_transport_rx_reorder_new(size_t capacity) {
+    _z_transport_rx_reorder_t *r = (_z_transport_rx_reorder_t *)z_malloc(sizeof(_z_transport_rx_reorder_t));
+    if (r == NULL) {
+        return NULL;
+    }
+    memset(r, 0, sizeof(_z_transport_rx_reorder_t));
+    r->_slots = (_z_transport_rx_held_t *)z_malloc(capacity * sizeof(_z_transport_rx_held_t));
+    if (r->_slots == NULL) {
+        z_free(r);
+        return NULL;
+    }
+    memset(r->_slots, 0, capacity * sizeof(_z_transport_rx_held_t));
+    r->_capacity = capacity;
+    return r;
+}
+
+void _z_transport_rx_reorder_reset(_z_transport_rx_reorder_t *r) {
+    for (size_t i = 0; (i < r->_capacity) && (r->_held > 0); i++) {
+        _z_transport_rx_held_t *slot = &r->_slots[i];
+        if (slot->_used) {
+            _z_t_msg_clear(&slot->_msg);
+            _z_zbuf_clear(&slot->_zbuf);
+            slot->_used = false;
+            r->_held--;
+        }
+    }
+}
+
+void _z_transport_rx_reorder_free(_z_transport_rx_reorder_t **r) {
+    _z_transport_rx_reorder_t *ptr = *r;
+    if (ptr != NULL) {
+        _z_transport_rx_reorder_reset(ptr);
+        z_free(ptr->_slots);
+        z_free(ptr);
+        *r = NULL;
+    }
+}
+
+static inline _z_zint_t _z_transport_rx_reorder_sn_of(const _z_transport_message_t *t_msg) {
+    return (_Z_MID(t_msg->_header) == _Z_MID_T_FRAME) ? t_msg->_body._frame._sn : t_msg->_body._fragment._sn;
+}
+
+static _z_transport_rx_held_t *_z_transport_rx_reorder_find(const _z_transport_rx_reorder_t *r, _z_zint_t sn) {
+    for (size_t i = 0; (i < r->_capacity) && (r->_held > 0); i++) {
+        _z_transport_rx_held_t *slot = &r->_slots[i];
+        if (slot->_used && (_z_transport_rx_reorder_sn_of(&slot->_msg) == sn)) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static z_result_t _z_transport_rx_reorder_hold(_z_transport_rx_reorder_t *r, const _z_transport_message_t *t_msg) {
+    _z_transport_rx_held_t *slot = NULL;
+    for (size_t i = 0; i < r->_capacity; i++) {
+        if (!r->_slots[i]._used) {
+            slot = &r->_slots[i];
+            break;
+        }
+    }
+    if (slot == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_OVERFLOW);
+    }
+    slot->_msg = *t_msg;
+    slot->_zbuf = _z_zbuf_null();
+    if (_Z_MID(t_msg->_header) == _Z_MID_T_FRAME) {
+        slot->_msg._body._frame._payload = NULL;
+        size_t len = _z_zbuf_len(t_msg->_body._frame._payload);
+        if (len > 0) {
+            slot->_zbuf = _z_zbuf_make(len);
+            if (_z_zbuf_capacity(&slot->_zbuf) != len) {
+                _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+            }
+            _z_zbuf_copy_bytes(&slot->_zbuf, t_msg->_body._frame._payload);
+        }
+    } else {
+        _Z_RETURN_IF_ERR(_z_slice_copy(&slot->_msg._body._fragment._payload, &t_msg->_body._fragment._payload));
+    }
+    slot->_used = true;
+    r->_held++;
+    return _Z_RES_OK;
+}
+
+_z_transport_rx_verdict_t _z_transport_rx_reorder_accept(_z_transport_rx_reorder_t *r, _z_zint_t sn_res,
+                                                         _z_zint_t last_sn, const _z_transport_message_t *t_msg,
+                                                         _z_transport_nack_f nack, void *arg) {
+    _z_zint_t sn = _z_transport_rx_reorder_sn_of(t_msg);
+    _z_zint_t expected = _z_sn_increment(sn_res, last_sn);
+    if ((sn == expected) || !_z_sn_precedes(sn_res, last_sn, sn)) {
+        return _Z_TRANSPORT_RX_HANDLE;
+    }
+    if (((sn - expected) & sn_res) >= r->_capacity) {
+        return _Z_TRANSPORT_RX_FLUSH;
+    }
+    if (_z_transport_rx_reorder_find(r, sn) != NULL) {
+        // Sent again while already held
+        return _Z_TRANSPORT_RX_HELD;
+    }
+    bool new_gap = (r->_held == 0);
+    if (_z_transport_rx_reorder_hold(r, t_msg) != _Z_RES_OK) {
+        return _Z_TRANSPORT_RX_FLUSH;
+    }
+    if (new_gap) {
+        r->_nack_next = expected;
+        r->_nack_rounds = 0;
+        r->_nack_time = z_clock_now();
+    }
+    if ((sn == r->_nack_next) || _z_sn_precedes(sn_res, r->_nack_next, sn)) {
+        if (sn != r->_nack_next) {
+            nack(arg, r->_nack_next, (sn - r->_nack_next) & sn_res);
+        }
+        r->_nack_next = _z_sn_increment(sn_res, sn);
+    }
+    return _Z_TRANSPORT_RX_HELD;
+}
+
+bool _z_transport_rx_reorder_take(_z_transport_rx_reorder_t *r, _z_zint_t sn, _z_transport_message_t *t_msg,
+                                  _z_zbuf_t *zbf) {
+    _z_transport_rx_held_t *slot = _z_transport_rx_reorder_find(r, sn);
+    if (slot == NULL) {
+        return false;
+    }
+    *t_msg = slot->_msg;
+    *zbf = slot->_zbuf;
+    if (_Z_MID(t_msg->_header) == _Z_MID_T_FRAME) {
+        t_msg->_body._frame._payload = zbf;
+    }
+    slot->_zbuf = _z_zbuf_null();
+    slot->_used = false;
+    r->_held--;
+    return true;
+}
+
+bool _z_transport_rx_reorder_first(const _z_transport_rx_reorder_t *r, _z_zint_t sn_res, _z_zint_t last_sn,
+                                   _z_zint_t *sn) {
+    bool found = false;
+    _z_zint_t min_distance = 0;
+    for (size_t i = 0; (i < r->_capacity) && (r->_held > 0); i++) {
+        const _z_transport_rx_held_t *slot = &r->_slots[i];
+        if (!slot->_used) {
+            continue;
+        }
+        _z_zint_t curr = _z_transport_rx_reorder_sn_of(&slot->_msg);
+        _z_zint_t distance = (curr - last_sn) & sn_res;
+        if (!found || (distance < min_distance)) {
+            found = true;
+            min_distance = distance;
+            *sn = curr;
+        }
+    }
+    return found;
+}
+
+bool _z_transport_rx_reorder_poll(_z_transport_rx_reorder_t *r, _z_zint_t sn_res, _z_zint_t last_sn,
+                                  _z_transport_nack_f nack, void *arg) {
+    if ((r->_held == 0) || (z_clock_elapsed_ms(&r->_nack_time) < Z_TRANSPORT_NACK_INTERVAL)) {
+        return false;
+    }
+    if (r->_nack_rounds >= Z_TRANSPORT_NACK_RETRIES) {
+        return true;
+    }
+    r->_nack_rounds++;
+    r->_nack_time = z_clock_now();
+    // Report the runs of SNs still missing
+    _z_zint_t sn = _z_sn_increment(sn_res, last_sn);
+    _z_zint_t run_sn = sn;
+    _z_zint_t run_len = 0;
+    for (size_t i = 0; (i < r->_capacity) && (sn != r->_nack_next); i++) {
+        if (_z_transport_rx_reorder_find(r, sn) != NULL) {
+            if (run_len > 0) {
+                nack(arg, run_sn, run_len);
+            }
+            run_len = 0;
+        } else {
+            if (run_len == 0) {
+                run_sn = sn;
+            }
+            run_len++;
+        }
+        sn = _z_sn_increment(sn_res, sn);
+    }
+    if (run_len > 0) {
+        nack(arg, run_sn, run_len);
+    }
+    return false;
+}
+
+#endif  // Z_FEATURE_SELECTIVE_REPEAT == 1
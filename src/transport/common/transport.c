@@ -17,9 +17,36 @@
 
 #include "zenoh-pico/link/link.h"
 #include "zenoh-pico/system/common/platform.h"
+#include "zenoh-pico/transport/common/selective_repeat.h"
 #include "zenoh-pico/transport/unicast/accept.h"
 #include "zenoh-pico/utils/result.h"
 
+#if Z_FEATURE_COMPRESSION == 1
+_z_transport_compression_t *_z_transport_compression_new(size_t batch_size) {
+    _z_transport_compression_t *c = (_z_transport_compression_t *)z_malloc(sizeof(_z_transport_compression_t));
+    if (c == NULL) {
+        return NULL;
+    }
+    c->_tx_buf = (uint8_t *)z_malloc(batch_size);
+    c->_tx_capacity = batch_size;
+    c->_zbuf = _z_zbuf_make(batch_size);
+    if ((c->_tx_buf == NULL) || (_z_zbuf_capacity(&c->_zbuf) != batch_size)) {
+        _z_transport_compression_free(&c);
+    }
+    return c;
+}
+
+void _z_transport_compression_free(_z_transport_compression_t **c) {
+    _z_transport_compression_t *ptr = *c;
+    if (ptr != NULL) {
+        z_free(ptr->_tx_buf);
+        _z_zbuf_clear(&ptr->_zbuf);
+        z_free(ptr);
+        *c = NULL;
+    }
+}
+#endif
+
 void _z_transport_common_clear(_z_transport_common_t *ztc) {
 #if Z_FEATURE_MULTI_THREAD == 1
     // Clean up the mutexes
@@ -29,6 +56,16 @@ void _z_transport_common_clear(_z_transport_common_t *ztc) {
     // Clean up the buffers
     _z_wbuf_clear(&ztc->_wbuf);
     _z_zbuf_clear(&ztc->_zbuf);
+#if Z_FEATURE_COMPRESSION == 1
+    _z_transport_compression_free(&ztc->_compression);
+#endif
+#if Z_FEATURE_FRAGMENTATION == 1
+    z_free(ztc->_tx_train_buf);
+    ztc->_tx_train_buf = NULL;
+#endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    _z_transport_tx_history_free(&ztc->_tx_history);
+#endif
 
     _z_link_free(&ztc->_link);
     _z_session_weak_drop(&ztc->_session);
@@ -14,15 +14,19 @@
 
 #include "zenoh-pico/transport/common/tx.h"
 
+#include <string.h>
+
 #include "zenoh-pico/api/constants.h"
 #include "zenoh-pico/protocol/codec/core.h"
 #include "zenoh-pico/protocol/codec/network.h"
 #include "zenoh-pico/protocol/codec/transport.h"
 #include "zenoh-pico/protocol/definitions/transport.h"
+#include "zenoh-pico/transport/common/selective_repeat.h"
 #include "zenoh-pico/transport/raweth/tx.h"
 #include "zenoh-pico/transport/transport.h"
 #include "zenoh-pico/transport/utils.h"
 #include "zenoh-pico/utils/endianness.h"
+#include "zenoh-pico/utils/hash.h"
 #include "zenoh-pico/utils/logging.h"
 
 #if defined(Z_TEST_HOOKS)
@@ -35,20 +39,11 @@ void _z_transport_set_send_n_msg_override(_z_session_send_override_fn fn) { _z_s
 
 /*------------------ Transmission helper ------------------*/
 
-static inline bool _z_transport_tx_get_express_status(const _z_network_message_t *msg) {
-    switch (msg->_tag) {
-        case _Z_N_DECLARE:
-            return _Z_HAS_FLAG(msg->_body._declare._ext_qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
-        case _Z_N_PUSH:
-            return _Z_HAS_FLAG(msg->_body._push._qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
-        case _Z_N_REQUEST:
-            return _Z_HAS_FLAG(msg->_body._request._ext_qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
-        case _Z_N_RESPONSE:
-            return _Z_HAS_FLAG(msg->_body._response._ext_qos._val, _Z_N_QOS_IS_EXPRESS_FLAG);
-        default:
-            return false;
-    }
-}
+#if Z_FEATURE_COMPRESSION == 1
+// Smaller batches, typically lone keep alives, are not worth compressing
+#define _Z_TRANSPORT_COMPRESSION_MIN_SIZE 32
+#endif
+
 static _z_zint_t _z_transport_tx_get_sn(_z_transport_common_t *ztc, z_reliability_t reliability) {
     _z_zint_t sn;
     if (reliability == Z_RELIABILITY_RELIABLE) {
@@ -61,10 +56,206 @@ static _z_zint_t _z_transport_tx_get_sn(_z_transport_common_t *ztc, z_reliabilit
     return sn;
 }
 
+static void _z_transport_tx_prepare_wbuf(_z_transport_common_t *ztc) {
+    __unsafe_z_prepare_wbuf(&ztc->_wbuf, ztc->_link->_cap._flow);
+#if Z_FEATURE_COMPRESSION == 1
+    if (ztc->_compression != NULL) {
+        // Batch header, set once the batch is complete
+        size_t pos = _z_wbuf_get_wpos(&ztc->_wbuf);
+        _z_wbuf_put(&ztc->_wbuf, 0, pos);
+        _z_wbuf_set_wpos(&ztc->_wbuf, pos + _Z_BATCH_HEADER_SIZE);
+    }
+#endif
+}
+
+#if Z_FEATURE_COMPRESSION == 1
+// Compresses the batch in place if it gets smaller, the batch header tells the receiver which is the case
+static void _z_transport_tx_compress_wbuf(_z_transport_common_t *ztc) {
+    _z_transport_compression_t *c = ztc->_compression;
+    if (c == NULL) {
+        return;
+    }
+    size_t header_pos = (ztc->_link->_cap._flow == Z_LINK_CAP_FLOW_STREAM) ? _Z_MSG_LEN_ENC_SIZE : 0;
+    size_t start = header_pos + _Z_BATCH_HEADER_SIZE;
+    _z_iosli_t *ios = _z_wbuf_get_iosli(&ztc->_wbuf, 0);
+    size_t len = ios->_w_pos - start;
+    if (len < _Z_TRANSPORT_COMPRESSION_MIN_SIZE) {
+        return;
+    }
+    size_t cap = (len - 1 < c->_tx_capacity) ? len - 1 : c->_tx_capacity;
+    size_t compressed = _z_lz4_compress(c->_tx_buf, cap, ios->_buf + start, len, c->_table);
+    if (compressed == 0) {
+        return;
+    }
+    memcpy(ios->_buf + start, c->_tx_buf, compressed);
+    _z_wbuf_put(&ztc->_wbuf, _Z_BATCH_HEADER_C, header_pos);
+    _z_wbuf_set_wpos(&ztc->_wbuf, start + compressed);
+}
+#else
+static inline void _z_transport_tx_compress_wbuf(_z_transport_common_t *ztc) { _ZP_UNUSED(ztc); }
+#endif
+
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+static inline void _z_transport_tx_set_batch_sn(_z_transport_common_t *ztc, _z_zint_t sn, z_reliability_t reliability) {
+    ztc->_tx_batch_sn = sn;
+    ztc->_tx_batch_reliable = (reliability == Z_RELIABILITY_RELIABLE);
+}
+
+// Keeps the finalized reliable batches sent on the link, in case a peer reports them missing
+static void _z_transport_tx_record_wbuf(_z_transport_common_t *ztc, const _z_transport_peer_unicast_slist_t *peers) {
+    if ((ztc->_tx_history != NULL) && ztc->_tx_batch_reliable && (peers == NULL)) {
+        _z_iosli_t *ios = _z_wbuf_get_iosli(&ztc->_wbuf, 0);
+        _z_transport_tx_history_push(ztc->_tx_history, ztc->_tx_batch_sn, ios->_buf, ios->_w_pos);
+    }
+    ztc->_tx_batch_reliable = false;
+}
+#else
+static inline void _z_transport_tx_set_batch_sn(_z_transport_common_t *ztc, _z_zint_t sn, z_reliability_t reliability) {
+    _ZP_UNUSED(ztc);
+    _ZP_UNUSED(sn);
+    _ZP_UNUSED(reliability);
+}
+
+static inline void _z_transport_tx_record_wbuf(_z_transport_common_t *ztc,
+                                               const _z_transport_peer_unicast_slist_t *peers) {
+    _ZP_UNUSED(ztc);
+    _ZP_UNUSED(peers);
+}
+#endif
+
+#if Z_FEATURE_UNICAST_PEER == 1
+// Lane of a network message on a striped transport, the messages of a lane always take the same link to a peer
+static size_t _z_transport_tx_get_lane(const _z_transport_common_t *ztc, const _z_network_message_t *n_msg) {
+    const _z_wireexpr_t *key;
+    _z_n_qos_t qos;
+    switch (n_msg->_tag) {
+        case _Z_N_PUSH:
+            key = &n_msg->_body._push._key;
+            qos = n_msg->_body._push._qos;
+            break;
+        case _Z_N_REQUEST:
+            key = &n_msg->_body._request._key;
+            qos = n_msg->_body._request._ext_qos;
+            break;
+        default:
+            // Declarations and interests keep the state of every link up to date
+            return _Z_STRIPING_LANE_ALL;
+    }
+    if (ztc->_striping == _Z_STRIPING_PRIORITY) {
+        return (size_t)_z_n_qos_get_priority(qos);
+    }
+    size_t hash = _z_hash_combine(_z_string_hash(&key->_suffix), (size_t)key->_id);
+    hash = _z_hash_combine(hash, (size_t)key->_mapping);
+    return hash & (_Z_STRIPING_LANE_ALL >> 1);
+}
+
+static bool _z_transport_tx_peer_on_lane(const _z_transport_common_t *ztc, const _z_transport_peer_unicast_t *peer,
+                                         size_t lane) {
+    if ((lane == _Z_STRIPING_LANE_ALL) || (peer->_link_nb <= 1)) {
+        return true;
+    }
+    size_t link;
+    if (ztc->_striping == _Z_STRIPING_PRIORITY) {
+        // Contiguous ranges of priorities share a link
+        link = (lane * peer->_link_nb) / ((size_t)Z_PRIORITY_BACKGROUND + 1);
+    } else {
+        link = lane % peer->_link_nb;
+    }
+    return link == peer->_link_idx;
+}
+#endif
+
+// Peer sockets handed over to the link at once
+#define _Z_TX_PEER_SOCKET_NB 16
+
+// Sends the transport wbuf on the peer sockets of its lane
+static void _z_transport_tx_send_to_peers(_z_transport_common_t *ztc, _z_transport_peer_unicast_slist_t *peers) {
+    bool all = true;
+    _z_sys_net_socket_t *sockets[_Z_TX_PEER_SOCKET_NB];
+    size_t socket_nb = 0;
+    _z_transport_peer_unicast_slist_t *curr_list = peers;
+    while (curr_list != NULL) {
+        _z_transport_peer_unicast_t *curr_peer = _z_transport_peer_unicast_slist_value(curr_list);
+        curr_list = _z_transport_peer_unicast_slist_next(curr_list);
+#if Z_FEATURE_UNICAST_PEER == 1
+        if (!_z_transport_tx_peer_on_lane(ztc, curr_peer, ztc->_tx_lane)) {
+            all = false;
+            continue;
+        }
+#endif
+        sockets[socket_nb++] = &curr_peer->_socket;
+        if (socket_nb == _Z_TX_PEER_SOCKET_NB) {
+            _z_link_send_wbuf_sockets(ztc->_link, &ztc->_wbuf, sockets, socket_nb);
+            socket_nb = 0;
+        }
+    }
+    // Send on the remaining peer sockets
+    if (socket_nb > 0) {
+        _z_link_send_wbuf_sockets(ztc->_link, &ztc->_wbuf, sockets, socket_nb);
+    }
+    // Links that were skipped still need their keep alives
+    if (all) {
+        ztc->_transmitted = true;  // Tell session we transmitted data
+    }
+}
+
 #if Z_FEATURE_FRAGMENTATION == 1
+// Size of the buffer gathering the fragments of a message for links with segmentation offload
+#define _Z_TX_FRAG_TRAIN_SIZE 65535
+
+// Consecutive fragments sent to the link in a single call, all but the last one being _segment bytes long
+typedef struct {
+    uint8_t *_buf;
+    size_t _len;
+    size_t _segment;
+} _z_transport_tx_train_t;
+
+static z_result_t _z_transport_tx_train_flush(_z_transport_common_t *ztc, _z_transport_tx_train_t *train) {
+    if (train->_len == 0) {
+        return _Z_RES_OK;
+    }
+    size_t wb = 0;
+    if (ztc->_link->_write_segments_f != NULL) {
+        wb = ztc->_link->_write_segments_f(ztc->_link, train->_buf, train->_len, train->_segment);
+    } else {
+        // The link gave up on segmentation offload while the train was being built
+        for (size_t n = 0; (n < train->_len) && (wb != SIZE_MAX); n += train->_segment) {
+            size_t len = ((train->_len - n) < train->_segment) ? (train->_len - n) : train->_segment;
+            wb = ztc->_link->_write_f(ztc->_link, &train->_buf[n], len, NULL);
+        }
+    }
+    train->_len = 0;
+    if (wb == SIZE_MAX) {
+        _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_TX_FAILED);
+    }
+    return _Z_RES_OK;
+}
+
+static z_result_t _z_transport_tx_train_push(_z_transport_common_t *ztc, _z_transport_tx_train_t *train) {
+    size_t len = _z_wbuf_len(&ztc->_wbuf);
+    if ((train->_len > 0) && ((len > train->_segment) || (train->_len + len > _Z_TX_FRAG_TRAIN_SIZE))) {
+        _Z_RETURN_IF_ERR(_z_transport_tx_train_flush(ztc, train));
+    }
+    if (train->_len == 0) {
+        train->_segment = len;
+    }
+    for (size_t i = 0; i < _z_wbuf_len_iosli(&ztc->_wbuf); i++) {
+        _z_slice_t bs = _z_iosli_to_bytes(_z_wbuf_get_iosli(&ztc->_wbuf, i));
+        // flawfinder: ignore
+        memcpy(&train->_buf[train->_len], bs.start, bs.len);
+        train->_len += bs.len;
+    }
+    // A shorter fragment can only end a train
+    if (len < train->_segment) {
+        return _z_transport_tx_train_flush(ztc, train);
+    }
+    return _Z_RES_OK;
+}
+
 static z_result_t _z_transport_tx_send_fragment_inner(_z_transport_common_t *ztc, _z_wbuf_t *frag_buff,
                                                       const _z_network_message_t *n_msg, z_reliability_t reliability,
-                                                      _z_zint_t first_sn, _z_transport_peer_unicast_slist_t *peers) {
+                                                      _z_zint_t first_sn, _z_transport_peer_unicast_slist_t *peers,
+                                                      _z_transport_tx_train_t *train) {
     bool is_first = true;
     _z_zint_t sn = first_sn;
     // Encode message on temp buffer
@@ -76,28 +267,31 @@ static z_result_t _z_transport_tx_send_fragment_inner(_z_transport_common_t *ztc
             sn = _z_transport_tx_get_sn(ztc, reliability);
         }
         // Serialize fragment
-        __unsafe_z_prepare_wbuf(&ztc->_wbuf, ztc->_link->_cap._flow);
+        _z_transport_tx_prepare_wbuf(ztc);
         z_result_t ret = __unsafe_z_serialize_zenoh_fragment(&ztc->_wbuf, frag_buff, reliability, sn, is_first);
         if (ret != _Z_RES_OK) {
             _Z_ERROR("Fragment serialization failed with err %d", ret);
             return ret;
         }
+        _z_transport_tx_set_batch_sn(ztc, sn, reliability);
         // Send fragment
+        _z_transport_tx_compress_wbuf(ztc);
         __unsafe_z_finalize_wbuf(&ztc->_wbuf, ztc->_link->_cap._flow);
-        if (peers == NULL) {
+        _z_transport_tx_record_wbuf(ztc, peers);
+        if (train != NULL) {
+            _Z_RETURN_IF_ERR(_z_transport_tx_train_push(ztc, train));
+            ztc->_transmitted = true;  // Tell session we transmitted data
+        } else if (peers == NULL) {
             _Z_RETURN_IF_ERR(_z_link_send_wbuf(ztc->_link, &ztc->_wbuf, NULL));
+            ztc->_transmitted = true;
         } else {
-            _z_transport_peer_unicast_slist_t *curr_list = peers;
-            while (curr_list != NULL) {
-                _z_transport_peer_unicast_t *curr_peer = _z_transport_peer_unicast_slist_value(curr_list);
-                // Send on peer socket
-                _z_link_send_wbuf(ztc->_link, &ztc->_wbuf, &curr_peer->_socket);
-                curr_list = _z_transport_peer_unicast_slist_next(curr_list);
-            }
+            _z_transport_tx_send_to_peers(ztc, peers);
         }
-        ztc->_transmitted = true;  // Tell session we transmitted data
         is_first = false;
     }
+    if (train != NULL) {
+        return _z_transport_tx_train_flush(ztc, train);
+    }
     return _Z_RES_OK;
 }
 
@@ -106,9 +300,18 @@ static z_result_t _z_transport_tx_send_fragment(_z_transport_common_t *ztc, cons
                                                 _z_transport_peer_unicast_slist_t *peers) {
     // Create an expandable wbuf for fragmentation
     _z_wbuf_t frag_buff = _z_wbuf_make(_Z_FRAG_BUFF_BASE_SIZE, true);
+    // Hand the fragments over to the link at once if it can segment them, else send them one by one
+    _z_transport_tx_train_t train = {._buf = NULL, ._len = 0, ._segment = 0};
+    if ((peers == NULL) && (ztc->_link->_write_segments_f != NULL)) {
+        if (ztc->_tx_train_buf == NULL) {
+            ztc->_tx_train_buf = (uint8_t *)z_malloc(_Z_TX_FRAG_TRAIN_SIZE);
+        }
+        train._buf = ztc->_tx_train_buf;
+    }
     // Send message as fragments
-    z_result_t ret = _z_transport_tx_send_fragment_inner(ztc, &frag_buff, n_msg, reliability, first_sn, peers);
-    // Clear the buffer as it's no longer required
+    z_result_t ret = _z_transport_tx_send_fragment_inner(ztc, &frag_buff, n_msg, reliability, first_sn, peers,
+                                                         (train._buf != NULL) ? &train : NULL);
+    // Clear the buffer as it is no longer required
     _z_wbuf_clear(&frag_buff);
     return ret;
 }
@@ -127,9 +330,19 @@ static z_result_t _z_transport_tx_send_fragment(_z_transport_common_t *ztc, cons
 }
 #endif
 
+static inline bool _z_transport_tx_batch_active(const _z_transport_common_t *ztc) {
+#if Z_FEATURE_BATCHING == 1
+    return ztc->_batch_state == _Z_BATCHING_ACTIVE;
+#else
+    _ZP_UNUSED(ztc);
+    return false;
+#endif
+}
+
 static inline bool _z_transport_tx_batch_has_data(_z_transport_common_t *ztc) {
 #if Z_FEATURE_BATCHING == 1
-    return (ztc->_batch_state == _Z_BATCHING_ACTIVE) && (ztc->_batch_count > 0);
+    // Only a flush resets the count, so messages batched by another sender are never discarded
+    return ztc->_batch_count > 0;
 #else
     _ZP_UNUSED(ztc);
     return false;
@@ -137,30 +350,27 @@ static inline bool _z_transport_tx_batch_has_data(_z_transport_common_t *ztc) {
 }
 
 static z_result_t _z_transport_tx_flush_buffer(_z_transport_common_t *ztc, _z_transport_peer_unicast_slist_t *peers) {
+    _z_transport_tx_compress_wbuf(ztc);
     __unsafe_z_finalize_wbuf(&ztc->_wbuf, ztc->_link->_cap._flow);
+    _z_transport_tx_record_wbuf(ztc, peers);
+#if Z_FEATURE_BATCHING == 1
+    // A batch that fails to send is dropped rather than resent with the next message
+    ztc->_batch_count = 0;
+#endif
     // Send network message
     if (peers == NULL) {
         _Z_RETURN_IF_ERR(_z_link_send_wbuf(ztc->_link, &ztc->_wbuf, NULL));
+        ztc->_transmitted = true;  // Tell session we transmitted data
     } else {
-        _z_transport_peer_unicast_slist_t *curr_list = peers;
-        while (curr_list != NULL) {
-            _z_transport_peer_unicast_t *curr_peer = _z_transport_peer_unicast_slist_value(curr_list);
-            // Send on peer socket
-            _z_link_send_wbuf(ztc->_link, &ztc->_wbuf, &curr_peer->_socket);
-            curr_list = _z_transport_peer_unicast_slist_next(curr_list);
-        }
+        _z_transport_tx_send_to_peers(ztc, peers);
     }
-    ztc->_transmitted = true;  // Tell session we transmitted data
-#if Z_FEATURE_BATCHING == 1
-    ztc->_batch_count = 0;
-#endif
     return _Z_RES_OK;
 }
 
 static z_result_t _z_transport_tx_flush_or_incr_batch(_z_transport_common_t *ztc,
-                                                      _z_transport_peer_unicast_slist_t *peers) {
+                                                      _z_transport_peer_unicast_slist_t *peers, bool batching) {
 #if Z_FEATURE_BATCHING == 1
-    if (ztc->_batch_state == _Z_BATCHING_ACTIVE) {
+    if (batching) {
         // Increment batch count
         ztc->_batch_count++;
         return _Z_RES_OK;
@@ -168,6 +378,7 @@ static z_result_t _z_transport_tx_flush_or_incr_batch(_z_transport_common_t *ztc
         return _z_transport_tx_flush_buffer(ztc, peers);
     }
 #else
+    _ZP_UNUSED(batching);
     return _z_transport_tx_flush_buffer(ztc, peers);
 #endif
 }
@@ -181,10 +392,11 @@ static z_result_t _z_transport_tx_batch_overflow(_z_transport_common_t *ztc, con
     // Send batch
     _Z_RETURN_IF_ERR(_z_transport_tx_flush_buffer(ztc, peers));
     // Init buffer
-    __unsafe_z_prepare_wbuf(&ztc->_wbuf, ztc->_link->_cap._flow);
+    _z_transport_tx_prepare_wbuf(ztc);
     sn = _z_transport_tx_get_sn(ztc, reliability);
     _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
     _Z_RETURN_IF_ERR(_z_transport_message_encode(&ztc->_wbuf, &t_msg));
+    _z_transport_tx_set_batch_sn(ztc, sn, reliability);
     // Retry encode
     z_result_t ret = _z_network_message_encode(&ztc->_wbuf, n_msg);
     if (ret != _Z_RES_OK) {
@@ -220,17 +432,51 @@ static inline size_t _z_transport_tx_save_wpos(_z_wbuf_t *wbuf) {
 #endif
 }
 
+#if Z_FEATURE_UNICAST_PEER == 1
+// Messages of another lane are added to the batch only if it would go to the same links
+static z_result_t _z_transport_tx_set_lane(_z_transport_common_t *ztc, const _z_network_message_t *n_msg,
+                                           _z_transport_peer_unicast_slist_t *peers) {
+    if ((peers == NULL) || (ztc->_striping == _Z_STRIPING_NONE)) {
+        return _Z_RES_OK;
+    }
+    size_t lane = _z_transport_tx_get_lane(ztc, n_msg);
+    if (lane == ztc->_tx_lane) {
+        return _Z_RES_OK;
+    }
+    if (_z_transport_tx_batch_has_data(ztc)) {
+        _z_transport_peer_unicast_slist_t *it = peers;
+        for (; it != NULL; it = _z_transport_peer_unicast_slist_next(it)) {
+            _z_transport_peer_unicast_t *peer = _z_transport_peer_unicast_slist_value(it);
+            bool on_lane = _z_transport_tx_peer_on_lane(ztc, peer, lane);
+            if (on_lane != _z_transport_tx_peer_on_lane(ztc, peer, ztc->_tx_lane)) {
+                break;
+            }
+        }
+        if (it == NULL) {
+            return _Z_RES_OK;
+        }
+        _Z_RETURN_IF_ERR(_z_transport_tx_flush_buffer(ztc, peers));
+    }
+    ztc->_tx_lane = lane;
+    return _Z_RES_OK;
+}
+#endif
+
 static z_result_t _z_transport_tx_send_n_msg_inner(_z_transport_common_t *ztc, const _z_network_message_t *n_msg,
                                                    z_reliability_t reliability,
-                                                   _z_transport_peer_unicast_slist_t *peers) {
+                                                   _z_transport_peer_unicast_slist_t *peers, bool batching) {
+#if Z_FEATURE_UNICAST_PEER == 1
+    _Z_RETURN_IF_ERR(_z_transport_tx_set_lane(ztc, n_msg, peers));
+#endif
     // Init buffer
     _z_zint_t sn = 0;
     bool batch_has_data = _z_transport_tx_batch_has_data(ztc);
     if (!batch_has_data) {
-        __unsafe_z_prepare_wbuf(&ztc->_wbuf, ztc->_link->_cap._flow);
+        _z_transport_tx_prepare_wbuf(ztc);
         sn = _z_transport_tx_get_sn(ztc, reliability);
         _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
         _Z_RETURN_IF_ERR(_z_transport_message_encode(&ztc->_wbuf, &t_msg));
+        _z_transport_tx_set_batch_sn(ztc, sn, reliability);
     }
     // Try encoding the network message
     size_t prev_wpos = _z_transport_tx_save_wpos(&ztc->_wbuf);
@@ -241,7 +487,7 @@ static z_result_t _z_transport_tx_send_n_msg_inner(_z_transport_common_t *ztc, c
             return _z_transport_tx_flush_buffer(ztc, peers);
         } else {
             // Flush buffer or increase batch
-            return _z_transport_tx_flush_or_incr_batch(ztc, peers);
+            return _z_transport_tx_flush_or_incr_batch(ztc, peers, batching);
         }
     } else if (!batch_has_data) {
         // Message doesn't fit in buffer, send as fragments
@@ -259,8 +505,13 @@ static z_result_t _z_transport_tx_send_t_msg_inner(_z_transport_common_t *ztc, c
     if (batch_has_data) {
         _Z_RETURN_IF_ERR(_z_transport_tx_flush_buffer(ztc, peers));
     }
+#if Z_FEATURE_UNICAST_PEER == 1
+    // Transport messages are for every link
+    ztc->_tx_lane = _Z_STRIPING_LANE_ALL;
+#endif
     // Encode transport message
-    __unsafe_z_prepare_wbuf(&ztc->_wbuf, ztc->_link->_cap._flow);
+    _z_transport_tx_prepare_wbuf(ztc);
+    _z_transport_tx_set_batch_sn(ztc, 0, Z_RELIABILITY_BEST_EFFORT);
     _Z_RETURN_IF_ERR(_z_transport_message_encode(&ztc->_wbuf, t_msg));
     // Send message
     return _z_transport_tx_flush_buffer(ztc, peers);
@@ -298,7 +549,35 @@ static z_result_t _z_transport_tx_send_n_msg(_z_transport_common_t *ztc, const _
         return ret;
     }
     // Process message
-    ret = _z_transport_tx_send_n_msg_inner(ztc, n_msg, reliability, peers);
+    ret = _z_transport_tx_send_n_msg_inner(ztc, n_msg, reliability, peers, _z_transport_tx_batch_active(ztc));
+    if (!_z_transport_batch_hold_tx_mutex()) {
+        _z_transport_tx_mutex_unlock(ztc);
+    }
+    return ret;
+}
+
+static z_result_t _z_transport_tx_send_n_msgs(_z_transport_common_t *ztc, const _z_network_message_t *n_msgs,
+                                              size_t count, z_reliability_t reliability, z_congestion_control_t cong_ctrl,
+                                              _z_transport_peer_unicast_slist_t *peers) {
+    z_result_t ret = _Z_RES_OK;
+    _Z_DEBUG("Send %zu network messages", count);
+
+    // Acquire the lock once for all messages and drop them if needed
+    if (!_z_transport_batch_hold_tx_mutex()) {
+        ret = _z_transport_tx_mutex_lock(ztc, cong_ctrl == Z_CONGESTION_CONTROL_BLOCK);
+    }
+    if (ret != _Z_RES_OK) {
+        _Z_INFO("Dropping zenoh messages because of congestion control");
+        return ret;
+    }
+    // Messages are batched together whatever the session batching state, a full batch is sent on overflow
+    for (size_t i = 0; (i < count) && (ret == _Z_RES_OK); i++) {
+        ret = _z_transport_tx_send_n_msg_inner(ztc, &n_msgs[i], reliability, peers, true);
+    }
+    // Send the remaining messages at once
+    if ((ret == _Z_RES_OK) && _z_transport_tx_batch_has_data(ztc)) {
+        ret = _z_transport_tx_flush_buffer(ztc, peers);
+    }
     if (!_z_transport_batch_hold_tx_mutex()) {
         _z_transport_tx_mutex_unlock(ztc);
     }
@@ -336,6 +615,36 @@ static z_result_t _z_transport_tx_send_n_batch(_z_transport_common_t *ztc, z_con
 #endif
 }
 
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+z_result_t _z_transport_tx_retransmit(_z_transport_common_t *ztc, _z_zint_t sn, _z_zint_t count) {
+    if (ztc->_tx_history == NULL) {
+        return _Z_RES_OK;
+    }
+    if (count > _Z_TRANSPORT_TX_HISTORY_RECORDS) {
+        count = _Z_TRANSPORT_TX_HISTORY_RECORDS;
+    }
+    z_result_t ret = _Z_RES_OK;
+    _z_transport_tx_mutex_lock(ztc, true);
+    for (_z_zint_t i = 0; (i < count) && (ret == _Z_RES_OK); i++) {
+        _z_slice_t batch;
+        if (_z_transport_tx_history_get(ztc->_tx_history, sn, &batch)) {
+            if ((batch.len > 0) && (ztc->_link->_write_f(ztc->_link, batch.start, batch.len, NULL) == SIZE_MAX)) {
+                _Z_ERROR_LOG(_Z_ERR_TRANSPORT_TX_FAILED);
+                ret = _Z_ERR_TRANSPORT_TX_FAILED;
+            }
+        } else {
+            // The batch is no longer kept, an empty frame lets the peer go past it
+            _Z_INFO("Reliable message %u lost, it is no longer kept", (unsigned int)sn);
+            _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, Z_RELIABILITY_RELIABLE);
+            ret = _z_link_send_t_msg(ztc->_link, &t_msg, NULL);
+        }
+        sn = _z_sn_increment(ztc->_sn_res, sn);
+    }
+    _z_transport_tx_mutex_unlock(ztc);
+    return ret;
+}
+#endif
+
 /**
  * This function is unsafe because it operates in potentially concurrent data.
  * Make sure that the following mutexes are locked before calling this function:
@@ -513,8 +822,10 @@ z_result_t _z_send_n_msg(_z_session_t *zn, const _z_network_message_t *z_msg, z_
                     // Send to a single peer, convert to peer list
                     _z_transport_peer_unicast_slist_t *dst_list = _z_transport_peer_unicast_slist_push_empty(NULL);
                     if (dst_list != NULL) {
-                        memcpy(_z_transport_peer_unicast_slist_value(dst_list), (_z_transport_peer_unicast_t *)peer,
-                               sizeof(_z_transport_peer_unicast_t));
+                        _z_transport_peer_unicast_t *dst = _z_transport_peer_unicast_slist_value(dst_list);
+                        memcpy(dst, (_z_transport_peer_unicast_t *)peer, sizeof(_z_transport_peer_unicast_t));
+                        // The message is for this link whatever its lane
+                        dst->_link_nb = 1;
                         // Send message
                         ret = _z_transport_tx_send_n_msg(ztc, z_msg, reliability, cong_ctrl, dst_list);
                         z_free(dst_list);
@@ -540,6 +851,52 @@ z_result_t _z_send_n_msg(_z_session_t *zn, const _z_network_message_t *z_msg, z_
     return ret;
 }
 
+z_result_t _z_send_n_msgs(_z_session_t *zn, const _z_network_message_t *n_msgs, size_t count,
+                          z_reliability_t reliability, z_congestion_control_t cong_ctrl) {
+#if defined(Z_TEST_HOOKS)
+    if (_z_send_n_msg_override != NULL) {
+        for (size_t i = 0; i < count; i++) {
+            _Z_RETURN_IF_ERR(_z_send_n_msg(zn, &n_msgs[i], reliability, cong_ctrl, NULL));
+        }
+        return _Z_RES_OK;
+    }
+#endif
+    z_result_t ret = _Z_RES_OK;
+    // Call transport function
+    switch (zn->_tp._type) {
+        case _Z_TRANSPORT_UNICAST_TYPE: {
+            _z_transport_common_t *ztc = &zn->_tp._transport._unicast._common;
+            if (zn->_mode == Z_WHATAMI_CLIENT) {
+                ret = _z_transport_tx_send_n_msgs(ztc, n_msgs, count, reliability, cong_ctrl, NULL);
+            } else if (!_z_transport_peer_unicast_slist_is_empty(zn->_tp._transport._unicast._peers)) {
+                if (!_z_transport_batch_hold_peer_mutex()) {
+                    _z_transport_peer_mutex_lock(ztc);
+                }
+                ret = _z_transport_tx_send_n_msgs(ztc, n_msgs, count, reliability, cong_ctrl,
+                                                  zn->_tp._transport._unicast._peers);
+                if (!_z_transport_batch_hold_peer_mutex()) {
+                    _z_transport_peer_mutex_unlock(ztc);
+                }
+            }
+        } break;
+        case _Z_TRANSPORT_MULTICAST_TYPE:
+            ret = _z_transport_tx_send_n_msgs(&zn->_tp._transport._multicast._common, n_msgs, count, reliability,
+                                              cong_ctrl, NULL);
+            break;
+        case _Z_TRANSPORT_RAWETH_TYPE:
+            // The raweth transport has its own tx path, messages go one by one
+            for (size_t i = 0; (i < count) && (ret == _Z_RES_OK); i++) {
+                ret = _z_raweth_send_n_msg(zn, &n_msgs[i], reliability, cong_ctrl);
+            }
+            break;
+        default:
+            _Z_ERROR_LOG(_Z_ERR_TRANSPORT_NOT_AVAILABLE);
+            ret = _Z_ERR_TRANSPORT_NOT_AVAILABLE;
+            break;
+    }
+    return ret;
+}
+
 z_result_t _z_send_n_batch(_z_session_t *zn, z_congestion_control_t cong_ctrl) {
     z_result_t ret = _Z_RES_OK;
     // Call transport function
@@ -559,9 +916,7 @@ z_result_t _z_send_n_batch(_z_session_t *zn, z_congestion_control_t cong_ctrl) {
             ret = _z_transport_tx_send_n_batch(&zn->_tp._transport._multicast._common, cong_ctrl, NULL);
             break;
         case _Z_TRANSPORT_RAWETH_TYPE:
-            _Z_INFO("Batching not yet supported on raweth transport");
-            _Z_ERROR_LOG(_Z_ERR_TRANSPORT_TX_FAILED);
-            ret = _Z_ERR_TRANSPORT_TX_FAILED;
+            ret = _z_raweth_send_n_batch(zn, cong_ctrl);
             break;
         default:
             _Z_ERROR_LOG(_Z_ERR_TRANSPORT_NOT_AVAILABLE);
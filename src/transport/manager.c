@@ -21,13 +21,18 @@
 #if Z_FEATURE_LINK_TLS == 1
 #include "zenoh-pico/link/transport/tls_stream.h"
 #endif
+#if Z_FEATURE_LINK_SHM == 1
+#include "zenoh-pico/link/transport/shm.h"
+#endif
 #include "zenoh-pico/link/link.h"
 #include "zenoh-pico/runtime/runtime.h"
 #include "zenoh-pico/session/interest.h"
 #include "zenoh-pico/system/common/platform.h"
+#include "zenoh-pico/transport/common/selective_repeat.h"
 #include "zenoh-pico/transport/multicast/transport.h"
 #include "zenoh-pico/transport/unicast/accept.h"
 #include "zenoh-pico/transport/unicast/transport.h"
+#include "zenoh-pico/utils/config.h"
 #include "zenoh-pico/utils/sleep.h"
 
 #if Z_FEATURE_CONNECTIVITY == 1
@@ -64,6 +69,34 @@ static void _z_new_peer_dispatch_connected_event(_z_transport_unicast_t *ztu, co
 }
 #endif
 
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+// Only datagram links lose messages. Selective repeat is used by multicast transports only: NACKs are transport OAM
+// messages that routers do not answer, so unicast transports, whose remote end is usually a router, never enable it.
+static z_result_t _z_transport_set_selective_repeat(_z_transport_common_t *ztc, const _z_config_t *session_cfg) {
+    bool enabled = false;
+    if (session_cfg != NULL) {
+        _Z_RETURN_IF_ERR(_z_config_get_bool_default(session_cfg, Z_CONFIG_TRANSPORT_SELECTIVE_REPEAT_KEY,
+                                                    Z_CONFIG_TRANSPORT_SELECTIVE_REPEAT_DEFAULT, &enabled));
+    }
+    if (!enabled || (ztc->_link->_cap._flow != Z_LINK_CAP_FLOW_DATAGRAM)) {
+        return _Z_RES_OK;
+    }
+#if Z_FEATURE_COMPRESSION == 1
+    // NACKs and empty frames are sent without a batch header
+    if (ztc->_compression != NULL) {
+        _Z_INFO("Selective repeat is not used on compressed transports");
+        return _Z_RES_OK;
+    }
+#endif
+    ztc->_tx_history = _z_transport_tx_history_new(Z_TRANSPORT_TX_HISTORY_SIZE);
+    if (ztc->_tx_history == NULL) {
+        _Z_ERROR("Not enough memory to allocate transport TX history!");
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    return _Z_RES_OK;
+}
+#endif
+
 static z_result_t _z_new_transport_client(_z_transport_t *zt, const _z_string_t *locator, const _z_id_t *local_zid,
                                           const _z_config_t *session_cfg) {
     z_result_t ret = _Z_RES_OK;
@@ -83,7 +116,17 @@ static z_result_t _z_new_transport_client(_z_transport_t *zt, const _z_string_t
     switch (zl->_cap._transport) {
         // Unicast transport
         case Z_LINK_CAP_TRANSPORT_UNICAST: {
-            _z_transport_unicast_establish_param_t tp_param;
+            _z_transport_unicast_establish_param_t tp_param = {0};
+#if Z_FEATURE_COMPRESSION == 1
+            if (session_cfg != NULL) {
+                ret = _z_config_get_bool_default(session_cfg, Z_CONFIG_TRANSPORT_COMPRESSION_KEY,
+                                                 Z_CONFIG_TRANSPORT_COMPRESSION_DEFAULT, &tp_param._compression);
+                if (ret != _Z_RES_OK) {
+                    _z_link_free(&zl);
+                    return ret;
+                }
+            }
+#endif
             ret = _z_unicast_open_client(&tp_param, zl, local_zid);
             if (ret != _Z_RES_OK) {
                 _z_link_free(&zl);
@@ -107,6 +150,11 @@ static z_result_t _z_new_transport_client(_z_transport_t *zt, const _z_string_t
                 return ret;
             }
             ret = _z_multicast_transport_create(zt, zl, &tp_param);
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+            if (zl->_cap._transport == Z_LINK_CAP_TRANSPORT_MULTICAST) {
+                _Z_SET_IF_OK(ret, _z_transport_set_selective_repeat(&zt->_transport._multicast._common, session_cfg));
+            }
+#endif
             break;
         }
         default:
@@ -118,6 +166,26 @@ static z_result_t _z_new_transport_client(_z_transport_t *zt, const _z_string_t
     return ret;
 }
 
+#if Z_FEATURE_UNICAST_PEER == 1
+static z_result_t _z_transport_get_striping(const _z_config_t *session_cfg, uint8_t *striping) {
+    const char *mode = (session_cfg != NULL) ? _z_config_get(session_cfg, Z_CONFIG_TRANSPORT_STRIPING_KEY) : NULL;
+    if (mode == NULL) {
+        mode = Z_CONFIG_TRANSPORT_STRIPING_DEFAULT;
+    }
+    if (_z_str_eq(mode, Z_CONFIG_TRANSPORT_STRIPING_NONE)) {
+        *striping = _Z_STRIPING_NONE;
+    } else if (_z_str_eq(mode, Z_CONFIG_TRANSPORT_STRIPING_PRIORITY)) {
+        *striping = _Z_STRIPING_PRIORITY;
+    } else if (_z_str_eq(mode, Z_CONFIG_TRANSPORT_STRIPING_KEYEXPR)) {
+        *striping = _Z_STRIPING_KEYEXPR;
+    } else {
+        _Z_ERROR("Invalid transport striping mode: %s", mode);
+        return _Z_ERR_CONFIG_INVALID_VALUE;
+    }
+    return _Z_RES_OK;
+}
+#endif
+
 static z_result_t _z_new_transport_peer(_z_transport_t *zt, const _z_string_t *locator, const _z_id_t *local_zid,
                                         int peer_op, const _z_config_t *session_cfg, _z_runtime_t *runtime) {
     z_result_t ret = _Z_RES_OK;
@@ -143,6 +211,12 @@ static z_result_t _z_new_transport_peer(_z_transport_t *zt, const _z_string_t *l
     switch (zl->_cap._transport) {
         case Z_LINK_CAP_TRANSPORT_UNICAST: {
 #if Z_FEATURE_UNICAST_PEER == 1
+            uint8_t striping = _Z_STRIPING_NONE;
+            ret = _z_transport_get_striping(session_cfg, &striping);
+            if (ret != _Z_RES_OK) {
+                _z_link_free(&zl);
+                return ret;
+            }
             _z_transport_unicast_establish_param_t tp_param = {0};
             ret = _z_unicast_open_peer(&tp_param, zl, local_zid, peer_op, NULL);
             if (ret != _Z_RES_OK) {
@@ -150,13 +224,16 @@ static z_result_t _z_new_transport_peer(_z_transport_t *zt, const _z_string_t *l
                 return ret;
             }
             ret = _z_unicast_transport_create(zt, zl, &tp_param);
+            if (ret == _Z_RES_OK) {
+                zt->_transport._unicast._common._striping = striping;
+            }
             _Z_SET_IF_OK(ret, _z_socket_set_blocking(_z_link_get_socket(zl), false));
             if (ret == _Z_RES_OK) {
                 if (peer_op == _Z_PEER_OP_OPEN) {
                     ret = _z_transport_peer_unicast_add(&zt->_transport._unicast, &tp_param, *_z_link_get_socket(zl),
                                                         false, NULL);
                 } else {
-#if Z_FEATURE_LINK_TCP == 1 || Z_FEATURE_LINK_TLS == 1
+#if Z_FEATURE_LINK_TCP == 1 || Z_FEATURE_LINK_TLS == 1 || Z_FEATURE_LINK_UNIXSOCK == 1
                     _z_fut_t f = _z_fut_null();
                     f._fut_arg = &zt->_transport._unicast;
                     f._fut_fn = _zp_unicast_accept_task_fn;
@@ -186,6 +263,11 @@ static z_result_t _z_new_transport_peer(_z_transport_t *zt, const _z_string_t *l
                 return ret;
             }
             ret = _z_multicast_transport_create(zt, zl, &tp_param);
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+            if (zl->_cap._transport == Z_LINK_CAP_TRANSPORT_MULTICAST) {
+                _Z_SET_IF_OK(ret, _z_transport_set_selective_repeat(&zt->_transport._multicast._common, session_cfg));
+            }
+#endif
             break;
         }
         default:
@@ -227,6 +309,9 @@ z_result_t _z_new_peer(_z_transport_t *zt, const _z_id_t *session_id, const _z_s
             if (ret != _Z_RES_OK) {
 #if Z_FEATURE_LINK_TLS == 1
                 _z_close_tls_socket(&socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+                _z_close_shm_socket(&socket);
 #endif
                 _z_socket_close(&socket);
                 return ret;
@@ -235,6 +320,9 @@ z_result_t _z_new_peer(_z_transport_t *zt, const _z_id_t *session_id, const _z_s
             if (ret != _Z_RES_OK) {
 #if Z_FEATURE_LINK_TLS == 1
                 _z_close_tls_socket(&socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+                _z_close_shm_socket(&socket);
 #endif
                 _z_socket_close(&socket);
                 return ret;
@@ -22,6 +22,7 @@
 #include "zenoh-pico/session/query.h"
 #include "zenoh-pico/session/utils.h"
 #include "zenoh-pico/transport/multicast/lease.h"
+#include "zenoh-pico/transport/multicast/peer_table.h"
 #include "zenoh-pico/transport/multicast/transport.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/result.h"
@@ -81,27 +82,10 @@ _z_fut_fn_result_t _zp_multicast_failed_result(_z_transport_multicast_t *ztm, _z
 #endif
 }
 
-static _z_zint_t _z_get_minimum_lease(_z_transport_peer_multicast_slist_t *peers, _z_zint_t local_lease) {
-    _z_zint_t ret = local_lease;
-
-    _z_transport_peer_multicast_slist_t *it = peers;
-    while (it != NULL) {
-        _z_transport_peer_multicast_t *val = _z_transport_peer_multicast_slist_value(it);
-        _z_zint_t lease = val->_lease;
-        if (lease < ret) {
-            ret = lease;
-        }
-
-        it = _z_transport_peer_multicast_slist_next(it);
-    }
-
-    return ret;
-}
-
 static bool _zp_multicast_peer_is_expired(const _z_transport_peer_multicast_t *target,
                                           const _z_transport_peer_multicast_t *peer) {
     _ZP_UNUSED(target);
-    return !peer->common._received;
+    return !_z_multicast_peer_table_contains(peer);
 }
 
 static void _zp_multicast_report_disconnected_events(_z_transport_multicast_t *ztm,
@@ -144,19 +128,18 @@ _z_fut_fn_result_t _zp_multicast_lease_task_fn(void *ztm_arg, _z_executor_t *exe
     }
 
     _z_transport_peer_multicast_slist_t *dropped_peers = _z_transport_peer_multicast_slist_new();
+    bool expired = false;
     _z_transport_peer_mutex_lock(&ztm->_common);
-    ztm->_peers = _z_transport_peer_multicast_slist_extract_all_filter(ztm->_peers, &dropped_peers,
-                                                                       _zp_multicast_peer_is_expired, NULL);
-    _z_transport_peer_multicast_slist_t *curr_list = ztm->_peers;
-    while (curr_list != NULL) {
-        _z_transport_peer_multicast_t *curr_peer = _z_transport_peer_multicast_slist_value(curr_list);
-        curr_peer->common._received = false;
-        curr_list = _z_transport_peer_multicast_slist_next(curr_list);
+    // Only the peers whose lease check is due are visited
+    unsigned long next_check =
+        _z_multicast_peer_table_check_leases(&ztm->_peer_table, (unsigned long)ztm->_common._lease, &expired);
+    if (expired) {
+        ztm->_peers = _z_transport_peer_multicast_slist_extract_all_filter(ztm->_peers, &dropped_peers,
+                                                                           _zp_multicast_peer_is_expired, NULL);
     }
-    unsigned long min_lease = (unsigned long)_z_get_minimum_lease(ztm->_peers, ztm->_common._lease);
     _z_transport_peer_mutex_unlock(&ztm->_common);
     _zp_multicast_report_disconnected_events(ztm, &dropped_peers);
-    return _z_fut_fn_result_wake_up_after(min_lease);
+    return _z_fut_fn_result_wake_up_after(next_check);
 }
 
 _z_fut_fn_result_t _zp_multicast_keep_alive_task_fn(void *ztm_arg, _z_executor_t *executor) {
@@ -176,7 +159,8 @@ _z_fut_fn_result_t _zp_multicast_keep_alive_task_fn(void *ztm_arg, _z_executor_t
     }
     ztm->_common._transmitted = false;
     _z_transport_peer_mutex_lock(&ztm->_common);
-    unsigned long min_lease = (unsigned long)_z_get_minimum_lease(ztm->_peers, ztm->_common._lease);
+    unsigned long min_lease =
+        (unsigned long)_z_multicast_peer_table_min_lease(&ztm->_peer_table, ztm->_common._lease);
     _z_transport_peer_mutex_unlock(&ztm->_common);
     return _z_fut_fn_result_wake_up_after(min_lease / Z_TRANSPORT_LEASE_EXPIRE_FACTOR);
 }
@@ -0,0 +1,235 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/transport/multicast/peer_table.h"
+
+#include <limits.h>
+#include <string.h>
+
+#include "zenoh-pico/utils/logging.h"
+
+#if Z_FEATURE_MULTICAST_TRANSPORT == 1 || Z_FEATURE_RAWETH_TRANSPORT == 1
+
+#define _Z_MULTICAST_PEER_TABLE_BUCKETS 64
+#define _Z_MULTICAST_PEER_UNTRACKED SIZE_MAX
+
+static size_t _z_multicast_peer_table_addr_hash(const void *key) { return _z_slice_hash((const _z_slice_t *)key); }
+
+static bool _z_multicast_peer_table_addr_eq(const void *left, const void *right) {
+    const _z_hashmap_entry_t *l = (const _z_hashmap_entry_t *)left;
+    const _z_hashmap_entry_t *r = (const _z_hashmap_entry_t *)right;
+    return _z_slice_eq((const _z_slice_t *)l->_key, (const _z_slice_t *)r->_key);
+}
+
+// Keys and values belong to the peers
+static void _z_multicast_peer_table_entry_free(void **e) {
+    z_free(*e);
+    *e = NULL;
+}
+
+// Deadlines wrap around with the clock, they are compared by their distance
+static inline bool _z_multicast_deadline_before(unsigned long left, unsigned long right) {
+    return (left != right) && ((right - left) <= (ULONG_MAX / 2));
+}
+
+static inline bool _z_multicast_peer_table_heap_less(const _z_multicast_peer_table_t *table, size_t left,
+                                                     size_t right) {
+    return _z_multicast_deadline_before(table->_lease_heap[left]->_lease_deadline,
+                                        table->_lease_heap[right]->_lease_deadline);
+}
+
+static void _z_multicast_peer_table_heap_swap(_z_multicast_peer_table_t *table, size_t left, size_t right) {
+    _z_transport_peer_multicast_t *tmp = table->_lease_heap[left];
+    table->_lease_heap[left] = table->_lease_heap[right];
+    table->_lease_heap[right] = tmp;
+    table->_lease_heap[left]->_lease_heap_idx = left;
+    table->_lease_heap[right]->_lease_heap_idx = right;
+}
+
+static void _z_multicast_peer_table_sift_up(_z_multicast_peer_table_t *table, size_t idx) {
+    while (idx > 0) {
+        size_t parent = (idx - 1) / 2;
+        if (!_z_multicast_peer_table_heap_less(table, idx, parent)) {
+            break;
+        }
+        _z_multicast_peer_table_heap_swap(table, idx, parent);
+        idx = parent;
+    }
+}
+
+static void _z_multicast_peer_table_sift_down(_z_multicast_peer_table_t *table, size_t idx) {
+    while (true) {
+        size_t smallest = idx;
+        size_t left = 2 * idx + 1;
+        size_t right = left + 1;
+        if ((left < table->_lease_heap_len) && _z_multicast_peer_table_heap_less(table, left, smallest)) {
+            smallest = left;
+        }
+        if ((right < table->_lease_heap_len) && _z_multicast_peer_table_heap_less(table, right, smallest)) {
+            smallest = right;
+        }
+        if (smallest == idx) {
+            break;
+        }
+        _z_multicast_peer_table_heap_swap(table, idx, smallest);
+        idx = smallest;
+    }
+}
+
+static z_result_t _z_multicast_peer_table_heap_reserve(_z_multicast_peer_table_t *table) {
+    if (table->_lease_heap_len < table->_lease_heap_capacity) {
+        return _Z_RES_OK;
+    }
+    size_t capacity = (table->_lease_heap_capacity << 1) | 0x01;
+    _z_transport_peer_multicast_t **heap =
+        (_z_transport_peer_multicast_t **)z_malloc(capacity * sizeof(_z_transport_peer_multicast_t *));
+    if (heap == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    if (table->_lease_heap_len > 0) {
+        (void)memcpy(heap, table->_lease_heap, table->_lease_heap_len * sizeof(_z_transport_peer_multicast_t *));
+    }
+    z_free(table->_lease_heap);
+    table->_lease_heap = heap;
+    table->_lease_heap_capacity = capacity;
+    return _Z_RES_OK;
+}
+
+void _z_multicast_peer_table_init(_z_multicast_peer_table_t *table) {
+    _z_hashmap_init(&table->_by_addr, _Z_MULTICAST_PEER_TABLE_BUCKETS, _z_multicast_peer_table_addr_hash,
+                    _z_multicast_peer_table_addr_eq);
+    table->_lease_heap = NULL;
+    table->_lease_heap_len = 0;
+    table->_lease_heap_capacity = 0;
+    table->_lease_clock = z_clock_now();
+    table->_min_lease = 0;
+    table->_min_lease_stale = false;
+}
+
+void _z_multicast_peer_table_clear(_z_multicast_peer_table_t *table) {
+    _z_hashmap_clear(&table->_by_addr, _z_multicast_peer_table_entry_free);
+    for (size_t i = 0; i < table->_lease_heap_len; i++) {
+        table->_lease_heap[i]->_lease_heap_idx = _Z_MULTICAST_PEER_UNTRACKED;
+    }
+    z_free(table->_lease_heap);
+    table->_lease_heap = NULL;
+    table->_lease_heap_len = 0;
+    table->_lease_heap_capacity = 0;
+    table->_min_lease = 0;
+    table->_min_lease_stale = false;
+}
+
+z_result_t _z_multicast_peer_table_add(_z_multicast_peer_table_t *table, _z_transport_peer_multicast_t *peer) {
+    peer->_lease_heap_idx = _Z_MULTICAST_PEER_UNTRACKED;
+    _Z_RETURN_IF_ERR(_z_multicast_peer_table_heap_reserve(table));
+    if (_z_hashmap_insert(&table->_by_addr, &peer->_remote_addr, peer, _z_multicast_peer_table_entry_free, false) ==
+        NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    if (!table->_min_lease_stale && ((table->_lease_heap_len == 0) || (peer->_lease < table->_min_lease))) {
+        table->_min_lease = peer->_lease;
+    }
+    peer->_lease_deadline = z_clock_elapsed_ms(&table->_lease_clock) + (unsigned long)peer->_lease;
+    peer->_lease_heap_idx = table->_lease_heap_len;
+    table->_lease_heap[table->_lease_heap_len++] = peer;
+    _z_multicast_peer_table_sift_up(table, peer->_lease_heap_idx);
+    return _Z_RES_OK;
+}
+
+void _z_multicast_peer_table_remove(_z_multicast_peer_table_t *table, _z_transport_peer_multicast_t *peer) {
+    if (!_z_multicast_peer_table_contains(peer)) {
+        return;
+    }
+    _z_hashmap_remove(&table->_by_addr, &peer->_remote_addr, _z_multicast_peer_table_entry_free);
+    size_t idx = peer->_lease_heap_idx;
+    size_t last = --table->_lease_heap_len;
+    if (idx != last) {
+        _z_multicast_peer_table_heap_swap(table, idx, last);
+        _z_multicast_peer_table_sift_down(table, idx);
+        _z_multicast_peer_table_sift_up(table, idx);
+    }
+    peer->_lease_heap_idx = _Z_MULTICAST_PEER_UNTRACKED;
+    if (peer->_lease == table->_min_lease) {
+        table->_min_lease_stale = true;
+    }
+}
+
+bool _z_multicast_peer_table_contains(const _z_transport_peer_multicast_t *peer) {
+    return peer->_lease_heap_idx != _Z_MULTICAST_PEER_UNTRACKED;
+}
+
+_z_transport_peer_multicast_t *_z_multicast_peer_table_find(const _z_multicast_peer_table_t *table,
+                                                            const _z_slice_t *remote_addr) {
+    return (_z_transport_peer_multicast_t *)_z_hashmap_get(&table->_by_addr, remote_addr);
+}
+
+void _z_multicast_peer_table_set_lease(_z_multicast_peer_table_t *table, _z_transport_peer_multicast_t *peer,
+                                       _z_zint_t lease) {
+    _z_zint_t prev = peer->_lease;
+    peer->_lease = lease;
+    if ((lease == prev) || !_z_multicast_peer_table_contains(peer)) {
+        return;
+    }
+    if (lease < table->_min_lease) {
+        table->_min_lease = lease;
+    } else if (prev == table->_min_lease) {
+        table->_min_lease_stale = true;
+    }
+    if (lease < prev) {
+        unsigned long deadline = z_clock_elapsed_ms(&table->_lease_clock) + (unsigned long)lease;
+        if (_z_multicast_deadline_before(deadline, peer->_lease_deadline)) {
+            peer->_lease_deadline = deadline;
+            _z_multicast_peer_table_sift_up(table, peer->_lease_heap_idx);
+        }
+    }
+}
+
+_z_zint_t _z_multicast_peer_table_min_lease(_z_multicast_peer_table_t *table, _z_zint_t local_lease) {
+    if (table->_lease_heap_len == 0) {
+        return local_lease;
+    }
+    if (table->_min_lease_stale) {
+        table->_min_lease = table->_lease_heap[0]->_lease;
+        for (size_t i = 1; i < table->_lease_heap_len; i++) {
+            if (table->_lease_heap[i]->_lease < table->_min_lease) {
+                table->_min_lease = table->_lease_heap[i]->_lease;
+            }
+        }
+        table->_min_lease_stale = false;
+    }
+    return (table->_min_lease < local_lease) ? table->_min_lease : local_lease;
+}
+
+unsigned long _z_multicast_peer_table_check_leases(_z_multicast_peer_table_t *table, unsigned long max_wait,
+                                                   bool *expired) {
+    unsigned long now = z_clock_elapsed_ms(&table->_lease_clock);
+    while (table->_lease_heap_len > 0) {
+        _z_transport_peer_multicast_t *peer = table->_lease_heap[0];
+        if (_z_multicast_deadline_before(now, peer->_lease_deadline)) {
+            unsigned long wait = peer->_lease_deadline - now;
+            return (wait < max_wait) ? wait : max_wait;
+        }
+        if (peer->common._received) {
+            peer->common._received = false;
+            peer->_lease_deadline = now + (unsigned long)peer->_lease;
+            _z_multicast_peer_table_sift_down(table, 0);
+        } else {
+            _z_multicast_peer_table_remove(table, peer);
+            *expired = true;
+        }
+    }
+    return max_wait;
+}
+
+#endif  // Z_FEATURE_MULTICAST_TRANSPORT == 1 || Z_FEATURE_RAWETH_TRANSPORT == 1
@@ -31,6 +31,10 @@
 static z_result_t _zp_multicast_process_messages(_z_transport_multicast_t *ztm) {
     size_t to_read = 0;
 
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    // Held messages are given up on even when nothing else is received
+    _Z_RETURN_IF_ERR(_z_multicast_poll_held(ztm));
+#endif
     z_result_t ret = _z_multicast_recv_zbuf(ztm, &to_read);
     if (ret == _Z_ERR_TRANSPORT_NOT_ENOUGH_BYTES || ret == _Z_ERR_TRANSPORT_RX_FAILED) {
         return _Z_NO_DATA_PROCESSED;
@@ -68,6 +72,9 @@ z_result_t _zp_multicast_read(_z_transport_multicast_t *ztm, bool single_read) {
     // Read & process a single message
     if (single_read) {
         _z_transport_message_t t_msg;
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+        _Z_RETURN_IF_ERR(_z_multicast_poll_held(ztm));
+#endif
         _Z_RETURN_IF_ERR(_z_multicast_recv_t_msg(ztm, &t_msg));
         _Z_CLEAN_RETURN_IF_ERR(_z_multicast_handle_transport_message(ztm, &t_msg, &ztm->_zbuf_addr),
                                _z_t_msg_clear(&t_msg));
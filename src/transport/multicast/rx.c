@@ -29,6 +29,9 @@
 #include "zenoh-pico/protocol/iobuf.h"
 #include "zenoh-pico/session/utils.h"
 #include "zenoh-pico/system/common/platform.h"
+#include "zenoh-pico/transport/common/selective_repeat.h"
+#include "zenoh-pico/transport/common/tx.h"
+#include "zenoh-pico/transport/multicast/peer_table.h"
 #include "zenoh-pico/transport/multicast/rx.h"
 #include "zenoh-pico/transport/multicast/transport.h"
 #include "zenoh-pico/transport/utils.h"
@@ -158,22 +161,14 @@ static z_result_t _z_multicast_remote_addr_to_endpoint(const _z_transport_multic
 }
 #endif
 
-static _z_transport_peer_multicast_t *_z_find_peer_entry(_z_transport_peer_multicast_slist_t *l,
-                                                         _z_slice_t *remote_addr) {
-    _z_transport_peer_multicast_t *ret = NULL;
-
-    _z_transport_peer_multicast_slist_t *xs = l;
-    for (; xs != NULL; xs = _z_transport_peer_multicast_slist_next(xs)) {
-        _z_transport_peer_multicast_t *val = _z_transport_peer_multicast_slist_value(xs);
-        if (val->_remote_addr.len != remote_addr->len) {
-            continue;
-        }
-        if (memcmp(val->_remote_addr.start, remote_addr->start, remote_addr->len) == 0) {
-            ret = val;
-        }
-    }
+static bool _z_multicast_peer_is(const _z_transport_peer_multicast_t *target,
+                                 const _z_transport_peer_multicast_t *peer) {
+    return target == peer;
+}
 
-    return ret;
+static void _z_multicast_drop_peer(_z_transport_multicast_t *ztm, _z_transport_peer_multicast_t *peer) {
+    _z_multicast_peer_table_remove(&ztm->_peer_table, peer);
+    ztm->_peers = _z_transport_peer_multicast_slist_drop_first_filter(ztm->_peers, _z_multicast_peer_is, peer);
 }
 
 static z_result_t _z_multicast_handle_frame(_z_transport_multicast_t *ztm, uint8_t header, _z_t_msg_frame_t *msg,
@@ -368,6 +363,121 @@ static z_result_t _z_multicast_handle_fragment(_z_transport_multicast_t *ztm, ui
     return ret;
 }
 
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+static z_result_t _z_multicast_handle_sequenced(_z_transport_multicast_t *ztm, _z_transport_message_t *t_msg,
+                                                _z_transport_peer_multicast_t *entry) {
+    if (_Z_MID(t_msg->_header) == _Z_MID_T_FRAME) {
+        return _z_multicast_handle_frame(ztm, t_msg->_header, &t_msg->_body._frame, entry);
+    }
+    return _z_multicast_handle_fragment(ztm, t_msg->_header, &t_msg->_body._fragment, entry);
+}
+
+// Handles the held messages that became next in order
+static z_result_t _z_multicast_drain_held(_z_transport_multicast_t *ztm, _z_transport_peer_multicast_t *entry) {
+    z_result_t ret = _Z_RES_OK;
+    _z_transport_message_t t_msg;
+    _z_zbuf_t zbf;
+    while ((ret == _Z_RES_OK) &&
+           _z_transport_rx_reorder_take(entry->common._rx_reorder,
+                                        _z_sn_increment(entry->_sn_res, entry->_sn_rx_sns._val._plain._reliable),
+                                        &t_msg, &zbf)) {
+        ret = _z_multicast_handle_sequenced(ztm, &t_msg, entry);
+        _z_zbuf_clear(&zbf);
+    }
+    return ret;
+}
+
+// Handles the held messages without waiting any longer for the missing ones
+static z_result_t _z_multicast_flush_held(_z_transport_multicast_t *ztm, _z_transport_peer_multicast_t *entry) {
+    z_result_t ret = _Z_RES_OK;
+    _z_zint_t sn;
+    while ((ret == _Z_RES_OK) && _z_transport_rx_reorder_first(entry->common._rx_reorder, entry->_sn_res,
+                                                                entry->_sn_rx_sns._val._plain._reliable, &sn)) {
+        _Z_INFO("Reliable messages lost before message %u", (unsigned int)sn);
+#if Z_FEATURE_FRAGMENTATION == 1
+        _z_wbuf_clear(&entry->common._dbuf_reliable);
+        entry->common._state_reliable = _Z_DBUF_STATE_NULL;
+#endif
+        entry->_sn_rx_sns._val._plain._reliable = _z_sn_decrement(entry->_sn_res, sn);
+        ret = _z_multicast_drain_held(ztm, entry);
+    }
+    return ret;
+}
+
+// Holds the reliable messages received after a gap until the missing ones are sent again
+static z_result_t _z_multicast_handle_reliable(_z_transport_multicast_t *ztm, _z_transport_message_t *t_msg,
+                                               _z_transport_peer_multicast_t *entry) {
+    _z_transport_rx_reorder_t *r = (entry != NULL) ? entry->common._rx_reorder : NULL;
+    if ((r == NULL) || !_Z_HAS_FLAG(t_msg->_header, _Z_FLAG_T_FRAME_R)) {
+        return _z_multicast_handle_sequenced(ztm, t_msg, entry);
+    }
+    z_result_t ret = _Z_RES_OK;
+    _z_transport_nack_target_t target = {._link = ztm->_common._link, ._zid = entry->common._remote_zid};
+    switch (_z_transport_rx_reorder_accept(r, entry->_sn_res, entry->_sn_rx_sns._val._plain._reliable, t_msg,
+                                           _z_transport_nack_send, &target)) {
+        case _Z_TRANSPORT_RX_HELD:
+            entry->common._received = true;
+            _z_t_msg_clear(t_msg);
+            return _Z_RES_OK;
+        case _Z_TRANSPORT_RX_FLUSH:
+            ret = _z_multicast_flush_held(ztm, entry);
+            break;
+        case _Z_TRANSPORT_RX_HANDLE:
+        default:
+            break;
+    }
+    z_result_t res = _z_multicast_handle_sequenced(ztm, t_msg, entry);
+    _Z_SET_IF_OK(ret, res);
+    _Z_SET_IF_OK(ret, _z_multicast_drain_held(ztm, entry));
+    return ret;
+}
+
+z_result_t _z_multicast_poll_held(_z_transport_multicast_t *ztm) {
+    z_result_t ret = _Z_RES_OK;
+    _z_transport_peer_mutex_lock(&ztm->_common);
+    _z_transport_peer_multicast_slist_t *it = ztm->_peers;
+    for (; (it != NULL) && (ret == _Z_RES_OK); it = _z_transport_peer_multicast_slist_next(it)) {
+        _z_transport_peer_multicast_t *entry = _z_transport_peer_multicast_slist_value(it);
+        _z_transport_rx_reorder_t *r = entry->common._rx_reorder;
+        if (r == NULL) {
+            continue;
+        }
+        _z_transport_nack_target_t target = {._link = ztm->_common._link, ._zid = entry->common._remote_zid};
+        if (_z_transport_rx_reorder_poll(r, entry->_sn_res, entry->_sn_rx_sns._val._plain._reliable,
+                                         _z_transport_nack_send, &target)) {
+            ret = _z_multicast_flush_held(ztm, entry);
+        }
+    }
+    _z_transport_peer_mutex_unlock(&ztm->_common);
+    return ret;
+}
+
+static void _z_multicast_handle_oam(_z_transport_multicast_t *ztm, _z_t_msg_oam_t *msg) {
+    if ((msg->_id == _Z_T_OAM_ID_NACK) && (ztm->_common._tx_history != NULL) &&
+        _z_id_eq(&msg->_body._nack._zid, &_z_transport_common_get_session(&ztm->_common)->_local_zid)) {
+        (void)_z_transport_tx_retransmit(&ztm->_common, msg->_body._nack._sn, msg->_body._nack._count);
+    }
+    _z_t_msg_oam_clear(msg);
+}
+#endif
+
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+// Periodic joins must not give up on the reliable messages held or still missing: the reliable SN is kept as long as
+// the peer is no further ahead than the reorder window, the missing messages are then asked for when the next ones
+// arrive
+static bool _z_multicast_join_keeps_reliable_sn(const _z_transport_peer_multicast_t *entry,
+                                                const _z_t_msg_join_t *msg) {
+    const _z_transport_rx_reorder_t *r = entry->common._rx_reorder;
+    if ((r == NULL) || msg->_next_sn._is_qos) {
+        return false;
+    }
+    _z_zint_t last = entry->_sn_rx_sns._val._plain._reliable;
+    _z_zint_t peer_last = _z_sn_decrement(entry->_sn_res, msg->_next_sn._val._plain._reliable);
+    return (peer_last == last) ||
+           (_z_sn_precedes(entry->_sn_res, last, peer_last) && (((peer_last - last) & entry->_sn_res) <= r->_capacity));
+}
+#endif
+
 static z_result_t _z_multicast_handle_join_inner(_z_transport_multicast_t *ztm, _z_slice_t *addr, _z_t_msg_join_t *msg,
                                                  _z_transport_peer_multicast_t *entry) {
     // Check proto version
@@ -383,7 +493,11 @@ static z_result_t _z_multicast_handle_join_inner(_z_transport_multicast_t *ztm,
             _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_OPEN_SN_RESOLUTION);
         }
         // Initialize entry
-        ztm->_peers = _z_transport_peer_multicast_slist_push_empty(ztm->_peers);
+        _z_transport_peer_multicast_slist_t *peers = _z_transport_peer_multicast_slist_push_empty(ztm->_peers);
+        if (peers == ztm->_peers) {
+            _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        }
+        ztm->_peers = peers;
         entry = _z_transport_peer_multicast_slist_value(ztm->_peers);
         entry->_sn_res = _z_sn_max(msg->_seq_num_res);
         entry->_remote_addr = _z_slice_duplicate(addr);
@@ -410,6 +524,16 @@ static z_result_t _z_multicast_handle_join_inner(_z_transport_multicast_t *ztm,
         entry->common._dbuf_reliable = _z_wbuf_null();
         entry->common._dbuf_best_effort = _z_wbuf_null();
 #endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+        // Without a reorder window the peer falls back to dropping the messages that are out of order
+        entry->common._rx_reorder =
+            (ztm->_common._tx_history != NULL) ? _z_transport_rx_reorder_new(Z_TRANSPORT_RX_REORDER_SIZE) : NULL;
+#endif
+        z_result_t ret = _z_multicast_peer_table_add(&ztm->_peer_table, entry);
+        if (ret != _Z_RES_OK) {
+            ztm->_peers = _z_transport_peer_multicast_slist_pop(ztm->_peers);
+            return ret;
+        }
 #if Z_FEATURE_CONNECTIVITY == 1
         _z_connectivity_peer_event_data_t connected_peer = {0};
         uint16_t mtu = 0;
@@ -439,7 +563,7 @@ static z_result_t _z_multicast_handle_join_inner(_z_transport_multicast_t *ztm,
             _z_connectivity_peer_event_data_copy_from_common(&disconnected_peer, &entry->common);
 #endif
             // TODO: cleanup here should also be done on mappings/subs/etc...
-            _z_transport_peer_multicast_slist_drop_first_filter(ztm->_peers, _z_transport_peer_multicast_eq, entry);
+            _z_multicast_drop_peer(ztm, entry);
 #if Z_FEATURE_CONNECTIVITY == 1
             _z_transport_peer_mutex_unlock(&ztm->_common);
             _z_connectivity_peer_disconnected(_z_transport_common_get_session(&ztm->_common), &disconnected_peer, true,
@@ -449,11 +573,24 @@ static z_result_t _z_multicast_handle_join_inner(_z_transport_multicast_t *ztm,
 #endif
             return _Z_RES_OK;
         }
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+        _z_zint_t sn_rx_reliable = entry->_sn_rx_sns._val._plain._reliable;
+        bool keep_reliable = _z_multicast_join_keeps_reliable_sn(entry, msg);
+        // Otherwise held messages are handled before the SNs move on
+        if ((entry->common._rx_reorder != NULL) && !keep_reliable) {
+            _Z_RETURN_IF_ERR(_z_multicast_flush_held(ztm, entry));
+        }
+#endif
         // Update SNs
         _z_conduit_sn_list_copy(&entry->_sn_rx_sns, &msg->_next_sn);
         _z_conduit_sn_list_decrement(entry->_sn_res, &entry->_sn_rx_sns);
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+        if (keep_reliable) {
+            entry->_sn_rx_sns._val._plain._reliable = sn_rx_reliable;
+        }
+#endif
         // Update lease time (set as ms during)
-        entry->_lease = msg->_lease;
+        _z_multicast_peer_table_set_lease(&ztm->_peer_table, entry, msg->_lease);
     }
     return _Z_RES_OK;
 }
@@ -470,17 +607,25 @@ z_result_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm,
     z_result_t ret = _Z_RES_OK;
     _z_transport_peer_mutex_lock(&ztm->_common);
     // Mark the session that we have received data from this peer
-    _z_transport_peer_multicast_t *entry = _z_find_peer_entry(ztm->_peers, addr);
+    _z_transport_peer_multicast_t *entry = _z_multicast_peer_table_find(&ztm->_peer_table, addr);
     switch (_Z_MID(t_msg->_header)) {
         case _Z_MID_T_FRAME: {
             _Z_DEBUG("Received _Z_FRAME message");
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+            ret = _z_multicast_handle_reliable(ztm, t_msg, entry);
+#else
             ret = _z_multicast_handle_frame(ztm, t_msg->_header, &t_msg->_body._frame, entry);
+#endif
             break;
         }
 
         case _Z_MID_T_FRAGMENT:
             _Z_DEBUG("Received Z_FRAGMENT message");
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+            ret = _z_multicast_handle_reliable(ztm, t_msg, entry);
+#else
             ret = _z_multicast_handle_fragment(ztm, t_msg->_header, &t_msg->_body._fragment, entry);
+#endif
             break;
 
         case _Z_MID_T_KEEP_ALIVE: {
@@ -521,8 +666,7 @@ z_result_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm,
                 _z_transport_get_link_properties(&ztm->_common, &mtu, &is_streamed, &is_reliable);
                 _z_connectivity_peer_event_data_copy_from_common(&disconnected_peer, &entry->common);
 #endif
-                ztm->_peers = _z_transport_peer_multicast_slist_drop_first_filter(
-                    ztm->_peers, _z_transport_peer_multicast_eq, entry);
+                _z_multicast_drop_peer(ztm, entry);
 #if Z_FEATURE_CONNECTIVITY == 1
                 _z_transport_peer_mutex_unlock(&ztm->_common);
                 _z_connectivity_peer_disconnected(_z_transport_common_get_session(&ztm->_common), &disconnected_peer,
@@ -535,6 +679,14 @@ z_result_t _z_multicast_handle_transport_message(_z_transport_multicast_t *ztm,
             break;
         }
 
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+        case _Z_MID_T_OAM: {
+            _Z_DEBUG("Received _Z_OAM message");
+            _z_multicast_handle_oam(ztm, &t_msg->_body._oam);
+            break;
+        }
+#endif
+
         default: {
             _Z_ERROR("Unknown session message ID");
             _z_t_msg_clear(t_msg);
@@ -21,6 +21,7 @@
 
 #include "zenoh-pico/link/link.h"
 #include "zenoh-pico/transport/common/tx.h"
+#include "zenoh-pico/transport/multicast/peer_table.h"
 #include "zenoh-pico/transport/multicast/transport.h"
 #include "zenoh-pico/transport/raweth/tx.h"
 #include "zenoh-pico/transport/utils.h"
@@ -56,6 +57,22 @@ z_result_t _z_multicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
     ztm->_common._batch_state = _Z_BATCHING_IDLE;
     ztm->_common._batch_count = 0;
 #endif
+#if Z_FEATURE_COMPRESSION == 1
+    // Compression is only negotiated on unicast transports
+    ztm->_common._compression = NULL;
+#endif
+#if Z_FEATURE_FRAGMENTATION == 1
+    ztm->_common._tx_train_buf = NULL;
+#endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    // Allocated by the transport manager when selective repeat is enabled
+    ztm->_common._tx_history = NULL;
+    ztm->_common._tx_batch_reliable = false;
+#endif
+#if Z_FEATURE_UNICAST_PEER == 1
+    ztm->_common._striping = _Z_STRIPING_NONE;
+    ztm->_common._tx_lane = _Z_STRIPING_LANE_ALL;
+#endif
 
 #if Z_FEATURE_MULTI_THREAD == 1
     // Initialize the mutexes
@@ -101,6 +118,7 @@ z_result_t _z_multicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
 
         // Initialize peer list
         ztm->_peers = _z_transport_peer_multicast_slist_new();
+        _z_multicast_peer_table_init(&ztm->_peer_table);
 
         ztm->_common._lease = Z_TRANSPORT_LEASE;
 
@@ -175,6 +193,7 @@ z_result_t _z_multicast_transport_close(_z_transport_multicast_t *ztm, uint8_t r
 }
 
 void _z_multicast_transport_clear(_z_transport_multicast_t *ztm) {
+    _z_multicast_peer_table_clear(&ztm->_peer_table);
     _z_transport_peer_multicast_slist_free(&ztm->_peers);
     _z_transport_common_clear(
         &ztm->_common);  // free common in the very end, as peers might access the link data in common while being freed
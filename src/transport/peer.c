@@ -16,10 +16,14 @@
 #if Z_FEATURE_LINK_TLS == 1
 #include "zenoh-pico/link/transport/tls_stream.h"
 #endif
+#if Z_FEATURE_LINK_SHM == 1
+#include "zenoh-pico/link/transport/shm.h"
+#endif
 #include "zenoh-pico/link/endpoint.h"
 #include "zenoh-pico/net/session.h"
 #include "zenoh-pico/protocol/core.h"
 #include "zenoh-pico/session/session.h"
+#include "zenoh-pico/transport/common/selective_repeat.h"
 #include "zenoh-pico/transport/transport.h"
 #include "zenoh-pico/transport/utils.h"
 
@@ -57,6 +61,9 @@ void _z_transport_peer_common_clear(_z_transport_peer_common_t *src) {
 #if Z_FEATURE_FRAGMENTATION == 1
     _z_wbuf_clear(&src->_dbuf_reliable);
     _z_wbuf_clear(&src->_dbuf_best_effort);
+#endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    _z_transport_rx_reorder_free(&src->_rx_reorder);
 #endif
     src->_remote_zid = _z_id_empty();
     _z_resource_slist_free(&src->_remote_resources);
@@ -76,6 +83,10 @@ void _z_transport_peer_common_copy(_z_transport_peer_common_t *dst, const _z_tra
     _z_wbuf_copy(&dst->_dbuf_reliable, &src->_dbuf_reliable);
     _z_wbuf_copy(&dst->_dbuf_best_effort, &src->_dbuf_best_effort);
     dst->_patch = src->_patch;
+#endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    // Held messages stay with the original peer
+    dst->_rx_reorder = NULL;
 #endif
     dst->_remote_resources = NULL;
     dst->_received = src->_received;
@@ -154,6 +165,9 @@ void _z_transport_peer_unicast_clear(_z_transport_peer_unicast_t *src) {
     if (src->_owns_socket) {
 #if Z_FEATURE_LINK_TLS == 1
         _z_close_tls_socket(&src->_socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        _z_close_shm_socket(&src->_socket);
 #endif
         _z_socket_close(&src->_socket);
     }
@@ -169,6 +183,8 @@ void _z_transport_peer_unicast_copy(_z_transport_peer_unicast_t *dst, const _z_t
     dst->flow_state = _Z_FLOW_STATE_INACTIVE;
     dst->flow_curr_size = 0;
     dst->flow_buff = _z_zbuf_null();
+    dst->_link_idx = src->_link_idx;
+    dst->_link_nb = src->_link_nb;
     _z_transport_peer_common_copy(&dst->common, &src->common);
 }
 
@@ -209,6 +225,8 @@ z_result_t _z_transport_peer_unicast_add(_z_transport_unicast_t *ztu, _z_transpo
     peer->_pending = false;
     peer->_socket = socket;
     peer->_owns_socket = owns_socket;
+    peer->_link_idx = 0;
+    peer->_link_nb = 1;
     _z_zint_t initial_sn_rx = _z_sn_decrement(ztu->_common._sn_res, param->_initial_sn_rx);
     peer->_sn_rx_reliable = initial_sn_rx;
     peer->_sn_rx_best_effort = initial_sn_rx;
@@ -228,6 +246,10 @@ z_result_t _z_transport_peer_unicast_add(_z_transport_unicast_t *ztu, _z_transpo
     peer->common._dbuf_reliable = _z_wbuf_null();
     peer->common._dbuf_best_effort = _z_wbuf_null();
 #endif
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+    // Selective repeat is only used by multicast transports
+    peer->common._rx_reorder = NULL;
+#endif
 #if Z_FEATURE_CONNECTIVITY == 1
     if (ztu->_common._link != NULL) {
         mtu = ztu->_common._link->_mtu;
@@ -245,6 +267,7 @@ z_result_t _z_transport_peer_unicast_add(_z_transport_unicast_t *ztu, _z_transpo
         _z_connectivity_peer_event_data_copy_from_common(&peer_event_data, &peer->common);
     }
 #endif
+    _z_transport_peer_unicast_group_links(ztu->_peers);
     _z_transport_peer_mutex_unlock(&ztu->_common);
 
     if (output_peer != NULL) {
@@ -260,3 +283,22 @@ z_result_t _z_transport_peer_unicast_add(_z_transport_unicast_t *ztu, _z_transpo
 
     return _Z_RES_OK;
 }
+
+void _z_transport_peer_unicast_group_links(_z_transport_peer_unicast_slist_t *peers) {
+    // Peers are few, links to a same remote peer are numbered in list order
+    for (_z_transport_peer_unicast_slist_t *it = peers; it != NULL; it = _z_transport_peer_unicast_slist_next(it)) {
+        _z_transport_peer_unicast_t *peer = _z_transport_peer_unicast_slist_value(it);
+        peer->_link_idx = 0;
+        peer->_link_nb = 0;
+        for (_z_transport_peer_unicast_slist_t *other = peers; other != NULL;
+             other = _z_transport_peer_unicast_slist_next(other)) {
+            _z_transport_peer_unicast_t *other_peer = _z_transport_peer_unicast_slist_value(other);
+            if (_z_id_eq(&peer->common._remote_zid, &other_peer->common._remote_zid)) {
+                if (other == it) {
+                    peer->_link_idx = peer->_link_nb;
+                }
+                peer->_link_nb++;
+            }
+        }
+    }
+}
@@ -23,6 +23,7 @@
 #include "zenoh-pico/link/transport/raweth.h"
 #include "zenoh-pico/protocol/codec/core.h"
 #include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/transport/raweth/mapping.h"
 #include "zenoh-pico/utils/logging.h"
 #include "zenoh-pico/utils/pointers.h"
 
@@ -63,7 +64,7 @@ const uint16_t _ZP_RAWETH_DEFAULT_ETHTYPE = 0x72e0;
 const char *_ZP_RAWETH_DEFAULT_INTERFACE = "lo";
 const uint8_t _ZP_RAWETH_DEFAULT_SMAC[_ZP_MAC_ADDR_LENGTH] = {0x30, 0x03, 0xc8, 0x37, 0x25, 0xa1};
 const _zp_raweth_mapping_entry_t _ZP_RAWETH_DEFAULT_MAPPING = {
-    ._keyexpr = {0}, ._vlan = 0x0000, ._dmac = {0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff}, ._has_vlan = false};
+    ._keyexpr = {._slice = {0}}, ._vlan = 0x0000, ._dmac = {0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff}, ._has_vlan = false};
 
 static bool _z_valid_iface_raweth(_z_str_intmap_t *config);
 static const char *_z_get_iface_raweth(_z_str_intmap_t *config);
@@ -358,6 +359,7 @@ static uint8_t *_z_parse_address_raweth(const char *address) {
 static z_result_t _z_f_link_open_raweth(_z_link_t *self) {
     // Init arrays
     self->_socket._raweth._mapping = _zp_raweth_mapping_array_empty();
+    self->_socket._raweth._mapping_index = NULL;
     self->_socket._raweth._whitelist = _zp_raweth_whitelist_array_empty();
     // Init socket smac
     if (_z_valid_address_raweth_inner(&self->_endpoint._locator._address)) {
@@ -397,6 +399,8 @@ static z_result_t _z_f_link_open_raweth(_z_link_t *self) {
         _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(&self->_socket._raweth._mapping, 0);
         *entry = _ZP_RAWETH_DEFAULT_MAPPING;
     }
+    // Precompile mapping lookup, the mapping is scanned if it fails
+    self->_socket._raweth._mapping_index = _zp_raweth_mapping_index_new(&self->_socket._raweth._mapping);
     // Init socket whitelist
     size = _z_valid_whitelist_raweth(&self->_endpoint._config);
     if (size != (size_t)0) {
@@ -405,15 +409,20 @@ static z_result_t _z_f_link_open_raweth(_z_link_t *self) {
         _Z_DEBUG("Invalid locator whitelist, filtering deactivated.");
     }
     // Open raweth link
-    return _z_open_raweth(&self->_socket._raweth._sock, self->_socket._raweth._interface);
+    _Z_RETURN_IF_ERR(_z_open_raweth(&self->_socket._raweth._sock, self->_socket._raweth._interface));
+    // Map frame rings if possible
+    self->_socket._raweth._ring = _z_raweth_ring_new(&self->_socket._raweth._sock);
+    return _Z_RES_OK;
 }
 
 static z_result_t _z_f_link_listen_raweth(_z_link_t *self) { return _z_f_link_open_raweth(self); }
 
 static void _z_f_link_close_raweth(_z_link_t *self) {
     // Close connection
+    _z_raweth_ring_free(&self->_socket._raweth._ring);
     _z_close_raweth(&self->_socket._raweth._sock);
     // Clear config
+    _zp_raweth_mapping_index_free(&self->_socket._raweth._mapping_index);
     _zp_raweth_mapping_array_clear(&self->_socket._raweth._mapping);
     if (_zp_raweth_whitelist_array_len(&self->_socket._raweth._whitelist) != 0) {
         _zp_raweth_whitelist_array_clear(&self->_socket._raweth._whitelist);
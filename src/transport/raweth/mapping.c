@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/transport/raweth/mapping.h"
+
+#include <string.h>
+
+#include "zenoh-pico/collections/hashmap.h"
+#include "zenoh-pico/collections/intmap.h"
+#include "zenoh-pico/utils/logging.h"
+
+#if Z_FEATURE_RAWETH_TRANSPORT == 1
+
+static inline size_t _zp_raweth_mapping_pos_size(size_t *pos) {
+    _ZP_UNUSED(pos);
+    return sizeof(size_t);
+}
+static inline void _zp_raweth_mapping_pos_copy(size_t *dst, const size_t *src) { *dst = *src; }
+
+_Z_ELEM_DEFINE(_zp_raweth_mapping_pos, size_t, _zp_raweth_mapping_pos_size, _z_noop_clear, _zp_raweth_mapping_pos_copy,
+               _z_noop_move, _z_noop_eq, _z_noop_cmp, _z_noop_hash)
+_Z_HASHMAP_DEFINE(_z_string, _zp_raweth_mapping_pos, _z_string_t, size_t)
+_Z_INT_MAP_DEFINE(_zp_raweth_mapping_pos, size_t)
+
+struct _zp_raweth_mapping_index_t {
+    // One matcher per mapping entry
+    _z_keyexpr_matcher_t *_matchers;
+    size_t _len;
+    // Positions of the entries with wildcards, in mapping order
+    size_t *_wild;
+    size_t _wild_len;
+    // Position of the first entry of each key expression without wildcards
+    _z_string__zp_raweth_mapping_pos_hashmap_t _exact;
+    _zp_raweth_mapping_pos_intmap_t _cache;
+};
+
+static z_result_t _zp_raweth_mapping_index_add_exact(_zp_raweth_mapping_index_t *index, const _z_string_t *key,
+                                                     size_t pos) {
+    if (_z_string__zp_raweth_mapping_pos_hashmap_get(&index->_exact, key) != NULL) {
+        // An earlier entry takes precedence
+        return _Z_RES_OK;
+    }
+    _z_string_t *k = (_z_string_t *)z_malloc(sizeof(_z_string_t));
+    size_t *v = (size_t *)z_malloc(sizeof(size_t));
+    if ((k == NULL) || (v == NULL)) {
+        z_free(k);
+        z_free(v);
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    *k = _z_string_alias(*key);
+    *v = pos;
+    if (_z_string__zp_raweth_mapping_pos_hashmap_insert(&index->_exact, k, v) == NULL) {
+        z_free(k);
+        z_free(v);
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    return _Z_RES_OK;
+}
+
+_zp_raweth_mapping_index_t *_zp_raweth_mapping_index_new(const _zp_raweth_mapping_array_t *mapping) {
+    size_t len = _zp_raweth_mapping_array_len(mapping);
+    if (len == 0) {
+        return NULL;
+    }
+    _zp_raweth_mapping_index_t *index = (_zp_raweth_mapping_index_t *)z_malloc(sizeof(_zp_raweth_mapping_index_t));
+    if (index == NULL) {
+        _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        return NULL;
+    }
+    index->_matchers = (_z_keyexpr_matcher_t *)z_malloc(len * sizeof(_z_keyexpr_matcher_t));
+    index->_wild = (size_t *)z_malloc(len * sizeof(size_t));
+    index->_wild_len = 0;
+    // Sized so that buckets hold about one key expression each
+    _z_hashmap_init(&index->_exact, len, _z_string_elem_hash, _z_string__zp_raweth_mapping_pos_hashmap_entry_key_eq);
+    index->_cache = _zp_raweth_mapping_pos_intmap_make();
+    if ((index->_matchers == NULL) || (index->_wild == NULL)) {
+        z_free(index->_matchers);
+        z_free(index->_wild);
+        z_free(index);
+        _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        return NULL;
+    }
+    for (size_t i = 0; i < len; i++) {
+        index->_matchers[i] = _z_keyexpr_matcher_null();
+    }
+    index->_len = len;
+
+    z_result_t ret = _Z_RES_OK;
+    for (size_t i = 0; (i < len) && (ret == _Z_RES_OK); i++) {
+        const _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(mapping, i);
+        _z_keyexpr_t key = _z_keyexpr_alias_from_string(&entry->_keyexpr);
+        size_t key_len = _z_string_len(&key._keyexpr);
+        if (key_len == 0) {
+            // Matches nothing
+            continue;
+        }
+        ret = _z_keyexpr_matcher_compile(&index->_matchers[i], &key);
+        if (ret != _Z_RES_OK) {
+            continue;
+        }
+        if (_z_keyexpr_non_wild_prefix_len(&key) == key_len) {
+            ret = _zp_raweth_mapping_index_add_exact(index, &key._keyexpr, i);
+        } else {
+            index->_wild[index->_wild_len++] = i;
+        }
+    }
+    if (ret != _Z_RES_OK) {
+        _zp_raweth_mapping_index_free(&index);
+    }
+    return index;
+}
+
+void _zp_raweth_mapping_index_free(_zp_raweth_mapping_index_t **index) {
+    _zp_raweth_mapping_index_t *ptr = *index;
+    if (ptr == NULL) {
+        return;
+    }
+    _z_string__zp_raweth_mapping_pos_hashmap_clear(&ptr->_exact);
+    _zp_raweth_mapping_pos_intmap_clear(&ptr->_cache);
+    for (size_t i = 0; i < ptr->_len; i++) {
+        _z_keyexpr_matcher_clear(&ptr->_matchers[i]);
+    }
+    z_free(ptr->_matchers);
+    z_free(ptr->_wild);
+    z_free(ptr);
+    *index = NULL;
+}
+
+static bool _zp_raweth_mapping_index_intersects(const _zp_raweth_mapping_index_t *index,
+                                                const _zp_raweth_mapping_array_t *mapping, size_t pos,
+                                                const _z_keyexpr_t *keyexpr) {
+    const _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(mapping, pos);
+    if (_z_string_len(&entry->_keyexpr) == 0) {
+        return false;
+    }
+    _z_keyexpr_t entry_ke = _z_keyexpr_alias_from_string(&entry->_keyexpr);
+    return _z_keyexpr_matcher_intersects(&index->_matchers[pos], &entry_ke, keyexpr);
+}
+
+size_t _zp_raweth_mapping_index_find(const _zp_raweth_mapping_index_t *index,
+                                     const _zp_raweth_mapping_array_t *mapping, const _z_keyexpr_t *keyexpr) {
+    size_t key_len = _z_string_len(&keyexpr->_keyexpr);
+    if (memchr(_z_string_data(&keyexpr->_keyexpr), '*', key_len) != NULL) {
+        // Key expressions with wildcards may intersect any entry
+        for (size_t i = 0; i < _zp_raweth_mapping_array_len(mapping); i++) {
+            if (_zp_raweth_mapping_index_intersects(index, mapping, i, keyexpr)) {
+                return i;
+            }
+        }
+        return SIZE_MAX;
+    }
+    // Otherwise only an equal entry or an entry with wildcards may match, the earliest one wins
+    const size_t *exact = _z_string__zp_raweth_mapping_pos_hashmap_get(&index->_exact, &keyexpr->_keyexpr);
+    size_t found = (exact != NULL) ? *exact : SIZE_MAX;
+    for (size_t i = 0; (i < index->_wild_len) && (index->_wild[i] < found); i++) {
+        if (_zp_raweth_mapping_index_intersects(index, mapping, index->_wild[i], keyexpr)) {
+            return index->_wild[i];
+        }
+    }
+    return found;
+}
+
+bool _zp_raweth_mapping_index_cache_get(const _zp_raweth_mapping_index_t *index, uint16_t id, size_t *pos) {
+    const size_t *cached = _zp_raweth_mapping_pos_intmap_get(&index->_cache, id);
+    if (cached == NULL) {
+        return false;
+    }
+    *pos = *cached;
+    return true;
+}
+
+void _zp_raweth_mapping_index_cache_insert(_zp_raweth_mapping_index_t *index, uint16_t id, size_t pos) {
+    size_t *v = (size_t *)z_malloc(sizeof(size_t));
+    if (v == NULL) {
+        // Looked up again on the next message
+        return;
+    }
+    *v = pos;
+    if (_zp_raweth_mapping_pos_intmap_insert(&index->_cache, id, v) == NULL) {
+        z_free(v);
+    }
+}
+
+void _zp_raweth_mapping_index_cache_forget(_zp_raweth_mapping_index_t *index, uint16_t id) {
+    _zp_raweth_mapping_pos_intmap_remove(&index->_cache, id);
+}
+
+#endif  // Z_FEATURE_RAWETH_TRANSPORT == 1
@@ -31,14 +31,12 @@ z_result_t _zp_raweth_read(_z_transport_multicast_t *ztm, bool single_read) {
     z_result_t ret = _Z_RES_OK;
     _ZP_UNUSED(single_read);
 
-    _z_slice_t addr;
     _z_transport_message_t t_msg;
-    ret = _z_raweth_recv_t_msg(ztm, &t_msg, &addr);
+    ret = _z_raweth_recv_t_msg(ztm, &t_msg, &ztm->_zbuf_addr);
     if (ret == _Z_RES_OK) {
-        ret = _z_multicast_handle_transport_message(ztm, &t_msg, &addr);
+        ret = _z_multicast_handle_transport_message(ztm, &t_msg, &ztm->_zbuf_addr);
         _z_t_msg_clear(&t_msg);
     }
-    _z_slice_clear(&addr);
     ret = _z_raweth_update_rx_buff(ztm);
     if (ret != _Z_RES_OK) {
         _Z_ERROR("Failed to allocate rx buffer");
@@ -57,33 +55,28 @@ _z_fut_fn_result_t _zp_raweth_read_task_fn(void *ztm_arg, _z_executor_t *executo
     }
 
     _z_transport_message_t t_msg;
-    _z_slice_t addr = _z_slice_alias_buf(NULL, 0);
 
     // Read message from link
-    z_result_t ret = _z_raweth_recv_t_msg(ztm, &t_msg, &addr);
+    z_result_t ret = _z_raweth_recv_t_msg(ztm, &t_msg, &ztm->_zbuf_addr);
     switch (ret) {
         case _Z_RES_OK:
             // Process message
             break;
         case _Z_ERR_TRANSPORT_RX_FAILED:
             // Drop message
-            _z_slice_clear(&addr);
             return _z_fut_fn_result_continue();
         default:
             // Drop message & stop task
             _Z_ERROR("Connection closed due to malformed message: %d", ret);
-            _z_slice_clear(&addr);
             return _z_fut_fn_result_ready();
     }
     // Process message
-    ret = _z_multicast_handle_transport_message(ztm, &t_msg, &addr);
+    ret = _z_multicast_handle_transport_message(ztm, &t_msg, &ztm->_zbuf_addr);
     if (ret != _Z_RES_OK) {
         _Z_ERROR("Connection closed due to message processing error: %d", ret);
-        _z_slice_clear(&addr);
         return _z_fut_fn_result_ready();
     }
     _z_t_msg_clear(&t_msg);
-    _z_slice_clear(&addr);
     if (_z_raweth_update_rx_buff(ztm) != _Z_RES_OK) {
         _Z_ERROR("Connection closed due to lack of memory to allocate rx buffer");
         return _z_fut_fn_result_ready();
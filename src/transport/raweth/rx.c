@@ -30,8 +30,14 @@
 
 static size_t _z_raweth_link_recv_zbuf(const _z_link_t *link, _z_zbuf_t *zbf, _z_slice_t *addr) {
     uint8_t *buff = _z_zbuf_get_wptr(zbf);
-    size_t rb = _z_receive_raweth(&link->_socket._raweth._sock, buff, _z_zbuf_space_left(zbf), addr,
-                                  &link->_socket._raweth._whitelist);
+    const _z_raweth_socket_t *resocket = &link->_socket._raweth;
+    size_t rb = SIZE_MAX;
+    if (resocket->_ring != NULL) {
+        rb = _z_raweth_ring_receive(resocket->_ring, &resocket->_sock, buff, _z_zbuf_space_left(zbf), addr,
+                                    &resocket->_whitelist);
+    } else {
+        rb = _z_receive_raweth(&resocket->_sock, buff, _z_zbuf_space_left(zbf), addr, &resocket->_whitelist);
+    }
     // Check validity
     if ((rb == SIZE_MAX) || (rb < sizeof(_zp_eth_header_t))) {
         return SIZE_MAX;
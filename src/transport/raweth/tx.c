@@ -26,60 +26,155 @@
 #include "zenoh-pico/protocol/codec/transport.h"
 #include "zenoh-pico/protocol/iobuf.h"
 #include "zenoh-pico/session/keyexpr.h"
+#include "zenoh-pico/session/resource.h"
 #include "zenoh-pico/transport/multicast/transport.h"
+#include "zenoh-pico/transport/raweth/mapping.h"
 #include "zenoh-pico/transport/transport.h"
 #include "zenoh-pico/transport/utils.h"
 #include "zenoh-pico/utils/logging.h"
 
 #if Z_FEATURE_RAWETH_TRANSPORT == 1
 
-static int _zp_raweth_find_map_entry(const _z_keyexpr_t *keyexpr, _z_raweth_socket_t *sock) {
+static size_t _zp_raweth_find_key_entry(const _z_keyexpr_t *keyexpr, const _z_raweth_socket_t *sock) {
+    if (sock->_mapping_index != NULL) {
+        return _zp_raweth_mapping_index_find(sock->_mapping_index, &sock->_mapping, keyexpr);
+    }
     for (size_t i = 0; i < _zp_raweth_mapping_array_len(&sock->_mapping); i++) {
         // Find matching keyexpr
         const _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(&sock->_mapping, i);
-        _z_keyexpr_t entry_ke = _z_keyexpr_alias_from_string(&entry->_keyexpr);
-        if (!z_keyexpr_intersects(keyexpr, &entry_ke)) {
+        if (_z_string_len(&entry->_keyexpr) == 0) {
             continue;
         }
-        return (int)i;
+        _z_keyexpr_t entry_ke = _z_keyexpr_alias_from_string(&entry->_keyexpr);
+        if (_z_keyexpr_intersects(keyexpr, &entry_ke)) {
+            return i;
+        }
     }
-    return -1;
+    return SIZE_MAX;
 }
 
-static z_result_t _zp_raweth_set_socket(const _z_keyexpr_t *keyexpr, _z_raweth_socket_t *sock) {
-    z_result_t ret = _Z_RES_OK;
+static size_t _zp_raweth_find_map_entry(_z_session_t *zn, const _z_wireexpr_t *expr, _z_raweth_socket_t *sock) {
+    // The entry of a key expression declared by the session is looked up once
+    bool is_cached = (sock->_mapping_index != NULL) && _z_wireexpr_is_local(expr) &&
+                     (expr->_id != Z_RESOURCE_ID_NONE) && !_z_wireexpr_has_suffix(expr);
+    size_t idx = SIZE_MAX;
+    if (is_cached && _zp_raweth_mapping_index_cache_get(sock->_mapping_index, expr->_id, &idx)) {
+        return idx;
+    }
+    if (!_z_wireexpr_is_local(expr) && (expr->_id != Z_RESOURCE_ID_NONE)) {
+        _Z_DEBUG("Key declared by a remote node, sending to default address");
+        return 0;
+    }
+    _z_keyexpr_t keyexpr;
+    if (_z_get_keyexpr_from_wireexpr(zn, &keyexpr, expr, NULL, true) != _Z_RES_OK) {
+        _Z_DEBUG("Unknown key id %u, sending to default address", (unsigned int)expr->_id);
+        return 0;
+    }
+    idx = _zp_raweth_find_key_entry(&keyexpr, sock);
+    // Key not found case
+    if (idx == SIZE_MAX) {
+        idx = 0;
+        _Z_DEBUG("Key '%.*s' wasn't found in config mapping, sending to default address",
+                 (int)_z_string_len(&keyexpr._keyexpr), _z_string_data(&keyexpr._keyexpr));
+    }
+    _z_keyexpr_clear(&keyexpr);
+    if (is_cached) {
+        _zp_raweth_mapping_index_cache_insert(sock->_mapping_index, expr->_id, idx);
+    }
+    return idx;
+}
 
+static const _zp_raweth_mapping_entry_t *_zp_raweth_get_map_entry(_z_session_t *zn, const _z_wireexpr_t *expr,
+                                                                   _z_raweth_socket_t *sock) {
     if (_zp_raweth_mapping_array_len(&sock->_mapping) < 1) {
+        return NULL;
+    }
+    size_t idx = 0;  // Default entry
+    if (expr != NULL) {
+        idx = _zp_raweth_find_map_entry(zn, expr, sock);
+    }
+    return _zp_raweth_mapping_array_get(&sock->_mapping, idx);
+}
+
+static void _zp_raweth_forget_map_entry(_z_raweth_socket_t *sock, const _z_network_message_t *n_msg) {
+    if ((sock->_mapping_index == NULL) || (n_msg->_tag != _Z_N_DECLARE)) {
+        return;
+    }
+    // Ids are reused by later declarations
+    const _z_declaration_t *decl = &n_msg->_body._declare._decl;
+    if (decl->_tag == _Z_DECL_KEXPR) {
+        _zp_raweth_mapping_index_cache_forget(sock->_mapping_index, decl->_body._decl_kexpr._id);
+    } else if (decl->_tag == _Z_UNDECL_KEXPR) {
+        _zp_raweth_mapping_index_cache_forget(sock->_mapping_index, decl->_body._undecl_kexpr._id);
+    }
+}
+
+static bool _zp_raweth_socket_targets(const _z_raweth_socket_t *sock, const _zp_raweth_mapping_entry_t *entry) {
+    if ((sock->_has_vlan != entry->_has_vlan) || (sock->_has_vlan && (sock->_vlan != entry->_vlan))) {
+        return false;
+    }
+    return memcmp(sock->_dmac, entry->_dmac, _ZP_MAC_ADDR_LENGTH) == 0;
+}
+
+static void _zp_raweth_set_socket_entry(_z_raweth_socket_t *sock, const _zp_raweth_mapping_entry_t *entry) {
+    // Flawfinder: ignore [CWE-120] - fixed-size MAC copy, both operands are _ZP_MAC_ADDR_LENGTH bytes.
+    memcpy(sock->_dmac, entry->_dmac, _ZP_MAC_ADDR_LENGTH);
+    sock->_has_vlan = entry->_has_vlan;
+    if (sock->_has_vlan) {
+        sock->_vlan = entry->_vlan;
+    }
+}
+
+static z_result_t _zp_raweth_set_socket(_z_raweth_socket_t *sock) {
+    // Session messages are sent to the default address
+    const _zp_raweth_mapping_entry_t *entry = _zp_raweth_get_map_entry(NULL, NULL, sock);
+    if (entry == NULL) {
         _Z_ERROR_RETURN(_Z_ERR_GENERIC);
     }
-    if (keyexpr == NULL) {
-        // Store default value into socket
-        const _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(&sock->_mapping, 0);
-        // Flawfinder: ignore [CWE-120] - fixed-size MAC copy, both operands are _ZP_MAC_ADDR_LENGTH bytes.
-        memcpy(sock->_dmac, entry->_dmac, _ZP_MAC_ADDR_LENGTH);
-        sock->_has_vlan = entry->_has_vlan;
-        if (sock->_has_vlan) {
-            sock->_vlan = entry->_vlan;
-        }
-    } else {
-        // Find config entry (linear)
-        int idx = _zp_raweth_find_map_entry(keyexpr, sock);
-        // Key not found case
-        if (idx < 0) {
-            idx = 0;  // Set to default entry
-            _Z_DEBUG("Key '%.*s' wasn't found in config mapping, sending to default address",
-                     (int)_z_string_len(&keyexpr), _z_string_data(&keyexpr));
-        }
-        // Store data into socket
-        const _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(&sock->_mapping, (size_t)idx);
-        // Flawfinder: ignore [CWE-120] - fixed-size MAC copy, both operands are _ZP_MAC_ADDR_LENGTH bytes.
-        memcpy(sock->_dmac, entry->_dmac, _ZP_MAC_ADDR_LENGTH);
-        sock->_has_vlan = entry->_has_vlan;
-        if (sock->_has_vlan) {
-            sock->_vlan = entry->_vlan;
-        }
+    // Store data into socket
+    _zp_raweth_set_socket_entry(sock, entry);
+    return _Z_RES_OK;
+}
+
+static const _z_wireexpr_t *_zp_raweth_get_wireexpr(const _z_network_message_t *n_msg) {
+    switch (n_msg->_tag) {
+        case _Z_N_PUSH:
+            return &n_msg->_body._push._key;
+        case _Z_N_REQUEST:
+            return &n_msg->_body._request._key;
+        case _Z_N_RESPONSE:
+            return &n_msg->_body._response._key;
+        case _Z_N_RESPONSE_FINAL:
+        case _Z_N_DECLARE:
+        default:
+            return NULL;
     }
-    return ret;
+}
+
+static inline bool _z_raweth_tx_batch_active(const _z_transport_common_t *ztc) {
+#if Z_FEATURE_BATCHING == 1
+    return ztc->_batch_state == _Z_BATCHING_ACTIVE;
+#else
+    _ZP_UNUSED(ztc);
+    return false;
+#endif
+}
+
+static inline bool _z_raweth_tx_batch_has_data(const _z_transport_common_t *ztc) {
+#if Z_FEATURE_BATCHING == 1
+    return _z_raweth_tx_batch_active(ztc) && (ztc->_batch_count > 0);
+#else
+    _ZP_UNUSED(ztc);
+    return false;
+#endif
+}
+
+static inline bool _z_raweth_tx_batch_hold_mutex(void) {
+#if Z_FEATURE_BATCHING == 1
+    return _z_transport_batch_hold_tx_mutex();
+#else
+    return false;
+#endif
 }
 
 /**
@@ -153,13 +248,20 @@ static z_result_t __unsafe_z_raweth_write_header(_z_link_t *zl, _z_wbuf_t *wbf)
 
 static z_result_t _z_raweth_link_send_wbuf(const _z_link_t *zl, const _z_wbuf_t *wbf) {
     z_result_t ret = _Z_RES_OK;
+    const _z_raweth_socket_t *resocket = &zl->_socket._raweth;
     for (size_t i = 0; (i < _z_wbuf_len_iosli(wbf)) && (ret == _Z_RES_OK); i++) {
         _z_slice_t bs = _z_iosli_to_bytes(_z_wbuf_get_iosli(wbf, i));
         size_t n = bs.len;
 
         do {
             // Retrieve addr from config + vlan tag above (locator)
-            size_t wb = _z_send_raweth(&zl->_socket._raweth._sock, bs.start, n);  // Unix
+            size_t wb = SIZE_MAX;
+            if (resocket->_ring != NULL) {
+                // Queued until the next link flush
+                wb = _z_raweth_ring_send(resocket->_ring, &resocket->_sock, bs.start, n);
+            } else {
+                wb = _z_send_raweth(&resocket->_sock, bs.start, n);  // Unix
+            }
             if (wb == SIZE_MAX) {
                 _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_TX_FAILED);
             }
@@ -170,6 +272,32 @@ static z_result_t _z_raweth_link_send_wbuf(const _z_link_t *zl, const _z_wbuf_t
     return ret;
 }
 
+static z_result_t _z_raweth_link_flush(const _z_link_t *zl) {
+    const _z_raweth_socket_t *resocket = &zl->_socket._raweth;
+    if (resocket->_ring == NULL) {
+        return _Z_RES_OK;
+    }
+    return _z_raweth_ring_flush(resocket->_ring, &resocket->_sock);
+}
+
+/**
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztm->_mutex_inner
+ */
+static z_result_t __unsafe_z_raweth_send_frame(_z_transport_common_t *ztc) {
+    // Write the eth header
+    _Z_RETURN_IF_ERR(__unsafe_z_raweth_write_header(ztc->_link, &ztc->_wbuf));
+    // Send the wbuf on the socket
+    _Z_RETURN_IF_ERR(_z_raweth_link_send_wbuf(ztc->_link, &ztc->_wbuf));
+    // Mark the session that we have transmitted data
+    ztc->_transmitted = true;
+#if Z_FEATURE_BATCHING == 1
+    ztc->_batch_count = 0;
+#endif
+    return _Z_RES_OK;
+}
+
 z_result_t _z_raweth_link_send_t_msg(const _z_link_t *zl, const _z_transport_message_t *t_msg) {
     z_result_t ret = _Z_RES_OK;
 
@@ -184,7 +312,7 @@ z_result_t _z_raweth_link_send_t_msg(const _z_link_t *zl, const _z_transport_mes
     // Discard const qualifier
     _z_link_t *mzl = (_z_link_t *)zl;
     // Set socket info
-    _Z_RETURN_IF_ERR(_zp_raweth_set_socket(NULL, &mzl->_socket._raweth));
+    _Z_RETURN_IF_ERR(_zp_raweth_set_socket(&mzl->_socket._raweth));
     // Prepare buff
     __unsafe_z_raweth_prepare_header(mzl, &wbf);
     // Encode the session message
@@ -193,6 +321,9 @@ z_result_t _z_raweth_link_send_t_msg(const _z_link_t *zl, const _z_transport_mes
     _Z_RETURN_IF_ERR(__unsafe_z_raweth_write_header(mzl, &wbf));
     // Send the wbuf on the socket
     ret = _z_raweth_link_send_wbuf(zl, &wbf);
+    if (ret == _Z_RES_OK) {
+        ret = _z_raweth_link_flush(zl);
+    }
     _z_wbuf_clear(&wbf);
 
     return ret;
@@ -203,25 +334,128 @@ z_result_t _z_raweth_send_t_msg(_z_transport_common_t *ztc, const _z_transport_m
     _Z_DEBUG(">> send session message");
 
     _z_transport_tx_mutex_lock(ztc, true);
+    // Send the pending batch first
+    if (_z_raweth_tx_batch_has_data(ztc)) {
+        _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_send_frame(ztc), _z_transport_tx_mutex_unlock(ztc));
+    }
     // Reset wbuf
     _z_wbuf_reset(&ztc->_wbuf);
     // Set socket info
-    _Z_CLEAN_RETURN_IF_ERR(_zp_raweth_set_socket(NULL, &ztc->_link->_socket._raweth),
+    _Z_CLEAN_RETURN_IF_ERR(_zp_raweth_set_socket(&ztc->_link->_socket._raweth),
                            _z_transport_tx_mutex_unlock(ztc));
     // Prepare buff
     __unsafe_z_raweth_prepare_header(ztc->_link, &ztc->_wbuf);
     // Encode the session message
     _Z_CLEAN_RETURN_IF_ERR(_z_transport_message_encode(&ztc->_wbuf, t_msg), _z_transport_tx_mutex_unlock(ztc));
-    // Write the message header
-    _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_write_header(ztc->_link, &ztc->_wbuf), _z_transport_tx_mutex_unlock(ztc));
-    // Send the wbuf on the socket
-    _Z_CLEAN_RETURN_IF_ERR(_z_raweth_link_send_wbuf(ztc->_link, &ztc->_wbuf), _z_transport_tx_mutex_unlock(ztc));
-    // Mark the session that we have transmitted data
-    ztc->_transmitted = true;
+    // Send the frame, along with the frames queued by the batch
+    _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_send_frame(ztc), _z_transport_tx_mutex_unlock(ztc));
+    ret = _z_raweth_link_flush(ztc->_link);
     _z_transport_tx_mutex_unlock(ztc);
     return ret;
 }
 
+/**
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztm->_mutex_inner
+ */
+static z_result_t __unsafe_z_raweth_send_fragments(_z_transport_multicast_t *ztm, const _z_network_message_t *n_msg,
+                                                   z_reliability_t reliability) {
+#if Z_FEATURE_FRAGMENTATION == 1
+    // Create an expandable wbuf for fragmentation
+    _z_wbuf_t fbf = _z_wbuf_make(_Z_FRAG_BUFF_BASE_SIZE, true);
+    if (_z_wbuf_capacity(&fbf) != _Z_FRAG_BUFF_BASE_SIZE) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    // Encode the message on the expandable wbuf
+    _Z_CLEAN_RETURN_IF_ERR(_z_network_message_encode(&fbf, n_msg), _z_wbuf_clear(&fbf));
+    // Fragment and send the message
+    bool is_first = true;
+    _z_zint_t sn = 0;
+    while (_z_wbuf_len(&fbf) > 0) {
+        if (is_first) {
+            // Get the fragment sequence number
+            sn = __unsafe_z_raweth_get_sn(ztm, reliability);
+        }
+        // Reset wbuf
+        _z_wbuf_reset(&ztm->_common._wbuf);
+        // Prepare buff
+        __unsafe_z_raweth_prepare_header(ztm->_common._link, &ztm->_common._wbuf);
+        // Serialize one fragment
+        _Z_CLEAN_RETURN_IF_ERR(
+            __unsafe_z_serialize_zenoh_fragment(&ztm->_common._wbuf, &fbf, reliability, sn, is_first),
+            _z_wbuf_clear(&fbf));
+        // Queue the fragment, they are all sent by the next link flush
+        _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_send_frame(&ztm->_common), _z_wbuf_clear(&fbf));
+        is_first = false;
+    }
+    // Clear the expandable buffer
+    _z_wbuf_clear(&fbf);
+#else
+    _ZP_UNUSED(ztm);
+    _ZP_UNUSED(n_msg);
+    _ZP_UNUSED(reliability);
+    _Z_INFO("Sending the message required fragmentation feature that is deactivated.");
+#endif
+    return _Z_RES_OK;
+}
+
+/**
+ * This function is unsafe because it operates in potentially concurrent data.
+ * Make sure that the following mutexes are locked before calling this function:
+ *  - ztm->_mutex_inner
+ */
+static z_result_t __unsafe_z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg,
+                                               z_reliability_t reliability) {
+    _z_transport_multicast_t *ztm = &zn->_tp._transport._raweth;
+    _z_transport_common_t *ztc = &ztm->_common;
+    _z_raweth_socket_t *resocket = &ztc->_link->_socket._raweth;
+    _zp_raweth_forget_map_entry(resocket, n_msg);
+    const _zp_raweth_mapping_entry_t *entry = _zp_raweth_get_map_entry(zn, _zp_raweth_get_wireexpr(n_msg), resocket);
+    if (entry == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    bool batch_has_data = _z_raweth_tx_batch_has_data(ztc);
+    if (batch_has_data && !_zp_raweth_socket_targets(resocket, entry)) {
+        // The pending batch goes to another address
+        _Z_RETURN_IF_ERR(__unsafe_z_raweth_send_frame(ztc));
+        batch_has_data = false;
+    }
+    if (!batch_has_data) {
+        // Reset wbuf
+        _z_wbuf_reset(&ztc->_wbuf);
+        // Set socket info
+        _zp_raweth_set_socket_entry(resocket, entry);
+        // Prepare buff
+        __unsafe_z_raweth_prepare_header(ztc->_link, &ztc->_wbuf);
+        // Set the frame header
+        _z_zint_t sn = __unsafe_z_raweth_get_sn(ztm, reliability);
+        _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
+        // Encode the frame header
+        _Z_RETURN_IF_ERR(_z_transport_message_encode(&ztc->_wbuf, &t_msg));
+    }
+    // Encode the network message
+    size_t prev_wpos = _z_wbuf_get_wpos(&ztc->_wbuf);
+    if (_z_network_message_encode(&ztc->_wbuf, n_msg) == _Z_RES_OK) {
+        if (_z_raweth_tx_batch_active(ztc) && !_z_transport_tx_get_express_status(n_msg)) {
+            // Wait for more messages to the same address
+#if Z_FEATURE_BATCHING == 1
+            ztc->_batch_count++;
+#endif
+            return _Z_RES_OK;
+        }
+        return __unsafe_z_raweth_send_frame(ztc);
+    } else if (batch_has_data) {
+        // The batch is too full for the message, send it and start a new one
+        _z_wbuf_set_wpos(&ztc->_wbuf, prev_wpos);
+        _Z_RETURN_IF_ERR(__unsafe_z_raweth_send_frame(ztc));
+        return __unsafe_z_raweth_send_n_msg(zn, n_msg, reliability);
+    } else {
+        // The message does not fit in a frame, let's fragment it
+        return __unsafe_z_raweth_send_fragments(ztm, n_msg, reliability);
+    }
+}
+
 z_result_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_msg, z_reliability_t reliability,
                                 z_congestion_control_t cong_ctrl) {
     z_result_t ret = _Z_RES_OK;
@@ -229,94 +463,54 @@ z_result_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_
     _Z_DEBUG(">> send network message");
 
     // Acquire the lock and drop the message if needed
-    ret = _z_transport_tx_mutex_lock(&ztm->_common, cong_ctrl == Z_CONGESTION_CONTROL_BLOCK);
+    if (!_z_raweth_tx_batch_hold_mutex()) {
+        ret = _z_transport_tx_mutex_lock(&ztm->_common, cong_ctrl == Z_CONGESTION_CONTROL_BLOCK);
+    }
     if (ret != _Z_RES_OK) {
         _Z_INFO("Dropping zenoh message because of congestion control");
         return ret;
     }
-    const _z_keyexpr_t *keyexpr = NULL;
-    switch (n_msg->_tag) {
-        case _Z_N_PUSH:
-            keyexpr = &n_msg->_body._push._key;
-            break;
-        case _Z_N_REQUEST:
-            keyexpr = &n_msg->_body._request._key;
-            break;
-        case _Z_N_RESPONSE:
-            keyexpr = &n_msg->_body._response._key;
-            break;
-        case _Z_N_RESPONSE_FINAL:
-        case _Z_N_DECLARE:
-        default:
-            break;
+    ret = __unsafe_z_raweth_send_n_msg(zn, n_msg, reliability);
+    // Frames of a batch are sent together once it is flushed
+    if ((ret == _Z_RES_OK) && !_z_raweth_tx_batch_has_data(&ztm->_common)) {
+        ret = _z_raweth_link_flush(ztm->_common._link);
     }
-    // Reset wbuf
-    _z_wbuf_reset(&ztm->_common._wbuf);
-    // Set socket info
-    _Z_CLEAN_RETURN_IF_ERR(_zp_raweth_set_socket(keyexpr, &ztm->_common._link->_socket._raweth),
-                           _z_transport_tx_mutex_unlock(&ztm->_common));
-    // Prepare buff
-    __unsafe_z_raweth_prepare_header(ztm->_common._link, &ztm->_common._wbuf);
-    // Set the frame header
-    _z_zint_t sn = __unsafe_z_raweth_get_sn(ztm, reliability);
-    _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, reliability);
-    // Encode the frame header
-    _Z_CLEAN_RETURN_IF_ERR(_z_transport_message_encode(&ztm->_common._wbuf, &t_msg),
-                           _z_transport_tx_mutex_unlock(&ztm->_common));
-    // Encode the network message
-    if (_z_network_message_encode(&ztm->_common._wbuf, n_msg) == _Z_RES_OK) {
-        // Write the eth header
-        _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_write_header(ztm->_common._link, &ztm->_common._wbuf),
-                               _z_transport_tx_mutex_unlock(&ztm->_common));
-        // Send the wbuf on the socket
-        _Z_CLEAN_RETURN_IF_ERR(_z_raweth_link_send_wbuf(ztm->_common._link, &ztm->_common._wbuf),
-                               _z_transport_tx_mutex_unlock(&ztm->_common));
-        // Mark the session that we have transmitted data
-        ztm->_common._transmitted = true;
-    } else {  // The message does not fit in the current batch, let's fragment it
-#if Z_FEATURE_FRAGMENTATION == 1
-        // Create an expandable wbuf for fragmentation
-        _z_wbuf_t fbf = _z_wbuf_make(_Z_FRAG_BUFF_BASE_SIZE, true);
-        if (_z_wbuf_capacity(&fbf) != _Z_FRAG_BUFF_BASE_SIZE) {
-            _Z_ERROR_LOG(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
-            _z_transport_tx_mutex_unlock(&ztm->_common);
-            return _Z_ERR_SYSTEM_OUT_OF_MEMORY;
+    if (!_z_raweth_tx_batch_hold_mutex()) {
+        _z_transport_tx_mutex_unlock(&ztm->_common);
+    }
+    return ret;
+}
+
+z_result_t _z_raweth_send_n_batch(_z_session_t *zn, z_congestion_control_t cong_ctrl) {
+#if Z_FEATURE_BATCHING == 1
+    z_result_t ret = _Z_RES_OK;
+    _z_transport_common_t *ztc = &zn->_tp._transport._raweth._common;
+    // Check batch size
+    if (ztc->_batch_count > 0) {
+        // Acquire the lock and drop the message if needed
+        if (!_z_raweth_tx_batch_hold_mutex()) {
+            ret = _z_transport_tx_mutex_lock(ztc, cong_ctrl == Z_CONGESTION_CONTROL_BLOCK);
         }
-        // Encode the message on the expandable wbuf
-        _Z_CLEAN_RETURN_IF_ERR(_z_network_message_encode(&fbf, n_msg), _z_transport_tx_mutex_unlock(&ztm->_common));
-        // Fragment and send the message
-        bool is_first = true;
-        while (_z_wbuf_len(&fbf) > 0) {
-            if (is_first) {
-                // Get the fragment sequence number
-                sn = __unsafe_z_raweth_get_sn(ztm, reliability);
-            }
-            // Reset wbuf
-            _z_wbuf_reset(&ztm->_common._wbuf);
-            // Prepare buff
-            __unsafe_z_raweth_prepare_header(ztm->_common._link, &ztm->_common._wbuf);
-            // Serialize one fragment
-            _Z_CLEAN_RETURN_IF_ERR(
-                __unsafe_z_serialize_zenoh_fragment(&ztm->_common._wbuf, &fbf, reliability, sn, is_first),
-                _z_transport_tx_mutex_unlock(&ztm->_common));
-            // Write the eth header
-            _Z_CLEAN_RETURN_IF_ERR(__unsafe_z_raweth_write_header(ztm->_common._link, &ztm->_common._wbuf),
-                                   _z_transport_tx_mutex_unlock(&ztm->_common));
-            // Send the wbuf on the socket
-            _Z_CLEAN_RETURN_IF_ERR(_z_raweth_link_send_wbuf(ztm->_common._link, &ztm->_common._wbuf),
-                                   _z_transport_tx_mutex_unlock(&ztm->_common));
-            // Mark the session that we have transmitted data
-            ztm->_common._transmitted = true;
-            is_first = false;
+        if (ret != _Z_RES_OK) {
+            _Z_INFO("Dropping zenoh batch because of congestion control");
+            return ret;
+        }
+        // Send batch
+        _Z_DEBUG("Send network batch");
+        ret = __unsafe_z_raweth_send_frame(ztc);
+        if (ret == _Z_RES_OK) {
+            ret = _z_raweth_link_flush(ztc->_link);
+        }
+        if (!_z_raweth_tx_batch_hold_mutex()) {
+            _z_transport_tx_mutex_unlock(ztc);
         }
-        // Clear the expandable buffer
-        _z_wbuf_clear(&fbf);
-#else
-        _Z_INFO("Sending the message required fragmentation feature that is deactivated.");
-#endif
     }
-    _z_transport_tx_mutex_unlock(&ztm->_common);
     return ret;
+#else
+    _ZP_UNUSED(zn);
+    _ZP_UNUSED(cong_ctrl);
+    return _Z_RES_OK;
+#endif
 }
 
 #else
@@ -339,4 +533,10 @@ z_result_t _z_raweth_send_n_msg(_z_session_t *zn, const _z_network_message_t *n_
     _ZP_UNUSED(cong_ctrl);
     _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_NOT_AVAILABLE);
 }
+
+z_result_t _z_raweth_send_n_batch(_z_session_t *zn, z_congestion_control_t cong_ctrl) {
+    _ZP_UNUSED(zn);
+    _ZP_UNUSED(cong_ctrl);
+    _Z_ERROR_RETURN(_Z_ERR_TRANSPORT_NOT_AVAILABLE);
+}
 #endif  // Z_FEATURE_RAWETH_TRANSPORT == 1
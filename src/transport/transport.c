@@ -30,6 +30,19 @@ size_t _z_transport_get_peers_count(_z_transport_t *zt) {
     switch (zt->_type) {
         case _Z_TRANSPORT_UNICAST_TYPE:
             _z_transport_peer_mutex_lock(&zt->_transport._unicast._common);
+#if Z_FEATURE_UNICAST_PEER == 1
+            if (zt->_transport._unicast._common._striping != _Z_STRIPING_NONE) {
+                // Requests only go through one of the links to each remote peer
+                _z_transport_peer_unicast_slist_t *it = zt->_transport._unicast._peers;
+                for (; it != NULL; it = _z_transport_peer_unicast_slist_next(it)) {
+                    if (_z_transport_peer_unicast_slist_value(it)->_link_idx == 0) {
+                        count++;
+                    }
+                }
+                _z_transport_peer_mutex_unlock(&zt->_transport._unicast._common);
+                return count;
+            }
+#endif
             count = _z_transport_peer_unicast_slist_len(zt->_transport._unicast._peers);
             _z_transport_peer_mutex_unlock(&zt->_transport._unicast._common);
             return count;
@@ -115,7 +128,7 @@ z_result_t _z_transport_start_batching(_z_transport_t *zt) {
     if (ztc->_batch_state == _Z_BATCHING_ACTIVE) {
         return _Z_ERR_GENERIC;
     }
-    ztc->_batch_count = 0;
+    // The count is left to the tx path: messages batched by a concurrent send are still pending
     ztc->_batch_state = _Z_BATCHING_ACTIVE;
 
 #if Z_FEATURE_BATCH_TX_MUTEX == 1
@@ -15,6 +15,9 @@
 #if Z_FEATURE_LINK_TLS == 1
 #include "zenoh-pico/link/transport/tls_stream.h"
 #endif
+#if Z_FEATURE_LINK_SHM == 1
+#include "zenoh-pico/link/transport/shm.h"
+#endif
 #include "zenoh-pico/runtime/runtime.h"
 #include "zenoh-pico/session/interest.h"
 #include "zenoh-pico/session/liveliness.h"
@@ -27,7 +30,7 @@
 #include "zenoh-pico/utils/logging.h"
 
 #if Z_FEATURE_UNICAST_TRANSPORT == 1 && Z_FEATURE_UNICAST_PEER == 1 && \
-    (Z_FEATURE_LINK_TCP == 1 || Z_FEATURE_LINK_TLS == 1)
+    (Z_FEATURE_LINK_TCP == 1 || Z_FEATURE_LINK_TLS == 1 || Z_FEATURE_LINK_UNIXSOCK == 1)
 #if Z_FEATURE_CONNECTIVITY == 1
 static void _zp_unicast_dispatch_connected_event(_z_transport_unicast_t *ztu, const _z_transport_peer_unicast_t *peer) {
     if (ztu == NULL || peer == NULL) {
@@ -73,7 +76,20 @@ _z_fut_fn_result_t _zp_unicast_accept_task_fn(void *ctx, _z_executor_t *executor
 
     _z_sys_net_socket_t listen_socket = *socket_ptr;
     _z_sys_net_socket_t con_socket = {0};
-    z_result_t ret = _z_tcp_accept(&listen_socket, &con_socket);
+    z_result_t ret;
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+    if (ztu->_common._link->_type == _Z_LINK_TYPE_UNIXSOCK) {
+        ret = _z_unixsock_stream_accept(&listen_socket, &con_socket);
+    } else
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        if (ztu->_common._link->_type == _Z_LINK_TYPE_SHM) {
+        ret = _z_shm_accept(&listen_socket, &con_socket);
+    } else
+#endif
+    {
+        ret = _z_tcp_accept(&listen_socket, &con_socket);
+    }
     if (ret != _Z_RES_OK) {
         if (ret == _Z_ERR_INVALID) {
             _Z_INFO("Accept socket was closed");
@@ -86,6 +102,9 @@ _z_fut_fn_result_t _zp_unicast_accept_task_fn(void *ctx, _z_executor_t *executor
         _Z_INFO("Refusing connection as max connections currently reached");
 #if Z_FEATURE_LINK_TLS == 1
         _z_close_tls_socket(&con_socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        _z_close_shm_socket(&con_socket);
 #endif
         _z_socket_close(&con_socket);
         return _z_fut_fn_result_wake_up_after(1000);
@@ -96,6 +115,9 @@ _z_fut_fn_result_t _zp_unicast_accept_task_fn(void *ctx, _z_executor_t *executor
         _Z_INFO("Failed to set socket blocking with error %d", ret);
 #if Z_FEATURE_LINK_TLS == 1
         _z_close_tls_socket(&con_socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        _z_close_shm_socket(&con_socket);
 #endif
         _z_socket_close(&con_socket);
         return _z_fut_fn_result_continue();
@@ -121,6 +143,9 @@ _z_fut_fn_result_t _zp_unicast_accept_task_fn(void *ctx, _z_executor_t *executor
         _Z_INFO("Connection accept handshake failed with error %d", ret);
 #if Z_FEATURE_LINK_TLS == 1
         _z_close_tls_socket(&con_socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        _z_close_shm_socket(&con_socket);
 #endif
         _z_socket_close(&con_socket);
         return _z_fut_fn_result_continue();
@@ -130,6 +155,9 @@ _z_fut_fn_result_t _zp_unicast_accept_task_fn(void *ctx, _z_executor_t *executor
         _Z_INFO("Failed to set socket non blocking");
 #if Z_FEATURE_LINK_TLS == 1
         _z_close_tls_socket(&con_socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        _z_close_shm_socket(&con_socket);
 #endif
         _z_socket_close(&con_socket);
         return _z_fut_fn_result_continue();
@@ -140,6 +168,9 @@ _z_fut_fn_result_t _zp_unicast_accept_task_fn(void *ctx, _z_executor_t *executor
     if (ret != _Z_RES_OK) {
 #if Z_FEATURE_LINK_TLS == 1
         _z_close_tls_socket(&con_socket);
+#endif
+#if Z_FEATURE_LINK_SHM == 1
+        _z_close_shm_socket(&con_socket);
 #endif
         _z_socket_close(&con_socket);
         return _z_fut_fn_result_continue();
@@ -155,6 +155,7 @@ _z_fut_fn_result_t _zp_unicast_lease_task_fn(void *ztu_arg, _z_executor_t *execu
         _z_transport_peer_mutex_lock(&ztu->_common);
         ztu->_peers = _z_transport_peer_unicast_slist_extract_all_filter(ztu->_peers, &dropped_peers,
                                                                          _zp_unicast_peer_is_expired, NULL);
+        _z_transport_peer_unicast_group_links(ztu->_peers);
         _z_transport_peer_unicast_slist_t *curr_list = ztu->_peers;
         while (curr_list != NULL) {
             _z_transport_peer_unicast_t *curr_peer = _z_transport_peer_unicast_slist_value(curr_list);
@@ -46,6 +46,13 @@ static z_result_t _z_unicast_process_messages(_z_transport_unicast_t *ztu, _z_tr
     } else {
         zbuf = _z_zbuf_view(&ztu->_common._zbuf, to_read);
     }
+#if Z_FEATURE_COMPRESSION == 1
+    z_result_t dret = _z_transport_rx_decompress_batch(&ztu->_common, &zbuf);
+    if (dret != _Z_RES_OK) {
+        _Z_INFO("Connection compromised due to malformed compressed batch: %d", dret);
+        return dret;
+    }
+#endif
 
     peer->common._received = true;
     while (_z_zbuf_len(&zbuf) > 0) {
@@ -357,6 +364,7 @@ static z_result_t _zp_unicast_process_peer_event(_z_transport_unicast_t *ztu) {
 #endif
             _z_interest_peer_disconnected(zs, &curr_peer->common);
             ztu->_peers = _z_transport_peer_unicast_slist_drop_element(ztu->_peers, prev_drop);
+            _z_transport_peer_unicast_group_links(ztu->_peers);
 #if Z_FEATURE_CONNECTIVITY == 1
             _z_transport_peer_mutex_unlock(&ztu->_common);
             _z_connectivity_peer_disconnected(zs, &disconnected_peer, false, mtu, is_streamed, is_reliable);
@@ -81,14 +81,27 @@ z_result_t _z_unicast_recv_t_msg(_z_transport_unicast_t *ztu, _z_transport_messa
 
         // Wrap the main buffer to_read bytes
         _z_zbuf_t zbuf = _z_zbuf_view(&ztu->_common._zbuf, to_read);
-        ret = _z_transport_message_decode(t_msg, &zbuf);
+        size_t consumed = 0;
+#if Z_FEATURE_COMPRESSION == 1
+        ret = _z_transport_rx_decompress_batch(&ztu->_common, &zbuf);
+        if (ztu->_common._compression != NULL) {
+            // The decoded message may come from the decompressed batch, the received one is consumed as a whole
+            consumed = to_read;
+        }
+#endif
+        if (ret == _Z_RES_OK) {
+            ret = _z_transport_message_decode(t_msg, &zbuf);
+        }
 
         if (ret == _Z_RES_OK) {
             // Mark the session that we have received data
             peer->common._received = true;
 
             // Update the actual buffer pointers
-            _z_zbuf_set_rpos(&ztu->_common._zbuf, _z_zbuf_get_rpos(&ztu->_common._zbuf) + _z_zbuf_get_rpos(&zbuf));
+            if (consumed == 0) {
+                consumed = _z_zbuf_get_rpos(&zbuf);
+            }
+            _z_zbuf_set_rpos(&ztu->_common._zbuf, _z_zbuf_get_rpos(&ztu->_common._zbuf) + consumed);
         } else {
             _Z_ERROR("Malformed transport message: %d", ret);
             _z_zbuf_set_rpos(&ztu->_common._zbuf, _z_zbuf_get_rpos(&ztu->_common._zbuf) + to_read);
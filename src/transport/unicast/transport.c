@@ -56,6 +56,15 @@ static z_result_t _z_unicast_transport_create_inner(_z_transport_unicast_t *ztu,
         _Z_ERROR("Not enough memory to allocate transport buffers!");
         _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
     }
+#if Z_FEATURE_COMPRESSION == 1
+    if (param->_compression) {
+        ztu->_common._compression = _z_transport_compression_new(zbuf_size);
+        if (ztu->_common._compression == NULL) {
+            _Z_ERROR("Not enough memory to allocate transport compression buffers!");
+            _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+        }
+    }
+#endif
     // Set default SN resolution
     ztu->_common._sn_res = _z_sn_max(param->_seq_num_res);
     // The initial SN at TX side
@@ -67,6 +76,11 @@ static z_result_t _z_unicast_transport_create_inner(_z_transport_unicast_t *ztu,
     ztu->_common._lease = param->_lease;
     // Transport link for unicast
     ztu->_common._link = zl;
+#if Z_FEATURE_UNICAST_PEER == 1
+    // Set by the peer mode from the session config
+    ztu->_common._striping = _Z_STRIPING_NONE;
+    ztu->_common._tx_lane = _Z_STRIPING_LANE_ALL;
+#endif
 
     ztu->_peers = _z_transport_peer_unicast_slist_new();
     ztu->_pending_peers = _z_pending_peers_null();
@@ -88,6 +102,9 @@ z_result_t _z_unicast_transport_create(_z_transport_t *zt, _z_link_t *zl,
 #endif
         _z_wbuf_clear(&ztu->_common._wbuf);
         _z_zbuf_clear(&ztu->_common._zbuf);
+#if Z_FEATURE_COMPRESSION == 1
+        _z_transport_compression_free(&ztu->_common._compression);
+#endif
     }
     return ret;
 }
@@ -101,6 +118,12 @@ static z_result_t _z_unicast_handshake_open(_z_transport_unicast_establish_param
     param->_seq_num_res = ism._body._init._seq_num_res;  // The announced sn resolution
     param->_req_id_res = ism._body._init._req_id_res;    // The announced req id resolution
     param->_batch_size = ism._body._init._batch_size;    // The announced batch size
+#if Z_FEATURE_COMPRESSION == 1
+    if (param->_compression) {
+        ism._body._init._compression = true;
+        _Z_SET_FLAG(ism._header, _Z_FLAG_T_Z);
+    }
+#endif
 
     // Encode and send the message
     _Z_DEBUG("Sending Z_INIT(Syn)");
@@ -147,6 +170,10 @@ static z_result_t _z_unicast_handshake_open(_z_transport_unicast_establish_param
         _Z_ERROR_LOG(_Z_ERR_GENERIC);
         ret = _Z_ERR_GENERIC;
     }
+#endif
+#if Z_FEATURE_COMPRESSION == 1
+    // Batches are only compressed if both sides asked for it
+    param->_compression = param->_compression && iam._body._init._compression;
 #endif
     if (ret != _Z_RES_OK) {
         _z_t_msg_clear(&iam);
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/utils/logging.h"
+
+#if Z_FEATURE_ASYNC_LOG == 1
+#include <stdarg.h>
+#include <string.h>
+
+#include "zenoh-pico/collections/atomic.h"
+#include "zenoh-pico/collections/mpmc_queue.h"
+#include "zenoh-pico/system/platform.h"
+
+#define _Z_LOG_TIMESTAMP_SIZE 64
+#define _Z_LOG_EOL "\r\n"
+#define _Z_LOG_EOL_LEN 2
+
+typedef struct {
+    size_t _len;
+    char _buf[Z_LOG_ASYNC_RECORD_SIZE];
+} _z_log_record_t;
+
+typedef struct {
+    _z_log_record_t *_records;
+    // Records free to be filled by the callers, and filled records waiting for the drain task
+    _z_mpmc_queue_t _free;
+    _z_mpmc_queue_t _ready;
+    _z_log_sink_f _sink;
+    void *_sink_arg;
+    _z_task_t _task;
+    _z_atomic_bool_t _running;
+    // Callers currently holding a record, waited for before releasing the ring
+    _z_atomic_size_t _writers;
+    _z_atomic_size_t _dropped;
+    size_t _reported;
+} _z_log_async_t;
+
+static _z_log_async_t _z_log_async = {0};
+
+static size_t _z_log_clamp(int n, size_t size) {
+    if (n < 0) {
+        return 0;
+    }
+    return ((size_t)n < size) ? (size_t)n : size - 1;
+}
+
+static size_t _z_log_vformat(char *buf, size_t size, const char *level, const char *func, bool newline,
+                             const char *fmt, va_list args) {
+    char timestamp[_Z_LOG_TIMESTAMP_SIZE];
+    z_time_now_as_str(timestamp, sizeof(timestamp));
+    size_t len = _z_log_clamp(snprintf(buf, size, "[%s %s ::%s] ", timestamp, level, func), size);
+    len += _z_log_clamp(vsnprintf(buf + len, size - len, fmt, args), size - len);
+    if (newline) {
+        // Truncated records still end the line
+        if (len + _Z_LOG_EOL_LEN >= size) {
+            len = size - _Z_LOG_EOL_LEN - 1;
+        }
+        memcpy(buf + len, _Z_LOG_EOL, _Z_LOG_EOL_LEN + 1);
+        len += _Z_LOG_EOL_LEN;
+    }
+    return len;
+}
+
+static void _z_log_sink_default(const char *record, size_t len, void *arg) {
+    _ZP_UNUSED(arg);
+    ZENOH_LOG_PRINT("%.*s", (int)len, record);
+}
+
+static void _z_log_sink_write(const char *record, size_t len) {
+    _z_log_async._sink(record, len, _z_log_async._sink_arg);
+}
+
+static size_t _z_log_drain(void) {
+    size_t n = 0;
+    _z_log_record_t *r = (_z_log_record_t *)_z_mpmc_queue_pull(&_z_log_async._ready);
+    while (r != NULL) {
+        _z_log_sink_write(r->_buf, r->_len);
+        _z_mpmc_queue_push(&_z_log_async._free, r);
+        n++;
+        r = (_z_log_record_t *)_z_mpmc_queue_pull(&_z_log_async._ready);
+    }
+    size_t dropped = _z_atomic_size_load(&_z_log_async._dropped, _z_memory_order_relaxed);
+    if (dropped != _z_log_async._reported) {
+        char buf[Z_LOG_ASYNC_RECORD_SIZE];
+        char timestamp[_Z_LOG_TIMESTAMP_SIZE];
+        z_time_now_as_str(timestamp, sizeof(timestamp));
+        size_t len = _z_log_clamp(snprintf(buf, sizeof(buf), "[%s WARN ::%s] Dropped %zu log records" _Z_LOG_EOL,
+                                           timestamp, __func__, dropped - _z_log_async._reported),
+                                  sizeof(buf));
+        _z_log_sink_write(buf, len);
+        _z_log_async._reported = dropped;
+    }
+    return n;
+}
+
+static void *_z_log_drain_task(void *arg) {
+    _ZP_UNUSED(arg);
+    while (_z_atomic_bool_load(&_z_log_async._running, _z_memory_order_acquire)) {
+        if (_z_log_drain() == 0) {
+            z_sleep_ms(Z_LOG_ASYNC_DRAIN_PERIOD);
+        }
+    }
+    return NULL;
+}
+
+static void _z_log_async_clear(void) {
+    _z_mpmc_queue_clear(&_z_log_async._free, _z_noop_free);
+    _z_mpmc_queue_clear(&_z_log_async._ready, _z_noop_free);
+    z_free(_z_log_async._records);
+    _z_log_async._records = NULL;
+}
+
+z_result_t _z_log_async_start(_z_log_sink_f sink, void *arg) {
+    if (_z_log_async._records != NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    _z_log_async._records = (_z_log_record_t *)z_malloc(Z_LOG_ASYNC_RING_SIZE * sizeof(_z_log_record_t));
+    if (_z_log_async._records == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_SYSTEM_OUT_OF_MEMORY);
+    }
+    z_result_t ret = _z_mpmc_queue_init(&_z_log_async._free, Z_LOG_ASYNC_RING_SIZE);
+    _Z_SET_IF_OK(ret, _z_mpmc_queue_init(&_z_log_async._ready, Z_LOG_ASYNC_RING_SIZE));
+    if (ret != _Z_RES_OK) {
+        _z_log_async_clear();
+        return ret;
+    }
+    for (size_t i = 0; i < Z_LOG_ASYNC_RING_SIZE; i++) {
+        _z_mpmc_queue_push(&_z_log_async._free, &_z_log_async._records[i]);
+    }
+    _z_log_async._sink = (sink != NULL) ? sink : _z_log_sink_default;
+    _z_log_async._sink_arg = arg;
+    _z_log_async._reported = 0;
+    _z_atomic_size_init(&_z_log_async._dropped, 0);
+    _z_atomic_size_init(&_z_log_async._writers, 0);
+    _z_atomic_bool_init(&_z_log_async._running, true);
+    ret = _z_task_init(&_z_log_async._task, NULL, _z_log_drain_task, NULL);
+    if (ret != _Z_RES_OK) {
+        _z_atomic_bool_store(&_z_log_async._running, false, _z_memory_order_seq_cst);
+        _z_log_async_clear();
+    }
+    return ret;
+}
+
+z_result_t _z_log_async_stop(void) {
+    if (_z_log_async._records == NULL) {
+        _Z_ERROR_RETURN(_Z_ERR_GENERIC);
+    }
+    _z_atomic_bool_store(&_z_log_async._running, false, _z_memory_order_seq_cst);
+    z_result_t ret = _z_task_join(&_z_log_async._task);
+    // Callers that saw the backend running may still be filling a record
+    while (_z_atomic_size_load(&_z_log_async._writers, _z_memory_order_seq_cst) != 0) {
+        z_sleep_ms(1);
+    }
+    _z_log_drain();
+    _z_log_async_clear();
+    return ret;
+}
+
+size_t _z_log_async_dropped(void) { return _z_atomic_size_load(&_z_log_async._dropped, _z_memory_order_relaxed); }
+
+void _z_log_write(const char *level, const char *func, bool newline, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    _z_atomic_size_fetch_add(&_z_log_async._writers, 1, _z_memory_order_seq_cst);
+    if (_z_atomic_bool_load(&_z_log_async._running, _z_memory_order_seq_cst)) {
+        _z_log_record_t *r = (_z_log_record_t *)_z_mpmc_queue_pull(&_z_log_async._free);
+        if (r != NULL) {
+            r->_len = _z_log_vformat(r->_buf, sizeof(r->_buf), level, func, newline, fmt, args);
+            _z_mpmc_queue_push(&_z_log_async._ready, r);
+        } else {
+            _z_atomic_size_fetch_add(&_z_log_async._dropped, 1, _z_memory_order_relaxed);
+        }
+        _z_atomic_size_fetch_sub(&_z_log_async._writers, 1, _z_memory_order_seq_cst);
+    } else {
+        _z_atomic_size_fetch_sub(&_z_log_async._writers, 1, _z_memory_order_seq_cst);
+        char buf[Z_LOG_ASYNC_RECORD_SIZE];
+        size_t len = _z_log_vformat(buf, sizeof(buf), level, func, newline, fmt, args);
+        _z_log_sink_default(buf, len, NULL);
+    }
+    va_end(args);
+}
+#endif
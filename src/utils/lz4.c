@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "zenoh-pico/utils/lz4.h"
+
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/utils/logging.h"
+
+#if Z_FEATURE_COMPRESSION == 1
+
+// A block is a list of sequences: a token holding the literals length and the match length in its high and low
+// nibbles, extra length bytes when a nibble is saturated, the literals, then the match as a 2-byte little-endian offset
+// back into the output. The last sequence only holds literals.
+#define _Z_LZ4_MIN_MATCH 4
+#define _Z_LZ4_LAST_LITERALS 5
+#define _Z_LZ4_MF_LIMIT 12
+#define _Z_LZ4_MAX_OFFSET 65535
+#define _Z_LZ4_NIBBLE_MAX 15
+
+static inline uint32_t _z_lz4_read32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t _z_lz4_hash(uint32_t v) { return (v * 2654435761U) >> (32 - _Z_LZ4_HASH_LOG); }
+
+static inline size_t _z_lz4_len_size(size_t len) {
+    return (len >= _Z_LZ4_NIBBLE_MAX) ? (len - _Z_LZ4_NIBBLE_MAX) / 255 + 1 : 0;
+}
+
+static inline uint8_t *_z_lz4_write_len(uint8_t *op, size_t len) {
+    if (len < _Z_LZ4_NIBBLE_MAX) {
+        return op;
+    }
+    len -= _Z_LZ4_NIBBLE_MAX;
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (uint8_t)len;
+    return op;
+}
+
+static inline uint8_t _z_lz4_nibble(size_t len) {
+    return (len < _Z_LZ4_NIBBLE_MAX) ? (uint8_t)len : (uint8_t)_Z_LZ4_NIBBLE_MAX;
+}
+
+size_t _z_lz4_compress(uint8_t *dst, size_t dst_cap, const uint8_t *src, size_t len, uint32_t *table) {
+    const uint8_t *ip = src;
+    const uint8_t *anchor = src;
+    const uint8_t *end = src + len;
+    uint8_t *op = dst;
+
+    // Matches must start at least _Z_LZ4_MF_LIMIT bytes and end at least _Z_LZ4_LAST_LITERALS bytes before the end
+    if (len > _Z_LZ4_MF_LIMIT) {
+        const uint8_t *mf_limit = end - _Z_LZ4_MF_LIMIT;
+        const uint8_t *match_limit = end - _Z_LZ4_LAST_LITERALS;
+        // Stale entries are rejected by comparing the bytes they point to
+        memset(table, 0, _Z_LZ4_TABLE_SIZE * sizeof(uint32_t));
+        while (ip < mf_limit) {
+            uint32_t seq = _z_lz4_read32(ip);
+            uint32_t h = _z_lz4_hash(seq);
+            const uint8_t *ref = src + table[h];
+            table[h] = (uint32_t)(ip - src);
+            if ((ref >= ip) || ((size_t)(ip - ref) > _Z_LZ4_MAX_OFFSET) || (_z_lz4_read32(ref) != seq)) {
+                ip++;
+                continue;
+            }
+            while ((ip > anchor) && (ref > src) && (ip[-1] == ref[-1])) {
+                ip--;
+                ref--;
+            }
+            const uint8_t *mp = ip + _Z_LZ4_MIN_MATCH;
+            const uint8_t *rp = ref + _Z_LZ4_MIN_MATCH;
+            while ((mp < match_limit) && (*mp == *rp)) {
+                mp++;
+                rp++;
+            }
+            size_t lit_len = (size_t)(ip - anchor);
+            size_t match_len = (size_t)(mp - ip) - _Z_LZ4_MIN_MATCH;
+            size_t need = 1 + _z_lz4_len_size(lit_len) + lit_len + 2 + _z_lz4_len_size(match_len);
+            if ((size_t)((dst + dst_cap) - op) < need) {
+                return 0;
+            }
+            uint8_t *token = op++;
+            *token = (uint8_t)(_z_lz4_nibble(lit_len) << 4 | _z_lz4_nibble(match_len));
+            op = _z_lz4_write_len(op, lit_len);
+            memcpy(op, anchor, lit_len);
+            op += lit_len;
+            size_t offset = (size_t)(ip - ref);
+            *op++ = (uint8_t)offset;
+            *op++ = (uint8_t)(offset >> 8);
+            op = _z_lz4_write_len(op, match_len);
+            // Index the end of the match, positions inside it are skipped
+            table[_z_lz4_hash(_z_lz4_read32(mp - 2))] = (uint32_t)(mp - 2 - src);
+            ip = mp;
+            anchor = mp;
+        }
+    }
+
+    size_t lit_len = (size_t)(end - anchor);
+    if ((size_t)((dst + dst_cap) - op) < 1 + _z_lz4_len_size(lit_len) + lit_len) {
+        return 0;
+    }
+    *op++ = (uint8_t)(_z_lz4_nibble(lit_len) << 4);
+    op = _z_lz4_write_len(op, lit_len);
+    if (lit_len > 0) {
+        memcpy(op, anchor, lit_len);
+        op += lit_len;
+    }
+    return (size_t)(op - dst);
+}
+
+static inline z_result_t _z_lz4_read_len(const uint8_t **ip, const uint8_t *iend, size_t *len) {
+    if (*len < _Z_LZ4_NIBBLE_MAX) {
+        return _Z_RES_OK;
+    }
+    uint8_t b;
+    do {
+        if (*ip >= iend) {
+            _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+        }
+        b = *(*ip)++;
+        *len += b;
+    } while (b == 255);
+    return _Z_RES_OK;
+}
+
+z_result_t _z_lz4_decompress(uint8_t *dst, size_t dst_cap, const uint8_t *src, size_t len, size_t *out_len) {
+    const uint8_t *ip = src;
+    const uint8_t *iend = src + len;
+    uint8_t *op = dst;
+    uint8_t *oend = dst + dst_cap;
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+        size_t lit_len = token >> 4;
+        _Z_RETURN_IF_ERR(_z_lz4_read_len(&ip, iend, &lit_len));
+        if ((lit_len > (size_t)(iend - ip)) || (lit_len > (size_t)(oend - op))) {
+            _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+        }
+        if (lit_len > 0) {
+            memcpy(op, ip, lit_len);
+            op += lit_len;
+            ip += lit_len;
+        }
+        if (ip == iend) {
+            break;
+        }
+        if ((size_t)(iend - ip) < 2) {
+            _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+        }
+        size_t offset = (size_t)ip[0] | (size_t)ip[1] << 8;
+        ip += 2;
+        size_t match_len = token & _Z_LZ4_NIBBLE_MAX;
+        _Z_RETURN_IF_ERR(_z_lz4_read_len(&ip, iend, &match_len));
+        match_len += _Z_LZ4_MIN_MATCH;
+        if ((offset == 0) || (offset > (size_t)(op - dst)) || (match_len > (size_t)(oend - op))) {
+            _Z_ERROR_RETURN(_Z_ERR_MESSAGE_DESERIALIZATION_FAILED);
+        }
+        const uint8_t *ref = op - offset;
+        if (offset >= match_len) {
+            memcpy(op, ref, match_len);
+            op += match_len;
+        } else {
+            // Overlapping match, repeats the last offset bytes
+            for (size_t i = 0; i < match_len; i++) {
+                *op++ = *ref++;
+            }
+        }
+    }
+    *out_len = (size_t)(op - dst);
+    return _Z_RES_OK;
+}
+
+#endif
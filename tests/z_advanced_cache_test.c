@@ -0,0 +1,340 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+#include "zenoh-pico/collections/advanced_cache.h"
+#include "zenoh-pico/session/keyexpr.h"
+#include "zenoh-pico/system/common/allocator.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_ADVANCED_PUBLICATION == 1 && Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_QUERY == 1 && \
+    Z_FEATURE_LINK_TCP == 1
+
+#define LOCATOR "tcp/127.0.0.1:7465"
+#define KEYEXPR "test/advanced_cache"
+#define PUT_CACHE_SIZE 8
+#define PUT_NB 64
+
+static _z_declared_keyexpr_t key;
+
+static void open_peer(z_owned_session_t *s, bool listen) {
+    z_owned_config_t config;
+    z_config_default(&config);
+    zp_config_insert(z_loan_mut(config), Z_CONFIG_MODE_KEY, Z_CONFIG_MODE_PEER);
+    zp_config_insert(z_loan_mut(config), listen ? Z_CONFIG_LISTEN_KEY : Z_CONFIG_CONNECT_KEY, LOCATOR);
+    assert(z_open(s, z_move(config), NULL) == Z_OK);
+    assert(zp_start_read_task(z_loan_mut(*s), NULL) == Z_OK);
+    assert(zp_start_lease_task(z_loan_mut(*s), NULL) == Z_OK);
+}
+
+static _ze_advanced_cache_t *new_cache(const z_owned_session_t *s, size_t capacity) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, KEYEXPR);
+    ze_advanced_publisher_cache_options_t opts = {.is_enabled = true,
+                                                  .max_samples = capacity,
+                                                  .congestion_control = Z_CONGESTION_CONTROL_BLOCK,
+                                                  .priority = Z_PRIORITY_DATA,
+                                                  .is_express = false,
+                                                  ._liveliness = false};
+    _ze_advanced_cache_t *cache = _ze_advanced_cache_new(z_loan(*s), z_loan(ke), NULL, opts);
+    assert(cache != NULL);
+    return cache;
+}
+
+static void add_at(_ze_advanced_cache_t *cache, uint32_t sn, const _z_timestamp_t *timestamp) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u", (unsigned)sn);
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, buf);
+    _z_source_info_t info = _z_source_info_null();
+    info._source_id.zid.id[0] = 1;
+    info._source_sn = sn;
+    assert(_ze_advanced_cache_add(cache, &key, z_loan(payload), timestamp, NULL, Z_SAMPLE_KIND_PUT, _Z_N_QOS_DEFAULT,
+                                  NULL, Z_RELIABILITY_RELIABLE, &info) == _Z_RES_OK);
+    z_drop(z_move(payload));
+}
+
+static void add(_ze_advanced_cache_t *cache, uint32_t sn) { add_at(cache, sn, NULL); }
+
+static _z_ntp64_t now_ntp64(void) {
+    _z_time_since_epoch t;
+    assert(_z_get_time_since_epoch(&t) == _Z_RES_OK);
+    return _z_timestamp_ntp64_from_time(t.secs, t.nanos);
+}
+
+static _z_timestamp_t seconds_ago(_z_ntp64_t now, uint64_t secs) {
+    _z_timestamp_t ts = _z_timestamp_null();
+    ts.valid = true;
+    ts.time = now - (secs << 32);
+    return ts;
+}
+
+static size_t collect(_ze_advanced_cache_t *cache, const char *params, _z_ntp64_t now, uint32_t *sns, size_t max) {
+    _z_string_t str = _z_string_alias_str(params);
+    _z_sample_t *samples = NULL;
+    size_t count = 0;
+    assert(_ze_advanced_cache_collect(cache, &str, now, &samples, &count) == _Z_RES_OK);
+    assert(count <= max);
+    assert((count == 0) == (samples == NULL));
+    for (size_t i = 0; i < count; i++) {
+        sns[i] = samples[i].source_info._source_sn;
+        assert(_z_bytes_len(&samples[i].payload) > 0);
+        _z_sample_clear(&samples[i]);
+    }
+    if (samples != NULL) {
+        z_free(samples);
+    }
+    return count;
+}
+
+static void check(_ze_advanced_cache_t *cache, const char *params, _z_ntp64_t now, const uint32_t *expected,
+                  size_t expected_nb) {
+    uint32_t sns[16];
+    size_t count = collect(cache, params, now, sns, 16);
+    if (count != expected_nb) {
+        printf("  '%s': %zu samples, expected %zu\n", params, count, expected_nb);
+    }
+    assert(count == expected_nb);
+    for (size_t i = 0; i < count; i++) {
+        assert(sns[i] == expected[i]);
+    }
+}
+
+static void test_empty(const z_owned_session_t *s) {
+    printf("Test: an empty cache matches nothing\n");
+    _ze_advanced_cache_t *cache = new_cache(s, 4);
+    _z_ntp64_t now = now_ntp64();
+    check(cache, "", now, NULL, 0);
+    check(cache, "_sn=0..10", now, NULL, 0);
+    check(cache, "_max=3", now, NULL, 0);
+    check(cache, "_time=[now(-1s)..]", now, NULL, 0);
+    _ze_advanced_cache_free(&cache);
+}
+
+static void test_eviction(const z_owned_session_t *s) {
+    printf("Test: a full cache evicts its oldest samples\n");
+    _ze_advanced_cache_t *cache = new_cache(s, 4);
+    _z_ntp64_t now = now_ntp64();
+    for (uint32_t sn = 1; sn <= 6; sn++) {
+        add(cache, sn);
+    }
+    check(cache, "", now, (uint32_t[]){3, 4, 5, 6}, 4);
+    check(cache, "_sn=1..2", now, NULL, 0);
+    check(cache, "_sn=..3", now, (uint32_t[]){3}, 1);
+    check(cache, "_sn=2..4", now, (uint32_t[]){3, 4}, 2);
+    check(cache, "_sn=6..100", now, (uint32_t[]){6}, 1);
+    check(cache, "_sn=7..", now, NULL, 0);
+    check(cache, "_max=2", now, (uint32_t[]){5, 6}, 2);
+    // The slab wraps around several times
+    for (uint32_t sn = 7; sn <= 14; sn++) {
+        add(cache, sn);
+    }
+    check(cache, "", now, (uint32_t[]){11, 12, 13, 14}, 4);
+    check(cache, "_sn=12..13", now, (uint32_t[]){12, 13}, 2);
+    _ze_advanced_cache_free(&cache);
+}
+
+static void test_sn_wraparound(const z_owned_session_t *s) {
+    printf("Test: sequence numbers wrapping around within the cache\n");
+    _ze_advanced_cache_t *cache = new_cache(s, 4);
+    _z_ntp64_t now = now_ntp64();
+    add(cache, UINT32_MAX - 1);
+    add(cache, UINT32_MAX);
+    add(cache, 0);
+    add(cache, 1);
+    check(cache, "", now, (uint32_t[]){UINT32_MAX - 1, UINT32_MAX, 0, 1}, 4);
+    check(cache, "_sn=0..1", now, (uint32_t[]){0, 1}, 2);
+    check(cache, "_sn=4294967295..", now, (uint32_t[]){UINT32_MAX}, 1);
+    check(cache, "_sn=..0", now, (uint32_t[]){0}, 1);
+    check(cache, "_max=3", now, (uint32_t[]){UINT32_MAX, 0, 1}, 3);
+    // Late samples are put back in order across the wrap
+    add(cache, 3);
+    add(cache, 2);
+    check(cache, "", now, (uint32_t[]){0, 1, 2, 3}, 4);
+    check(cache, "_sn=2..2", now, (uint32_t[]){2}, 1);
+    _ze_advanced_cache_free(&cache);
+}
+
+static void test_range_between_entries(const z_owned_session_t *s) {
+    printf("Test: range bounds falling between cached samples\n");
+    _ze_advanced_cache_t *cache = new_cache(s, 8);
+    _z_ntp64_t now = now_ntp64();
+    for (uint32_t sn = 10; sn <= 40; sn += 10) {
+        _z_timestamp_t ts = seconds_ago(now, 50 - sn);
+        add_at(cache, sn, &ts);
+    }
+    check(cache, "_sn=15..35", now, (uint32_t[]){20, 30}, 2);
+    check(cache, "_sn=5..9", now, NULL, 0);
+    check(cache, "_sn=11..19", now, NULL, 0);
+    check(cache, "_sn=41..", now, NULL, 0);
+    check(cache, "_sn=20..20", now, (uint32_t[]){20}, 1);
+    check(cache, "_sn=..25", now, (uint32_t[]){10, 20}, 2);
+    check(cache, "_sn=15..;_max=2", now, (uint32_t[]){30, 40}, 2);
+    // Samples are 40, 30, 20 and 10 seconds old
+    check(cache, "_time=[now(-35s)..now(-15s)]", now, (uint32_t[]){20, 30}, 2);
+    check(cache, "_time=]now(-30s)..now(-10s)[", now, (uint32_t[]){30}, 1);
+    check(cache, "_time=[now(-5s)..]", now, NULL, 0);
+    check(cache, "_time=[..now(-45s)]", now, NULL, 0);
+    check(cache, "_sn=10..20;_time=[now(-35s)..]", now, (uint32_t[]){20}, 1);
+    // Out of order timestamps fall back to a scan
+    _z_timestamp_t ts = seconds_ago(now, 25);
+    add_at(cache, 50, &ts);
+    check(cache, "_time=[now(-27s)..now(-15s)]", now, (uint32_t[]){30, 50}, 2);
+    _ze_advanced_cache_free(&cache);
+}
+
+static void test_put_allocations(const z_owned_session_t *s, zp_tracking_allocator_t *tracker) {
+    printf("Test: puts on an advanced publisher with a full cache do not allocate\n");
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, KEYEXPR "/put");
+    ze_advanced_publisher_options_t opts;
+    ze_advanced_publisher_options_default(&opts);
+    opts.cache.is_enabled = true;
+    opts.cache.max_samples = PUT_CACHE_SIZE;
+    ze_owned_advanced_publisher_t pub;
+    assert(ze_declare_advanced_publisher(z_loan(*s), &pub, z_loan(ke), &opts) == Z_OK);
+
+    static z_owned_bytes_t payloads[PUT_NB];
+    for (size_t i = 0; i < PUT_NB; i++) {
+        assert(z_bytes_copy_from_str(&payloads[i], "payload") == Z_OK);
+    }
+    // Fill the cache once, its slots then keep their slice vectors
+    size_t warm_up = 2 * PUT_CACHE_SIZE;
+    for (size_t i = 0; i < warm_up; i++) {
+        assert(ze_advanced_publisher_put(z_loan(pub), z_move(payloads[i]), NULL) == Z_OK);
+    }
+    zp_allocator_stats_t before = zp_tracking_allocator_stats(tracker);
+    for (size_t i = warm_up; i < PUT_NB; i++) {
+        assert(ze_advanced_publisher_put(z_loan(pub), z_move(payloads[i]), NULL) == Z_OK);
+    }
+    zp_allocator_stats_t after = zp_tracking_allocator_stats(tracker);
+    printf("  %zu allocations for %d puts\n", after.allocations - before.allocations, PUT_NB - (int)warm_up);
+    assert(after.allocations == before.allocations);
+    // Evicted samples released their payload
+    assert(after.frees > before.frees);
+
+    ze_advanced_publisher_drop(z_move(pub));
+}
+
+static size_t get(const z_owned_session_t *s, const char *params, uint32_t *sns, size_t max) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, KEYEXPR);
+    z_owned_closure_reply_t callback;
+    z_owned_fifo_handler_reply_t handler;
+    assert(z_fifo_channel_reply_new(&callback, &handler, 16) == Z_OK);
+    z_get_options_t opts;
+    z_get_options_default(&opts);
+    opts.consolidation = z_query_consolidation_none();
+    assert(z_get(z_loan(*s), z_loan(ke), params, z_move(callback), &opts) == Z_OK);
+
+    size_t count = 0;
+    z_owned_reply_t reply;
+    while (z_recv(z_loan(handler), &reply) == Z_OK) {
+        assert(z_reply_is_ok(z_loan(reply)));
+        z_owned_string_t value;
+        z_bytes_to_string(z_sample_payload(z_reply_ok(z_loan(reply))), &value);
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%.*s", (int)z_string_len(z_loan(value)), z_string_data(z_loan(value)));
+        z_drop(z_move(value));
+        assert(count < max);
+        sns[count++] = (uint32_t)strtoul(buf, NULL, 10);
+        z_drop(z_move(reply));
+    }
+    z_drop(z_move(handler));
+    return count;
+}
+
+static void test_query_handler(z_owned_session_t *s1) {
+    printf("Test: remote cache queries are answered in order from the cache\n");
+    z_owned_session_t s2;
+    open_peer(&s2, false);
+    _ze_advanced_cache_t *cache = new_cache(s1, 4);
+    z_sleep_ms(1000);
+
+    uint32_t sns[8];
+    assert(get(&s2, "", sns, 8) == 0);
+    for (uint32_t sn = 1; sn <= 6; sn++) {
+        add(cache, sn);
+    }
+    assert(get(&s2, "", sns, 8) == 4);
+    assert((sns[0] == 3) && (sns[1] == 4) && (sns[2] == 5) && (sns[3] == 6));
+    assert(get(&s2, "_sn=4..5", sns, 8) == 2);
+    assert((sns[0] == 4) && (sns[1] == 5));
+    assert(get(&s2, "_sn=4..;_max=1", sns, 8) == 1);
+    assert(sns[0] == 6);
+
+#if Z_FEATURE_BATCHING == 1
+    printf("Test: cache queries leave the session batching to the application\n");
+    // The query handler runs on the read task while the application batches its own publications
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, KEYEXPR);
+    z_owned_closure_reply_t callback;
+    z_owned_fifo_handler_reply_t handler;
+    assert(z_fifo_channel_reply_new(&callback, &handler, 64) == Z_OK);
+    z_get_options_t opts;
+    z_get_options_default(&opts);
+    opts.consolidation = z_query_consolidation_none();
+    assert(z_get(z_loan(s2), z_loan(ke), "", z_move(callback), &opts) == Z_OK);
+    for (int i = 0; i < 200; i++) {
+        assert(zp_batch_start(z_loan(*s1)) == Z_OK);
+        add(cache, 7 + (uint32_t)i);
+        assert(zp_batch_stop(z_loan(*s1)) == Z_OK);
+    }
+    size_t count = 0;
+    z_owned_reply_t reply;
+    while (z_recv(z_loan(handler), &reply) == Z_OK) {
+        assert(z_reply_is_ok(z_loan(reply)));
+        count++;
+        z_drop(z_move(reply));
+    }
+    z_drop(z_move(handler));
+    assert(count == 4);
+#endif
+
+    _ze_advanced_cache_free(&cache);
+    z_drop(z_move(s2));
+}
+
+int main(void) {
+    // Installed before anything is allocated, so that every block is freed by the allocator that allocated it
+    zp_tracking_allocator_t tracker;
+    assert(zp_tracking_allocator_init(&tracker, NULL) == _Z_RES_OK);
+    zp_allocator_t allocator = zp_tracking_allocator(&tracker);
+    assert(zp_allocator_set(&allocator) == _Z_RES_OK);
+
+    key = _z_declared_keyexpr_alias_from_str(KEYEXPR);
+    z_owned_session_t s;
+    open_peer(&s, true);
+    test_empty(&s);
+    test_eviction(&s);
+    test_sn_wraparound(&s);
+    test_range_between_entries(&s);
+    test_put_allocations(&s, &tracker);
+    test_query_handler(&s);
+    z_drop(z_move(s));
+
+    assert(zp_allocator_set(NULL) == _Z_RES_OK);
+    zp_tracking_allocator_clear(&tracker);
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
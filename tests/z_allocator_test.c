@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+#include "zenoh-pico/system/common/allocator.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+static void test_pool_reuses_blocks(void) {
+    printf("Test: pool allocator reuses freed blocks of the same class\n");
+    static uint8_t region[4096];
+    zp_pool_allocator_t pool;
+    assert(zp_pool_allocator_init(&pool, region, sizeof(region), NULL) == _Z_RES_OK);
+    zp_allocator_t a = zp_pool_allocator(&pool);
+
+    void *p1 = a.alloc_fn(a.context, 10);
+    void *p2 = a.alloc_fn(a.context, 16);
+    assert(p1 != NULL && p2 != NULL && p1 != p2);
+    assert((uintptr_t)p1 % sizeof(void *) == 0);
+    memset(p1, 0xAA, 10);
+    memset(p2, 0xBB, 16);
+
+    a.free_fn(a.context, p1);
+    void *p3 = a.alloc_fn(a.context, 12);
+    assert(p3 == p1);
+
+    // Growing within the block class keeps the block, growing past it moves the data
+    assert(a.realloc_fn(a.context, p2, 14) == p2);
+    uint8_t *p4 = (uint8_t *)a.realloc_fn(a.context, p2, 100);
+    assert(p4 != NULL && (void *)p4 != p2);
+    for (size_t i = 0; i < 16; i++) {
+        assert(p4[i] == 0xBB);
+    }
+    void *p5 = a.alloc_fn(a.context, 16);
+    assert(p5 == p2);
+
+    a.free_fn(a.context, p3);
+    a.free_fn(a.context, p4);
+    a.free_fn(a.context, p5);
+    zp_pool_allocator_clear(&pool);
+}
+
+static void test_pool_fallback(void) {
+    printf("Test: pool allocator forwards what it cannot serve to its fallback\n");
+    static uint8_t region[256];
+    zp_tracking_allocator_t tracker;
+    assert(zp_tracking_allocator_init(&tracker, NULL) == _Z_RES_OK);
+    zp_allocator_t fallback = zp_tracking_allocator(&tracker);
+
+    zp_pool_allocator_t pool;
+    assert(zp_pool_allocator_init(&pool, region, sizeof(region), NULL) == _Z_RES_OK);
+    zp_allocator_t a = zp_pool_allocator(&pool);
+    // Larger than the largest class
+    assert(a.alloc_fn(a.context, 1 << 20) == NULL);
+    // Region exhausted
+    void *blocks[16];
+    size_t count = 0;
+    while (count < 16 && (blocks[count] = a.alloc_fn(a.context, 64)) != NULL) {
+        count++;
+    }
+    assert(count > 0 && count < 16);
+    for (size_t i = 0; i < count; i++) {
+        a.free_fn(a.context, blocks[i]);
+    }
+    zp_pool_allocator_clear(&pool);
+
+    assert(zp_pool_allocator_init(&pool, region, sizeof(region), &fallback) == _Z_RES_OK);
+    a = zp_pool_allocator(&pool);
+    void *big = a.alloc_fn(a.context, 1 << 20);
+    assert(big != NULL);
+    assert(zp_tracking_allocator_stats(&tracker).current_bytes == 1 << 20);
+    void *small = a.alloc_fn(a.context, 32);
+    assert(small != NULL);
+    assert(zp_tracking_allocator_stats(&tracker).allocations == 1);
+    a.free_fn(a.context, big);
+    a.free_fn(a.context, small);
+    assert(zp_tracking_allocator_stats(&tracker).current_bytes == 0);
+    zp_pool_allocator_clear(&pool);
+    zp_tracking_allocator_clear(&tracker);
+}
+
+static void test_arena(void) {
+    printf("Test: arena allocator bumps, resizes its last block in place and resets\n");
+    static uint8_t region[1024];
+    zp_arena_allocator_t arena;
+    assert(zp_arena_allocator_init(&arena, region, sizeof(region)) == _Z_RES_OK);
+    zp_allocator_t a = zp_arena_allocator(&arena);
+
+    uint8_t *p1 = (uint8_t *)a.alloc_fn(a.context, 8);
+    uint8_t *p2 = (uint8_t *)a.alloc_fn(a.context, 8);
+    assert(p1 != NULL && p2 != NULL && p2 > p1);
+    memset(p1, 0x11, 8);
+    memset(p2, 0x22, 8);
+    size_t used = zp_arena_allocator_used(&arena);
+
+    // The last block grows in place
+    assert(a.realloc_fn(a.context, p2, 64) == p2);
+    assert(zp_arena_allocator_used(&arena) > used);
+    // Other blocks are copied
+    uint8_t *p3 = (uint8_t *)a.realloc_fn(a.context, p1, 32);
+    assert(p3 != NULL && p3 != p1 && p3[0] == 0x11 && p3[7] == 0x11);
+
+    // Freeing the last block releases it
+    used = zp_arena_allocator_used(&arena);
+    void *p4 = a.alloc_fn(a.context, 16);
+    a.free_fn(a.context, p4);
+    assert(zp_arena_allocator_used(&arena) == used);
+
+    assert(a.alloc_fn(a.context, 4096) == NULL);
+    zp_arena_allocator_reset(&arena);
+    assert(zp_arena_allocator_used(&arena) == 0);
+    assert(a.alloc_fn(a.context, 8) == p1);
+    zp_arena_allocator_clear(&arena);
+}
+
+static void test_tracking(void) {
+    printf("Test: tracking allocator records allocations and peak usage\n");
+    zp_tracking_allocator_t tracker;
+    assert(zp_tracking_allocator_init(&tracker, NULL) == _Z_RES_OK);
+    zp_allocator_t a = zp_tracking_allocator(&tracker);
+
+    void *p1 = a.alloc_fn(a.context, 100);
+    void *p2 = a.alloc_fn(a.context, 50);
+    p1 = a.realloc_fn(a.context, p1, 200);
+    assert(p1 != NULL && p2 != NULL);
+    zp_allocator_stats_t stats = zp_tracking_allocator_stats(&tracker);
+    assert(stats.allocations == 2 && stats.frees == 0);
+    assert(stats.current_bytes == 250 && stats.peak_bytes == 250);
+
+    a.free_fn(a.context, p2);
+    a.free_fn(a.context, p1);
+    stats = zp_tracking_allocator_stats(&tracker);
+    assert(stats.allocations == 2 && stats.frees == 2);
+    assert(stats.current_bytes == 0 && stats.peak_bytes == 250);
+    zp_tracking_allocator_clear(&tracker);
+}
+
+static void test_install(void) {
+    printf("Test: installed allocator serves zenoh-pico allocations\n");
+    zp_allocator_t invalid = {0};
+    assert(zp_allocator_set(&invalid) != _Z_RES_OK);
+
+    zp_tracking_allocator_t tracker;
+    assert(zp_tracking_allocator_init(&tracker, NULL) == _Z_RES_OK);
+    zp_allocator_t a = zp_tracking_allocator(&tracker);
+    assert(zp_allocator_set(&a) == _Z_RES_OK);
+
+    z_owned_config_t config;
+    assert(z_config_default(&config) == _Z_RES_OK);
+    z_owned_bytes_t bytes;
+    assert(z_bytes_copy_from_str(&bytes, "allocator") == _Z_RES_OK);
+    zp_allocator_stats_t stats = zp_tracking_allocator_stats(&tracker);
+    assert(stats.allocations > 0 && stats.current_bytes > 0);
+    z_drop(z_move(bytes));
+    z_drop(z_move(config));
+
+    assert(zp_allocator_set(NULL) == _Z_RES_OK);
+    stats = zp_tracking_allocator_stats(&tracker);
+    assert(stats.allocations == stats.frees);
+    assert(stats.current_bytes == 0);
+
+    // Back to the platform allocator
+    void *p = z_malloc(16);
+    assert(p != NULL);
+    z_free(p);
+    assert(zp_tracking_allocator_stats(&tracker).allocations == stats.allocations);
+    zp_tracking_allocator_clear(&tracker);
+}
+
+int main(void) {
+    test_pool_reuses_blocks();
+    test_pool_fallback();
+    test_arena();
+    test_tracking();
+    test_install();
+
+    printf("All allocator tests passed.\n");
+    return 0;
+}
@@ -200,10 +200,123 @@ void zero_size_test(void) {
     z_drop(z_move(ring_handler));
 }
 
+void element_recycling_test(void) {
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 2);
+    _z_freelist_t *elems = &_Z_RC_IN_VAL(z_loan(handler))->elems;
+    char buf[100];
+
+    SEND(closure, "v1")
+    SEND(closure, "v22")
+    assert(_z_freelist_len(elems) == 0);
+    RECV(handler, buf)
+    assert(strcmp(buf, "v1") == 0);
+    RECV(handler, buf)
+    assert(strcmp(buf, "v22") == 0);
+    assert(_z_freelist_len(elems) == 2);
+
+    // Received boxes are handed out again
+    SEND(closure, "v333")
+    assert(_z_freelist_len(elems) == 1);
+    RECV(handler, buf)
+    assert(strcmp(buf, "v333") == 0);
+    assert(_z_freelist_len(elems) == 2);
+
+    z_drop(z_move(closure));
+    z_drop(z_move(handler));
+
+    // Elements dropped by a full ring are recycled as well, up to the channel capacity
+    z_owned_ring_handler_sample_t ring_handler;
+    z_ring_channel_sample_new(&closure, &ring_handler, 1);
+    elems = &_Z_RC_IN_VAL(z_loan(ring_handler))->elems;
+    SEND(closure, "v1")
+    SEND(closure, "v22")
+    SEND(closure, "v333")
+    assert(_z_freelist_len(elems) == 1);
+    RECV(ring_handler, buf)
+    assert(strcmp(buf, "v333") == 0);
+    assert(_z_freelist_len(elems) == 1);
+
+    z_drop(z_move(closure));
+    z_drop(z_move(ring_handler));
+}
+
+void batch_recv_test(void) {
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 4);
+    z_owned_sample_t samples[3];
+    size_t count = 0;
+
+    assert(z_try_recv_batch(z_loan(handler), samples, 3, &count) == Z_CHANNEL_NODATA);
+    assert(count == 0);
+
+    SEND(closure, "v1")
+    SEND(closure, "v22")
+    SEND(closure, "v333")
+    SEND(closure, "v4444")
+
+    const char *expected[] = {"v1", "v22", "v333", "v4444"};
+    size_t received = 0;
+    assert(z_recv_batch(z_loan(handler), samples, 3, &count) == Z_OK);
+    assert(count == 3);
+    for (size_t i = 0; i < count; i++, received++) {
+        z_owned_string_t value;
+        z_bytes_to_string(z_sample_payload(z_loan(samples[i])), &value);
+        assert(strncmp(z_string_data(z_loan(value)), expected[received], z_string_len(z_loan(value))) == 0);
+        z_drop(z_move(value));
+        z_drop(z_move(samples[i]));
+    }
+    assert(z_try_recv_batch(z_loan(handler), samples, 3, &count) == Z_OK);
+    assert(count == 1);
+    z_drop(z_move(samples[0]));
+    z_drop(z_move(closure));
+    z_drop(z_move(handler));
+
+    // Batches larger than a chunk of boxes are received whole, their boxes recycled up to the capacity
+    z_owned_sample_t many[2 * _Z_CHANNEL_BATCH_CHUNK + 1];
+    size_t many_nb = sizeof(many) / sizeof(many[0]);
+    z_fifo_channel_sample_new(&closure, &handler, many_nb);
+    for (size_t i = 0; i < many_nb; i++) {
+        SEND(closure, "v")
+    }
+    assert(z_recv_batch(z_loan(handler), many, many_nb + 1, &count) == Z_OK);
+    assert(count == many_nb);
+    assert(_z_freelist_len(&_Z_RC_IN_VAL(z_loan(handler))->elems) == many_nb);
+    for (size_t i = 0; i < count; i++) {
+        assert(z_bytes_len(z_sample_payload(z_loan(many[i]))) == 1);
+        z_drop(z_move(many[i]));
+    }
+    assert(z_try_recv_batch(z_loan(handler), many, many_nb, &count) == Z_CHANNEL_NODATA);
+    assert(count == 0);
+
+    z_drop(z_move(closure));
+    assert(z_recv_batch(z_loan(handler), samples, 3, &count) == Z_CHANNEL_DISCONNECTED);
+    assert(count == 0);
+    z_drop(z_move(handler));
+
+    // A ring keeps the most recent items
+    z_owned_ring_handler_sample_t ring_handler;
+    z_ring_channel_sample_new(&closure, &ring_handler, 2);
+    SEND(closure, "v1")
+    SEND(closure, "v22")
+    SEND(closure, "v333")
+    assert(z_recv_batch(z_loan(ring_handler), samples, 3, &count) == Z_OK);
+    assert(count == 2);
+    z_drop(z_move(samples[0]));
+    z_drop(z_move(samples[1]));
+    z_drop(z_move(closure));
+    assert(z_try_recv_batch(z_loan(ring_handler), samples, 3, &count) == Z_CHANNEL_DISCONNECTED);
+    z_drop(z_move(ring_handler));
+}
+
 int main(void) {
     sample_fifo_channel_test();
     sample_fifo_channel_test_try_recv();
     sample_ring_channel_test_in_size();
     sample_ring_channel_test_over_size();
     zero_size_test();
+    element_recycling_test();
+    batch_recv_test();
 }
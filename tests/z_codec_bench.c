@@ -0,0 +1,239 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+// In-process benchmark of the network and transport message codecs. Each message is encoded and decoded repeatedly
+// from the same buffers and the average time per message is printed as CSV, one line per message and operation:
+//
+//   message,operation,bytes,iterations,ns_per_msg
+//
+// Usage: z_codec_bench [iterations] [payload size]
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico/api/constants.h"
+#include "zenoh-pico/collections/bytes.h"
+#include "zenoh-pico/net/encoding.h"
+#include "zenoh-pico/protocol/codec/network.h"
+#include "zenoh-pico/protocol/codec/transport.h"
+#include "zenoh-pico/protocol/core.h"
+#include "zenoh-pico/protocol/definitions/declarations.h"
+#include "zenoh-pico/protocol/definitions/network.h"
+#include "zenoh-pico/protocol/definitions/transport.h"
+#include "zenoh-pico/protocol/iobuf.h"
+#include "zenoh-pico/system/platform.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define DEFAULT_ITERATIONS 100000
+#define DEFAULT_PAYLOAD_SIZE 64
+// Number of push messages batched in a frame
+#define FRAME_BATCH 8
+#define BUF_SIZE 65536
+
+typedef struct {
+    const char *name;
+    bool is_transport;
+    _z_network_message_t n_msg;
+    _z_transport_message_t t_msg;
+    // Network messages following the transport header
+    size_t batch;
+} bench_msg_t;
+
+// Owned by the benchmark, the messages only alias them
+static _z_wireexpr_t key;
+static _z_bytes_t payload;
+static _z_bytes_t attachment;
+static _z_encoding_t encoding;
+static _z_timestamp_t timestamp;
+static _z_slice_t parameters;
+static uint8_t *fragment_buf;
+
+static void gen_commons(size_t payload_size) {
+    key = (_z_wireexpr_t){._id = 0, ._mapping = _Z_KEYEXPR_MAPPING_LOCAL,
+                          ._suffix = _z_string_copy_from_str("bench/codec/key")};
+    uint8_t *buf = (uint8_t *)z_malloc(payload_size);
+    assert(buf != NULL || payload_size == 0);
+    for (size_t i = 0; i < payload_size; i++) {
+        buf[i] = (uint8_t)i;
+    }
+    assert(_z_bytes_from_buf(&payload, buf, payload_size) == _Z_RES_OK);
+    fragment_buf = buf;
+    uint8_t att[] = {'b', 'e', 'n', 'c', 'h'};
+    assert(_z_bytes_from_buf(&attachment, att, sizeof(att)) == _Z_RES_OK);
+    encoding = _z_encoding_wrap(_Z_ENCODING_ID_DEFAULT, NULL);
+    timestamp.valid = true;
+    timestamp.time = 0x123456789abcdefULL;
+    for (size_t i = 0; i < sizeof(timestamp.id.id); i++) {
+        timestamp.id.id[i] = (uint8_t)(i + 1);
+    }
+    parameters = _z_slice_alias_buf((const uint8_t *)"arg=1;other=2", strlen("arg=1;other=2"));
+}
+
+static void clear_commons(void) {
+    _z_wireexpr_clear(&key);
+    _z_bytes_drop(&payload);
+    _z_bytes_drop(&attachment);
+    z_free(fragment_buf);
+}
+
+static void gen_msgs(bench_msg_t *msgs, size_t *len, size_t payload_size) {
+    _z_n_qos_t qos = _z_n_qos_make(false, true, Z_PRIORITY_DEFAULT);
+    size_t n = 0;
+
+    msgs[n] = (bench_msg_t){.name = "push"};
+    _z_n_msg_make_push_put(&msgs[n].n_msg, &key, &payload, &encoding, qos, &timestamp, &attachment,
+                           Z_RELIABILITY_RELIABLE, NULL);
+    n++;
+
+    msgs[n] = (bench_msg_t){.name = "request"};
+    _z_n_msg_make_query(&msgs[n].n_msg, &key, &parameters, 0x1234, Z_RELIABILITY_RELIABLE,
+                        Z_CONSOLIDATION_MODE_DEFAULT, &payload, &encoding, 10000, &attachment, qos, NULL, false);
+    n++;
+
+    msgs[n] = (bench_msg_t){.name = "reply"};
+    _z_n_msg_make_reply_ok_put(&msgs[n].n_msg, &timestamp.id, 0x1234, &key, Z_RELIABILITY_RELIABLE,
+                               Z_CONSOLIDATION_MODE_DEFAULT, qos, &timestamp, NULL, &payload, &encoding, &attachment);
+    n++;
+
+    msgs[n] = (bench_msg_t){.name = "declare"};
+    _z_wireexpr_t decl_key;
+    assert(_z_wireexpr_copy(&decl_key, &key) == _Z_RES_OK);
+    _z_n_msg_make_declare(&msgs[n].n_msg, _z_make_decl_subscriber(&decl_key, 42), _z_optional_id_make_none());
+    n++;
+
+    msgs[n] = (bench_msg_t){.name = "frame", .is_transport = true, .batch = FRAME_BATCH};
+    msgs[n].t_msg = _z_t_msg_make_frame_header(0x10000, Z_RELIABILITY_RELIABLE);
+    msgs[n].n_msg = msgs[0].n_msg;
+    n++;
+
+    msgs[n] = (bench_msg_t){.name = "fragment", .is_transport = true};
+    msgs[n].t_msg = _z_t_msg_make_fragment(0x10000, _z_slice_alias_buf(fragment_buf, payload_size),
+                                           Z_RELIABILITY_RELIABLE, false, true, false);
+    n++;
+
+    *len = n;
+}
+
+static z_result_t bench_encode(_z_wbuf_t *wbf, const bench_msg_t *m) {
+    if (!m->is_transport) {
+        return _z_network_message_encode(wbf, &m->n_msg);
+    }
+    _Z_RETURN_IF_ERR(_z_transport_message_encode(wbf, &m->t_msg));
+    for (size_t i = 0; i < m->batch; i++) {
+        _Z_RETURN_IF_ERR(_z_network_message_encode(wbf, &m->n_msg));
+    }
+    return _Z_RES_OK;
+}
+
+static z_result_t bench_decode(_z_zbuf_t *zbf) {
+    _z_network_message_t n_msg;
+    _z_arc_slice_t arcs = _z_arc_slice_empty();
+    z_result_t ret = _z_network_message_decode(&n_msg, zbf, &arcs, _Z_KEYEXPR_MAPPING_LOCAL);
+    _z_n_msg_clear(&n_msg);
+    return ret;
+}
+
+static z_result_t bench_decode_transport(_z_zbuf_t *zbf) {
+    _z_transport_message_t t_msg;
+    _Z_RETURN_IF_ERR(_z_transport_message_decode(&t_msg, zbf));
+    if (_Z_MID(t_msg._header) == _Z_MID_T_FRAME) {
+        while (_z_zbuf_len(t_msg._body._frame._payload) > 0) {
+            _Z_RETURN_IF_ERR(bench_decode(t_msg._body._frame._payload));
+        }
+    }
+    _z_t_msg_clear(&t_msg);
+    return _Z_RES_OK;
+}
+
+static void report(const char *name, const char *op, size_t bytes, size_t iterations, unsigned long elapsed_us) {
+    printf("%s,%s,%zu,%zu,%.1f\n", name, op, bytes, iterations, (double)elapsed_us * 1000.0 / (double)iterations);
+    fflush(stdout);
+}
+
+static void run(const bench_msg_t *m, _z_wbuf_t *wbf, size_t iterations) {
+    // Warm-up, also checks that the message round-trips
+    size_t warmup = iterations / 10 + 1;
+    for (size_t i = 0; i < warmup; i++) {
+        _z_wbuf_reset(wbf);
+        assert(bench_encode(wbf, m) == _Z_RES_OK);
+    }
+    z_clock_t start = z_clock_now();
+    for (size_t i = 0; i < iterations; i++) {
+        _z_wbuf_reset(wbf);
+        bench_encode(wbf, m);
+    }
+    unsigned long elapsed_us = z_clock_elapsed_us(&start);
+    size_t bytes = _z_wbuf_len(wbf);
+    report(m->name, "encode", bytes, iterations, elapsed_us);
+
+    // Decoding a frame resets its payload buffer, restore the positions before each run
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(wbf);
+    for (size_t i = 0; i < warmup; i++) {
+        _z_zbuf_set_wpos(&zbf, bytes);
+        _z_zbuf_set_rpos(&zbf, 0);
+        z_result_t ret = m->is_transport ? bench_decode_transport(&zbf) : bench_decode(&zbf);
+        assert(ret == _Z_RES_OK);
+    }
+    start = z_clock_now();
+    for (size_t i = 0; i < iterations; i++) {
+        _z_zbuf_set_wpos(&zbf, bytes);
+        _z_zbuf_set_rpos(&zbf, 0);
+        if (m->is_transport) {
+            bench_decode_transport(&zbf);
+        } else {
+            bench_decode(&zbf);
+        }
+    }
+    elapsed_us = z_clock_elapsed_us(&start);
+    report(m->name, "decode", bytes, iterations, elapsed_us);
+    _z_zbuf_clear(&zbf);
+}
+
+int main(int argc, char **argv) {
+    size_t iterations = DEFAULT_ITERATIONS;
+    size_t payload_size = DEFAULT_PAYLOAD_SIZE;
+    if (argc > 1) {
+        iterations = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        payload_size = (size_t)strtoul(argv[2], NULL, 10);
+    }
+    if (iterations == 0 || payload_size > BUF_SIZE / (FRAME_BATCH + 1)) {
+        fprintf(stderr, "Usage: %s [iterations > 0] [payload size <= %d]\n", argv[0], BUF_SIZE / (FRAME_BATCH + 1));
+        return -1;
+    }
+
+    gen_commons(payload_size);
+    bench_msg_t msgs[6];
+    size_t len = 0;
+    gen_msgs(msgs, &len, payload_size);
+
+    _z_wbuf_t wbf = _z_wbuf_make(BUF_SIZE, false);
+    printf("message,operation,bytes,iterations,ns_per_msg\n");
+    for (size_t i = 0; i < len; i++) {
+        run(&msgs[i], &wbf, iterations);
+    }
+    _z_wbuf_clear(&wbf);
+
+    // The declaration owns its key, the other messages alias the common fields
+    _z_n_msg_clear(&msgs[3].n_msg);
+    clear_commons();
+    return 0;
+}
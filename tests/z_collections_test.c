@@ -17,7 +17,9 @@
 #include <stdlib.h>
 
 #include "zenoh-pico/collections/fifo.h"
+#include "zenoh-pico/collections/freelist.h"
 #include "zenoh-pico/collections/lifo.h"
+#include "zenoh-pico/collections/mpmc_queue.h"
 #include "zenoh-pico/collections/ring.h"
 #include "zenoh-pico/collections/sortedmap.h"
 #include "zenoh-pico/collections/string.h"
@@ -387,6 +389,171 @@ void fifo_test_init_free(void) {
     assert(r == NULL);
 }
 
+// MPMC QUEUE
+static size_t mpmc_dropped = 0;
+static void mpmc_drop(void **e) {
+    mpmc_dropped++;
+    *e = NULL;
+}
+
+void mpmc_queue_test(void) {
+    _z_mpmc_queue_t q;
+    assert(_z_mpmc_queue_init(&q, 0) != _Z_RES_OK);
+    assert(_z_mpmc_queue_init(&q, 3) == _Z_RES_OK);
+    assert(_z_mpmc_queue_capacity(&q) == 3);
+    assert(_z_mpmc_queue_pull(&q) == NULL);
+
+    // The capacity holds even though the slot count is rounded up
+    assert(_z_mpmc_queue_push(&q, a));
+    assert(_z_mpmc_queue_push(&q, b));
+    assert(_z_mpmc_queue_push(&q, c));
+    assert(!_z_mpmc_queue_push(&q, d));
+    assert(_z_mpmc_queue_len(&q) == 3);
+    assert(_z_mpmc_queue_pull(&q) == a);
+
+    // Wrap around several laps
+    for (size_t i = 0; i < 10; i++) {
+        assert(_z_mpmc_queue_push(&q, d));
+        assert(_z_mpmc_queue_pull(&q) != NULL);
+    }
+    assert(_z_mpmc_queue_len(&q) == 2);
+
+    // Forcing a push drops the oldest element
+    _z_mpmc_queue_push_force_drop(&q, a, mpmc_drop);
+    assert(mpmc_dropped == 0);
+    _z_mpmc_queue_push_force_drop(&q, b, mpmc_drop);
+    assert(mpmc_dropped == 1);
+    assert(_z_mpmc_queue_pull(&q) == d);
+    assert(_z_mpmc_queue_pull(&q) == a);
+    assert(_z_mpmc_queue_pull(&q) == b);
+    assert(_z_mpmc_queue_pull(&q) == NULL);
+
+    // A bulk push stops at the capacity
+    void *batch[] = {a, b, c, d};
+    assert(_z_mpmc_queue_push_n(&q, batch, 4) == 3);
+    assert(_z_mpmc_queue_push_n(&q, batch, 1) == 0);
+    assert(_z_mpmc_queue_pull(&q) == a);
+    assert(_z_mpmc_queue_push_n(&q, &batch[3], 1) == 1);
+    assert(_z_mpmc_queue_pull(&q) == b);
+    assert(_z_mpmc_queue_pull(&q) == c);
+    assert(_z_mpmc_queue_pull(&q) == d);
+    assert(_z_mpmc_queue_pull(&q) == NULL);
+
+    assert(_z_mpmc_queue_push(&q, c));
+    _z_mpmc_queue_clear(&q, mpmc_drop);
+    assert(mpmc_dropped == 2);
+}
+
+#if Z_FEATURE_MULTI_THREAD == 1
+#define MPMC_THREADS 2
+#define MPMC_COUNT 10000
+
+typedef struct {
+    _z_mpmc_queue_t *q;
+    size_t base;
+    size_t sum;
+} mpmc_task_arg_t;
+
+static void *mpmc_producer(void *arg) {
+    mpmc_task_arg_t *t = (mpmc_task_arg_t *)arg;
+    for (size_t i = 1; i <= MPMC_COUNT; i++) {
+        while (!_z_mpmc_queue_push(t->q, (void *)(uintptr_t)(t->base + i))) {
+            z_sleep_us(1);
+        }
+    }
+    return NULL;
+}
+
+static void *mpmc_consumer(void *arg) {
+    mpmc_task_arg_t *t = (mpmc_task_arg_t *)arg;
+    for (size_t i = 0; i < MPMC_COUNT; i++) {
+        void *e = NULL;
+        while ((e = _z_mpmc_queue_pull(t->q)) == NULL) {
+            z_sleep_us(1);
+        }
+        t->sum += (size_t)(uintptr_t)e;
+    }
+    return NULL;
+}
+
+void mpmc_queue_concurrent_test(void) {
+    _z_mpmc_queue_t q;
+    assert(_z_mpmc_queue_init(&q, 7) == _Z_RES_OK);
+    _z_task_t tasks[2 * MPMC_THREADS];
+    mpmc_task_arg_t args[2 * MPMC_THREADS];
+    size_t expected = 0;
+    for (size_t i = 0; i < MPMC_THREADS; i++) {
+        args[i] = (mpmc_task_arg_t){.q = &q, .base = i * MPMC_COUNT, .sum = 0};
+        args[MPMC_THREADS + i] = (mpmc_task_arg_t){.q = &q, .base = 0, .sum = 0};
+        expected += i * MPMC_COUNT * MPMC_COUNT + MPMC_COUNT * (MPMC_COUNT + 1) / 2;
+    }
+    for (size_t i = 0; i < 2 * MPMC_THREADS; i++) {
+        assert(_z_task_init(&tasks[i], NULL, i < MPMC_THREADS ? mpmc_producer : mpmc_consumer, &args[i]) ==
+               _Z_RES_OK);
+    }
+    size_t sum = 0;
+    for (size_t i = 0; i < 2 * MPMC_THREADS; i++) {
+        assert(_z_task_join(&tasks[i]) == _Z_RES_OK);
+        sum += args[i].sum;
+    }
+    // Every element was pulled exactly once
+    assert(sum == expected);
+    assert(_z_mpmc_queue_pull(&q) == NULL);
+    _z_mpmc_queue_clear(&q, mpmc_drop);
+}
+
+#define FREELIST_BLOCKS 3
+
+typedef struct {
+    _z_freelist_t *fl;
+    size_t base;
+    size_t rounds;
+} freelist_task_arg_t;
+
+static void *freelist_user(void *arg) {
+    freelist_task_arg_t *t = (freelist_task_arg_t *)arg;
+    _z_freelist_t *fl = t->fl;
+    for (size_t i = 0; i < MPMC_COUNT; i++) {
+        size_t *blocks[FREELIST_BLOCKS];
+        for (size_t j = 0; j < FREELIST_BLOCKS; j++) {
+            blocks[j] = (size_t *)_z_freelist_get(fl);
+            assert(blocks[j] != NULL);
+            *blocks[j] = t->base + j;
+        }
+        // A block handed out twice would be overwritten by the other thread
+        for (size_t j = 0; j < FREELIST_BLOCKS; j++) {
+            assert(*blocks[j] == t->base + j);
+            if ((i % 2) == 0) {
+                _z_freelist_release(blocks[j]);
+            }
+        }
+        if ((i % 2) != 0) {
+            _z_freelist_release_n((void **)blocks, FREELIST_BLOCKS);
+        }
+        t->rounds++;
+    }
+    return NULL;
+}
+
+void freelist_concurrent_test(void) {
+    _z_freelist_t fl;
+    assert(_z_freelist_init(&fl, sizeof(size_t), 4) == _Z_RES_OK);
+    _z_task_t tasks[2 * MPMC_THREADS];
+    freelist_task_arg_t args[2 * MPMC_THREADS];
+    for (size_t i = 0; i < 2 * MPMC_THREADS; i++) {
+        args[i] = (freelist_task_arg_t){.fl = &fl, .base = i * FREELIST_BLOCKS, .rounds = 0};
+        assert(_z_task_init(&tasks[i], NULL, freelist_user, &args[i]) == _Z_RES_OK);
+    }
+    for (size_t i = 0; i < 2 * MPMC_THREADS; i++) {
+        assert(_z_task_join(&tasks[i]) == _Z_RES_OK);
+        assert(args[i].rounds == MPMC_COUNT);
+    }
+    // Blocks over the bound went back to the allocator
+    assert(_z_freelist_len(&fl) == 4);
+    _z_freelist_clear(&fl);
+}
+#endif
+
 void int_map_iterator_test(void) {
     _z_str_intmap_t map;
 
@@ -850,6 +1017,11 @@ int main(void) {
     lifo_test_init_free();
     fifo_test();
     fifo_test_init_free();
+    mpmc_queue_test();
+#if Z_FEATURE_MULTI_THREAD == 1
+    mpmc_queue_concurrent_test();
+    freelist_concurrent_test();
+#endif
 
     int_map_iterator_test();
     int_map_iterator_deletion_test();
@@ -0,0 +1,244 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+#include "zenoh-pico/net/encoding.h"
+#include "zenoh-pico/protocol/codec/transport.h"
+#include "zenoh-pico/transport/common/rx.h"
+#include "zenoh-pico/transport/common/tx.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_COMPRESSION == 1 && Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_PUBLICATION == 1 && \
+    Z_FEATURE_SUBSCRIPTION == 1 && Z_FEATURE_LINK_TCP == 1 && Z_FEATURE_LOCAL_SUBSCRIBER == 0
+
+#define LOCATOR "tcp/127.0.0.1:7466"
+#define KEYEXPR "test/compression"
+#define TEXT_PLAIN_ID 4
+
+static volatile int received = 0;
+static char last_payload[64];
+static size_t last_len = 0;
+
+static void on_sample(z_loaned_sample_t *sample, void *arg) {
+    (void)arg;
+    z_owned_string_t value;
+    z_bytes_to_string(z_sample_payload(sample), &value);
+    snprintf(last_payload, sizeof(last_payload), "%.*s", (int)z_string_len(z_loan(value)),
+             z_string_data(z_loan(value)));
+    last_len = z_string_len(z_loan(value));
+    z_drop(z_move(value));
+    received++;
+}
+
+static void open_peer(z_owned_session_t *s, bool listen) {
+    z_owned_config_t config;
+    z_config_default(&config);
+    zp_config_insert(z_loan_mut(config), Z_CONFIG_MODE_KEY, Z_CONFIG_MODE_PEER);
+    zp_config_insert(z_loan_mut(config), listen ? Z_CONFIG_LISTEN_KEY : Z_CONFIG_CONNECT_KEY, LOCATOR);
+    assert(z_open(s, z_move(config), NULL) == Z_OK);
+    assert(zp_start_read_task(z_loan_mut(*s), NULL) == Z_OK);
+    assert(zp_start_lease_task(z_loan_mut(*s), NULL) == Z_OK);
+}
+
+static void put(const z_owned_session_t *s, const uint8_t *data, size_t len, uint16_t id, const char *schema) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, KEYEXPR);
+    z_owned_bytes_t payload;
+    assert(z_bytes_copy_from_buf(&payload, data, len) == Z_OK);
+    z_owned_encoding_t encoding;
+    assert(_z_encoding_make(&encoding._val, id, schema, (schema == NULL) ? 0 : strlen(schema)) == _Z_RES_OK);
+    z_put_options_t opts;
+    z_put_options_default(&opts);
+    opts.encoding = z_move(encoding);
+    assert(z_put(z_loan(*s), z_loan(ke), z_move(payload), &opts) == Z_OK);
+}
+
+static void wait_received(int expected) {
+    for (int i = 0; (i < 50) && (received < expected); i++) {
+        z_sleep_ms(100);
+    }
+}
+
+static void test_malformed_payload(void) {
+    printf("Test: a malformed compressed payload drops its sample but not the connection\n");
+    z_owned_session_t sub_s;
+    z_owned_session_t pub_s;
+    open_peer(&sub_s, true);
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, on_sample, NULL, NULL);
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, KEYEXPR);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(sub_s), &sub, z_loan(ke), z_move(callback), NULL) == Z_OK);
+    open_peer(&pub_s, false);
+    z_sleep_ms(1000);
+
+    const char *text = "uncompressed";
+    put(&pub_s, (const uint8_t *)text, strlen(text), TEXT_PLAIN_ID, NULL);
+    wait_received(1);
+    assert(received == 1);
+
+    // Too short, an absurd original length, then a body that is not LZ4
+    uint8_t short_body[2] = {1, 0};
+    put(&pub_s, short_body, sizeof(short_body), TEXT_PLAIN_ID, _Z_ENCODING_SCHEMA_COMPRESSED);
+    uint8_t huge_len[8] = {0xFF, 0xFF, 0xFF, 0x7F, 0, 0, 0, 0};
+    put(&pub_s, huge_len, sizeof(huge_len), TEXT_PLAIN_ID, _Z_ENCODING_SCHEMA_COMPRESSED);
+    uint8_t garbage[16] = {16, 0, 0, 0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    put(&pub_s, garbage, sizeof(garbage), TEXT_PLAIN_ID, _Z_ENCODING_SCHEMA_COMPRESSED ";utf8");
+
+    text = "still connected";
+    put(&pub_s, (const uint8_t *)text, strlen(text), TEXT_PLAIN_ID, NULL);
+    wait_received(2);
+    z_sleep_ms(200);
+    assert(received == 2);
+    assert(strcmp(last_payload, text) == 0);
+
+    // Foreign encoding ids are delivered untouched, including those with bit 15 set
+    text = "foreign id";
+    put(&pub_s, (const uint8_t *)text, strlen(text), 0x8001, NULL);
+    wait_received(3);
+    assert(received == 3);
+    assert(strcmp(last_payload, text) == 0);
+
+    // A compressing publisher reuses its scratch space across puts
+    z_owned_publisher_t pub;
+    z_publisher_options_t pub_opts;
+    z_publisher_options_default(&pub_opts);
+    pub_opts.compression = true;
+    assert(z_declare_publisher(z_loan(pub_s), &pub, z_loan(ke), &pub_opts) == Z_OK);
+    char large[2 * Z_COMPRESSION_THRESHOLD];
+    memset(large, 'z', sizeof(large));
+    for (int i = 0; i < 2; i++) {
+        z_owned_bytes_t payload;
+        assert(z_bytes_copy_from_buf(&payload, (const uint8_t *)large, sizeof(large)) == Z_OK);
+        assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+        wait_received(4 + i);
+        assert(received == 4 + i);
+        assert(last_len == sizeof(large) && last_payload[0] == 'z');
+    }
+    z_drop(z_move(pub));
+
+    z_drop(z_move(sub));
+    z_drop(z_move(pub_s));
+    z_drop(z_move(sub_s));
+}
+#endif
+
+#if Z_FEATURE_COMPRESSION == 1
+#define BATCH_SIZE 2048
+#define PAYLOAD_SIZE 1000
+
+static uint8_t sent[BATCH_SIZE];
+static size_t sent_len = 0;
+
+static size_t capture_write(const _z_link_t *self, const uint8_t *ptr, size_t len, _z_sys_net_socket_t *socket) {
+    (void)self;
+    (void)socket;
+    assert(sent_len + len <= sizeof(sent));
+    memcpy(&sent[sent_len], ptr, len);
+    sent_len += len;
+    return len;
+}
+
+// Sends a frame through the transport, then decompresses and decodes what reached the link
+static void send_and_receive(_z_transport_common_t *ztc, const uint8_t *data, bool expect_compressed) {
+    _z_zbuf_t payload = _z_zbuf_make(PAYLOAD_SIZE);
+    memcpy(_z_zbuf_get_wptr(&payload), data, PAYLOAD_SIZE);
+    _z_zbuf_set_wpos(&payload, PAYLOAD_SIZE);
+    _z_transport_message_t t_msg = _z_t_msg_make_frame(42, &payload, Z_RELIABILITY_RELIABLE);
+    sent_len = 0;
+    assert(_z_transport_tx_send_t_msg(ztc, &t_msg, NULL) == _Z_RES_OK);
+    _z_zbuf_clear(&payload);
+
+    size_t header_pos = 0;
+    if (ztc->_link->_cap._flow == Z_LINK_CAP_FLOW_STREAM) {
+        header_pos = _Z_MSG_LEN_ENC_SIZE;
+        assert((size_t)(sent[0] | (sent[1] << 8)) == sent_len - _Z_MSG_LEN_ENC_SIZE);
+    }
+    assert(_Z_HAS_FLAG(sent[header_pos], _Z_BATCH_HEADER_C) == expect_compressed);
+    if (expect_compressed) {
+        assert(sent_len < PAYLOAD_SIZE);
+    } else {
+        assert(sent_len > PAYLOAD_SIZE);
+    }
+
+    _z_zbuf_t zbf = _z_zbuf_make(BATCH_SIZE);
+    memcpy(_z_zbuf_get_wptr(&zbf), &sent[header_pos], sent_len - header_pos);
+    _z_zbuf_set_wpos(&zbf, sent_len - header_pos);
+    _z_zbuf_t batch = zbf;
+    assert(_z_transport_rx_decompress_batch(ztc, &batch) == _Z_RES_OK);
+    _z_transport_message_t decoded;
+    assert(_z_transport_message_decode(&decoded, &batch) == _Z_RES_OK);
+    assert(_Z_MID(decoded._header) == _Z_MID_T_FRAME);
+    assert(decoded._body._frame._sn == 42);
+    assert(_z_zbuf_len(decoded._body._frame._payload) == PAYLOAD_SIZE);
+    assert(memcmp(_z_zbuf_get_rptr(decoded._body._frame._payload), data, PAYLOAD_SIZE) == 0);
+    _z_zbuf_clear(&zbf);
+}
+
+static void test_transport_batch(_z_link_cap_flow_t flow) {
+    printf("Test: batches are compressed only when it pays off, %s link\n",
+           flow == Z_LINK_CAP_FLOW_STREAM ? "stream" : "datagram");
+    _z_link_t link;
+    memset(&link, 0, sizeof(link));
+    link._cap._flow = flow;
+    link._write_f = capture_write;
+    _z_transport_common_t ztc;
+    memset(&ztc, 0, sizeof(ztc));
+    ztc._link = &link;
+    ztc._wbuf = _z_wbuf_make(BATCH_SIZE, false);
+    ztc._compression = _z_transport_compression_new(BATCH_SIZE);
+    assert(ztc._compression != NULL);
+#if Z_FEATURE_MULTI_THREAD == 1
+    assert(_z_mutex_init(&ztc._mutex_tx) == _Z_RES_OK);
+#endif
+
+    uint8_t data[PAYLOAD_SIZE];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)('a' + (i % 4));
+    }
+    send_and_receive(&ztc, data, true);
+
+    // Noise does not shrink, so it goes out as is behind a cleared header
+    uint32_t seed = 0x12345678;
+    for (size_t i = 0; i < sizeof(data); i++) {
+        seed = seed * 1103515245u + 12345u;
+        data[i] = (uint8_t)(seed >> 24);
+    }
+    send_and_receive(&ztc, data, false);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_drop(&ztc._mutex_tx);
+#endif
+    _z_transport_compression_free(&ztc._compression);
+    _z_wbuf_clear(&ztc._wbuf);
+}
+#endif
+
+int main(void) {
+#if Z_FEATURE_COMPRESSION == 1
+    test_transport_batch(Z_LINK_CAP_FLOW_DATAGRAM);
+    test_transport_batch(Z_LINK_CAP_FLOW_STREAM);
+#endif
+#if Z_FEATURE_COMPRESSION == 1 && Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_PUBLICATION == 1 && \
+    Z_FEATURE_SUBSCRIPTION == 1 && Z_FEATURE_LINK_TCP == 1 && Z_FEATURE_LOCAL_SUBSCRIBER == 0
+    test_malformed_payload();
+#endif
+    return 0;
+}
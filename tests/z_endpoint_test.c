@@ -26,6 +26,9 @@
 #if Z_FEATURE_LINK_TLS == 1
 #include "zenoh-pico/link/config/tls.h"
 #endif
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+#include "zenoh-pico/link/manager.h"
+#endif
 
 #undef NDEBUG
 #include <assert.h>
@@ -198,5 +201,38 @@ int main(void) {
     _z_endpoint_clear(&ep);
 #endif
 
+#if Z_FEATURE_LINK_UNIXSOCK == 1
+    str = _z_string_alias_str("unixsock-stream//tmp/zenoh.sock");
+    assert(_z_endpoint_from_string(&ep, &str) == _Z_RES_OK);
+
+    str = _z_string_alias_str("unixsock-stream");
+    assert(_z_string_equals(&ep._locator._protocol, &str) == true);
+    str = _z_string_alias_str("/tmp/zenoh.sock");
+    assert(_z_string_equals(&ep._locator._address, &str) == true);
+    assert(_z_endpoint_unixsock_stream_valid(&ep) == _Z_RES_OK);
+    assert(_z_endpoint_unixsock_dgram_valid(&ep) != _Z_RES_OK);
+    _z_endpoint_clear(&ep);
+
+    str = _z_string_alias_str("unixsock-dgram/relative.sock");
+    assert(_z_endpoint_from_string(&ep, &str) == _Z_RES_OK);
+    assert(_z_endpoint_unixsock_dgram_valid(&ep) == _Z_RES_OK);
+    assert(_z_endpoint_unixsock_stream_valid(&ep) != _Z_RES_OK);
+    _z_endpoint_clear(&ep);
+
+    // Paths must fit in sun_path
+    char long_locator[sizeof("unixsock-stream/") + _Z_UNIXSOCK_PATH_MAX];
+    memcpy(long_locator, "unixsock-stream/", strlen("unixsock-stream/"));
+    memset(&long_locator[strlen("unixsock-stream/")], 'a', _Z_UNIXSOCK_PATH_MAX);
+    long_locator[sizeof(long_locator) - 1] = '\0';
+    str = _z_string_alias_str(long_locator);
+    assert(_z_endpoint_from_string(&ep, &str) == _Z_RES_OK);
+    assert(_z_endpoint_unixsock_stream_valid(&ep) != _Z_RES_OK);
+    _z_endpoint_clear(&ep);
+
+    str = _z_string_alias_str("unixsock-stream/");
+    assert(_z_endpoint_from_string(&ep, &str) == _Z_ERR_CONFIG_LOCATOR_INVALID);
+    _z_endpoint_clear(&ep);
+#endif
+
     return 0;
 }
@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/transport/socket.h"
+#include "zenoh-pico/link/transport/tcp.h"
+#include "zenoh-pico/system/platform/unix/io_uring.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if defined(ZENOH_LINUX) && Z_FEATURE_IO_URING == 1
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define SOCKET_NB 128
+// Together more than the provided buffers of a ring hold
+#define RECV_SOCKET_NB 8
+#define RECV_LEN (Z_IO_URING_RECV_BUFFER_NB * Z_IO_URING_RECV_BUFFER_SIZE / 4)
+#define SEND_SOCKET_NB 40
+#define SEND_LEN 1000
+
+typedef struct {
+    _z_sys_net_socket_t sock;
+    int other;
+    bool ready;
+    bool in_set;
+} entry_t;
+
+typedef struct {
+    entry_t entries[SOCKET_NB];
+    size_t len;
+} set_t;
+
+static void iter_reset(_z_socket_wait_iter_t *iter) { iter->_current_entry = NULL; }
+
+static bool iter_next(_z_socket_wait_iter_t *iter) {
+    set_t *set = (set_t *)iter->_ctx;
+    entry_t *e = (entry_t *)iter->_current_entry;
+    e = (e == NULL) ? &set->entries[0] : e + 1;
+    while ((e < &set->entries[set->len]) && !e->in_set) {
+        e++;
+    }
+    iter->_current_entry = (e < &set->entries[set->len]) ? e : NULL;
+    return iter->_current_entry != NULL;
+}
+
+static const _z_sys_net_socket_t *iter_get_socket(const _z_socket_wait_iter_t *iter) {
+    return &((entry_t *)iter->_current_entry)->sock;
+}
+
+static void iter_set_ready(_z_socket_wait_iter_t *iter, bool ready) {
+    ((entry_t *)iter->_current_entry)->ready = ready;
+}
+
+static void open_entry(entry_t *e) {
+    int fds[2];
+    assert(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+    e->sock._fd = fds[0];
+    e->other = fds[1];
+    e->ready = false;
+    e->in_set = true;
+}
+
+static void close_entry(entry_t *e) {
+    _z_socket_close(&e->sock);
+    close(e->other);
+    e->in_set = false;
+}
+
+static void wait_set(set_t *set, uint32_t timeout_ms) {
+    _z_socket_wait_iter_t iter = {
+        ._ctx = set,
+        ._current_entry = NULL,
+        ._reset = iter_reset,
+        ._next = iter_next,
+        ._get_socket = iter_get_socket,
+        ._set_ready = iter_set_ready,
+    };
+    assert(_z_socket_wait_readable(&iter, timeout_ms) == _Z_RES_OK);
+}
+
+static size_t count_ready(const set_t *set) {
+    size_t n = 0;
+    for (size_t i = 0; i < set->len; i++) {
+        n += set->entries[i].ready ? 1 : 0;
+    }
+    return n;
+}
+
+static void test_readiness(void) {
+    printf("Test: readiness is reported for the readable sockets only, as long as data is pending\n");
+    static set_t set;
+    set.len = SOCKET_NB;
+    for (size_t i = 0; i < set.len; i++) {
+        open_entry(&set.entries[i]);
+    }
+
+    z_clock_t start = z_clock_now();
+    wait_set(&set, 50);
+    assert(count_ready(&set) == 0);
+    assert(z_clock_elapsed_ms(&start) >= 40);
+
+    uint8_t byte = 1;
+    assert(write(set.entries[7].other, &byte, 1) == 1);
+    assert(write(set.entries[100].other, &byte, 1) == 1);
+    wait_set(&set, 1000);
+    assert(count_ready(&set) == 2);
+    assert(set.entries[7].ready && set.entries[100].ready);
+
+    // Sockets that were not read stay readable
+    wait_set(&set, 1000);
+    assert(count_ready(&set) == 2);
+    assert(read(set.entries[7].sock._fd, &byte, 1) == 1);
+    wait_set(&set, 1000);
+    assert(count_ready(&set) == 1);
+    assert(set.entries[100].ready);
+    assert(read(set.entries[100].sock._fd, &byte, 1) == 1);
+    wait_set(&set, 10);
+    assert(count_ready(&set) == 0);
+
+    // Sockets left out of the set are not reported
+    set.entries[3].in_set = false;
+    assert(write(set.entries[3].other, &byte, 1) == 1);
+    wait_set(&set, 10);
+    assert(count_ready(&set) == 0);
+    set.entries[3].in_set = true;
+    wait_set(&set, 1000);
+    assert(count_ready(&set) == 1);
+    assert(set.entries[3].ready);
+
+    // Peer shutdown makes the socket readable
+    close(set.entries[50].other);
+    set.entries[50].other = -1;
+    wait_set(&set, 1000);
+    assert(set.entries[50].ready);
+
+    for (size_t i = 0; i < set.len; i++) {
+        close_entry(&set.entries[i]);
+    }
+}
+
+static void test_reused_descriptor(void) {
+    printf("Test: a closed socket whose descriptor number is reused is waited on as the new socket\n");
+    static set_t set;
+    set.len = 2;
+    open_entry(&set.entries[0]);
+    open_entry(&set.entries[1]);
+    wait_set(&set, 10);
+    assert(count_ready(&set) == 0);
+
+    int fd = set.entries[0].sock._fd;
+    close_entry(&set.entries[0]);
+    open_entry(&set.entries[0]);
+    assert(set.entries[0].sock._fd == fd);
+    uint8_t byte = 1;
+    assert(write(set.entries[0].other, &byte, 1) == 1);
+    wait_set(&set, 1000);
+    assert(count_ready(&set) == 1);
+    assert(set.entries[0].ready);
+
+    close_entry(&set.entries[0]);
+    close_entry(&set.entries[1]);
+}
+
+static void test_empty(void) {
+    printf("Test: waiting on no socket returns right away\n");
+    static set_t set;
+    set.len = 0;
+    z_clock_t start = z_clock_now();
+    wait_set(&set, 1000);
+    assert(z_clock_elapsed_ms(&start) < 500);
+}
+
+static void fill(uint8_t *buf, size_t len, size_t seed) {
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)((i * 7) + seed);
+    }
+}
+
+// Reads from a socket like the peer read task does: once it is reported readable, without blocking
+static void read_entry(set_t *set, entry_t *e, uint8_t *buf, size_t len) {
+    size_t n = 0;
+    while (n < len) {
+        wait_set(set, 1000);
+        if (!e->ready) {
+            continue;
+        }
+        size_t rb = _z_tcp_read(e->sock, &buf[n], len - n);
+        if (rb == SIZE_MAX) {
+            continue;
+        }
+        assert(rb != 0);
+        n += rb;
+    }
+}
+
+static void open_nonblocking_entry(entry_t *e) {
+    open_entry(e);
+    assert(_z_socket_set_blocking(&e->sock, false) == _Z_RES_OK);
+}
+
+static void test_multishot_recv(void) {
+    printf("Test: data of the sockets read by the waiting thread is received in order, even past the buffers\n");
+    static set_t set;
+    static uint8_t expected[RECV_LEN];
+    static uint8_t buf[RECV_LEN];
+    set.len = RECV_SOCKET_NB;
+    for (size_t i = 0; i < set.len; i++) {
+        open_nonblocking_entry(&set.entries[i]);
+    }
+
+    // The first reads use recv, the data that follows is received by multishot requests
+    for (size_t i = 0; i < set.len; i++) {
+        uint8_t byte = (uint8_t)i;
+        assert(write(set.entries[i].other, &byte, 1) == 1);
+        read_entry(&set, &set.entries[i], buf, 1);
+        assert(buf[0] == (uint8_t)i);
+    }
+    for (size_t i = 0; i < set.len; i++) {
+        fill(expected, RECV_LEN, i);
+        assert(write(set.entries[i].other, expected, RECV_LEN) == RECV_LEN);
+    }
+    // Sockets whose request ran out of buffers are read from the buffers first, then with recv
+    for (size_t i = 0; i < set.len; i++) {
+        fill(expected, RECV_LEN, i);
+        memset(buf, 0, sizeof(buf));
+        read_entry(&set, &set.entries[i], buf, RECV_LEN);
+        assert(memcmp(buf, expected, RECV_LEN) == 0);
+    }
+
+    uint8_t byte = 42;
+    assert(write(set.entries[0].other, &byte, 1) == 1);
+    wait_set(&set, 1000);
+    assert(set.entries[0].ready);
+    bool in_buffers = (recv(set.entries[0].sock._fd, buf, 1, MSG_PEEK | MSG_DONTWAIT) < 0) && (errno == EAGAIN);
+    printf("multishot receive %s\n", in_buffers ? "in use" : "unavailable, using recv");
+    read_entry(&set, &set.entries[0], buf, 1);
+    assert(buf[0] == 42);
+
+    // Peer shutdown is reported once the received data has been read
+    assert(write(set.entries[1].other, &byte, 1) == 1);
+    close(set.entries[1].other);
+    set.entries[1].other = -1;
+    read_entry(&set, &set.entries[1], buf, 1);
+    assert(buf[0] == 42);
+    wait_set(&set, 1000);
+    assert(set.entries[1].ready);
+    assert(_z_tcp_read(set.entries[1].sock, buf, 1) == 0);
+
+    // A socket opened on the descriptor number of a closed one does not get its data
+    assert(write(set.entries[2].other, &byte, 1) == 1);
+    wait_set(&set, 1000);
+    close_entry(&set.entries[2]);
+    open_nonblocking_entry(&set.entries[2]);
+    byte = 7;
+    assert(write(set.entries[2].other, &byte, 1) == 1);
+    read_entry(&set, &set.entries[2], buf, 1);
+    assert(buf[0] == 7);
+
+    for (size_t i = 0; i < set.len; i++) {
+        close_entry(&set.entries[i]);
+    }
+}
+
+static void test_batched_send(void) {
+    printf("Test: a buffer is sent on several sockets at once, sockets that would block do not hold the others\n");
+    static set_t set;
+    set.len = SEND_SOCKET_NB;
+    _z_sys_net_socket_t *sockets[SEND_SOCKET_NB];
+    for (size_t i = 0; i < set.len; i++) {
+        open_entry(&set.entries[i]);
+        sockets[i] = &set.entries[i].sock;
+    }
+    uint8_t msg[SEND_LEN];
+    uint8_t buf[SEND_LEN];
+    fill(msg, sizeof(msg), 3);
+    size_t sent = _z_io_uring_send(msg, sizeof(msg), sockets, set.len);
+    if (sent == SIZE_MAX) {
+        printf("io_uring unavailable, skipping\n");
+    } else {
+        assert(sent == set.len);
+        for (size_t i = 0; i < set.len; i++) {
+            assert(read(set.entries[i].other, buf, sizeof(buf)) == (ssize_t)sizeof(buf));
+            assert(memcmp(buf, msg, sizeof(msg)) == 0);
+        }
+
+        while (send(set.entries[0].sock._fd, msg, sizeof(msg), MSG_DONTWAIT) > 0) {
+        }
+        assert(_z_io_uring_send(msg, sizeof(msg), sockets, 2) == 1);
+        assert(read(set.entries[1].other, buf, sizeof(buf)) == (ssize_t)sizeof(buf));
+    }
+
+    for (size_t i = 0; i < set.len; i++) {
+        close_entry(&set.entries[i]);
+    }
+}
+
+int main(void) {
+    // Fail instead of blocking forever if some data is lost
+    alarm(60);
+    printf("io_uring backend %s\n", _z_io_uring_is_available() ? "enabled" : "unavailable, using select");
+    test_readiness();
+    test_reused_descriptor();
+    test_empty();
+    test_multishot_recv();
+    test_batched_send();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
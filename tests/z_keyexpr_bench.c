@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+// In-process benchmark of key expression matching, as done for every subscription on a cache miss. Each subscription
+// below is matched against the topic tree of a robot fleet and the average time per match is printed as CSV, for the
+// generic matching and the matcher precompiled at declaration time:
+//
+//   operation,subscription,keys,matches,iterations,ns_per_match
+//
+// Build the library with Z_KEYEXPR_SIMD=0 to compare against the scalar chunk scans.
+//
+// Usage: z_keyexpr_bench [iterations] [robots]
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico/session/keyexpr.h"
+#include "zenoh-pico/system/platform.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define DEFAULT_ITERATIONS 200
+#define DEFAULT_ROBOTS 64
+#define KEY_SIZE 128
+
+// Published by every robot, under fleet/<site>/robot_<id>/
+static const char *topics[] = {
+    "odometry/filtered",
+    "cmd_vel",
+    "battery/state_of_charge",
+    "battery/cell_temperatures",
+    "sensors/lidar/front_upper/points_compressed",
+    "sensors/lidar/rear_lower/points_compressed",
+    "sensors/camera/front_left/image_rect_color",
+    "sensors/camera/front_right/image_rect_color",
+    "sensors/imu/orientation_covariance",
+    "navigation/global_planner/planned_trajectory",
+    "navigation/local_costmap/obstacle_layer_footprint",
+    "diagnostics/motor_controllers/left_wheel_status",
+    "@telemetry/firmware/bootloader_version_string",
+};
+static const char *sites[] = {"warehouse_north_distribution_center", "warehouse_south_distribution_center",
+                              "cross_dock_terminal_eastern_region"};
+
+static const char *subscriptions[] = {
+    "fleet/warehouse_north_distribution_center/robot_17/sensors/lidar/front_upper/points_compressed",
+    "fleet/**",
+    "fleet/*/*/battery/state_of_charge",
+    "fleet/warehouse_$*/**/sensors/camera/*/image_rect_color",
+    "fleet/**/navigation/local_costmap/obstacle_layer_footprint",
+    "**/sensors/lidar/*/points_$*",
+    "fleet/*/robot_1$*/diagnostics/**",
+    "fleet/cross_dock_terminal_eastern_region/*/navigation/global_planner/planned_trajectory",
+    "**/@telemetry/**",
+};
+
+static size_t gen_keys(_z_keyexpr_t **out, size_t robots) {
+    size_t topics_len = sizeof(topics) / sizeof(topics[0]);
+    size_t sites_len = sizeof(sites) / sizeof(sites[0]);
+    size_t len = robots * topics_len;
+    _z_keyexpr_t *keys = (_z_keyexpr_t *)z_malloc(len * sizeof(_z_keyexpr_t));
+    assert(keys != NULL);
+    char buf[KEY_SIZE];
+    for (size_t r = 0; r < robots; r++) {
+        for (size_t t = 0; t < topics_len; t++) {
+            snprintf(buf, sizeof(buf), "fleet/%s/robot_%zu/%s", sites[r % sites_len], r, topics[t]);
+            _z_string_t str = _z_string_alias_str(buf);
+            assert(_z_keyexpr_from_string(&keys[r * topics_len + t], &str) == _Z_RES_OK);
+        }
+    }
+    *out = keys;
+    return len;
+}
+
+typedef enum { OP_INTERSECTS, OP_INCLUDES, OP_MATCHER_INTERSECTS } bench_op_t;
+static const char *op_names[] = {"intersects", "includes", "matcher_intersects"};
+
+static size_t match_all(bench_op_t op, const _z_keyexpr_matcher_t *m, const _z_keyexpr_t *sub,
+                        const _z_keyexpr_t *keys, size_t len) {
+    size_t matches = 0;
+    for (size_t i = 0; i < len; i++) {
+        bool match;
+        switch (op) {
+            case OP_INTERSECTS:
+                match = _z_keyexpr_intersects(sub, &keys[i]);
+                break;
+            case OP_INCLUDES:
+                match = _z_keyexpr_includes(sub, &keys[i]);
+                break;
+            default:
+                match = _z_keyexpr_matcher_intersects(m, sub, &keys[i]);
+                break;
+        }
+        if (match) {
+            matches++;
+        }
+    }
+    return matches;
+}
+
+static void run(bench_op_t op, const char *expr, const _z_keyexpr_t *keys, size_t len, size_t iterations) {
+    _z_keyexpr_t sub = _z_keyexpr_alias_from_str(expr);
+    _z_keyexpr_matcher_t m;
+    assert(_z_keyexpr_matcher_compile(&m, &sub) == _Z_RES_OK);
+    // Warm-up
+    size_t matches = match_all(op, &m, &sub, keys, len);
+    z_clock_t start = z_clock_now();
+    size_t total = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        total += match_all(op, &m, &sub, keys, len);
+    }
+    unsigned long elapsed_us = z_clock_elapsed_us(&start);
+    assert(total == matches * iterations);
+    printf("%s,%s,%zu,%zu,%zu,%.1f\n", op_names[op], expr, len, matches, iterations,
+           (double)elapsed_us * 1000.0 / (double)(iterations * len));
+    fflush(stdout);
+    _z_keyexpr_matcher_clear(&m);
+}
+
+int main(int argc, char **argv) {
+    size_t iterations = DEFAULT_ITERATIONS;
+    size_t robots = DEFAULT_ROBOTS;
+    if (argc > 1) {
+        iterations = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (argc > 2) {
+        robots = (size_t)strtoul(argv[2], NULL, 10);
+    }
+    if (iterations == 0 || robots == 0) {
+        fprintf(stderr, "Usage: %s [iterations > 0] [robots > 0]\n", argv[0]);
+        return -1;
+    }
+
+    _z_keyexpr_t *keys = NULL;
+    size_t len = gen_keys(&keys, robots);
+    printf("operation,subscription,keys,matches,iterations,ns_per_match\n");
+    for (size_t i = 0; i < sizeof(subscriptions) / sizeof(subscriptions[0]); i++) {
+        run(OP_INTERSECTS, subscriptions[i], keys, len, iterations);
+        run(OP_INCLUDES, subscriptions[i], keys, len, iterations);
+        run(OP_MATCHER_INTERSECTS, subscriptions[i], keys, len, iterations);
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        _z_keyexpr_clear(&keys[i]);
+    }
+    z_free(keys);
+    return 0;
+}
@@ -11,8 +11,10 @@
 // Contributors:
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "zenoh-pico/api/primitives.h"
 #include "zenoh-pico/session/keyexpr.h"
@@ -439,6 +441,121 @@ void test_relation_to(void) {
            Z_KEYEXPR_INTERSECTION_LEVEL_DISJOINT);
 }
 
+#define LONG_CHUNK_LEN 48
+
+static bool long_chunk_intersects(const char *a, const char *b) {
+    _z_keyexpr_t ke_a = _z_keyexpr_alias_from_str(a);
+    _z_keyexpr_t ke_b = _z_keyexpr_alias_from_str(b);
+    return _z_keyexpr_intersects(&ke_a, &ke_b);
+}
+
+static bool long_chunk_includes(const char *a, const char *b) {
+    _z_keyexpr_t ke_a = _z_keyexpr_alias_from_str(a);
+    _z_keyexpr_t ke_b = _z_keyexpr_alias_from_str(b);
+    return _z_keyexpr_includes(&ke_a, &ke_b);
+}
+
+// Chunks spanning several 16-byte blocks, with the mismatch or the stardsl at every position
+void test_long_chunks(void) {
+    char chunk[LONG_CHUNK_LEN + 1];
+    for (size_t i = 0; i < LONG_CHUNK_LEN; i++) {
+        chunk[i] = (char)('a' + i % 26);
+    }
+    chunk[LONG_CHUNK_LEN] = '\0';
+    char a[256], b[256];
+
+    snprintf(a, sizeof(a), "*/%s/x", chunk);
+    snprintf(b, sizeof(b), "p/%s/x", chunk);
+    assert(long_chunk_intersects(a, b) && long_chunk_includes(a, b));
+    snprintf(a, sizeof(a), "**/%s", chunk);
+    snprintf(b, sizeof(b), "p/q/%s", chunk);
+    assert(long_chunk_intersects(a, b) && long_chunk_includes(a, b));
+
+    for (size_t i = 0; i < LONG_CHUNK_LEN; i++) {
+        char other[LONG_CHUNK_LEN + 1];
+        memcpy(other, chunk, sizeof(other));
+        other[i] = 'Z';
+        snprintf(a, sizeof(a), "*/%s/x", chunk);
+        snprintf(b, sizeof(b), "p/%s/x", other);
+        assert(!long_chunk_intersects(a, b) && !long_chunk_includes(a, b));
+        snprintf(a, sizeof(a), "**/%s", chunk);
+        snprintf(b, sizeof(b), "p/q/%s", other);
+        assert(!long_chunk_intersects(a, b) && !long_chunk_includes(a, b));
+
+        // Splitting the chunk with a delimiter, away from its ends not to make empty chunks
+        if (i > 0 && i < LONG_CHUNK_LEN - 1) {
+            other[i] = '/';
+            snprintf(b, sizeof(b), "p/q/%s", other);
+            assert(!long_chunk_intersects(a, b) && !long_chunk_includes(a, b));
+        }
+
+        // A lone stardsl is not canonical
+        if (i == 0) {
+            continue;
+        }
+
+        // Leading part followed by a stardsl, matched forward then backward
+        snprintf(a, sizeof(a), "*/%.*s$*/x", (int)i, chunk);
+        snprintf(b, sizeof(b), "p/%s/x", chunk);
+        assert(long_chunk_intersects(a, b) && long_chunk_includes(a, b));
+        snprintf(a, sizeof(a), "**/%.*s$*", (int)i, chunk);
+        snprintf(b, sizeof(b), "p/q/%s", chunk);
+        assert(long_chunk_intersects(a, b) && long_chunk_includes(a, b));
+
+        // Trailing part preceded by a stardsl
+        snprintf(a, sizeof(a), "*/$*%s/x", chunk + i);
+        snprintf(b, sizeof(b), "p/%s/x", chunk);
+        assert(long_chunk_intersects(a, b) && long_chunk_includes(a, b));
+        snprintf(a, sizeof(a), "**/$*%s", chunk + i);
+        snprintf(b, sizeof(b), "p/q/%s", chunk);
+        assert(long_chunk_intersects(a, b) && long_chunk_includes(a, b));
+
+        // The stardsl in the right one only matches for intersects
+        snprintf(a, sizeof(a), "*/%s/x", chunk);
+        snprintf(b, sizeof(b), "p/%.*s$*/x", (int)i, chunk);
+        assert(long_chunk_intersects(a, b) && !long_chunk_includes(a, b));
+    }
+}
+
+// The precompiled matcher agrees with the generic matching on every pair
+void test_matcher(void) {
+    const char *lefts[] = {"a/b/c",     "a/*/c",     "a/**",      "**",        "**/c",       "a/**/c",    "*/b/*",
+                           "a/b/*",     "@a/**",     "a/@b/*",    "a/**/@b/c", "a/*$*/c",    "a/**/b/**", "*",
+                           "a/b/*/c/d", "**/b/c/d",  "a/b/**/c",  "a/b/**/c/d", "**/@a/**",  "a/*/**",    "*/*/*/*",
+                           "a",         "a/b/c/d/e"};
+    const char *rights[] = {"a",       "a/b",       "a/b/c",   "a/c",     "a/x/y/c", "b/b/c",    "a/b/c/d/e",
+                            "@a",      "@a/b",      "a/@b/c",  "a/@b",    "a/x/@b/c", "@a/b/c",  "a/bb/c",
+                            "a/*/c",   "a/**",      "a/xyz$*/c", "c",     "x/y/z/c", "a/b/b",    "a/b/c/d",
+                            "a/b/x/c/d", "a/bc/d",  "a/b/c/dd", "x/a/b/c/d", "ab/c", "a/b/c/c/d", "a/b/@x/c"};
+    for (size_t i = 0; i < sizeof(lefts) / sizeof(lefts[0]); i++) {
+        _z_keyexpr_t left;
+        _z_string_t str = _z_string_alias_str(lefts[i]);
+        assert(_z_keyexpr_from_string(&left, &str) == _Z_RES_OK);
+        _z_keyexpr_matcher_t m;
+        assert(_z_keyexpr_matcher_compile(&m, &left) == _Z_RES_OK);
+        for (size_t j = 0; j < sizeof(rights) / sizeof(rights[0]); j++) {
+            _z_keyexpr_t right = _z_keyexpr_alias_from_str(rights[j]);
+            assert(_z_keyexpr_matcher_intersects(&m, &left, &right) == _z_keyexpr_intersects(&left, &right));
+            assert(_z_keyexpr_matcher_includes(&m, &left, &right) == _z_keyexpr_includes(&left, &right));
+        }
+        _z_keyexpr_matcher_clear(&m);
+        _z_keyexpr_clear(&left);
+    }
+
+    _z_keyexpr_t key = _z_keyexpr_alias_from_str("a/b/c");
+    _z_keyexpr_matcher_t m;
+    assert(_z_keyexpr_matcher_compile(&m, &key) == _Z_RES_OK && m._kind == _Z_KEYEXPR_MATCHER_EXACT);
+    key = _z_keyexpr_alias_from_str("a/*/**/c/d");
+    assert(_z_keyexpr_matcher_compile(&m, &key) == _Z_RES_OK && m._kind == _Z_KEYEXPR_MATCHER_CHUNKS);
+    assert(m._len == 4 && m._double_star == 2 && m._segments[1]._is_star);
+    assert(m._segments[3]._begin == 7 && m._segments[3]._len == 3);
+    _z_keyexpr_matcher_clear(&m);
+    key = _z_keyexpr_alias_from_str("a/**/b/**");
+    assert(_z_keyexpr_matcher_compile(&m, &key) == _Z_RES_OK && m._kind == _Z_KEYEXPR_MATCHER_GENERIC);
+    key = _z_keyexpr_alias_from_str("a/b$*");
+    assert(_z_keyexpr_matcher_compile(&m, &key) == _Z_RES_OK && m._kind == _Z_KEYEXPR_MATCHER_GENERIC);
+}
+
 void test_non_wild_prefix_len(void) {
     _z_keyexpr_t ke1, ke2, ke3, ke4, ke5;
     ke1 = _z_keyexpr_alias_from_str("foo/bar/**");
@@ -457,6 +574,8 @@ void test_non_wild_prefix_len(void) {
 int main(void) {
     test_intersects();
     test_includes();
+    test_long_chunks();
+    test_matcher();
     test_canonize();
     test_equals();
     test_keyexpr_constructor();
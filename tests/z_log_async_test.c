@@ -0,0 +1,159 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+#include "zenoh-pico/collections/atomic.h"
+#include "zenoh-pico/utils/logging.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_ASYNC_LOG == 1
+
+#define CAPTURE_SIZE 64
+#define WRITERS 4
+#define RECORDS_PER_WRITER 1000
+
+typedef struct {
+    char records[CAPTURE_SIZE][Z_LOG_ASYNC_RECORD_SIZE];
+    char last[Z_LOG_ASYNC_RECORD_SIZE];
+    size_t len;
+    size_t total;
+    _z_atomic_bool_t blocked;
+} capture_t;
+
+static capture_t capture;
+
+// Only called from the drain task, and read once the backend is stopped
+static void capture_sink(const char *record, size_t len, void *arg) {
+    capture_t *c = (capture_t *)arg;
+    while (_z_atomic_bool_load(&c->blocked, _z_memory_order_acquire)) {
+        z_sleep_ms(1);
+    }
+    assert(len < Z_LOG_ASYNC_RECORD_SIZE);
+    memcpy(c->last, record, len);
+    c->last[len] = '\0';
+    if (c->len < CAPTURE_SIZE) {
+        memcpy(c->records[c->len], c->last, len + 1);
+        c->len++;
+    }
+    c->total++;
+}
+
+static void capture_reset(bool blocked) {
+    memset(&capture, 0, sizeof(capture));
+    _z_atomic_bool_init(&capture.blocked, blocked);
+}
+
+static void test_records(void) {
+    printf("Test: records are formatted and written to the sink\n");
+    capture_reset(false);
+    assert(zp_log_async_start(capture_sink, &capture) == _Z_RES_OK);
+    // Only one backend at a time
+    assert(zp_log_async_start(capture_sink, &capture) != _Z_RES_OK);
+    _z_log_write("INFO", "test_records", true, "first %d", 1);
+    _z_log_write("ERROR", "test_records", false, "second %s", "record");
+    assert(zp_log_async_stop() == _Z_RES_OK);
+    assert(zp_log_async_stop() != _Z_RES_OK);
+
+    assert(capture.len == 2);
+    assert(strstr(capture.records[0], " INFO ::test_records] first 1\r\n") != NULL);
+    assert(capture.records[0][0] == '[');
+    assert(strstr(capture.records[1], " ERROR ::test_records] second record") != NULL);
+    assert(strstr(capture.records[1], "\r\n") == NULL);
+    assert(zp_log_async_dropped() == 0);
+}
+
+static void test_truncation(void) {
+    printf("Test: truncated records keep their line ending\n");
+    capture_reset(false);
+    char msg[2 * Z_LOG_ASYNC_RECORD_SIZE];
+    memset(msg, 'x', sizeof(msg) - 1);
+    msg[sizeof(msg) - 1] = '\0';
+    assert(zp_log_async_start(capture_sink, &capture) == _Z_RES_OK);
+    _z_log_write("WARN", "test_truncation", true, "%s", msg);
+    assert(zp_log_async_stop() == _Z_RES_OK);
+
+    assert(capture.len == 1);
+    size_t len = strlen(capture.records[0]);
+    assert(len == Z_LOG_ASYNC_RECORD_SIZE - 1);
+    assert(strcmp(capture.records[0] + len - 2, "\r\n") == 0);
+}
+
+static void test_dropped(void) {
+    printf("Test: records logged while the ring is full are dropped and reported\n");
+    capture_reset(true);
+    assert(zp_log_async_start(capture_sink, &capture) == _Z_RES_OK);
+    // The sink blocks, records only return to the ring once written
+    size_t logged = 2 * Z_LOG_ASYNC_RING_SIZE;
+    for (size_t i = 0; i < logged; i++) {
+        _z_log_write("DEBUG", "test_dropped", true, "record %zu", i);
+    }
+    size_t dropped = zp_log_async_dropped();
+    assert(dropped == logged - Z_LOG_ASYNC_RING_SIZE);
+    _z_atomic_bool_store(&capture.blocked, false, _z_memory_order_release);
+    assert(zp_log_async_stop() == _Z_RES_OK);
+
+    // Kept records plus the drop notice
+    assert(capture.total == logged - dropped + 1);
+    assert(strstr(capture.records[0], "record 0\r\n") != NULL);
+    char notice[64];
+    snprintf(notice, sizeof(notice), " WARN ::_z_log_drain] Dropped %zu log records\r\n", dropped);
+    assert(strstr(capture.last, notice) != NULL);
+}
+
+static void *writer_task(void *arg) {
+    size_t id = *(size_t *)arg;
+    for (size_t i = 0; i < RECORDS_PER_WRITER; i++) {
+        _z_log_write("INFO", "writer_task", true, "writer %zu record %zu", id, i);
+    }
+    return NULL;
+}
+
+static void test_concurrent_writers(void) {
+    printf("Test: concurrent writers\n");
+    capture_reset(false);
+    assert(zp_log_async_start(capture_sink, &capture) == _Z_RES_OK);
+    _z_task_t tasks[WRITERS];
+    size_t ids[WRITERS];
+    for (size_t i = 0; i < WRITERS; i++) {
+        ids[i] = i;
+        assert(_z_task_init(&tasks[i], NULL, writer_task, &ids[i]) == _Z_RES_OK);
+    }
+    for (size_t i = 0; i < WRITERS; i++) {
+        assert(_z_task_join(&tasks[i]) == _Z_RES_OK);
+    }
+    assert(zp_log_async_stop() == _Z_RES_OK);
+
+    // Every record is either written or counted as dropped, the drop notices come on top
+    size_t dropped = zp_log_async_dropped();
+    assert(capture.total >= WRITERS * RECORDS_PER_WRITER - dropped);
+}
+
+int main(void) {
+    test_records();
+    test_truncation();
+    test_dropped();
+    test_concurrent_writers();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
@@ -113,6 +113,9 @@ void print_transport_message_type(uint8_t header) {
         case _Z_MID_T_FRAGMENT:
             printf("Frame message");
             break;
+        case _Z_MID_T_OAM:
+            printf("OAM message");
+            break;
         default:
             assert(0);
             break;
@@ -387,6 +390,41 @@ void zint(void) {
     _z_wbuf_clear(&wbf);
 }
 
+void zint_boundaries(void) {
+    printf("\n>> ZINT boundaries\n");
+    // Values around each encoded length, decoded both with and without enough trailing bytes for a word load
+    for (uint8_t bits = 0; bits <= 64; bits++) {
+        uint64_t base = (bits == 64) ? UINT64_MAX : (UINT64_C(1) << bits);
+        uint64_t values[] = {base - 1, base, base + 1};
+        for (size_t i = 0; i < _ZP_ARRAY_SIZE(values); i++) {
+            uint64_t e_z = values[i];
+            uint8_t len = _z_zint_len(e_z);
+            assert(len >= 1 && len <= 9);
+            for (size_t padding = 0; padding <= 8; padding += 8) {
+                _z_wbuf_t wbf = _z_wbuf_make(32, false);
+                assert(_z_zint64_encode(&wbf, e_z) == _Z_RES_OK);
+                assert(_z_wbuf_len(&wbf) == len);
+                for (size_t j = 0; j < padding; j++) {
+                    assert(_z_wbuf_write(&wbf, 0xff) == _Z_RES_OK);
+                }
+                _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+                uint64_t d_z = 0;
+                assert(_z_zint64_decode(&d_z, &zbf) == _Z_RES_OK);
+                assert(e_z == d_z);
+                assert(_z_zbuf_len(&zbf) == padding);
+                _z_zbuf_clear(&zbf);
+                _z_wbuf_clear(&wbf);
+            }
+        }
+    }
+    // Truncated zint
+    uint8_t truncated[] = {0x80, 0x80, 0x80};
+    _z_zbuf_t zbf = _z_slice_as_zbuf(_z_slice_alias_buf(truncated, sizeof(truncated)));
+    uint64_t d_z = 0;
+    assert(_z_zint64_decode(&d_z, &zbf) != _Z_RES_OK);
+    _z_zbuf_clear(&zbf);
+}
+
 /*=============================*/
 /*  Zenoh Messages Extensions  */
 /*=============================*/
@@ -1825,11 +1863,19 @@ void join_message(void) {
 }
 
 _z_transport_message_t gen_init(void) {
+    _z_transport_message_t msg;
     if (gen_bool()) {
-        return _z_t_msg_make_init_syn(_z_whatami_from_uint8((gen_uint8() % 3)), gen_zid());
+        msg = _z_t_msg_make_init_syn(_z_whatami_from_uint8((gen_uint8() % 3)), gen_zid());
     } else {
-        return _z_t_msg_make_init_ack(_z_whatami_from_uint8((gen_uint8() % 3)), gen_zid(), gen_slice(16));
+        msg = _z_t_msg_make_init_ack(_z_whatami_from_uint8((gen_uint8() % 3)), gen_zid(), gen_slice(16));
     }
+#if Z_FEATURE_COMPRESSION == 1
+    if (gen_bool()) {
+        msg._body._init._compression = true;
+        _Z_SET_FLAG(msg._header, _Z_FLAG_T_Z);
+    }
+#endif
+    return msg;
 }
 void assert_eq_init(const _z_t_msg_init_t *left, const _z_t_msg_init_t *right) {
     assert(left->_batch_size == right->_batch_size);
@@ -1839,6 +1885,9 @@ void assert_eq_init(const _z_t_msg_init_t *left, const _z_t_msg_init_t *right) {
     assert(memcmp(left->_zid.id, right->_zid.id, 16) == 0);
     assert(left->_version == right->_version);
     assert(left->_whatami == right->_whatami);
+#if Z_FEATURE_COMPRESSION == 1
+    assert(left->_compression == right->_compression);
+#endif
 }
 void init_message(void) {
     printf("\n>> Init message\n");
@@ -2049,8 +2098,31 @@ void fragment_message(void) {
     _z_wbuf_clear(&wbf);
 }
 
+_z_transport_message_t gen_t_oam(void) { return _z_t_msg_make_nack(gen_zid(), gen_zint(), gen_zint()); }
+void assert_eq_t_oam(const _z_t_msg_oam_t *left, const _z_t_msg_oam_t *right) {
+    assert(left->_id == right->_id);
+    assert(memcmp(left->_body._nack._zid.id, right->_body._nack._zid.id, 16) == 0);
+    assert(left->_body._nack._sn == right->_body._nack._sn);
+    assert(left->_body._nack._count == right->_body._nack._count);
+}
+void t_oam_message(void) {
+    printf("\n>> transport oam message\n");
+    _z_wbuf_t wbf = gen_wbuf(UINT16_MAX);
+    _z_transport_message_t expected = gen_t_oam();
+    assert(_z_t_oam_encode(&wbf, expected._header, &expected._body._oam) == _Z_RES_OK);
+    _z_t_msg_oam_t decoded = {0};
+    _z_zbuf_t zbf = _z_wbuf_to_zbuf(&wbf);
+    z_result_t ret = _z_t_oam_decode(&decoded, &zbf, expected._header);
+    assert(_Z_RES_OK == ret);
+    assert_eq_t_oam(&expected._body._oam, &decoded);
+    _z_t_msg_oam_clear(&decoded);
+    _z_t_msg_clear(&expected);
+    _z_zbuf_clear(&zbf);
+    _z_wbuf_clear(&wbf);
+}
+
 _z_transport_message_t gen_transport(void) {
-    switch (gen_uint8() % 5) {
+    switch (gen_uint8() % 6) {
         case 0: {
             return gen_join();
         };
@@ -2063,8 +2135,11 @@ _z_transport_message_t gen_transport(void) {
         case 3: {
             return gen_close();
         };
-        default:
         case 4: {
+            return gen_t_oam();
+        };
+        default:
+        case 5: {
             return gen_keep_alive();
         };
     }
@@ -2087,6 +2162,9 @@ void assert_eq_transport(const _z_transport_message_t *left, const _z_transport_
         case _Z_MID_T_KEEP_ALIVE: {
             assert_eq_keep_alive(&left->_body._keep_alive, &right->_body._keep_alive);
         } break;
+        case _Z_MID_T_OAM: {
+            assert_eq_t_oam(&left->_body._oam, &right->_body._oam);
+        } break;
         default:
             assert(false);
     }
@@ -2320,6 +2398,7 @@ int main(void) {
 
         // Core
         zint();
+        zint_boundaries();
 
         // Message fields
         payload_field();
@@ -2359,6 +2438,7 @@ int main(void) {
         keep_alive_message();
         frame_message();
         fragment_message();
+        t_oam_message();
         transport_message();
 
         // Scouting messages
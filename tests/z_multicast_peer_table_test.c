@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/transport/multicast/peer_table.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_MULTICAST_TRANSPORT == 1 || Z_FEATURE_RAWETH_TRANSPORT == 1
+
+#define PEER_NB 150
+#define ADDR_LEN 6
+
+static _z_transport_peer_multicast_t peers[PEER_NB];
+static uint8_t addrs[PEER_NB][ADDR_LEN];
+
+static void init_peers(_z_zint_t base_lease) {
+    memset(peers, 0, sizeof(peers));
+    for (size_t i = 0; i < PEER_NB; i++) {
+        addrs[i][0] = 0x02;
+        addrs[i][4] = (uint8_t)(i >> 8);
+        addrs[i][5] = (uint8_t)i;
+        peers[i]._remote_addr = _z_slice_alias_buf(addrs[i], ADDR_LEN);
+        peers[i]._lease = base_lease + (_z_zint_t)((i * 37) % PEER_NB);
+    }
+}
+
+static void check_heap(const _z_multicast_peer_table_t *table) {
+    for (size_t i = 0; i < table->_lease_heap_len; i++) {
+        assert(table->_lease_heap[i]->_lease_heap_idx == i);
+        if (i > 0) {
+            unsigned long parent = table->_lease_heap[(i - 1) / 2]->_lease_deadline;
+            assert(table->_lease_heap[i]->_lease_deadline - parent <= ULONG_MAX / 2);
+        }
+    }
+}
+
+static void test_lookup(void) {
+    printf("Test: peers are found by remote address and the shortest lease is tracked\n");
+    _z_multicast_peer_table_t table;
+    _z_multicast_peer_table_init(&table);
+    init_peers(1000);
+    assert(_z_multicast_peer_table_min_lease(&table, 10000) == 10000);
+    for (size_t i = 0; i < PEER_NB; i++) {
+        assert(_z_multicast_peer_table_add(&table, &peers[i]) == _Z_RES_OK);
+        assert(_z_multicast_peer_table_contains(&peers[i]));
+    }
+    check_heap(&table);
+    for (size_t i = 0; i < PEER_NB; i++) {
+        uint8_t addr[ADDR_LEN];
+        memcpy(addr, addrs[i], ADDR_LEN);
+        _z_slice_t key = _z_slice_alias_buf(addr, ADDR_LEN);
+        assert(_z_multicast_peer_table_find(&table, &key) == &peers[i]);
+    }
+    uint8_t unknown[ADDR_LEN] = {0x02, 0, 0, 0, 0xff, 0xff};
+    _z_slice_t key = _z_slice_alias_buf(unknown, ADDR_LEN);
+    assert(_z_multicast_peer_table_find(&table, &key) == NULL);
+    // Shorter addresses do not match
+    key = _z_slice_alias_buf(addrs[0], ADDR_LEN - 1);
+    assert(_z_multicast_peer_table_find(&table, &key) == NULL);
+
+    assert(_z_multicast_peer_table_min_lease(&table, 10000) == 1000);
+    assert(_z_multicast_peer_table_min_lease(&table, 500) == 500);
+    // Removing the peer with the shortest lease
+    _z_multicast_peer_table_remove(&table, &peers[0]);
+    assert(!_z_multicast_peer_table_contains(&peers[0]));
+    key = _z_slice_alias_buf(addrs[0], ADDR_LEN);
+    assert(_z_multicast_peer_table_find(&table, &key) == NULL);
+    assert(_z_multicast_peer_table_min_lease(&table, 10000) == 1001);
+    // Removing it twice is harmless
+    _z_multicast_peer_table_remove(&table, &peers[0]);
+    for (size_t i = 1; i < PEER_NB; i += 2) {
+        _z_multicast_peer_table_remove(&table, &peers[i]);
+    }
+    check_heap(&table);
+    for (size_t i = 0; i < PEER_NB; i++) {
+        key = _z_slice_alias_buf(addrs[i], ADDR_LEN);
+        _z_transport_peer_multicast_t *expected = ((i % 2 == 0) && (i != 0)) ? &peers[i] : NULL;
+        assert(_z_multicast_peer_table_find(&table, &key) == expected);
+    }
+    _z_multicast_peer_table_set_lease(&table, &peers[2], 10);
+    assert(_z_multicast_peer_table_min_lease(&table, 10000) == 10);
+    _z_multicast_peer_table_set_lease(&table, &peers[2], 5000);
+    assert(_z_multicast_peer_table_min_lease(&table, 10000) > 10);
+    check_heap(&table);
+
+    _z_multicast_peer_table_clear(&table);
+    assert(!_z_multicast_peer_table_contains(&peers[2]));
+    key = _z_slice_alias_buf(addrs[2], ADDR_LEN);
+    assert(_z_multicast_peer_table_find(&table, &key) == NULL);
+}
+
+static void test_leases(void) {
+    printf("Test: only the peers that stayed silent for a whole lease expire\n");
+    _z_multicast_peer_table_t table;
+    _z_multicast_peer_table_init(&table);
+    init_peers(50);
+    for (size_t i = 0; i < PEER_NB; i++) {
+        peers[i]._lease = 50;
+        peers[i].common._received = true;
+        assert(_z_multicast_peer_table_add(&table, &peers[i]) == _Z_RES_OK);
+    }
+    // Nothing is due yet
+    bool expired = false;
+    unsigned long wait = _z_multicast_peer_table_check_leases(&table, 1000, &expired);
+    assert(!expired);
+    assert((wait > 0) && (wait <= 50));
+    assert(_z_multicast_peer_table_check_leases(&table, 5, &expired) <= 5);
+
+    // The first check renews every peer that received
+    z_sleep_ms(60);
+    wait = _z_multicast_peer_table_check_leases(&table, 1000, &expired);
+    assert(!expired);
+    assert(wait <= 50);
+    check_heap(&table);
+    for (size_t i = 0; i < PEER_NB; i++) {
+        assert(_z_multicast_peer_table_contains(&peers[i]));
+        assert(!peers[i].common._received);
+        peers[i].common._received = (i % 3 == 0);
+    }
+
+    // The second one expires the silent ones
+    z_sleep_ms(60);
+    (void)_z_multicast_peer_table_check_leases(&table, 1000, &expired);
+    assert(expired);
+    check_heap(&table);
+    for (size_t i = 0; i < PEER_NB; i++) {
+        assert(_z_multicast_peer_table_contains(&peers[i]) == (i % 3 == 0));
+        _z_slice_t key = _z_slice_alias_buf(addrs[i], ADDR_LEN);
+        assert((_z_multicast_peer_table_find(&table, &key) != NULL) == (i % 3 == 0));
+    }
+
+    // A shorter lease brings the next check forward
+    _z_multicast_peer_table_set_lease(&table, &peers[3], 1);
+    z_sleep_ms(5);
+    expired = false;
+    (void)_z_multicast_peer_table_check_leases(&table, 1000, &expired);
+    assert(expired);
+    assert(!_z_multicast_peer_table_contains(&peers[3]));
+    assert(_z_multicast_peer_table_contains(&peers[0]));
+    _z_multicast_peer_table_clear(&table);
+    assert(_z_multicast_peer_table_check_leases(&table, 1000, &expired) == 1000);
+}
+
+int main(void) {
+    test_lookup();
+    test_leases();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
@@ -0,0 +1,346 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+// In-process publication benchmark. Two sessions are connected through an in-memory stream link, so that a put goes
+// through _z_write, batching and framing on the publisher side, and through the link read, the transport decode and
+// the subscription dispatch on the subscriber side, without any router or network. Everything runs on the calling
+// thread, the subscriber session being read explicitly after each publication.
+//
+// Throughput is measured with batching enabled, latency one message at a time. Payloads too large for the subscriber
+// side to reassemble with this configuration are skipped. Results are printed as CSV, one line per payload size and
+// subscriber count:
+//
+//   payload,subscribers,messages,msgs_per_s,mb_per_s,p50_ns,p99_ns,p999_ns
+//
+// Usage: z_pubsub_bench [messages]
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/link.h"
+#include "zenoh-pico/net/primitives.h"
+#include "zenoh-pico/net/session.h"
+#include "zenoh-pico/session/keyexpr.h"
+#include "zenoh-pico/session/utils.h"
+#include "zenoh-pico/transport/common/tx.h"
+#include "zenoh-pico/transport/transport.h"
+#include "zenoh-pico/transport/unicast/read.h"
+#include "zenoh-pico/transport/unicast/transport.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_PUBLICATION == 1 && Z_FEATURE_SUBSCRIPTION == 1 && Z_FEATURE_UNICAST_TRANSPORT == 1
+
+#define DEFAULT_MESSAGES 20000
+// Upper bound on the bytes published per run, so that large payloads do not take forever
+#define MAX_RUN_BYTES (256 * 1024 * 1024)
+#define KEYEXPR "bench/pubsub"
+
+// Room left for the message headers when checking which payloads can be delivered
+#define HEADERS_SIZE 128
+
+static const size_t payload_sizes[] = {8, 64, 256, 1024, 2048, 4096, 16384, 65536};
+static const size_t subscriber_counts[] = {1, 4, 16};
+
+/*------------------ In-memory link ------------------*/
+typedef struct {
+    uint8_t *buf;
+    size_t cap;
+    size_t r_pos;
+    size_t w_pos;
+} mem_pipe_t;
+
+// The link is the first member, so that the link callbacks can get back to the pipes
+typedef struct {
+    _z_link_t link;
+    mem_pipe_t *tx;
+    mem_pipe_t *rx;
+} mem_link_t;
+
+static size_t mem_pipe_len(const mem_pipe_t *p) { return p->w_pos - p->r_pos; }
+
+static size_t mem_link_write(const _z_link_t *self, const uint8_t *ptr, size_t len, _z_sys_net_socket_t *socket) {
+    (void)socket;
+    mem_pipe_t *p = ((const mem_link_t *)self)->tx;
+    if (p->r_pos == p->w_pos) {
+        p->r_pos = 0;
+        p->w_pos = 0;
+    }
+    if (p->w_pos + len > p->cap) {
+        size_t cap = (p->cap == 0) ? 4096 : p->cap;
+        while (p->w_pos + len > cap) {
+            cap *= 2;
+        }
+        uint8_t *buf = (uint8_t *)z_realloc(p->buf, cap);
+        if (buf == NULL) {
+            return SIZE_MAX;
+        }
+        p->buf = buf;
+        p->cap = cap;
+    }
+    memcpy(p->buf + p->w_pos, ptr, len);
+    p->w_pos += len;
+    return len;
+}
+
+static size_t mem_link_write_all(const _z_link_t *self, const uint8_t *ptr, size_t len) {
+    return mem_link_write(self, ptr, len, NULL);
+}
+
+static size_t mem_link_read(const _z_link_t *self, uint8_t *ptr, size_t len, _z_slice_t *addr) {
+    (void)addr;
+    mem_pipe_t *p = ((const mem_link_t *)self)->rx;
+    size_t n = mem_pipe_len(p);
+    if (n > len) {
+        n = len;
+    }
+    memcpy(ptr, p->buf + p->r_pos, n);
+    p->r_pos += n;
+    return n;
+}
+
+static size_t mem_link_read_exact(const _z_link_t *self, uint8_t *ptr, size_t len, _z_slice_t *addr,
+                                  _z_sys_net_socket_t *socket) {
+    (void)socket;
+    mem_pipe_t *p = ((const mem_link_t *)self)->rx;
+    if (mem_pipe_len(p) < len) {
+        return SIZE_MAX;
+    }
+    return mem_link_read(self, ptr, len, addr);
+}
+
+// Socket reads do not get the link, they read from the pipe being drained
+static mem_pipe_t *reading;
+
+static size_t mem_link_read_socket(const _z_sys_net_socket_t socket, uint8_t *ptr, size_t len) {
+    (void)socket;
+    size_t n = mem_pipe_len(reading);
+    if (n > len) {
+        n = len;
+    }
+    memcpy(ptr, reading->buf + reading->r_pos, n);
+    reading->r_pos += n;
+    return n;
+}
+
+static _z_link_t *mem_link_new(mem_pipe_t *tx, mem_pipe_t *rx) {
+    // Freed by the transport as any other link
+    mem_link_t *ml = (mem_link_t *)z_malloc(sizeof(mem_link_t));
+    assert(ml != NULL);
+    memset(ml, 0, sizeof(mem_link_t));
+    ml->tx = tx;
+    ml->rx = rx;
+    ml->link._write_f = mem_link_write;
+    ml->link._write_all_f = mem_link_write_all;
+    ml->link._read_f = mem_link_read;
+    ml->link._read_exact_f = mem_link_read_exact;
+    ml->link._read_socket_f = mem_link_read_socket;
+    ml->link._mtu = Z_BATCH_UNICAST_SIZE;
+    ml->link._cap._transport = Z_LINK_CAP_TRANSPORT_UNICAST;
+    ml->link._cap._flow = Z_LINK_CAP_FLOW_STREAM;
+    ml->link._cap._is_reliable = true;
+    return &ml->link;
+}
+
+/*------------------ Sessions ------------------*/
+// Opens a client session on the link, with the parameters a successful handshake with the remote would have produced
+static _z_session_rc_t open_session(const _z_id_t *zid, const _z_id_t *remote_zid, mem_pipe_t *tx, mem_pipe_t *rx) {
+    _z_session_t *zn = (_z_session_t *)z_malloc(sizeof(_z_session_t));
+    assert(zn != NULL);
+    assert(_z_session_init(zn, zid) == _Z_RES_OK);
+    _z_session_rc_t rc = _z_session_rc_new(zn);
+    assert(!_Z_RC_IS_NULL(&rc));
+    zn->_mode = Z_WHATAMI_CLIENT;
+
+    _z_transport_unicast_establish_param_t param = {0};
+    param._remote_zid = *remote_zid;
+    param._remote_whatami = Z_WHATAMI_PEER;
+    param._batch_size = Z_BATCH_UNICAST_SIZE;
+    param._seq_num_res = Z_SN_RESOLUTION;
+    param._req_id_res = Z_REQ_RESOLUTION;
+    param._initial_sn_tx = 0;
+    param._initial_sn_rx = 0;
+    param._lease = Z_TRANSPORT_LEASE;
+#if Z_FEATURE_FRAGMENTATION == 1
+    param._patch = _Z_CURRENT_PATCH;
+#endif
+    _z_link_t *link = mem_link_new(tx, rx);
+    assert(_z_unicast_transport_create(&zn->_tp, link, &param) == _Z_RES_OK);
+    _z_sys_net_socket_t socket;
+    memset(&socket, 0, sizeof(socket));
+    assert(_z_transport_peer_unicast_add(&zn->_tp._transport._unicast, &param, socket, false, NULL) == _Z_RES_OK);
+    _z_transport_common_t *ztc = _z_transport_get_common(&zn->_tp);
+    ztc->_session = _z_session_rc_clone_as_weak(&rc);
+    ztc->_state = _Z_TRANSPORT_STATE_OPEN;
+    return rc;
+}
+
+static void close_session(_z_session_rc_t *rc) {
+    _z_session_close(_Z_RC_IN_VAL(rc));
+    _z_session_rc_drop(rc);
+}
+
+// Processes everything the session received, running the body of its read task until the link is drained
+static void drain(_z_session_rc_t *rc, mem_pipe_t *rx) {
+    _z_transport_unicast_t *ztu = &_Z_RC_IN_VAL(rc)->_tp._transport._unicast;
+    reading = rx;
+    while (mem_pipe_len(rx) > 0 || _z_zbuf_len(&ztu->_common._zbuf) > 0) {
+        _z_fut_fn_result_t res = _zp_unicast_read_task_fn(ztu, NULL);
+        assert(res._status == _Z_FUT_STATUS_RUNNING);
+    }
+    reading = NULL;
+}
+
+/*------------------ Benchmark ------------------*/
+static size_t received;
+
+static void on_sample(_z_sample_t *sample, void *arg) {
+    (void)sample;
+    (void)arg;
+    received++;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int cmp_u64(const void *a, const void *b) {
+    uint64_t l = *(const uint64_t *)a;
+    uint64_t r = *(const uint64_t *)b;
+    return (l > r) - (l < r);
+}
+
+static uint64_t percentile(const uint64_t *sorted, size_t len, unsigned permille) {
+    size_t i = (len * permille) / 1000;
+    return sorted[(i < len) ? i : len - 1];
+}
+
+static z_result_t publish(_z_session_rc_t *rc, const _z_declared_keyexpr_t *ke, _z_bytes_t *payload) {
+    return _z_write(_Z_RC_IN_VAL(rc), ke, payload, NULL, Z_SAMPLE_KIND_PUT, Z_CONGESTION_CONTROL_BLOCK,
+                    Z_PRIORITY_DEFAULT, false, NULL, NULL, Z_RELIABILITY_RELIABLE, NULL, Z_LOCALITY_REMOTE);
+}
+
+static void run(size_t payload_size, size_t subscribers, size_t messages, uint64_t *latencies) {
+    mem_pipe_t pub_to_sub = {0};
+    mem_pipe_t sub_to_pub = {0};
+    _z_id_t pub_zid = {.id = {1}};
+    _z_id_t sub_zid = {.id = {2}};
+    _z_session_rc_t pub = open_session(&pub_zid, &sub_zid, &pub_to_sub, &sub_to_pub);
+    _z_session_rc_t sub = open_session(&sub_zid, &pub_zid, &sub_to_pub, &pub_to_sub);
+
+    _z_declared_keyexpr_t ke = _z_declared_keyexpr_alias_from_str(KEYEXPR);
+    for (size_t i = 0; i < subscribers; i++) {
+        uint32_t id;
+        assert(_z_register_subscriber(&id, &sub, &ke, on_sample, NULL, NULL, Z_LOCALITY_ANY, NULL) == _Z_RES_OK);
+    }
+    // The publisher does not need the declarations, they are only sent
+    drain(&pub, &sub_to_pub);
+
+    uint8_t *value = (uint8_t *)z_malloc(payload_size);
+    assert(value != NULL);
+    memset(value, 1, payload_size);
+    _z_bytes_t payload;
+    assert(_z_bytes_from_buf(&payload, value, payload_size) == _Z_RES_OK);
+
+    // Throughput, the subscriber side reads whatever batches were flushed after each put
+    received = 0;
+    assert(_z_transport_start_batching(&_Z_RC_IN_VAL(&pub)->_tp) == _Z_RES_OK);
+    uint64_t start = now_ns();
+    for (size_t i = 0; i < messages; i++) {
+        assert(publish(&pub, &ke, &payload) == _Z_RES_OK);
+        drain(&sub, &pub_to_sub);
+    }
+    assert(_z_transport_stop_batching(&_Z_RC_IN_VAL(&pub)->_tp) == _Z_RES_OK);
+    assert(_z_send_n_batch(_Z_RC_IN_VAL(&pub), Z_CONGESTION_CONTROL_BLOCK) == _Z_RES_OK);
+    drain(&sub, &pub_to_sub);
+    uint64_t elapsed = now_ns() - start;
+    assert(received == messages * subscribers);
+    double msgs_per_s = (double)messages * 1e9 / (double)(elapsed > 0 ? elapsed : 1);
+
+    // Latency, from the put to the last subscriber callback
+    for (size_t i = 0; i < messages; i++) {
+        received = 0;
+        start = now_ns();
+        publish(&pub, &ke, &payload);
+        drain(&sub, &pub_to_sub);
+        latencies[i] = now_ns() - start;
+        assert(received == subscribers);
+    }
+    qsort(latencies, messages, sizeof(uint64_t), cmp_u64);
+
+    printf("%zu,%zu,%zu,%.0f,%.2f,%llu,%llu,%llu\n", payload_size, subscribers, messages, msgs_per_s,
+           msgs_per_s * (double)payload_size / 1e6, (unsigned long long)percentile(latencies, messages, 500),
+           (unsigned long long)percentile(latencies, messages, 990),
+           (unsigned long long)percentile(latencies, messages, 999));
+    fflush(stdout);
+
+    _z_bytes_drop(&payload);
+    z_free(value);
+    close_session(&sub);
+    close_session(&pub);
+    z_free(pub_to_sub.buf);
+    z_free(sub_to_pub.buf);
+}
+
+int main(int argc, char **argv) {
+    size_t messages = DEFAULT_MESSAGES;
+    if (argc > 1) {
+        messages = (size_t)strtoul(argv[1], NULL, 10);
+    }
+    if (messages == 0) {
+        fprintf(stderr, "Usage: %s [messages > 0]\n", argv[0]);
+        return -1;
+    }
+    uint64_t *latencies = (uint64_t *)z_malloc(messages * sizeof(uint64_t));
+    assert(latencies != NULL);
+
+    // Larger messages would be dropped by the subscriber side
+#if Z_FEATURE_FRAGMENTATION == 1
+    size_t max_payload_size = Z_FRAG_MAX_SIZE - HEADERS_SIZE;
+#else
+    size_t max_payload_size = Z_BATCH_UNICAST_SIZE - HEADERS_SIZE;
+#endif
+    printf("payload,subscribers,messages,msgs_per_s,mb_per_s,p50_ns,p99_ns,p999_ns\n");
+    for (size_t i = 0; i < sizeof(payload_sizes) / sizeof(payload_sizes[0]); i++) {
+        if (payload_sizes[i] > max_payload_size) {
+            break;
+        }
+        size_t n = messages;
+        if (n * payload_sizes[i] > MAX_RUN_BYTES) {
+            n = MAX_RUN_BYTES / payload_sizes[i];
+        }
+        for (size_t j = 0; j < sizeof(subscriber_counts) / sizeof(subscriber_counts[0]); j++) {
+            run(payload_sizes[i], subscriber_counts[j], n, latencies);
+        }
+    }
+    z_free(latencies);
+    return 0;
+}
+#else
+int main(void) {
+    printf(
+        "ERROR: Zenoh pico was compiled without Z_FEATURE_PUBLICATION, Z_FEATURE_SUBSCRIPTION or "
+        "Z_FEATURE_UNICAST_TRANSPORT but this test requires them.\n");
+    return -2;
+}
+#endif
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/transport/raweth.h"
+#include "zenoh-pico/protocol/codec/network.h"
+#include "zenoh-pico/protocol/codec/transport.h"
+#include "zenoh-pico/session/session.h"
+#include "zenoh-pico/transport/raweth/tx.h"
+#include "zenoh-pico/transport/utils.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if defined(ZENOH_LINUX) && Z_FEATURE_RAWETH_TRANSPORT == 1 && Z_FEATURE_BATCHING == 1
+
+#include <linux/if_packet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define ETHTYPE 0x72e0
+
+// Not shared with the other raweth tests, that may run at the same time on the loopback interface
+static const uint8_t SMAC[_ZP_MAC_ADDR_LENGTH] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x0c};
+static const uint8_t DMAC_DEFAULT[_ZP_MAC_ADDR_LENGTH] = {0x02, 0x00, 0x00, 0x00, 0x01, 0x00};
+static const uint8_t DMAC_B[_ZP_MAC_ADDR_LENGTH] = {0x02, 0x00, 0x00, 0x00, 0x01, 0x0b};
+
+static bool open_socket(_z_sys_net_socket_t *sock) {
+    if (_z_open_raweth(sock, "lo") != _Z_RES_OK) {
+        return false;
+    }
+#ifdef PACKET_IGNORE_OUTGOING
+    int ignore = 1;
+    (void)setsockopt(sock->_fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &ignore, sizeof(ignore));
+#endif
+    return true;
+}
+
+static void set_entry(_zp_raweth_mapping_array_t *mapping, size_t idx, const char *keyexpr, const uint8_t *dmac) {
+    _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(mapping, idx);
+    memset(entry, 0, sizeof(*entry));
+    entry->_keyexpr = _z_string_copy_from_str(keyexpr);
+    memcpy(entry->_dmac, dmac, _ZP_MAC_ADDR_LENGTH);
+}
+
+static void send_del(_z_session_t *zn, const char *keyexpr, bool express) {
+    _z_wireexpr_t key = _z_wireexpr_null();
+    key._suffix = _z_string_alias_str(keyexpr);
+    _z_network_message_t n_msg;
+    _z_n_msg_make_push_del(&n_msg, &key, _z_n_qos_make(express, true, Z_PRIORITY_DEFAULT), NULL,
+                           Z_RELIABILITY_RELIABLE, NULL);
+    assert(_z_raweth_send_n_msg(zn, &n_msg, Z_RELIABILITY_RELIABLE, Z_CONGESTION_CONTROL_BLOCK) == _Z_RES_OK);
+}
+
+// Reads the next frame and checks it carries the deletions of the given keys, in order
+static void check_frame(const _z_sys_net_socket_t *sock, const _zp_raweth_whitelist_array_t *whitelist,
+                        const uint8_t *dmac, const char **keys, size_t key_nb) {
+    static uint8_t in[_ZP_MAX_ETH_FRAME_SIZE];
+    size_t rb = SIZE_MAX;
+    do {
+        rb = _z_receive_raweth(sock, in, sizeof(in), NULL, whitelist);
+    } while (rb == SIZE_MAX);
+    _zp_eth_header_t header;
+    assert(rb > sizeof(header));
+    memcpy(&header, in, sizeof(header));
+    assert(memcmp(header.dmac, dmac, _ZP_MAC_ADDR_LENGTH) == 0);
+    assert(header.ethtype == _z_raweth_htons(ETHTYPE));
+    size_t len = _z_raweth_ntohs(header.data_length);
+    assert(sizeof(header) + len <= rb);
+
+    _z_zbuf_t zbf = _z_zbuf_make(len);
+    memcpy(_z_zbuf_get_wptr(&zbf), &in[sizeof(header)], len);
+    _z_zbuf_set_wpos(&zbf, len);
+    _z_transport_message_t t_msg;
+    assert(_z_transport_message_decode(&t_msg, &zbf) == _Z_RES_OK);
+    assert(_Z_MID(t_msg._header) == _Z_MID_T_FRAME);
+    for (size_t i = 0; i < key_nb; i++) {
+        _z_network_message_t n_msg = {0};
+        _z_arc_slice_t arcs = _z_arc_slice_empty();
+        assert(_z_network_message_decode(&n_msg, &zbf, &arcs, _Z_KEYEXPR_MAPPING_LOCAL) == _Z_RES_OK);
+        assert(n_msg._tag == _Z_N_PUSH);
+        _z_string_t expected = _z_string_alias_str(keys[i]);
+        assert(_z_string_equals(&n_msg._body._push._key._suffix, &expected));
+        _z_n_msg_clear(&n_msg);
+    }
+    assert(_z_zbuf_len(&zbf) == 0);
+    _z_zbuf_clear(&zbf);
+}
+
+static void test_batch(bool use_ring) {
+    printf("Test: batched messages are grouped per destination address, %s\n", use_ring ? "ring" : "system calls");
+    static _z_session_t zn;
+    static _z_link_t link;
+    memset(&zn, 0, sizeof(zn));
+    memset(&link, 0, sizeof(link));
+    _z_raweth_socket_t *resocket = &link._socket._raweth;
+    _z_sys_net_socket_t rx;
+    if (!open_socket(&resocket->_sock)) {
+        printf("Raw sockets not permitted, skipping\n");
+        return;
+    }
+    assert(open_socket(&rx));
+    if (use_ring) {
+        resocket->_ring = _z_raweth_ring_new(&resocket->_sock);
+        if (resocket->_ring == NULL) {
+            printf("TPACKET_V3 rings not supported, skipping\n");
+            _z_close_raweth(&resocket->_sock);
+            _z_close_raweth(&rx);
+            return;
+        }
+    }
+    resocket->_mapping = _zp_raweth_mapping_array_make(2);
+    set_entry(&resocket->_mapping, 0, "", DMAC_DEFAULT);
+    set_entry(&resocket->_mapping, 1, "test/b/**", DMAC_B);
+    memcpy(resocket->_smac, SMAC, _ZP_MAC_ADDR_LENGTH);
+    resocket->_ethtype = _z_raweth_htons(ETHTYPE);
+    _zp_raweth_whitelist_array_t whitelist = _zp_raweth_whitelist_array_make(1);
+    memcpy(_zp_raweth_whitelist_array_get(&whitelist, 0)->_mac, SMAC, _ZP_MAC_ADDR_LENGTH);
+
+    zn._tp._type = _Z_TRANSPORT_RAWETH_TYPE;
+    _z_transport_common_t *ztc = &zn._tp._transport._raweth._common;
+    ztc->_link = &link;
+    ztc->_wbuf = _z_wbuf_make(_ZP_MAX_ETH_FRAME_SIZE, false);
+    ztc->_sn_res = _z_sn_max(Z_SN_RESOLUTION);
+    ztc->_batch_state = _Z_BATCHING_ACTIVE;
+#if Z_FEATURE_MULTI_THREAD == 1
+    assert(_z_mutex_init(&zn._mutex_inner) == _Z_RES_OK);
+    assert(_z_mutex_init(&ztc->_mutex_tx) == _Z_RES_OK);
+#endif
+
+    // A message to another address sends the pending frame, the batch flush sends the last one
+    send_del(&zn, "test/a/1", false);
+    send_del(&zn, "test/a/2", false);
+    send_del(&zn, "test/a/3", false);
+    assert(ztc->_batch_count == 3);
+    send_del(&zn, "test/b/1", false);
+    send_del(&zn, "test/b/2", false);
+    assert(ztc->_batch_count == 2);
+    assert(_z_raweth_send_n_batch(&zn, Z_CONGESTION_CONTROL_BLOCK) == _Z_RES_OK);
+    assert(ztc->_batch_count == 0);
+    const char *keys_a[] = {"test/a/1", "test/a/2", "test/a/3"};
+    const char *keys_b[] = {"test/b/1", "test/b/2"};
+    check_frame(&rx, &whitelist, DMAC_DEFAULT, keys_a, 3);
+    check_frame(&rx, &whitelist, DMAC_B, keys_b, 2);
+
+    // Express messages are sent along with the pending frames of their address
+    send_del(&zn, "test/b/3", false);
+    send_del(&zn, "test/b/4", true);
+    assert(ztc->_batch_count == 0);
+    const char *keys_express[] = {"test/b/3", "test/b/4"};
+    check_frame(&rx, &whitelist, DMAC_B, keys_express, 2);
+
+    // Without a batch, each message is a frame of its own
+    ztc->_batch_state = _Z_BATCHING_IDLE;
+    send_del(&zn, "test/a/4", false);
+    send_del(&zn, "test/a/5", false);
+    const char *keys_single[] = {"test/a/4", "test/a/5"};
+    check_frame(&rx, &whitelist, DMAC_DEFAULT, &keys_single[0], 1);
+    check_frame(&rx, &whitelist, DMAC_DEFAULT, &keys_single[1], 1);
+
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_drop(&ztc->_mutex_tx);
+    _z_mutex_drop(&zn._mutex_inner);
+#endif
+    _z_wbuf_clear(&ztc->_wbuf);
+    _zp_raweth_whitelist_array_clear(&whitelist);
+    _zp_raweth_mapping_array_clear(&resocket->_mapping);
+    _z_raweth_ring_free(&resocket->_ring);
+    _z_close_raweth(&resocket->_sock);
+    _z_close_raweth(&rx);
+}
+
+int main(void) {
+    // Fail instead of blocking forever if a frame is lost
+    alarm(10);
+    test_batch(false);
+    test_batch(true);
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
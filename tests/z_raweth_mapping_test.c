@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/transport/raweth/mapping.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_RAWETH_TRANSPORT == 1
+
+#define GENERATED_NB 300
+
+static const char *MAPPING[] = {
+    "",  // Default entry
+    "robot/arm/joint",
+    "robot/*/camera",
+    "robot/leg/camera",
+    "fleet/**",
+    "fleet/robot1/status",
+    "robot/arm/joint",
+    "plant/**/temp",
+    "plant/$*room/humidity",
+};
+#define MAPPING_NB (sizeof(MAPPING) / sizeof(MAPPING[0]))
+
+static const char *KEYS[] = {
+    "robot/arm/joint", "robot/leg/camera", "robot/arm/camera", "robot/leg", "fleet", "fleet/robot1/status",
+    "fleet/a/b/c", "plant/temp", "plant/a/b/temp", "plant/myroom/humidity", "plant/room/humidity", "unknown/key",
+    "robot/*/joint", "robot/**", "fleet/*", "plant/*/humidity", "generated/7", "generated/*/x", "**", "generated/299",
+};
+#define KEYS_NB (sizeof(KEYS) / sizeof(KEYS[0]))
+
+static _zp_raweth_mapping_array_t make_mapping(size_t generated) {
+    _zp_raweth_mapping_array_t mapping = _zp_raweth_mapping_array_make(MAPPING_NB + generated);
+    assert(_zp_raweth_mapping_array_len(&mapping) == MAPPING_NB + generated);
+    for (size_t i = 0; i < MAPPING_NB + generated; i++) {
+        _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(&mapping, i);
+        memset(entry, 0, sizeof(*entry));
+        if (i < MAPPING_NB) {
+            entry->_keyexpr = _z_string_copy_from_str(MAPPING[i]);
+        } else {
+            char key[32];
+            snprintf(key, sizeof(key), (i % 2 == 0) ? "generated/%zu" : "generated/%zu/*", i - MAPPING_NB);
+            entry->_keyexpr = _z_string_copy_from_str(key);
+        }
+    }
+    return mapping;
+}
+
+static size_t linear_find(const _zp_raweth_mapping_array_t *mapping, const _z_keyexpr_t *key) {
+    for (size_t i = 0; i < _zp_raweth_mapping_array_len(mapping); i++) {
+        const _zp_raweth_mapping_entry_t *entry = _zp_raweth_mapping_array_get(mapping, i);
+        if (_z_string_len(&entry->_keyexpr) == 0) {
+            continue;
+        }
+        _z_keyexpr_t entry_ke = _z_keyexpr_alias_from_string(&entry->_keyexpr);
+        if (_z_keyexpr_intersects(key, &entry_ke)) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+static void test_find(size_t generated) {
+    printf("Test: indexed lookup matches the first intersecting entry, with %zu generated entries\n", generated);
+    _zp_raweth_mapping_array_t mapping = make_mapping(generated);
+    _zp_raweth_mapping_index_t *index = _zp_raweth_mapping_index_new(&mapping);
+    assert(index != NULL);
+    for (size_t i = 0; i < KEYS_NB; i++) {
+        _z_keyexpr_t key = _z_keyexpr_alias_from_str(KEYS[i]);
+        size_t expected = linear_find(&mapping, &key);
+        size_t found = _zp_raweth_mapping_index_find(index, &mapping, &key);
+        assert(found == expected);
+    }
+    // Earlier entries take precedence
+    _z_keyexpr_t key = _z_keyexpr_alias_from_str("robot/arm/joint");
+    assert(_zp_raweth_mapping_index_find(index, &mapping, &key) == 1);
+    key = _z_keyexpr_alias_from_str("robot/leg/camera");
+    assert(_zp_raweth_mapping_index_find(index, &mapping, &key) == 2);
+    key = _z_keyexpr_alias_from_str("fleet/robot1/status");
+    assert(_zp_raweth_mapping_index_find(index, &mapping, &key) == 4);
+    key = _z_keyexpr_alias_from_str("unknown/key");
+    assert(_zp_raweth_mapping_index_find(index, &mapping, &key) == SIZE_MAX);
+    _zp_raweth_mapping_index_free(&index);
+    assert(index == NULL);
+    _zp_raweth_mapping_array_clear(&mapping);
+}
+
+static void test_cache(void) {
+    printf("Test: entries of declared keys are cached by id until forgotten\n");
+    _zp_raweth_mapping_array_t mapping = make_mapping(0);
+    _zp_raweth_mapping_index_t *index = _zp_raweth_mapping_index_new(&mapping);
+    assert(index != NULL);
+    size_t pos = 0;
+    assert(!_zp_raweth_mapping_index_cache_get(index, 1, &pos));
+    _zp_raweth_mapping_index_cache_insert(index, 1, 5);
+    _zp_raweth_mapping_index_cache_insert(index, 2, 0);
+    assert(_zp_raweth_mapping_index_cache_get(index, 1, &pos) && (pos == 5));
+    assert(_zp_raweth_mapping_index_cache_get(index, 2, &pos) && (pos == 0));
+    _zp_raweth_mapping_index_cache_forget(index, 1);
+    assert(!_zp_raweth_mapping_index_cache_get(index, 1, &pos));
+    assert(_zp_raweth_mapping_index_cache_get(index, 2, &pos) && (pos == 0));
+    // Forgetting an unknown id is harmless
+    _zp_raweth_mapping_index_cache_forget(index, 3);
+    _zp_raweth_mapping_index_free(&index);
+    _zp_raweth_mapping_array_clear(&mapping);
+}
+
+int main(void) {
+    test_find(0);
+    test_find(GENERATED_NB);
+    test_cache();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/transport/raweth.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if defined(ZENOH_LINUX) && Z_FEATURE_RAWETH_TRANSPORT == 1
+
+#include <linux/if_packet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define ETHTYPE 0x72e0
+// More frames than the transmit ring holds
+#define FRAME_NB 300
+
+static const uint8_t SMAC[_ZP_MAC_ADDR_LENGTH] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x0a};
+static const uint8_t OTHER_SMAC[_ZP_MAC_ADDR_LENGTH] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x0b};
+
+static size_t make_frame(uint8_t *frame, const uint8_t *smac, size_t idx) {
+    _zp_eth_header_t header;
+    memset(header.dmac, 0xff, _ZP_MAC_ADDR_LENGTH);
+    memcpy(header.smac, smac, _ZP_MAC_ADDR_LENGTH);
+    header.ethtype = _z_raweth_htons(ETHTYPE);
+    size_t data_len = 46 + (idx * 13) % 400;
+    header.data_length = _z_raweth_htons((uint16_t)data_len);
+    memcpy(frame, &header, sizeof(header));
+    for (size_t i = 0; i < data_len; i++) {
+        frame[sizeof(header) + i] = (uint8_t)(idx + i);
+    }
+    return sizeof(header) + data_len;
+}
+
+static bool open_socket(_z_sys_net_socket_t *sock) {
+    if (_z_open_raweth(sock, "lo") != _Z_RES_OK) {
+        return false;
+    }
+#ifdef PACKET_IGNORE_OUTGOING
+    // Frames sent on the loopback interface are also seen on their way out
+    int ignore = 1;
+    (void)setsockopt(sock->_fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &ignore, sizeof(ignore));
+#endif
+    return true;
+}
+
+static void check_received(_z_raweth_ring_t *ring, const _z_sys_net_socket_t *sock,
+                           const _zp_raweth_whitelist_array_t *whitelist, size_t idx) {
+    static uint8_t expected[_ZP_MAX_ETH_FRAME_SIZE];
+    static uint8_t in[2048];
+    uint8_t addr_buf[_ZP_MAC_ADDR_LENGTH] = {0};
+    _z_slice_t addr = _z_slice_alias_buf(addr_buf, sizeof(addr_buf));
+    size_t len = make_frame(expected, SMAC, idx);
+    size_t rb = (ring != NULL) ? _z_raweth_ring_receive(ring, sock, in, sizeof(in), &addr, whitelist)
+                               : _z_receive_raweth(sock, in, sizeof(in), &addr, whitelist);
+    assert(rb == len);
+    assert(memcmp(in, expected, len) == 0);
+    assert(addr.len == _ZP_MAC_ADDR_LENGTH);
+    assert(memcmp(addr_buf, SMAC, _ZP_MAC_ADDR_LENGTH) == 0);
+}
+
+static void test_ring(void) {
+    printf("Test: frames queued on a transmit ring are read back in order from a receive ring\n");
+    _z_sys_net_socket_t tx;
+    _z_sys_net_socket_t rx;
+    if (!open_socket(&tx)) {
+        printf("Raw sockets not permitted, skipping\n");
+        return;
+    }
+    assert(open_socket(&rx));
+    _z_raweth_ring_t *tx_ring = _z_raweth_ring_new(&tx);
+    _z_raweth_ring_t *rx_ring = _z_raweth_ring_new(&rx);
+    if ((tx_ring == NULL) || (rx_ring == NULL)) {
+        printf("TPACKET_V3 rings not supported, skipping\n");
+        _z_raweth_ring_free(&tx_ring);
+        _z_raweth_ring_free(&rx_ring);
+        _z_close_raweth(&tx);
+        _z_close_raweth(&rx);
+        return;
+    }
+    _zp_raweth_whitelist_array_t whitelist = _zp_raweth_whitelist_array_make(1);
+    memcpy(_zp_raweth_whitelist_array_get(&whitelist, 0)->_mac, SMAC, _ZP_MAC_ADDR_LENGTH);
+
+    // Queued frames are sent by the flush
+    static uint8_t frame[_ZP_MAX_ETH_FRAME_SIZE];
+    size_t len = make_frame(frame, SMAC, 0);
+    assert(_z_raweth_ring_send(tx_ring, &tx, frame, len) == len);
+    // Frames from unknown sources are skipped
+    len = make_frame(frame, OTHER_SMAC, 1);
+    assert(_z_raweth_ring_send(tx_ring, &tx, frame, len) == len);
+    len = make_frame(frame, SMAC, 1);
+    assert(_z_raweth_ring_send(tx_ring, &tx, frame, len) == len);
+    assert(_z_raweth_ring_flush(tx_ring, &tx) == _Z_RES_OK);
+    check_received(rx_ring, &rx, &whitelist, 0);
+    check_received(rx_ring, &rx, &whitelist, 1);
+
+    // The ring is flushed when full
+    for (size_t i = 0; i < FRAME_NB; i++) {
+        len = make_frame(frame, SMAC, i);
+        assert(_z_raweth_ring_send(tx_ring, &tx, frame, len) == len);
+    }
+    assert(_z_raweth_ring_flush(tx_ring, &tx) == _Z_RES_OK);
+    for (size_t i = 0; i < FRAME_NB; i++) {
+        check_received(rx_ring, &rx, &whitelist, i);
+    }
+
+    // Frames written by a socket without rings
+    _z_sys_net_socket_t plain;
+    assert(open_socket(&plain));
+    len = make_frame(frame, SMAC, 7);
+    assert(_z_send_raweth(&plain, frame, len) == len);
+    check_received(rx_ring, &rx, &whitelist, 7);
+    _z_close_raweth(&plain);
+
+    // Frames larger than the buffer are truncated
+    len = make_frame(frame, SMAC, 8);
+    assert(_z_raweth_ring_send(tx_ring, &tx, frame, len) == len);
+    assert(_z_raweth_ring_flush(tx_ring, &tx) == _Z_RES_OK);
+    uint8_t in[20];
+    assert(_z_raweth_ring_receive(rx_ring, &rx, in, sizeof(in), NULL, &whitelist) == sizeof(in));
+    assert(memcmp(in, frame, sizeof(in)) == 0);
+
+    // A socket without rings reads what a ring sends
+    assert(open_socket(&plain));
+    len = make_frame(frame, SMAC, 9);
+    assert(_z_raweth_ring_send(tx_ring, &tx, frame, len) == len);
+    assert(_z_raweth_ring_flush(tx_ring, &tx) == _Z_RES_OK);
+    check_received(NULL, &plain, &whitelist, 9);
+
+    _zp_raweth_whitelist_array_clear(&whitelist);
+    _z_raweth_ring_free(&tx_ring);
+    _z_raweth_ring_free(&rx_ring);
+    assert((tx_ring == NULL) && (rx_ring == NULL));
+    _z_close_raweth(&tx);
+    _z_close_raweth(&rx);
+    _z_close_raweth(&plain);
+}
+
+int main(void) {
+    // Fail instead of blocking forever if a frame is lost
+    alarm(10);
+    test_ring();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
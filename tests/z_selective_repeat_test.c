@@ -0,0 +1,391 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/system/platform.h"
+#include "zenoh-pico/transport/common/selective_repeat.h"
+#include "zenoh-pico/transport/utils.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_SELECTIVE_REPEAT == 1
+
+#define SN_RES 0xFF
+#define WINDOW 8
+#define NACK_MAX 16
+
+typedef struct {
+    _z_zint_t sn;
+    _z_zint_t count;
+} nack_t;
+
+static nack_t nacks[NACK_MAX];
+static size_t nack_nb = 0;
+
+static void on_nack(void *arg, _z_zint_t sn, _z_zint_t count) {
+    (void)arg;
+    assert(nack_nb < NACK_MAX);
+    nacks[nack_nb].sn = sn;
+    nacks[nack_nb].count = count;
+    nack_nb++;
+}
+
+static void check_nack(size_t idx, _z_zint_t sn, _z_zint_t count) {
+    assert(idx < nack_nb);
+    assert(nacks[idx].sn == sn);
+    assert(nacks[idx].count == count);
+}
+
+static void test_history(void) {
+    printf("Test: sent batches are kept until they are overwritten\n");
+    _z_transport_tx_history_t *h = _z_transport_tx_history_new(100);
+    assert(h != NULL);
+    uint8_t batch[100];
+    for (size_t i = 0; i < sizeof(batch); i++) {
+        batch[i] = (uint8_t)i;
+    }
+    _z_slice_t out;
+    assert(!_z_transport_tx_history_get(h, 0, &out));
+
+    // Batches of 30 bytes: the fourth one wraps around and overwrites the first one
+    for (_z_zint_t sn = 0; sn < 3; sn++) {
+        _z_transport_tx_history_push(h, sn, &batch[sn], 30);
+    }
+    assert(_z_transport_tx_history_get(h, 1, &out));
+    assert((out.len == 30) && (out.start[0] == 1) && (out.start[29] == 30));
+    _z_transport_tx_history_push(h, 3, &batch[3], 30);
+    assert(!_z_transport_tx_history_get(h, 0, &out));
+    assert(_z_transport_tx_history_get(h, 2, &out));
+    assert((out.len == 30) && (out.start[0] == 2));
+    assert(_z_transport_tx_history_get(h, 3, &out));
+    assert((out.len == 30) && (out.start[0] == 3));
+
+    // Batches sent again are not sent once more right away
+    assert(_z_transport_tx_history_get(h, 1, &out));
+    assert(out.len == 0);
+    z_sleep_ms(Z_TRANSPORT_NACK_INTERVAL);
+    assert(_z_transport_tx_history_get(h, 1, &out));
+    assert(out.len == 30);
+
+    // Only the overwritten batches are dropped
+    _z_transport_tx_history_push(h, 4, &batch[4], 50);
+    assert(!_z_transport_tx_history_get(h, 1, &out));
+    assert(!_z_transport_tx_history_get(h, 2, &out));
+    assert(_z_transport_tx_history_get(h, 3, &out));
+    assert(_z_transport_tx_history_get(h, 4, &out));
+    assert((out.len == 50) && (out.start[0] == 4));
+    _z_transport_tx_history_push(h, 5, &batch[5], 50);
+    assert(!_z_transport_tx_history_get(h, 3, &out));
+    assert(!_z_transport_tx_history_get(h, 4, &out));
+    assert(_z_transport_tx_history_get(h, 5, &out));
+    assert((out.len == 50) && (out.start[49] == 54));
+
+    // Batches larger than the history are not kept
+    _z_transport_tx_history_push(h, 6, batch, 101);
+    assert(!_z_transport_tx_history_get(h, 6, &out));
+    assert(_z_transport_tx_history_get(h, 5, &out));
+    _z_transport_tx_history_free(&h);
+    assert(h == NULL);
+
+    // The number of batches is bounded too
+    h = _z_transport_tx_history_new(1000);
+    assert(h != NULL);
+    for (_z_zint_t sn = 0; sn < _Z_TRANSPORT_TX_HISTORY_RECORDS + 10; sn++) {
+        _z_transport_tx_history_push(h, sn, batch, 1);
+    }
+    assert(!_z_transport_tx_history_get(h, 9, &out));
+    assert(_z_transport_tx_history_get(h, 10, &out));
+    assert(_z_transport_tx_history_get(h, _Z_TRANSPORT_TX_HISTORY_RECORDS + 9, &out));
+    _z_transport_tx_history_free(&h);
+}
+
+static _z_transport_message_t make_frame(_z_zint_t sn, _z_zbuf_t *payload, uint8_t content) {
+    *payload = _z_zbuf_make(4);
+    assert(_z_zbuf_capacity(payload) == 4);
+    uint8_t *wptr = _z_zbuf_get_wptr(payload);
+    for (uint8_t i = 0; i < 4; i++) {
+        wptr[i] = (uint8_t)(content + i);
+    }
+    _z_zbuf_set_wpos(payload, 4);
+    _z_transport_message_t t_msg = _z_t_msg_make_frame_header(sn, Z_RELIABILITY_RELIABLE);
+    t_msg._body._frame._payload = payload;
+    return t_msg;
+}
+
+static void take_frame(_z_transport_rx_reorder_t *r, _z_zint_t sn, uint8_t content) {
+    _z_transport_message_t t_msg;
+    _z_zbuf_t zbf;
+    assert(_z_transport_rx_reorder_take(r, sn, &t_msg, &zbf));
+    assert(_Z_MID(t_msg._header) == _Z_MID_T_FRAME);
+    assert(t_msg._body._frame._sn == sn);
+    assert(t_msg._body._frame._payload == &zbf);
+    assert(_z_zbuf_len(&zbf) == 4);
+    assert(_z_zbuf_read(&zbf) == content);
+    _z_zbuf_clear(&zbf);
+}
+
+static _z_transport_rx_verdict_t accept_frame(_z_transport_rx_reorder_t *r, _z_zint_t last, _z_zint_t sn,
+                                              uint8_t content) {
+    _z_zbuf_t payload;
+    _z_transport_message_t t_msg = make_frame(sn, &payload, content);
+    _z_transport_rx_verdict_t verdict = _z_transport_rx_reorder_accept(r, SN_RES, last, &t_msg, on_nack, NULL);
+    // Held messages have their own copy
+    _z_zbuf_clear(&payload);
+    return verdict;
+}
+
+static void test_reorder(void) {
+    printf("Test: messages received after a gap are held and the gap is reported\n");
+    _z_transport_rx_reorder_t *r = _z_transport_rx_reorder_new(WINDOW);
+    assert(r != NULL);
+    nack_nb = 0;
+    _z_zint_t last = 10;
+
+    // In order and old messages are handled as usual
+    assert(accept_frame(r, last, 11, 0) == _Z_TRANSPORT_RX_HANDLE);
+    assert(accept_frame(r, last, 9, 0) == _Z_TRANSPORT_RX_HANDLE);
+    assert(nack_nb == 0);
+
+    // 11 and 12 are lost, then 14 too
+    assert(accept_frame(r, last, 13, 130) == _Z_TRANSPORT_RX_HELD);
+    check_nack(0, 11, 2);
+    assert(accept_frame(r, last, 15, 150) == _Z_TRANSPORT_RX_HELD);
+    check_nack(1, 14, 1);
+    // Held twice
+    assert(accept_frame(r, last, 13, 130) == _Z_TRANSPORT_RX_HELD);
+    assert(nack_nb == 2);
+    _z_zint_t first = 0;
+    assert(_z_transport_rx_reorder_first(r, SN_RES, last, &first));
+    assert(first == 13);
+
+    // Nothing to report before the NACK interval, then the runs still missing
+    assert(!_z_transport_rx_reorder_poll(r, SN_RES, last, on_nack, NULL));
+    assert(nack_nb == 2);
+    z_sleep_ms(Z_TRANSPORT_NACK_INTERVAL + 5);
+    assert(!_z_transport_rx_reorder_poll(r, SN_RES, last, on_nack, NULL));
+    check_nack(2, 11, 2);
+    check_nack(3, 14, 1);
+
+    // 11 and 12 are sent again
+    _z_transport_message_t t_msg;
+    _z_zbuf_t zbf;
+    last = 12;
+    assert(!_z_transport_rx_reorder_take(r, 12, &t_msg, &zbf));
+    take_frame(r, 13, 130);
+    last = 13;
+    assert(!_z_transport_rx_reorder_take(r, 14, &t_msg, &zbf));
+
+    // Until the gap is given up on
+    for (int i = 1; i < Z_TRANSPORT_NACK_RETRIES; i++) {
+        z_sleep_ms(Z_TRANSPORT_NACK_INTERVAL + 5);
+        assert(!_z_transport_rx_reorder_poll(r, SN_RES, last, on_nack, NULL));
+        check_nack(nack_nb - 1, 14, 1);
+    }
+    z_sleep_ms(Z_TRANSPORT_NACK_INTERVAL + 5);
+    size_t prev_nb = nack_nb;
+    assert(_z_transport_rx_reorder_poll(r, SN_RES, last, on_nack, NULL));
+    assert(nack_nb == prev_nb);
+    assert(_z_transport_rx_reorder_first(r, SN_RES, last, &first));
+    assert(first == 15);
+    take_frame(r, 15, 150);
+    last = 15;
+    assert(!_z_transport_rx_reorder_first(r, SN_RES, last, &first));
+
+    // Messages too far ahead flush the window, SNs wrap around
+    last = SN_RES - 1;
+    nack_nb = 0;
+    assert(accept_frame(r, last, 1, 10) == _Z_TRANSPORT_RX_HELD);
+    check_nack(0, SN_RES, 2);
+    assert(accept_frame(r, last, WINDOW - 2, 0) == _Z_TRANSPORT_RX_HELD);
+    check_nack(1, 2, WINDOW - 4);
+    assert(accept_frame(r, last, WINDOW - 1, 0) == _Z_TRANSPORT_RX_FLUSH);
+    assert(_z_transport_rx_reorder_first(r, SN_RES, last, &first));
+    assert(first == 1);
+
+    // Fragments keep their markers and a copy of their payload
+    uint8_t data[3] = {1, 2, 3};
+    _z_transport_message_t frag = _z_t_msg_make_fragment(3, _z_slice_alias_buf(data, 3), Z_RELIABILITY_RELIABLE,
+                                                         false, true, false);
+    assert(_z_transport_rx_reorder_accept(r, SN_RES, last, &frag, on_nack, NULL) == _Z_TRANSPORT_RX_HELD);
+    data[0] = 0;
+    assert(_z_transport_rx_reorder_take(r, 3, &t_msg, &zbf));
+    assert(_Z_MID(t_msg._header) == _Z_MID_T_FRAGMENT);
+    assert(_Z_HAS_FLAG(t_msg._header, _Z_FLAG_T_FRAGMENT_M));
+    assert(t_msg._body._fragment.first && !t_msg._body._fragment.drop);
+    assert((t_msg._body._fragment._payload.len == 3) && (t_msg._body._fragment._payload.start[0] == 1));
+    _z_t_msg_clear(&t_msg);
+    _z_zbuf_clear(&zbf);
+
+    // Held messages are freed with the window
+    _z_transport_rx_reorder_free(&r);
+    assert(r == NULL);
+}
+
+#if Z_FEATURE_MULTICAST_TRANSPORT == 1 && Z_FEATURE_LINK_UDP_MULTICAST == 1 && Z_FEATURE_MULTI_THREAD == 1 && \
+    Z_FEATURE_PUBLICATION == 1 && Z_FEATURE_SUBSCRIPTION == 1 && defined(ZENOH_LINUX)
+#define MULTICAST_LOCATOR "udp/224.0.0.224:7453#iface=lo"
+#define KEYEXPR "test/selective_repeat"
+#define PUT_NB 6
+#define DROPPED 2
+
+static _z_link_t *pub_link = NULL;
+static _z_link_t *sub_link = NULL;
+static _z_f_link_write write_f = NULL;
+static volatile bool armed = false;
+static volatile int frames_sent = 0;
+static volatile int nacks_sent = 0;
+static volatile int resent = 0;
+static uint8_t dropped[64];
+static size_t dropped_len = 0;
+
+static volatile int received_nb = 0;
+static int received[PUT_NB];
+
+static bool is_reliable_frame(const uint8_t *ptr, size_t len) {
+    return (len > 0) && (_Z_MID(ptr[0]) == _Z_MID_T_FRAME) && _Z_HAS_FLAG(ptr[0], _Z_FLAG_T_FRAME_R);
+}
+
+// Drops one reliable batch of the publisher, and records its NACK and its resending
+static size_t lossy_write(const _z_link_t *self, const uint8_t *ptr, size_t len, _z_sys_net_socket_t *socket) {
+    if (armed && (self == pub_link) && is_reliable_frame(ptr, len)) {
+        if ((dropped_len == len) && (memcmp(dropped, ptr, len) == 0)) {
+            resent++;
+        } else if (frames_sent++ == DROPPED) {
+            assert(len <= sizeof(dropped));
+            memcpy(dropped, ptr, len);
+            dropped_len = len;
+            return len;
+        }
+    }
+    if (armed && (self == sub_link) && (len > 0) && (_Z_MID(ptr[0]) == _Z_MID_T_OAM)) {
+        nacks_sent++;
+    }
+    return write_f(self, ptr, len, socket);
+}
+
+static void on_sample(z_loaned_sample_t *sample, void *arg) {
+    (void)arg;
+    z_owned_string_t value;
+    z_bytes_to_string(z_sample_payload(sample), &value);
+    if (received_nb < PUT_NB) {
+        received[received_nb] = atoi(z_string_data(z_loan(value)));
+    }
+    z_drop(z_move(value));
+    received_nb++;
+}
+
+static void open_peer(z_owned_session_t *s) {
+    z_owned_config_t config;
+    z_config_default(&config);
+    zp_config_insert(z_loan_mut(config), Z_CONFIG_MODE_KEY, Z_CONFIG_MODE_PEER);
+    zp_config_insert(z_loan_mut(config), Z_CONFIG_LISTEN_KEY, MULTICAST_LOCATOR);
+    zp_config_insert(z_loan_mut(config), Z_CONFIG_TRANSPORT_SELECTIVE_REPEAT_KEY, "true");
+    assert(z_open(s, z_move(config), NULL) == Z_OK);
+    assert(zp_start_read_task(z_loan_mut(*s), NULL) == Z_OK);
+    assert(zp_start_lease_task(z_loan_mut(*s), NULL) == Z_OK);
+}
+
+static _z_transport_multicast_t *get_transport(const z_owned_session_t *s) {
+    _z_session_t *zn = _Z_RC_IN_VAL(z_loan(*s));
+    assert(zn->_tp._type == _Z_TRANSPORT_MULTICAST_TYPE);
+    return &zn->_tp._transport._multicast;
+}
+
+static bool knows_peer(_z_transport_multicast_t *tp, const _z_id_t *zid) {
+    bool found = false;
+    _z_transport_peer_mutex_lock(&tp->_common);
+    for (_z_transport_peer_multicast_slist_t *it = tp->_peers; (it != NULL) && !found;
+         it = _z_transport_peer_multicast_slist_next(it)) {
+        found = _z_id_eq(&_z_transport_peer_multicast_slist_value(it)->common._remote_zid, zid);
+    }
+    _z_transport_peer_mutex_unlock(&tp->_common);
+    return found;
+}
+
+static void test_transport(void) {
+    printf("Test: a reliable batch lost on a multicast link is reported, sent again and delivered in order\n");
+    z_owned_session_t pub_s;
+    z_owned_session_t sub_s;
+    open_peer(&sub_s);
+    open_peer(&pub_s);
+    _z_transport_multicast_t *pub_tp = get_transport(&pub_s);
+    _z_transport_multicast_t *sub_tp = get_transport(&sub_s);
+    assert(pub_tp->_common._tx_history != NULL);
+
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, on_sample, NULL, NULL);
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, KEYEXPR);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(sub_s), &sub, z_loan(ke), z_move(callback), NULL) == Z_OK);
+    // Wait for the subscriber side to know the publisher through its join messages
+    const _z_id_t *pub_zid = &_Z_RC_IN_VAL(z_loan(pub_s))->_local_zid;
+    for (int i = 0; (i < 100) && !knows_peer(sub_tp, pub_zid); i++) {
+        z_sleep_ms(50);
+    }
+    assert(knows_peer(sub_tp, pub_zid));
+
+    pub_link = pub_tp->_common._link;
+    sub_link = sub_tp->_common._link;
+    write_f = pub_link->_write_f;
+    assert(sub_link->_write_f == write_f);
+    pub_link->_write_f = lossy_write;
+    sub_link->_write_f = lossy_write;
+    armed = true;
+
+    for (int i = 0; i < PUT_NB; i++) {
+        char value[8];
+        snprintf(value, sizeof(value), "%d", i);
+        z_owned_bytes_t payload;
+        assert(z_bytes_copy_from_str(&payload, value) == Z_OK);
+        assert(z_put(z_loan(pub_s), z_loan(ke), z_move(payload), NULL) == Z_OK);
+    }
+    for (int i = 0; (i < 100) && (received_nb < PUT_NB); i++) {
+        z_sleep_ms(20);
+    }
+    armed = false;
+
+    assert(dropped_len > 0);
+    assert(nacks_sent >= 1);
+    assert(resent >= 1);
+    assert(received_nb == PUT_NB);
+    for (int i = 0; i < PUT_NB; i++) {
+        assert(received[i] == i);
+    }
+
+    z_drop(z_move(sub));
+    z_drop(z_move(pub_s));
+    z_drop(z_move(sub_s));
+}
+#endif
+
+int main(void) {
+    test_history();
+    test_reorder();
+#if Z_FEATURE_MULTICAST_TRANSPORT == 1 && Z_FEATURE_LINK_UDP_MULTICAST == 1 && Z_FEATURE_MULTI_THREAD == 1 && \
+    Z_FEATURE_PUBLICATION == 1 && Z_FEATURE_SUBSCRIPTION == 1 && defined(ZENOH_LINUX)
+    test_transport();
+#endif
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
@@ -0,0 +1,174 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/link.h"
+#include "zenoh-pico/link/transport/shm.h"
+#include "zenoh-pico/link/transport/socket.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_LINK_SHM == 1 && Z_FEATURE_MULTI_THREAD == 1
+
+#include <poll.h>
+#include <unistd.h>
+
+// Several times the ring size, so that the writer has to wait for the reader
+#define BULK_SIZE (3 * Z_SHM_RING_SIZE + 12345)
+
+typedef struct {
+    _z_link_t *link;
+    uint8_t *data;
+} writer_ctx_t;
+
+static void *writer_task(void *arg) {
+    writer_ctx_t *ctx = (writer_ctx_t *)arg;
+    assert(ctx->link->_write_all_f(ctx->link, ctx->data, BULK_SIZE) == BULK_SIZE);
+    return NULL;
+}
+
+typedef struct {
+    _z_link_t *listener;
+    _z_sys_net_socket_t socket;
+} accept_ctx_t;
+
+// Opening waits for the accepting side to map the segment
+static void *accept_task(void *arg) {
+    accept_ctx_t *ctx = (accept_ctx_t *)arg;
+    assert(_z_shm_accept(&ctx->listener->_socket._shm._sock, &ctx->socket) == _Z_RES_OK);
+    return NULL;
+}
+
+static void open_pair(const char *path, _z_link_t *server, _z_link_t *client, _z_sys_net_socket_t *peer) {
+    unlink(path);
+    char buf[2 * _Z_UNIXSOCK_PATH_MAX];
+    snprintf(buf, sizeof(buf), "%s/%s", SHM_SCHEMA, path);
+    _z_string_t locator = _z_string_alias_str(buf);
+
+    assert(_z_listen_link(server, &locator, NULL) == _Z_RES_OK);
+    assert(server->_type == _Z_LINK_TYPE_SHM);
+    assert(server->_cap._flow == Z_LINK_CAP_FLOW_STREAM);
+
+    accept_ctx_t actx = {.listener = server};
+    _z_task_t task;
+    assert(_z_task_init(&task, NULL, accept_task, &actx) == _Z_RES_OK);
+    assert(_z_open_link(client, &locator, NULL) == _Z_RES_OK);
+    assert(_z_task_join(&task) == _Z_RES_OK);
+    *peer = actx.socket;
+}
+
+static void test_link(void) {
+    printf("Test: shared memory link listens, accepts and exchanges data both ways\n");
+    char path[_Z_UNIXSOCK_PATH_MAX];
+    snprintf(path, sizeof(path), "/tmp/zp_shm_test_%d.sock", (int)getpid());
+    _z_link_t server;
+    _z_link_t client;
+    _z_sys_net_socket_t peer;
+    open_pair(path, &server, &client, &peer);
+    _z_task_t task;
+
+    const uint8_t out[] = "zenoh over shared memory";
+    uint8_t in[sizeof(out)];
+    assert(client._write_all_f(&client, out, sizeof(out)) == sizeof(out));
+    assert(server._read_exact_f(&server, in, sizeof(in), NULL, &peer) == sizeof(in));
+    assert(memcmp(in, out, sizeof(out)) == 0);
+
+    memset(in, 0, sizeof(in));
+    assert(server._write_f(&server, out, sizeof(out), &peer) == sizeof(out));
+    assert(client._read_exact_f(&client, in, sizeof(in), NULL, NULL) == sizeof(in));
+    assert(memcmp(in, out, sizeof(out)) == 0);
+
+    // Non blocking sockets report an empty ring as would-block, and become readable once data is written
+    assert(_z_socket_set_blocking(&peer, false) == _Z_RES_OK);
+    assert(server._read_socket_f(peer, in, sizeof(in)) == SIZE_MAX);
+    assert(client._write_all_f(&client, out, 4) == 4);
+    assert(server._read_socket_f(peer, in, 2) == 2);
+    // Data left in the ring keeps the socket readable
+    struct pollfd pfd = {.fd = peer._fd, .events = POLLIN};
+    assert(poll(&pfd, 1, 0) == 1);
+    assert(server._read_socket_f(peer, in, sizeof(in)) == 2);
+    assert(server._read_socket_f(peer, in, sizeof(in)) == SIZE_MAX);
+    assert(_z_socket_set_blocking(&peer, true) == _Z_RES_OK);
+
+    // Bulk transfer larger than the ring
+    uint8_t *bulk = (uint8_t *)malloc(BULK_SIZE);
+    uint8_t *recv = (uint8_t *)malloc(BULK_SIZE);
+    assert((bulk != NULL) && (recv != NULL));
+    for (size_t i = 0; i < BULK_SIZE; i++) {
+        bulk[i] = (uint8_t)(i * 31 + 7);
+    }
+    writer_ctx_t ctx = {.link = &client, .data = bulk};
+    assert(_z_task_init(&task, NULL, writer_task, &ctx) == _Z_RES_OK);
+    assert(server._read_exact_f(&server, recv, BULK_SIZE, NULL, &peer) == BULK_SIZE);
+    assert(_z_task_join(&task) == _Z_RES_OK);
+    assert(memcmp(recv, bulk, BULK_SIZE) == 0);
+    free(bulk);
+    free(recv);
+
+    // Closing one side is seen as end of stream by the other
+    _z_link_clear(&client);
+    assert(server._read_socket_f(peer, in, sizeof(in)) == 0);
+    assert(server._write_f(&server, out, sizeof(out), &peer) == SIZE_MAX);
+    _z_close_shm_socket(&peer);
+
+    _z_link_clear(&server);
+    assert(access(path, F_OK) != 0);
+}
+
+static void test_corrupted(void) {
+    printf("Test: a ring whose counters are out of bounds closes the link\n");
+    char path[_Z_UNIXSOCK_PATH_MAX];
+    snprintf(path, sizeof(path), "/tmp/zp_shm_test_corrupted_%d.sock", (int)getpid());
+    _z_link_t server;
+    _z_link_t client;
+    _z_sys_net_socket_t peer;
+    open_pair(path, &server, &client, &peer);
+
+    const uint8_t out[] = "corrupted";
+    uint8_t in[64];
+    assert(client._write_all_f(&client, out, sizeof(out)) == sizeof(out));
+    // The ring to the accepting side follows the cache line aligned segment header, its write counter first
+    uint8_t *segment = *(uint8_t **)peer._shm_chan;
+    size_t head = (size_t)Z_SHM_RING_SIZE * 4;
+    memcpy(&segment[64], &head, sizeof(head));
+    assert(server._read_socket_f(peer, in, sizeof(in)) == 0);
+    assert(client._write_all_f(&client, out, sizeof(out)) == SIZE_MAX);
+
+    _z_close_shm_socket(&peer);
+    _z_link_clear(&client);
+    _z_link_clear(&server);
+}
+
+static void test_invalid(void) {
+    printf("Test: connecting to a missing rendezvous socket fails\n");
+    _z_string_t locator = _z_string_alias_str("shm//tmp/zp_shm_test_missing.sock");
+    _z_link_t client;
+    assert(_z_open_link(&client, &locator, NULL) != _Z_RES_OK);
+}
+
+int main(void) {
+    test_link();
+    test_corrupted();
+    test_invalid();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
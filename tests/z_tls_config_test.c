@@ -165,6 +165,7 @@ int main(void) {
     zp_config_insert(z_loan_mut(listen_cfg), Z_CONFIG_TLS_ROOT_CA_CERTIFICATE_BASE64_KEY, ca_base64);
     zp_config_insert(z_loan_mut(listen_cfg), Z_CONFIG_TLS_LISTEN_CERTIFICATE_BASE64_KEY, cert_base64);
     zp_config_insert(z_loan_mut(listen_cfg), Z_CONFIG_TLS_LISTEN_PRIVATE_KEY_BASE64_KEY, key_base64);
+    zp_config_insert(z_loan_mut(listen_cfg), Z_CONFIG_TLS_SESSION_TICKET_LIFETIME_KEY, "600");
 
     z_owned_session_t server;
     z_result_t res = z_open(&server, z_move(listen_cfg), NULL);
@@ -199,6 +200,7 @@ int main(void) {
     zp_config_insert(z_loan_mut(connect_cfg), Z_CONFIG_CONNECT_KEY, locator);
     zp_config_insert(z_loan_mut(connect_cfg), Z_CONFIG_TLS_ROOT_CA_CERTIFICATE_BASE64_KEY, ca_base64);
     zp_config_insert(z_loan_mut(connect_cfg), Z_CONFIG_TLS_VERIFY_NAME_ON_CONNECT_KEY, "false");
+    zp_config_insert(z_loan_mut(connect_cfg), Z_CONFIG_TLS_SESSION_CACHE_KEY, "true");
 
     z_owned_session_t client;
     res = z_open(&client, z_move(connect_cfg), NULL);
@@ -70,6 +70,16 @@ int main(void) {
     assert(client_key_inline != NULL && _z_str_eq(client_key_inline, "BASE64_KEY") == true);
     _z_str_intmap_clear(&config);
 
+    _z_str_intmap_init(&config);
+    res = _z_tls_config_from_str(&config, "session_cache=true;session_ticket_lifetime=3600");
+    assert(res == _Z_RES_OK);
+    assert(_z_str_intmap_len(&config) == 2);
+    char *session_cache = _z_str_intmap_get(&config, TLS_CONFIG_SESSION_CACHE_KEY);
+    assert(session_cache != NULL && _z_str_eq(session_cache, "true") == true);
+    char *ticket_lifetime = _z_str_intmap_get(&config, TLS_CONFIG_SESSION_TICKET_LIFETIME_KEY);
+    assert(ticket_lifetime != NULL && _z_str_eq(ticket_lifetime, "3600") == true);
+    _z_str_intmap_clear(&config);
+
     _z_str_intmap_init(&config);
     res = _z_tls_config_from_str(&config, "");
     assert(res == _Z_RES_OK);
@@ -84,6 +94,10 @@ int main(void) {
     assert(_zp_config_insert(&session_cfg, Z_CONFIG_TLS_CONNECT_CERTIFICATE_BASE64_KEY, "SESSION_CERT") == _Z_RES_OK);
     assert(_z_str_eq(_z_config_get(&session_cfg, Z_CONFIG_TLS_ROOT_CA_CERTIFICATE_KEY), "/session/ca.pem"));
     assert(_z_str_eq(_z_config_get(&session_cfg, Z_CONFIG_TLS_ENABLE_MTLS_KEY), "true"));
+    assert(_zp_config_insert(&session_cfg, Z_CONFIG_TLS_SESSION_CACHE_KEY, "true") == _Z_RES_OK);
+    assert(_zp_config_insert(&session_cfg, Z_CONFIG_TLS_SESSION_TICKET_LIFETIME_KEY, "600") == _Z_RES_OK);
+    assert(_z_str_eq(_z_config_get(&session_cfg, Z_CONFIG_TLS_SESSION_CACHE_KEY), "true"));
+    assert(_z_str_eq(_z_config_get(&session_cfg, Z_CONFIG_TLS_SESSION_TICKET_LIFETIME_KEY), "600"));
     _z_config_clear(&session_cfg);
 #else
     printf("TLS feature not enabled, skipping tests\n");
@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/link.h"
+#include "zenoh-pico/link/transport/udp_unicast.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if defined(ZENOH_LINUX) && Z_FEATURE_LINK_UDP_UNICAST == 1
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define SEGMENT 1000
+#define TRAIN_LEN (3 * SEGMENT + 300)
+// More segments than a single segmented send may carry
+#define LONG_TRAIN_NB 100
+#define LONG_TRAIN_SEGMENT 100
+
+static uint8_t train[LONG_TRAIN_NB * LONG_TRAIN_SEGMENT];
+
+static int bind_socket(uint16_t *port) {
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    assert(fd >= 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    assert(bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+    socklen_t len = sizeof(addr);
+    assert(getsockname(fd, (struct sockaddr *)&addr, &len) == 0);
+    *port = ntohs(addr.sin_port);
+    struct timeval tv = {.tv_sec = 1, .tv_usec = 0};
+    assert(setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) == 0);
+    return fd;
+}
+
+static void fill_train(size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        train[i] = (uint8_t)(i * 7 + i / 251);
+    }
+}
+
+static void test_link_segments(void) {
+    printf("Test: a segmented write on a UDP link is received as separate datagrams\n");
+    uint16_t port;
+    int fd = bind_socket(&port);
+    char buf[64];
+    snprintf(buf, sizeof(buf), "udp/127.0.0.1:%u", port);
+    _z_string_t locator = _z_string_alias_str(buf);
+    _z_link_t link;
+    assert(_z_open_link(&link, &locator, NULL) == _Z_RES_OK);
+    if (link._write_segments_f == NULL) {
+        printf("UDP segmentation offload not supported, skipping\n");
+        _z_link_clear(&link);
+        close(fd);
+        return;
+    }
+
+    fill_train(TRAIN_LEN);
+    assert(link._write_segments_f(&link, train, TRAIN_LEN, SEGMENT) == TRAIN_LEN);
+    uint8_t in[2 * SEGMENT];
+    for (size_t off = 0; off < TRAIN_LEN; off += SEGMENT) {
+        size_t expected = (TRAIN_LEN - off < SEGMENT) ? TRAIN_LEN - off : SEGMENT;
+        assert(recv(fd, in, sizeof(in), 0) == (ssize_t)expected);
+        assert(memcmp(in, &train[off], expected) == 0);
+    }
+
+    fill_train(sizeof(train));
+    assert(link._write_segments_f(&link, train, sizeof(train), LONG_TRAIN_SEGMENT) == sizeof(train));
+    for (size_t i = 0; i < LONG_TRAIN_NB; i++) {
+        assert(recv(fd, in, sizeof(in), 0) == LONG_TRAIN_SEGMENT);
+        assert(memcmp(in, &train[i * LONG_TRAIN_SEGMENT], LONG_TRAIN_SEGMENT) == 0);
+    }
+
+    // A single segment is a plain datagram
+    assert(link._write_segments_f(&link, train, 10, SEGMENT) == 10);
+    assert(recv(fd, in, sizeof(in), 0) == 10);
+
+    _z_link_clear(&link);
+    close(fd);
+}
+
+static void test_link_fallback(void) {
+    printf("Test: a refused segmented write is sent datagram by datagram and disables the offload\n");
+    uint16_t port;
+    int fd = bind_socket(&port);
+    char buf[64];
+    snprintf(buf, sizeof(buf), "udp/127.0.0.1:%u", port);
+    _z_string_t locator = _z_string_alias_str(buf);
+    _z_link_t link;
+    assert(_z_open_link(&link, &locator, NULL) == _Z_RES_OK);
+    if (link._write_segments_f == NULL) {
+        printf("UDP segmentation offload not supported, skipping\n");
+        _z_link_clear(&link);
+        close(fd);
+        return;
+    }
+
+    // The kernel refuses segmented sends without checksums
+    int on = 1;
+    assert(setsockopt(link._socket._udp._sock._fd, SOL_SOCKET, SO_NO_CHECK, &on, sizeof(on)) == 0);
+    fill_train(TRAIN_LEN);
+    assert(link._write_segments_f(&link, train, TRAIN_LEN, SEGMENT) == TRAIN_LEN);
+    assert(link._write_segments_f == NULL);
+    uint8_t in[2 * SEGMENT];
+    for (size_t off = 0; off < TRAIN_LEN; off += SEGMENT) {
+        size_t expected = (TRAIN_LEN - off < SEGMENT) ? TRAIN_LEN - off : SEGMENT;
+        assert(recv(fd, in, sizeof(in), 0) == (ssize_t)expected);
+        assert(memcmp(in, &train[off], expected) == 0);
+    }
+
+    _z_link_clear(&link);
+    close(fd);
+}
+
+static void test_gro_split(void) {
+    printf("Test: datagrams coalesced on reception are read back one by one\n");
+    uint16_t port;
+    _z_sys_net_socket_t rx = {._fd = bind_socket(&port)};
+    _z_udp_gro_t *gro = _z_udp_gro_new(rx);
+    if (gro == NULL) {
+        printf("UDP receive offload not supported, skipping\n");
+        close(rx._fd);
+        return;
+    }
+
+    char port_str[8];
+    snprintf(port_str, sizeof(port_str), "%u", port);
+    _z_sys_net_endpoint_t ep;
+    assert(_z_udp_unicast_endpoint_init(&ep, "127.0.0.1", port_str) == _Z_RES_OK);
+    _z_sys_net_socket_t tx;
+    assert(_z_udp_unicast_open(&tx, ep, 1000) == _Z_RES_OK);
+    if (!_z_udp_gso_supported(tx)) {
+        printf("UDP segmentation offload not supported, skipping\n");
+    } else {
+        bool offload_failed = false;
+        fill_train(TRAIN_LEN);
+        assert(_z_udp_write_segments(tx, train, TRAIN_LEN, SEGMENT, ep, &offload_failed) == TRAIN_LEN);
+        uint8_t in[2 * SEGMENT];
+        for (size_t off = 0; off < TRAIN_LEN; off += SEGMENT) {
+            size_t expected = (TRAIN_LEN - off < SEGMENT) ? TRAIN_LEN - off : SEGMENT;
+            const void *raddr = NULL;
+            assert(_z_udp_gro_read(rx, gro, in, sizeof(in), &raddr) == expected);
+            assert(memcmp(in, &train[off], expected) == 0);
+            assert(((const struct sockaddr_in *)raddr)->sin_family == AF_INET);
+        }
+
+        // Datagrams larger than the buffer are truncated, without spilling into the next one
+        assert(_z_udp_write_segments(tx, train, TRAIN_LEN, SEGMENT, ep, &offload_failed) == TRAIN_LEN);
+        assert(_z_udp_gro_read(rx, gro, in, 10, NULL) == 10);
+        assert(memcmp(in, train, 10) == 0);
+        assert(_z_udp_gro_read(rx, gro, in, sizeof(in), NULL) == SEGMENT);
+        assert(memcmp(in, &train[SEGMENT], SEGMENT) == 0);
+        assert(_z_udp_gro_read(rx, gro, in, sizeof(in), NULL) == SEGMENT);
+        assert(_z_udp_gro_read(rx, gro, in, sizeof(in), NULL) == 300);
+        assert(memcmp(in, &train[3 * SEGMENT], 300) == 0);
+
+        // Plain datagrams are read as they are
+        assert(_z_udp_unicast_write(tx, train, 5, ep) == 5);
+        assert(_z_udp_gro_read(rx, gro, in, sizeof(in), NULL) == 5);
+    }
+
+    _z_udp_unicast_close(&tx);
+    _z_udp_unicast_endpoint_clear(&ep);
+    _z_udp_gro_free(&gro);
+    assert(gro == NULL);
+    close(rx._fd);
+}
+
+int main(void) {
+    test_link_segments();
+    test_link_fallback();
+    test_gro_split();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
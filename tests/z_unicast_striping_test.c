@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico.h"
+#include "zenoh-pico/transport/transport.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_UNICAST_TRANSPORT == 1 && Z_FEATURE_UNICAST_PEER == 1
+
+static _z_transport_peer_unicast_slist_t *push_peer(_z_transport_peer_unicast_slist_t *peers, uint8_t zid) {
+    peers = _z_transport_peer_unicast_slist_push_empty(peers);
+    assert(peers != NULL);
+    _z_transport_peer_unicast_t *peer = _z_transport_peer_unicast_slist_value(peers);
+    memset(peer, 0, sizeof(*peer));
+    peer->common._remote_zid.id[0] = zid;
+    _z_transport_peer_unicast_group_links(peers);
+    return peers;
+}
+
+static void check_group(_z_transport_peer_unicast_slist_t *peers, uint8_t zid, uint16_t nb) {
+    bool seen[8] = {false};
+    uint16_t found = 0;
+    for (; peers != NULL; peers = _z_transport_peer_unicast_slist_next(peers)) {
+        _z_transport_peer_unicast_t *peer = _z_transport_peer_unicast_slist_value(peers);
+        if (peer->common._remote_zid.id[0] != zid) {
+            continue;
+        }
+        assert(peer->_link_nb == nb);
+        assert(peer->_link_idx < nb);
+        assert(!seen[peer->_link_idx]);
+        seen[peer->_link_idx] = true;
+        found++;
+    }
+    assert(found == nb);
+}
+
+static void test_link_groups(void) {
+    printf("Test: links to a same peer are numbered within their group\n");
+    _z_transport_t zt;
+    memset(&zt, 0, sizeof(zt));
+    zt._type = _Z_TRANSPORT_UNICAST_TYPE;
+#if Z_FEATURE_MULTI_THREAD == 1
+    assert(_z_mutex_rec_init(&zt._transport._unicast._common._mutex_peer) == _Z_RES_OK);
+#endif
+    _z_transport_peer_unicast_slist_t *peers = NULL;
+    peers = push_peer(peers, 1);
+    peers = push_peer(peers, 2);
+    peers = push_peer(peers, 1);
+    peers = push_peer(peers, 1);
+    check_group(peers, 1, 3);
+    check_group(peers, 2, 1);
+
+    // Requests go to each remote peer once when striping
+    zt._transport._unicast._peers = peers;
+    zt._transport._unicast._common._striping = _Z_STRIPING_NONE;
+    assert(_z_transport_get_peers_count(&zt) == 4);
+    zt._transport._unicast._common._striping = _Z_STRIPING_KEYEXPR;
+    assert(_z_transport_get_peers_count(&zt) == 2);
+
+    // Dropping a link renumbers the rest of its group
+    peers = _z_transport_peer_unicast_slist_drop_element(peers, NULL);
+    _z_transport_peer_unicast_group_links(peers);
+    check_group(peers, 1, 2);
+    check_group(peers, 2, 1);
+    zt._transport._unicast._peers = peers;
+    assert(_z_transport_get_peers_count(&zt) == 2);
+
+    _z_transport_peer_unicast_slist_free(&peers);
+#if Z_FEATURE_MULTI_THREAD == 1
+    _z_mutex_rec_drop(&zt._transport._unicast._common._mutex_peer);
+#endif
+}
+
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_PUBLICATION == 1 && Z_FEATURE_SUBSCRIPTION == 1 && \
+    Z_FEATURE_LINK_TCP == 1 && Z_FEATURE_LOCAL_SUBSCRIBER == 0
+
+#define LOCATOR "tcp/127.0.0.1:7463"
+#define KEY_NB 8
+#define MSG_NB 1000
+#define LINK_NB 3
+
+static volatile int received = 0;
+static volatile int out_of_order = 0;
+static int last_seq[KEY_NB];
+
+static void on_sample(z_loaned_sample_t *sample, void *arg) {
+    (void)arg;
+    z_owned_string_t value;
+    z_bytes_to_string(z_sample_payload(sample), &value);
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*s", (int)z_string_len(z_loan(value)), z_string_data(z_loan(value)));
+    z_drop(z_move(value));
+    int key = 0;
+    int seq = 0;
+    assert(sscanf(buf, "%d %d", &key, &seq) == 2);
+    assert((key >= 0) && (key < KEY_NB));
+    if (seq <= last_seq[key]) {
+        out_of_order++;
+    }
+    last_seq[key] = seq;
+    received++;
+}
+
+static void open_peer(z_owned_session_t *s, const char *striping, bool listen) {
+    z_owned_config_t config;
+    z_config_default(&config);
+    zp_config_insert(z_loan_mut(config), Z_CONFIG_MODE_KEY, Z_CONFIG_MODE_PEER);
+    zp_config_insert(z_loan_mut(config), Z_CONFIG_TRANSPORT_STRIPING_KEY, striping);
+    if (listen) {
+        zp_config_insert(z_loan_mut(config), Z_CONFIG_LISTEN_KEY, LOCATOR);
+    } else {
+        for (int i = 0; i < LINK_NB; i++) {
+            zp_config_insert(z_loan_mut(config), Z_CONFIG_CONNECT_KEY, LOCATOR);
+        }
+    }
+    assert(z_open(s, z_move(config), NULL) == Z_OK);
+    assert(zp_start_read_task(z_loan_mut(*s), NULL) == Z_OK);
+    assert(zp_start_lease_task(z_loan_mut(*s), NULL) == Z_OK);
+}
+
+static void test_striping(const char *striping) {
+    printf("Test: publications striped by %s over %d links arrive once and in order per key\n", striping, LINK_NB);
+    received = 0;
+    out_of_order = 0;
+    for (int i = 0; i < KEY_NB; i++) {
+        last_seq[i] = -1;
+    }
+    z_owned_session_t sub_s;
+    z_owned_session_t pub_s;
+    open_peer(&sub_s, striping, true);
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, on_sample, NULL, NULL);
+    z_view_keyexpr_t sub_ke;
+    z_view_keyexpr_from_str(&sub_ke, "test/striping/**");
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(sub_s), &sub, z_loan(sub_ke), z_move(callback), NULL) == Z_OK);
+    open_peer(&pub_s, striping, false);
+    z_sleep_s(1);
+
+    for (int i = 0; i < MSG_NB; i++) {
+        int key = i % KEY_NB;
+        char ke_str[32];
+        snprintf(ke_str, sizeof(ke_str), "test/striping/%d", key);
+        z_view_keyexpr_t ke;
+        z_view_keyexpr_from_str(&ke, ke_str);
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%d %d", key, i);
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, buf);
+        z_put_options_t opts;
+        z_put_options_default(&opts);
+        opts.priority = (z_priority_t)(Z_PRIORITY_REAL_TIME + (key % 7));
+        assert(z_put(z_loan(pub_s), z_loan(ke), z_move(payload), &opts) == Z_OK);
+    }
+    for (int i = 0; (i < 50) && (received < MSG_NB); i++) {
+        z_sleep_ms(100);
+    }
+    z_sleep_ms(200);
+    printf("  received %d/%d, %d out of order\n", received, MSG_NB, out_of_order);
+    assert(received == MSG_NB);
+    assert(out_of_order == 0);
+
+    z_drop(z_move(sub));
+    z_drop(z_move(pub_s));
+    z_drop(z_move(sub_s));
+}
+#endif
+
+int main(void) {
+    test_link_groups();
+#if Z_FEATURE_MULTI_THREAD == 1 && Z_FEATURE_PUBLICATION == 1 && Z_FEATURE_SUBSCRIPTION == 1 && \
+    Z_FEATURE_LINK_TCP == 1 && Z_FEATURE_LOCAL_SUBSCRIBER == 0
+    test_striping(Z_CONFIG_TRANSPORT_STRIPING_KEYEXPR);
+    test_striping(Z_CONFIG_TRANSPORT_STRIPING_PRIORITY);
+#endif
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
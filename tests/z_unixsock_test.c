@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2026 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh-pico/config.h"
+#include "zenoh-pico/link/link.h"
+#include "zenoh-pico/link/transport/unixsock.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if Z_FEATURE_LINK_UNIXSOCK == 1 && defined(ZENOH_LINUX)
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static void make_path(char *path, size_t len, const char *name) {
+    snprintf(path, len, "/tmp/zp_unixsock_test_%d_%s.sock", (int)getpid(), name);
+    unlink(path);
+}
+
+static _z_string_t make_locator(char *buf, size_t len, const char *schema, const char *path) {
+    snprintf(buf, len, "%s/%s", schema, path);
+    return _z_string_alias_str(buf);
+}
+
+static void test_stream(void) {
+    printf("Test: stream link listens, accepts and exchanges data both ways\n");
+    char path[_Z_UNIXSOCK_PATH_MAX];
+    make_path(path, sizeof(path), "stream");
+    char buf[2 * _Z_UNIXSOCK_PATH_MAX];
+    _z_string_t locator = make_locator(buf, sizeof(buf), UNIXSOCK_STREAM_SCHEMA, path);
+
+    _z_link_t server;
+    assert(_z_listen_link(&server, &locator, NULL) == _Z_RES_OK);
+    assert(server._type == _Z_LINK_TYPE_UNIXSOCK);
+    assert(server._cap._flow == Z_LINK_CAP_FLOW_STREAM);
+    assert(access(path, F_OK) == 0);
+
+    // A second listener on the same path must not steal the socket file
+    _z_link_t other;
+    assert(_z_listen_link(&other, &locator, NULL) != _Z_RES_OK);
+    assert(access(path, F_OK) == 0);
+
+    _z_link_t client;
+    assert(_z_open_link(&client, &locator, NULL) == _Z_RES_OK);
+    _z_sys_net_socket_t peer;
+    assert(_z_unixsock_stream_accept(&server._socket._unixsock._sock, &peer) == _Z_RES_OK);
+
+    const uint8_t out[] = "zenoh over unix sockets";
+    uint8_t in[sizeof(out)];
+    assert(client._write_all_f(&client, out, sizeof(out)) == sizeof(out));
+    assert(server._read_exact_f(&server, in, sizeof(in), NULL, &peer) == sizeof(in));
+    assert(memcmp(in, out, sizeof(out)) == 0);
+
+    memset(in, 0, sizeof(in));
+    assert(server._write_f(&server, out, sizeof(out), &peer) == sizeof(out));
+    assert(client._read_exact_f(&client, in, sizeof(in), NULL, NULL) == sizeof(in));
+    assert(memcmp(in, out, sizeof(out)) == 0);
+
+    _z_unixsock_close(&peer, NULL, false);
+    _z_link_clear(&client);
+    // Only the listener removes the socket file
+    assert(access(path, F_OK) == 0);
+    _z_link_clear(&server);
+    assert(access(path, F_OK) != 0);
+}
+
+static void test_dgram(void) {
+    printf("Test: datagram link exchanges datagrams with a bound socket\n");
+    char path[_Z_UNIXSOCK_PATH_MAX];
+    make_path(path, sizeof(path), "dgram");
+    char buf[2 * _Z_UNIXSOCK_PATH_MAX];
+    _z_string_t locator = make_locator(buf, sizeof(buf), UNIXSOCK_DGRAM_SCHEMA, path);
+
+    int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    assert(fd >= 0);
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    memcpy(addr.sun_path, path, strlen(path));
+    assert(bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+
+    _z_link_t listener;
+    assert(_z_listen_link(&listener, &locator, NULL) != _Z_RES_OK);
+
+    _z_link_t client;
+    assert(_z_open_link(&client, &locator, NULL) == _Z_RES_OK);
+    assert(client._cap._flow == Z_LINK_CAP_FLOW_DATAGRAM);
+
+    const uint8_t out[] = "zenoh datagram";
+    uint8_t in[64];
+    assert(client._write_all_f(&client, out, sizeof(out)) == sizeof(out));
+    struct sockaddr_un from;
+    socklen_t from_len = sizeof(from);
+    ssize_t rb = recvfrom(fd, in, sizeof(in), 0, (struct sockaddr *)&from, &from_len);
+    assert(rb == (ssize_t)sizeof(out));
+    assert(memcmp(in, out, sizeof(out)) == 0);
+
+    // The link is autobound, so the server can reply to it
+    assert(sendto(fd, out, sizeof(out), 0, (struct sockaddr *)&from, from_len) == (ssize_t)sizeof(out));
+    memset(in, 0, sizeof(in));
+    assert(client._read_f(&client, in, sizeof(in), NULL) == sizeof(out));
+    assert(memcmp(in, out, sizeof(out)) == 0);
+
+    _z_link_clear(&client);
+    close(fd);
+    unlink(path);
+}
+
+static void test_invalid(void) {
+    printf("Test: connecting to a missing socket fails\n");
+    char path[_Z_UNIXSOCK_PATH_MAX];
+    make_path(path, sizeof(path), "missing");
+    char buf[2 * _Z_UNIXSOCK_PATH_MAX];
+    _z_string_t locator = make_locator(buf, sizeof(buf), UNIXSOCK_STREAM_SCHEMA, path);
+    _z_link_t client;
+    assert(_z_open_link(&client, &locator, NULL) != _Z_RES_OK);
+}
+
+int main(void) {
+    test_stream();
+    test_dgram();
+    test_invalid();
+    return 0;
+}
+
+#else
+int main(void) { return 0; }
+#endif
@@ -14,9 +14,13 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "zenoh-pico/net/sample.h"
+#include "zenoh-pico/utils/lz4.h"
 #include "zenoh-pico/utils/pointers.h"
 #include "zenoh-pico/utils/query_params.h"
 #include "zenoh-pico/utils/time_range.h"
@@ -393,6 +397,160 @@ static void test_time_range_contains_fully_bounded_mixed(void) {
     assert(_z_time_range_contains_at_time(&r, _z_time_range_resolve_offset(now, 6.0), now) == false);
 }
 
+#if Z_FEATURE_COMPRESSION == 1
+static void test_lz4_roundtrip(const uint8_t *src, size_t len, uint32_t *table) {
+    size_t cap = _z_lz4_compress_bound(len);
+    uint8_t *comp = (uint8_t *)malloc(cap);
+    uint8_t *out = (uint8_t *)malloc(len + 1);
+    assert(comp != NULL && out != NULL);
+    size_t comp_len = _z_lz4_compress(comp, cap, src, len, table);
+    assert(comp_len > 0 && comp_len <= cap);
+    size_t out_len = 0;
+    assert(_z_lz4_decompress(out, len, comp, comp_len, &out_len) == _Z_RES_OK);
+    assert(out_len == len);
+    assert(len == 0 || memcmp(out, src, len) == 0);
+    // Too small destinations must be detected
+    if (len > 0) {
+        assert(_z_lz4_decompress(out, len - 1, comp, comp_len, &out_len) != _Z_RES_OK);
+    }
+    // Truncated blocks must be rejected or decompress to less, never overflow
+    for (size_t i = 1; i < comp_len; i++) {
+        out_len = 0;
+        if (_z_lz4_decompress(out, len, comp, i, &out_len) == _Z_RES_OK) {
+            assert(out_len < len);
+        }
+    }
+    free(comp);
+    free(out);
+}
+
+static void test_lz4(void) {
+    uint32_t *table = (uint32_t *)malloc(_Z_LZ4_TABLE_SIZE * sizeof(uint32_t));
+    assert(table != NULL);
+    size_t len = 4096;
+    uint8_t *buf = (uint8_t *)malloc(len);
+    assert(buf != NULL);
+
+    // Random data, incompressible
+    srand(42);
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)rand();
+    }
+    for (size_t l = 0; l <= 64; l++) {
+        test_lz4_roundtrip(buf, l, table);
+    }
+    test_lz4_roundtrip(buf, len, table);
+    uint8_t small[16];
+    assert(_z_lz4_compress(small, sizeof(small), buf, len, table) == 0);
+
+    // Long runs, overlapping matches and lengths over 255
+    memset(buf, 'a', len);
+    test_lz4_roundtrip(buf, len, table);
+    size_t comp_len = _z_lz4_compress(small, sizeof(small), buf, 300, table);
+    assert(comp_len > 0 && comp_len < 16);
+
+    // Telemetry-like text
+    size_t pos = 0;
+    for (int i = 0; pos + 64 < len; i++) {
+        pos += (size_t)snprintf((char *)buf + pos, len - pos, "{\"seq\":%d,\"temp\":%d.%d,\"state\":\"nominal\"},", i,
+                                20 + i % 7, i % 10);
+    }
+    test_lz4_roundtrip(buf, pos, table);
+    uint8_t *comp = (uint8_t *)malloc(_z_lz4_compress_bound(pos));
+    assert(comp != NULL);
+    comp_len = _z_lz4_compress(comp, _z_lz4_compress_bound(pos), buf, pos, table);
+    assert(comp_len < pos / 2);
+
+    // Offsets pointing before the start of the output
+    uint8_t bad[] = {0x10, 'a', 0x02, 0x00, 0x00};
+    size_t out_len = 0;
+    assert(_z_lz4_decompress(comp, pos, bad, sizeof(bad), &out_len) != _Z_RES_OK);
+    bad[2] = 0x00;
+    assert(_z_lz4_decompress(comp, pos, bad, sizeof(bad), &out_len) != _Z_RES_OK);
+    bad[2] = 0x01;
+    assert(_z_lz4_decompress(comp, pos, bad, sizeof(bad), &out_len) == _Z_RES_OK);
+    assert(out_len == 5 && memcmp(comp, "aaaaa", 5) == 0);
+
+    free(comp);
+    free(buf);
+    free(table);
+}
+
+static void test_payload_compression(void) {
+    size_t len = 2 * Z_COMPRESSION_THRESHOLD;
+    uint8_t *buf = (uint8_t *)malloc(len);
+    assert(buf != NULL);
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(i % 16);
+    }
+
+    // Spans several slices
+    _z_bytes_t payload = _z_bytes_null();
+    _z_bytes_t part = _z_bytes_null();
+    assert(_z_bytes_from_buf(&payload, buf, len / 2) == _Z_RES_OK);
+    assert(_z_bytes_from_buf(&part, buf + len / 2, len - len / 2) == _Z_RES_OK);
+    assert(_z_bytes_append_bytes(&payload, &part) == _Z_RES_OK);
+    _z_payload_compressor_t *c = _z_payload_compressor_new();
+    assert(c != NULL);
+    _z_encoding_t encoding = _z_encoding_wrap(5, NULL);
+    assert(_z_sample_payload_compress(c, &payload, &encoding) == _Z_RES_OK);
+    assert(encoding.id == 5);
+    assert(_z_string_len(&encoding.schema) == 4 && memcmp(_z_string_data(&encoding.schema), "@lz4", 4) == 0);
+    assert(_z_bytes_len(&payload) < len);
+    assert(_z_sample_payload_decompress(&payload, &encoding) == _Z_RES_OK);
+    assert(encoding.id == 5 && !_z_string_check(&encoding.schema));
+    assert(_z_bytes_len(&payload) == len);
+    uint8_t *out = (uint8_t *)malloc(len);
+    assert(out != NULL);
+    assert(_z_bytes_to_buf(&payload, out, len) == len);
+    assert(memcmp(out, buf, len) == 0);
+
+    // The original schema follows the reserved one, and ids are left alone, bit 15 included
+    _z_encoding_clear(&encoding);
+    assert(_z_encoding_make(&encoding, 0x8005, "utf8", 4) == _Z_RES_OK);
+    assert(_z_sample_payload_compress(NULL, &payload, &encoding) == _Z_RES_OK);
+    assert(encoding.id == 0x8005);
+    assert(_z_string_len(&encoding.schema) == 9 && memcmp(_z_string_data(&encoding.schema), "@lz4;utf8", 9) == 0);
+    assert(_z_sample_payload_decompress(&payload, &encoding) == _Z_RES_OK);
+    assert(encoding.id == 0x8005);
+    assert(_z_string_len(&encoding.schema) == 4 && memcmp(_z_string_data(&encoding.schema), "utf8", 4) == 0);
+    assert(_z_bytes_to_buf(&payload, out, len) == len);
+    assert(memcmp(out, buf, len) == 0);
+    _z_bytes_drop(&payload);
+    _z_encoding_clear(&encoding);
+    encoding = _z_encoding_wrap(5, NULL);
+
+    // Under the threshold or incompressible, left as is
+    assert(_z_bytes_from_buf(&payload, buf, Z_COMPRESSION_THRESHOLD - 1) == _Z_RES_OK);
+    assert(_z_sample_payload_compress(c, &payload, &encoding) == _Z_RES_OK);
+    assert(!_z_string_check(&encoding.schema) && _z_bytes_len(&payload) == Z_COMPRESSION_THRESHOLD - 1);
+    _z_bytes_drop(&payload);
+    srand(7);
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)rand();
+    }
+    assert(_z_bytes_from_buf(&payload, buf, len) == _Z_RES_OK);
+    assert(_z_sample_payload_compress(c, &payload, &encoding) == _Z_RES_OK);
+    assert(!_z_string_check(&encoding.schema) && _z_bytes_len(&payload) == len);
+    // Not flagged, left as is, whatever the id
+    encoding.id = 0xFFFF;
+    assert(_z_sample_payload_decompress(&payload, &encoding) == _Z_RES_OK);
+    assert(_z_bytes_len(&payload) == len);
+    // A schema that only starts like the reserved one is not flagged either
+    encoding.schema = _z_string_alias_str("@lz4x");
+    assert(_z_sample_payload_decompress(&payload, &encoding) == _Z_RES_OK);
+    // Flagged but malformed
+    encoding.schema = _z_string_alias_str("@lz4");
+    assert(_z_sample_payload_decompress(&payload, &encoding) != _Z_RES_OK);
+    _z_bytes_drop(&payload);
+    _z_payload_compressor_free(&c);
+    assert(c == NULL);
+
+    free(out);
+    free(buf);
+}
+#endif
+
 int main(void) {
     test_query_params();
     test_time_range();
@@ -401,5 +559,9 @@ int main(void) {
     test_time_range_contains_lower_bound_inclusive_exclusive();
     test_time_range_contains_upper_bound_inclusive_exclusive();
     test_time_range_contains_fully_bounded_mixed();
+#if Z_FEATURE_COMPRESSION == 1
+    test_lz4();
+    test_payload_compression();
+#endif
     return 0;
 }